@@ -0,0 +1,240 @@
+import { RawNetlinkSocket } from '../lib/raw'
+import { NetlinkSocket, createNetlink } from '../lib/netlink'
+import { Flags } from '../lib/constants'
+import { parseMessages, serialize, readU32, AttrStream, StreamData, HEADER_LENGTH } from '../lib/structs'
+import { createRtNetlink, RtNetlinkSocket } from '../lib/rt/rt'
+import * as rt from '../lib/rt/structs'
+import { parseMessagesNative } from '../lib/rt/native'
+import { MessageType } from '../lib/rt/gen_structs'
+import { BenchCase, BenchContext, now } from './harness'
+import { FakeKernel, createFakeKernel, SOCKET_BUFFER_SIZE } from './kernel'
+import { routeDump, routePayloads, linkStorm } from './fixtures'
+
+const ROUTES = 10000
+const STORM = 20000
+
+const socketOptions = { recvBufferSize: SOCKET_BUFFER_SIZE, sendBufferSize: SOCKET_BUFFER_SIZE }
+
+const totalLength = (datagrams: Buffer[]) =>
+    datagrams.reduce((n, x) => n + x.length, 0)
+
+/** Notification storm received by a raw socket, one message per datagram */
+function rawReceive(): BenchCase {
+    const datagrams = linkStorm(STORM)
+    const bytes = totalLength(datagrams)
+    let kernel: FakeKernel, socket: RawNetlinkSocket
+    let current: BenchContext, received: number, done: () => void
+    return {
+        name: 'raw receive (link storm)',
+        setup() {
+            let fd: number
+            [kernel, fd] = createFakeKernel()
+            socket = new RawNetlinkSocket(0, { fd, ...socketOptions })
+            socket.on('message', msg => {
+                current.latency(Number(now()) - kernel.sentAt[readU32.call(msg, 8)])
+                if (++received === datagrams.length) done()
+            })
+        },
+        async run(ctx) {
+            current = ctx
+            received = 0
+            const finished = new Promise<void>(resolve => { done = resolve })
+            await kernel.replay(datagrams)
+            await finished
+            ctx.count(datagrams.length, bytes)
+        },
+        teardown() {
+            socket.close()
+            kernel.close()
+        },
+    }
+}
+
+/**
+ * Parsing of route dump datagrams, without any I/O. If `native`, the
+ * routes are parsed by the generated native decoder.
+ */
+function parse(native: boolean): BenchCase {
+    const datagrams = routeDump(ROUTES)
+    const bytes = totalLength(datagrams)
+    return {
+        name: `parseMessages + ${native ? 'parseMessagesNative' : 'parseRoute'}`,
+        run(ctx) {
+            const start = now()
+            let n = 0
+            for (const datagram of datagrams) {
+                const msgs = parseMessages(datagram).filter(x => x.type === MessageType.NEWROUTE)
+                if (native)
+                    parseMessagesNative(msgs)
+                else
+                    msgs.forEach(x => rt.parseRouteMessage(x.data))
+                n += msgs.length
+            }
+            ctx.latency(Number(now() - start))
+            ctx.count(n, bytes)
+        },
+    }
+}
+
+/** Route dump reassembled by {@link NetlinkSocket.request} (multipart handling) */
+function multipart(): BenchCase {
+    const dump = routeDump(ROUTES)
+    const bytes = totalLength(dump)
+    let kernel: FakeKernel, socket: NetlinkSocket
+    return {
+        name: 'NetlinkSocket multipart dump',
+        setup() {
+            let fd: number
+            [kernel, fd] = createFakeKernel()
+            kernel.dumps.set(MessageType.GETROUTE, dump)
+            socket = createNetlink(0, { fd, ...socketOptions })
+        },
+        async run(ctx) {
+            const start = now()
+            const [ msgs ] = await socket.request(MessageType.GETROUTE, Buffer.alloc(12), { flags: Flags.DUMP })
+            ctx.latency(Number(now() - start))
+            ctx.count(msgs.length, bytes)
+        },
+        teardown() {
+            socket.close()
+            kernel.close()
+        },
+    }
+}
+
+/** Route dump fetched and parsed through {@link RtNetlinkSocket.getRoutes} */
+function getRoutes(lazy: boolean): BenchCase {
+    const dump = routeDump(ROUTES)
+    const bytes = totalLength(dump)
+    let kernel: FakeKernel, socket: RtNetlinkSocket
+    return {
+        name: `RtNetlinkSocket.getRoutes${lazy ? ' (lazy)' : ''}`,
+        setup() {
+            let fd: number
+            [kernel, fd] = createFakeKernel()
+            kernel.dumps.set(MessageType.GETROUTE, dump)
+            socket = createRtNetlink({ fd, lazy, ...socketOptions })
+        },
+        async run(ctx) {
+            const start = now()
+            const routes = await socket.getRoutes()
+            ctx.latency(Number(now() - start))
+            ctx.count(routes.length, bytes)
+        },
+        teardown() {
+            socket.socket.close()
+            kernel.close()
+        },
+    }
+}
+
+/** Same dump, decoded into columns through {@link RtNetlinkSocket.getRoutesColumnar} */
+function getRoutesColumnar(): BenchCase {
+    const dump = routeDump(ROUTES)
+    const bytes = totalLength(dump)
+    let kernel: FakeKernel, socket: RtNetlinkSocket
+    return {
+        name: 'RtNetlinkSocket.getRoutesColumnar',
+        setup() {
+            let fd: number
+            [kernel, fd] = createFakeKernel()
+            kernel.dumps.set(MessageType.GETROUTE, dump)
+            socket = createRtNetlink({ fd, ...socketOptions })
+        },
+        async run(ctx) {
+            const start = now()
+            const routes = await socket.getRoutesColumnar(['dst', 'dstLen', 'gateway', 'oif', 'table', 'metric', 'protocol'])
+            ctx.latency(Number(now() - start))
+            ctx.count(routes.length, bytes)
+        },
+        teardown() {
+            socket.socket.close()
+            kernel.close()
+        },
+    }
+}
+
+/**
+ * Sending of NEWROUTE messages, either formatted into a list of
+ * buffers (the kernel side sees the same bytes) or serialized in
+ * place by passing a function
+ */
+function send(serialized: boolean): BenchCase {
+    const route = rt.parseRouteMessage(routePayloads(1)[0])
+    const length = HEADER_LENGTH + serialize(out => rt.formatRouteMessage(route, out)).length
+    const BATCH = 1000
+    let kernel: FakeKernel, socket: NetlinkSocket
+    return {
+        name: `NetlinkSocket.send (${serialized ? 'serialized' : 'list'})`,
+        setup() {
+            let fd: number
+            [kernel, fd] = createFakeKernel()
+            socket = createNetlink(0, { fd, ...socketOptions })
+        },
+        async run(ctx) {
+            await Promise.all(Array.from({ length: BATCH }, () => new Promise<void>((resolve, reject) => {
+                const start = now()
+                let data: StreamData = out => rt.formatRouteMessage(route, out)
+                if (!serialized) {
+                    const out = new AttrStream()
+                    rt.formatRouteMessage(route, out)
+                    data = out.bufs
+                }
+                socket.send(MessageType.NEWROUTE, data, undefined, error => {
+                    ctx.latency(Number(now() - start))
+                    error ? reject(error) : resolve()
+                })
+            })))
+            ctx.count(BATCH, BATCH * length)
+        },
+        teardown() {
+            socket.close()
+            kernel.close()
+        },
+    }
+}
+
+/**
+ * Concurrent acknowledged requests through {@link NetlinkSocket.request},
+ * with replies matched in JS or natively (`nativeRequests`)
+ */
+function requests(native: boolean): BenchCase {
+    const route = rt.parseRouteMessage(routePayloads(1)[0])
+    const payload = serialize(out => rt.formatRouteMessage(route, out))
+    const BATCH = 1000
+    let kernel: FakeKernel, socket: NetlinkSocket
+    return {
+        name: `NetlinkSocket.request (${native ? 'native' : 'JS'})`,
+        setup() {
+            let fd: number
+            [kernel, fd] = createFakeKernel()
+            socket = createNetlink(0, { fd, nativeRequests: native, ...socketOptions })
+        },
+        async run(ctx) {
+            await Promise.all(Array.from({ length: BATCH }, async () => {
+                const start = now()
+                await socket.request(MessageType.NEWROUTE, payload, { timeout: 5000 })
+                ctx.latency(Number(now() - start))
+            }))
+            ctx.count(BATCH, BATCH * (HEADER_LENGTH + payload.length))
+        },
+        teardown() {
+            socket.close()
+            kernel.close()
+        },
+    }
+}
+
+export const cases: (() => BenchCase)[] = [
+    rawReceive,
+    () => parse(false),
+    () => parse(true),
+    multipart,
+    () => getRoutes(false),
+    () => getRoutes(true),
+    getRoutesColumnar,
+    () => send(false),
+    () => send(true),
+    () => requests(false),
+    () => requests(true),
+]
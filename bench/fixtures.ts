@@ -0,0 +1,108 @@
+/**
+ * Synthetic traffic resembling what the kernel sends: route dumps
+ * (many messages packed into large multipart datagrams, ended with
+ * DONE) and link notification storms (one message per datagram).
+ */
+
+import { Flags, MessageType as NlMessageType } from '../lib/constants'
+import { serialize, serializeMessage, readU32, writeU32, align, HEADER_LENGTH } from '../lib/structs'
+import * as rt from '../lib/rt/structs'
+import { MessageType, RoutingTableClass, RouteType, RouteProtocol, RouteScope } from '../lib/rt/gen_structs'
+
+const AF_INET = 2
+
+/** Default datagram size for dumps (the kernel uses up to 32kb, usually one page) */
+export const DUMP_DATAGRAM_SIZE = 16384
+
+function ipv4(n: number) {
+    const r = Buffer.alloc(4)
+    r.writeUInt32BE(((10 << 24) | n) >>> 0)
+    return r
+}
+
+/** Payloads of `count` IPv4 routes, spread across a few interfaces */
+export function routePayloads(count: number): Buffer[] {
+    const r: Buffer[] = []
+    for (let i = 0; i < count; i++) {
+        const x: rt.RouteMessage = {
+            kind: 'route',
+            data: {
+                family: AF_INET, dstLen: 32, table: RoutingTableClass.MAIN,
+                protocol: RouteProtocol.BOOT, scope: RouteScope.UNIVERSE, type: RouteType.UNICAST,
+            },
+            attrs: {
+                table: RoutingTableClass.MAIN,
+                dst: ipv4(i + 1),
+                gateway: ipv4(0xFFFF00 | (i % 200)),
+                oif: 2 + (i % 8),
+                priority: 100,
+            },
+        }
+        r.push(serialize(out => rt.formatRouteMessage(x, out)))
+    }
+    return r
+}
+
+/** Payloads of `count` link notifications */
+export function linkPayloads(count: number): Buffer[] {
+    const r: Buffer[] = []
+    for (let i = 0; i < count; i++) {
+        const x: rt.LinkMessage = {
+            kind: 'link',
+            data: { type: 'ETHER', index: 2 + (i % 64), flags: { up: true, running: true } },
+            attrs: { ifname: `veth${i % 64}`, mtu: 1500, txqlen: 1000 },
+        }
+        r.push(serialize(out => rt.formatLinkMessage(x, out)))
+    }
+    return r
+}
+
+/**
+ * Packs payloads into multipart datagrams of at most `size` bytes,
+ * followed by a DONE message (in its own datagram, like the kernel).
+ * The returned datagrams are templates; use {@link stamp} to set the
+ * sequence number and port before sending them.
+ */
+export function buildDump(type: number, payloads: Buffer[], size: number = DUMP_DATAGRAM_SIZE): Buffer[] {
+    const datagrams: Buffer[] = []
+    let current: Buffer[] = []
+    let length = 0
+    const flush = () => {
+        if (current.length) datagrams.push(Buffer.concat(current))
+        current = []
+        length = 0
+    }
+    for (const payload of payloads) {
+        const msg = serializeMessage({ type, flags: Flags.MULTI, seq: 0, port: 0, data: payload })
+        const padded = align(msg.length)
+        if (length && length + padded > size) flush()
+        current.push(msg, Buffer.alloc(padded - msg.length))
+        length += padded
+    }
+    flush()
+    datagrams.push(serializeMessage({ type: NlMessageType.DONE, flags: Flags.MULTI, seq: 0, port: 0, data: Buffer.alloc(4) }))
+    return datagrams
+}
+
+/** Single-message datagrams, as sent for notifications */
+export function buildNotifications(type: number, payloads: Buffer[]): Buffer[] {
+    return payloads.map(data => serializeMessage({ type, flags: 0, seq: 0, port: 0, data }))
+}
+
+/** Overwrites the sequence number and port of every message in the datagram */
+export function stamp(datagram: Buffer, seq: number, port: number) {
+    for (let offset = 0; offset + HEADER_LENGTH <= datagram.length; ) {
+        writeU32.call(datagram, seq, offset + 8)
+        writeU32.call(datagram, port, offset + 12)
+        offset += align(readU32.call(datagram, offset) || HEADER_LENGTH)
+    }
+    return datagram
+}
+
+export function routeDump(count: number) {
+    return buildDump(MessageType.NEWROUTE, routePayloads(count))
+}
+
+export function linkStorm(count: number) {
+    return buildNotifications(MessageType.NEWLINK, linkPayloads(count))
+}
@@ -0,0 +1,119 @@
+/**
+ * Minimal benchmark runner. Each case runs for a fixed amount of
+ * time and reports throughput (messages and bytes per second),
+ * latency percentiles and peak heap usage.
+ *
+ * Run node with `--expose-gc` so that the heap is collected
+ * before each case, otherwise peaks include garbage from the
+ * previous case.
+ */
+
+import { getHeapStatistics } from 'v8'
+
+export interface BenchContext {
+    /** Whether the case should keep running */
+    readonly running: boolean
+    /** Account processed messages */
+    count(messages: number, bytes: number): void
+    /** Account a latency sample, in nanoseconds */
+    latency(ns: number): void
+}
+
+export interface BenchCase {
+    name: string
+    /** Called repeatedly while `ctx.running` (the case may also loop itself) */
+    run(ctx: BenchContext): Promise<void> | void
+    setup?(): Promise<void> | void
+    teardown?(): Promise<void> | void
+}
+
+export interface BenchResult {
+    name: string
+    seconds: number
+    messages: number
+    bytes: number
+    /** Latency percentiles in nanoseconds (undefined if no samples) */
+    p50?: number
+    p99?: number
+    /** Peak used heap, relative to the start of the case, in bytes */
+    heapPeak: number
+}
+
+/** Maximum latency samples kept per case (older ones are overwritten) */
+const MAX_SAMPLES = 1 << 20
+
+export function now(): bigint {
+    return process.hrtime.bigint()
+}
+
+function percentile(sorted: Float64Array, p: number) {
+    return sorted[Math.min(sorted.length - 1, Math.floor(sorted.length * p))]
+}
+
+export async function runCase(c: BenchCase, duration: number): Promise<BenchResult> {
+    if (c.setup) await c.setup()
+    const gc = (global as any).gc
+    if (typeof gc === 'function') gc()
+
+    const samples = new Float64Array(MAX_SAMPLES)
+    let nSamples = 0
+    let messages = 0, bytes = 0
+    // checked against the clock, since synchronous cases never yield to timers
+    let deadline = 0
+    const ctx: BenchContext = {
+        get running() { return Number(now()) < deadline },
+        count(m, b) { messages += m; bytes += b },
+        latency(ns) { samples[nSamples++ % MAX_SAMPLES] = ns },
+    }
+
+    const heapBase = getHeapStatistics().used_heap_size
+    let heapPeak = heapBase
+    const sampleHeap = () => {
+        heapPeak = Math.max(heapPeak, getHeapStatistics().used_heap_size)
+    }
+    const heapTimer = setInterval(sampleHeap, 5)
+
+    const start = now()
+    deadline = Number(start) + duration * 1e9
+    while (ctx.running) {
+        await c.run(ctx)
+        sampleHeap()
+    }
+    const seconds = Number(now() - start) / 1e9
+    clearInterval(heapTimer)
+    if (c.teardown) await c.teardown()
+
+    const result: BenchResult = { name: c.name, seconds, messages, bytes, heapPeak: heapPeak - heapBase }
+    if (nSamples) {
+        const sorted = samples.subarray(0, Math.min(nSamples, MAX_SAMPLES)).sort()
+        result.p50 = percentile(sorted, 0.5)
+        result.p99 = percentile(sorted, 0.99)
+    }
+    return result
+}
+
+function formatRate(n: number, unit: string) {
+    const prefixes = ['', 'k', 'M', 'G']
+    let i = 0
+    while (n >= 1000 && i < prefixes.length - 1) {
+        n /= 1000
+        i++
+    }
+    return `${n.toFixed(2)} ${prefixes[i]}${unit}/s`
+}
+
+function formatTime(ns?: number) {
+    if (typeof ns === 'undefined') return '-'
+    return ns >= 1e6 ? `${(ns / 1e6).toFixed(2)} ms` : `${(ns / 1e3).toFixed(1)} µs`
+}
+
+export function formatResult(r: BenchResult) {
+    return [
+        r.name.padEnd(32),
+        formatRate(r.messages / r.seconds, 'msg').padStart(16),
+        formatRate(r.bytes / r.seconds, 'B').padStart(16),
+        `p50 ${formatTime(r.p50)}`.padStart(14),
+        `p99 ${formatTime(r.p99)}`.padStart(14),
+        `heap +${(r.heapPeak / (1 << 20)).toFixed(1)} MiB`.padStart(18),
+    ].join('  ')
+}
@@ -0,0 +1,32 @@
+/**
+ * Replay-driven benchmarks. A kernel stand-in (see `kernel.ts`) feeds
+ * synthetic dumps and notification storms to the sockets under test
+ * through a socket pair, so no privileges or real traffic are needed.
+ *
+ * Usage: npm run bench -- [filter] [--time=seconds]
+ */
+
+import { runCase, formatResult } from './harness'
+import { cases } from './cases'
+
+async function main(args: string[]) {
+    let duration = 2
+    const filters: string[] = []
+    for (const arg of args) {
+        if (arg.startsWith('--time='))
+            duration = Number(arg.substr(7))
+        else
+            filters.push(arg.toLowerCase())
+    }
+    for (const create of cases) {
+        const c = create()
+        if (filters.length && !filters.some(f => c.name.toLowerCase().includes(f)))
+            continue
+        console.log(formatResult(await runCase(c, duration)))
+    }
+}
+
+main(process.argv.slice(2)).catch(e => {
+    console.error(e)
+    process.exitCode = 1
+})
@@ -0,0 +1,91 @@
+/**
+ * Stand-in for the kernel, talking to the socket under test over
+ * one end of a {@link createSocketPair} pair. It runs in the same
+ * process, so measured latencies include its share of the event loop.
+ */
+
+import { RawNetlinkSocket, createSocketPair } from '../lib/raw'
+import { Flags, FlagsAck, MessageType } from '../lib/constants'
+import { parseMessages, serializeMessage, formatHeader } from '../lib/structs'
+import { stamp } from './fixtures'
+import { now } from './harness'
+
+export const SOCKET_BUFFER_SIZE = 4 << 20
+
+export class FakeKernel {
+    readonly socket: RawNetlinkSocket
+    /** Canned dump replies (see {@link buildDump}), by request type */
+    readonly dumps: Map<number, Buffer[]> = new Map()
+    /** Number of messages received */
+    received: number = 0
+    /** Send times (in ns) of replayed datagrams, indexed by sequence number */
+    sentAt: number[] = []
+
+    constructor(fd: number) {
+        this.socket = new RawNetlinkSocket(0, { fd, recvBufferSize: SOCKET_BUFFER_SIZE, sendBufferSize: SOCKET_BUFFER_SIZE })
+        this.socket.on('message', data => this.handle(data))
+    }
+
+    private handle(data: Buffer) {
+        for (const msg of parseMessages(data)) {
+            this.received++
+            const dump = this.dumps.get(msg.type)
+            if (dump && (msg.flags & Flags.DUMP) === Flags.DUMP) {
+                // copies are needed, the datagrams are sent asynchronously
+                for (const datagram of dump)
+                    this.socket.send(stamp(Buffer.from(datagram), msg.seq, msg.port))
+            } else if (msg.flags & Flags.ACK) {
+                const header = formatHeader({ ...msg, length: msg.data.length + 16 })
+                this.socket.send(serializeMessage({
+                    type: MessageType.ERROR, flags: FlagsAck.CAPPED, seq: msg.seq, port: msg.port,
+                    data: [ Buffer.alloc(4), header ],
+                }))
+            }
+        }
+    }
+
+    /**
+     * Sends the datagrams with at most `window` of them in flight,
+     * numbering them (through the sequence number) and recording the
+     * send time of each one in {@link sentAt}.
+     */
+    replay(datagrams: Buffer[], window: number = 64): Promise<void> {
+        this.sentAt = new Array(datagrams.length)
+        return new Promise((resolve, reject) => {
+            let next = 0, inFlight = 0, failed = false
+            const pump = () => {
+                while (inFlight < window && next < datagrams.length) {
+                    const seq = next++
+                    const datagram = stamp(Buffer.from(datagrams[seq]), seq, 0)
+                    inFlight++
+                    this.sentAt[seq] = Number(now())
+                    this.socket.send(datagram, undefined, error => {
+                        inFlight--
+                        if (failed) return
+                        if (error) {
+                            failed = true
+                            return reject(error)
+                        }
+                        if (next === datagrams.length && !inFlight)
+                            return resolve()
+                        pump()
+                    })
+                }
+            }
+            pump()
+        })
+    }
+
+    close() {
+        this.socket.close()
+    }
+}
+
+/**
+ * Creates a kernel stand-in, and returns it along with the
+ * descriptor for the socket under test (pass it as `fd`).
+ */
+export function createFakeKernel(): [FakeKernel, number] {
+    const [ fd, peer ] = createSocketPair()
+    return [ new FakeKernel(peer), fd ]
+}
@@ -0,0 +1,114 @@
+/**
+ * This module implements the synchronization shared by the caches
+ * (see {@link RtCache} and {@link Nl80211Cache}).
+ * @module
+ */
+
+import { EventEmitter } from 'events'
+
+import { MessageInfo, ErrnoException } from './raw'
+
+/**
+ * Base of the caches, which keep a state (of type `S`) populated with
+ * dumps and updated from notifications (of type `M`).
+ *
+ * A sync dumps everything into a new state ({@link dumpState}) which
+ * then replaces the current one ({@link replaceState}). Notifications
+ * received meanwhile are queued, and applied ({@link applyMessage})
+ * after the dumps. If notifications are lost (`ENOBUFS`), or a dump
+ * sets {@link resyncRequested} (i.e. because it was interrupted),
+ * everything is dumped again.
+ *
+ * Subclasses have to pass socket messages and errors to
+ * {@link _receive} and {@link _error}.
+ */
+export abstract class SyncedCache<S, M> extends EventEmitter {
+    protected state: S
+    /** While syncing, notifications are queued here (and applied after the dumps) */
+    protected pending?: [M, MessageInfo][]
+    protected syncing?: Promise<void>
+    /** If set while syncing, another pass is done */
+    protected resyncRequested = false
+    protected closed = false
+
+    constructor(state: S) {
+        super()
+        this.state = state
+    }
+
+    /**
+     * Populates the cache by dumping everything. Notifications
+     * received meanwhile are applied afterwards. If a sync is
+     * already in progress, waits for it instead.
+     */
+    sync(): Promise<void> {
+        if (!this.syncing) {
+            this.syncing = this._sync().finally(() => this.syncing = undefined)
+        }
+        return this.syncing
+    }
+
+    /**
+     * Requests a resync, which is performed in the background
+     * (after the current one, if any). Errors are emitted as
+     * `error` events.
+     */
+    resync() {
+        if (this.closed) return
+        if (this.syncing) {
+            this.resyncRequested = true
+            return
+        }
+        this.sync().then(() => this.emit('resync'), error => this.emit('error', error))
+    }
+
+    /** Called at the start of every sync (i.e. to join multicast groups) */
+    protected async prepareSync(): Promise<void> {}
+
+    /** Dumps everything into a new state */
+    protected abstract dumpState(): Promise<S>
+
+    /** Swaps the state, emitting the changes */
+    protected abstract replaceState(state: S): void
+
+    /** Applies a notification to the current state */
+    protected abstract applyMessage(msg: M, rinfo: MessageInfo): void
+
+    private async _sync() {
+        let state: S
+        try {
+            await this.prepareSync()
+            do {
+                // notifications from before the dumps are superseded by them
+                this.pending = []
+                this.resyncRequested = false
+                state = await this.dumpState()
+            } while (this.resyncRequested && !this.closed)
+        } catch (e) {
+            this.pending = undefined
+            throw e
+        }
+        const pending = this.pending || []
+        this.pending = undefined
+        this.replaceState(state)
+        for (const [msg, rinfo] of pending)
+            this.applyMessage(msg, rinfo)
+    }
+
+    protected _error(error: ErrnoException) {
+        // notifications were lost, we can't trust the state anymore
+        if (error.code === 'ENOBUFS')
+            this.resync()
+        else
+            this.emit('error', error)
+    }
+
+    protected _receive(msgs: M[], rinfo: MessageInfo) {
+        for (const x of msgs) {
+            if (this.pending)
+                this.pending.push([x, rinfo])
+            else
+                this.applyMessage(x, rinfo)
+        }
+    }
+}
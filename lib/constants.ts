@@ -159,6 +159,22 @@ export enum Attributes {
     GET_STRICT_CHK = 12,
 }
 
+/** Extended ACK TLVs (see {@link FlagsAck.ACK_TLVS}) */
+export enum ExtAckAttributes {
+    /** error message string */
+    MSG = 1,
+    /** offset of the error attribute in the request message (u32) */
+    OFFS = 2,
+    /** arbitrary subsystem specific cookie to be used - in the success case - to identify a created object or operation or similar */
+    COOKIE = 3,
+    /** policy for a rejected attribute (nested) */
+    POLICY = 4,
+    /** type of a missing required attribute (u32) */
+    MISS_TYPE = 5,
+    /** offset of the nest where attribute was missing (u32) */
+    MISS_NEST = 6,
+}
+
 
 // OTHER
 // -----
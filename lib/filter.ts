@@ -0,0 +1,294 @@
+/**
+ * This module implements a small compiler of message predicates
+ * into classic BPF programs, which can be attached to a socket
+ * (see {@link RawNetlinkSocket.attachFilter}) so that unwanted
+ * messages are dropped by the kernel before they reach us.
+ *
+ * The filter only looks at the first message of each datagram,
+ * which is fine for notifications (one message per datagram).
+ * To avoid breaking requests, control messages (such as ERROR
+ * or DONE), multipart messages and messages addressed to our
+ * own port are always accepted (unless disabled).
+ *
+ * @module
+ */
+
+import { endianness } from 'os'
+import { writeU16, writeU32, align, HEADER_LENGTH } from './structs'
+import { Flags } from './constants'
+
+const isLE = endianness() === 'LE'
+
+/** Maximum number of instructions in a program (BPF_MAXINSNS) */
+export const MAX_INSTRUCTIONS = 4096
+/** Size of a `struct sock_filter` (a single instruction) */
+export const INSTRUCTION_SIZE = 8
+
+/** Condition on a field of the family header (i.e. the payload) */
+export interface FieldPredicate {
+    /** Offset of the field, relative to the family header */
+    offset: number
+    /** Size of the field in bytes (fields are read in host endianness) */
+    size: 1 | 2 | 4
+    /** If set, the field must equal this value (or one of these values) */
+    equals?: number | number[]
+    /** If set, all of these bits must be set in the field */
+    mask?: number
+}
+
+/**
+ * Set of conditions a message has to satisfy to match the rule.
+ * All of the conditions must be satisfied.
+ */
+export interface FilterRule {
+    /** If set, the message type must be this (or one of these) */
+    type?: number | number[]
+    /** If set, all of these bits must be set in the message flags */
+    flags?: number
+    /** Conditions on the family header */
+    fields?: FieldPredicate[]
+    /** Length of the family header (required if `attributes` is set) */
+    headerLength?: number
+    /**
+     * Attribute types that must be present after the family header.
+     * Attributes are walked with an unrolled loop, so if the
+     * attribute isn't found within the first `maxAttributes`, the
+     * message is conservatively considered to match.
+     */
+    attributes?: number[]
+}
+
+export interface FilterOptions {
+    /** Our port. If set, messages addressed to it are always accepted. */
+    port?: number
+    /** Always accept control messages (type < 0x10) (default: true) */
+    acceptControl?: boolean
+    /** Always accept messages with the MULTI flag (default: true) */
+    acceptMulti?: boolean
+    /** Number of attributes to look at when checking attribute presence (default: 16) */
+    maxAttributes?: number
+}
+
+// Instruction classes and fields, see linux/filter.h
+
+const BPF_LD = 0x00, BPF_LDX = 0x01, BPF_ST = 0x02, BPF_ALU = 0x04, BPF_JMP = 0x05, BPF_RET = 0x06, BPF_MISC = 0x07
+const BPF_W = 0x00, BPF_H = 0x08, BPF_B = 0x10
+const BPF_IMM = 0x00, BPF_ABS = 0x20, BPF_IND = 0x40, BPF_MEM = 0x60, BPF_LEN = 0x80
+const BPF_ADD = 0x00, BPF_SUB = 0x10, BPF_OR = 0x40, BPF_AND = 0x50, BPF_LSH = 0x60
+const BPF_JA = 0x00, BPF_JEQ = 0x10, BPF_JGE = 0x30, BPF_JSET = 0x40
+const BPF_K = 0x00, BPF_X = 0x08
+const BPF_TAX = 0x00
+
+/** Scratch memory slots */
+const M_OFFSET = 0, M_TEMP = 1
+
+const NLA_TYPE_MASK = 0x3FFF
+
+interface Instruction {
+    code: number
+    jt: number
+    jf: number
+    k: number
+    /** For BPF_JA, label to jump to (resolved when assembling) */
+    target?: string
+}
+
+class Assembler {
+    readonly code: Instruction[] = []
+    readonly labels: Map<string, number> = new Map()
+    private counter = 0
+
+    newLabel() {
+        return `L${this.counter++}`
+    }
+
+    label(name: string) {
+        this.labels.set(name, this.code.length)
+    }
+
+    op(code: number, k: number = 0, jt: number = 0, jf: number = 0) {
+        this.code.push({ code, jt, jf, k: k >>> 0 })
+    }
+
+    jump(target: string) {
+        this.code.push({ code: BPF_JMP | BPF_JA, jt: 0, jf: 0, k: 0, target })
+    }
+
+    /** Continues if the condition holds, otherwise jumps to `fail` */
+    require(code: number, k: number, fail: string) {
+        this.op(BPF_JMP | code | BPF_K, k, 1, 0)
+        this.jump(fail)
+    }
+
+    /** Jumps to `target` if the condition holds, otherwise continues */
+    branch(code: number, k: number, target: string) {
+        this.op(BPF_JMP | code | BPF_K, k, 0, 1)
+        this.jump(target)
+    }
+
+    /** Continues if A equals any of the values, otherwise jumps to `fail` */
+    requireAny(values: number[], fail: string) {
+        if (values.length > 255)
+            throw Error('Too many values in predicate')
+        values.forEach((value, i) =>
+            this.op(BPF_JMP | BPF_JEQ | BPF_K, value, values.length - i, 0))
+        this.jump(fail)
+    }
+
+    /** Loads a field at an absolute offset into A, in host endianness (clobbers X) */
+    loadAbs(offset: number, size: 1 | 2 | 4) {
+        if (size === 1)
+            return this.op(BPF_LD | BPF_B | BPF_ABS, offset)
+        if (!isLE)
+            return this.op(BPF_LD | (size === 4 ? BPF_W : BPF_H) | BPF_ABS, offset)
+        // BPF loads are big endian, assemble the value byte by byte
+        this.op(BPF_LD | BPF_B | BPF_ABS, offset + size - 1)
+        for (let i = size - 2; i >= 0; i--) {
+            this.op(BPF_ALU | BPF_LSH | BPF_K, 8)
+            this.op(BPF_MISC | BPF_TAX)
+            this.op(BPF_LD | BPF_B | BPF_ABS, offset + i)
+            this.op(BPF_ALU | BPF_OR | BPF_X)
+        }
+    }
+
+    /** Loads a 16-bit field at X + offset into A, in host endianness (X is restored from M_OFFSET) */
+    loadInd16(offset: number) {
+        if (!isLE)
+            return this.op(BPF_LD | BPF_H | BPF_IND, offset)
+        this.op(BPF_LD | BPF_B | BPF_IND, offset + 1)
+        this.op(BPF_ALU | BPF_LSH | BPF_K, 8)
+        this.op(BPF_ST, M_TEMP)
+        this.op(BPF_LD | BPF_B | BPF_IND, offset)
+        this.op(BPF_LDX | BPF_W | BPF_MEM, M_TEMP)
+        this.op(BPF_ALU | BPF_OR | BPF_X)
+        this.op(BPF_LDX | BPF_W | BPF_MEM, M_OFFSET)
+    }
+
+    assemble(): Buffer {
+        if (this.code.length > MAX_INSTRUCTIONS)
+            throw Error(`Filter too long (${this.code.length} instructions)`)
+        const r = Buffer.alloc(this.code.length * INSTRUCTION_SIZE)
+        this.code.forEach((insn, i) => {
+            let k = insn.k
+            if (typeof insn.target !== 'undefined') {
+                const target = this.labels.get(insn.target)
+                if (typeof target === 'undefined')
+                    throw Error('Should never happen')
+                k = target - (i + 1)
+            }
+            const offset = i * INSTRUCTION_SIZE
+            writeU16.call(r, insn.code, offset)
+            r[offset + 2] = insn.jt
+            r[offset + 3] = insn.jf
+            writeU32.call(r, k, offset + 4)
+        })
+        return r
+    }
+}
+
+function compileAttribute(asm: Assembler, type: number, headerLength: number, maxAttributes: number, fail: string) {
+    const found = asm.newLabel()
+    // M_OFFSET = X = offset of the first attribute
+    asm.op(BPF_LD | BPF_IMM, HEADER_LENGTH + align(headerLength))
+    asm.op(BPF_ST, M_OFFSET)
+    asm.op(BPF_MISC | BPF_TAX)
+    for (let i = 0; i < maxAttributes; i++) {
+        // stop when there's no room for another attribute header
+        asm.op(BPF_LD | BPF_W | BPF_LEN)
+        asm.op(BPF_ALU | BPF_SUB | BPF_K, 4)
+        asm.op(BPF_JMP | BPF_JGE | BPF_X, 0, 1, 0)
+        asm.jump(fail)
+        // check type
+        asm.loadInd16(2)
+        asm.op(BPF_ALU | BPF_AND | BPF_K, NLA_TYPE_MASK)
+        asm.branch(BPF_JEQ, type, found)
+        // skip to the next attribute
+        asm.loadInd16(0)
+        asm.require(BPF_JGE, 4, fail)
+        asm.op(BPF_ALU | BPF_ADD | BPF_K, 3)
+        asm.op(BPF_ALU | BPF_AND | BPF_K, ~3)
+        asm.op(BPF_ALU | BPF_ADD | BPF_X)
+        asm.op(BPF_ST, M_OFFSET)
+        asm.op(BPF_MISC | BPF_TAX)
+    }
+    // walk was inconclusive, consider the attribute present
+    asm.label(found)
+}
+
+function compileRule(asm: Assembler, rule: FilterRule, maxAttributes: number, accept: string, fail: string) {
+    if (typeof rule.type !== 'undefined') {
+        asm.loadAbs(4, 2)
+        asm.requireAny((rule.type instanceof Array) ? rule.type : [rule.type], fail)
+    }
+    if (typeof rule.flags !== 'undefined') {
+        asm.loadAbs(6, 2)
+        asm.op(BPF_ALU | BPF_AND | BPF_K, rule.flags)
+        asm.require(BPF_JEQ, rule.flags, fail)
+    }
+    for (const field of rule.fields || []) {
+        // reject messages too short to contain the field
+        asm.op(BPF_LD | BPF_W | BPF_LEN)
+        asm.require(BPF_JGE, HEADER_LENGTH + field.offset + field.size, fail)
+        if (typeof field.equals !== 'undefined') {
+            asm.loadAbs(HEADER_LENGTH + field.offset, field.size)
+            asm.requireAny(((field.equals instanceof Array) ? field.equals : [field.equals]).map(x => x >>> 0), fail)
+        }
+        if (typeof field.mask !== 'undefined') {
+            asm.loadAbs(HEADER_LENGTH + field.offset, field.size)
+            asm.op(BPF_ALU | BPF_AND | BPF_K, field.mask)
+            asm.require(BPF_JEQ, field.mask >>> 0, fail)
+        }
+    }
+    if (rule.attributes && rule.attributes.length) {
+        if (typeof rule.headerLength !== 'number')
+            throw Error('headerLength is required to check attributes')
+        for (const type of rule.attributes)
+            compileAttribute(asm, type, rule.headerLength, maxAttributes, fail)
+    }
+    asm.jump(accept)
+}
+
+/**
+ * Compiles a set of rules into a classic BPF program. Messages
+ * matching any of the rules are accepted, the rest are dropped.
+ * If no rules are passed, all messages are accepted.
+ *
+ * @param rules Rules to compile
+ * @param options Options
+ * @returns Program (array of `struct sock_filter`)
+ */
+export function compileFilter(rules: FilterRule[], options?: FilterOptions): Buffer {
+    const maxAttributes = (options && options.maxAttributes) || 16
+    const asm = new Assembler()
+    const accept = asm.newLabel()
+
+    // accept anything without a complete header
+    asm.op(BPF_LD | BPF_W | BPF_LEN)
+    asm.require(BPF_JGE, HEADER_LENGTH, accept)
+
+    if (!(options && options.acceptControl === false)) {
+        asm.loadAbs(4, 2)
+        asm.require(BPF_JGE, 0x10, accept)
+    }
+    if (!(options && options.acceptMulti === false)) {
+        asm.loadAbs(6, 2)
+        asm.branch(BPF_JSET, Flags.MULTI, accept)
+    }
+    if (options && typeof options.port === 'number') {
+        asm.loadAbs(12, 4)
+        asm.branch(BPF_JEQ, options.port, accept)
+    }
+
+    if (!rules.length)
+        asm.jump(accept)
+    for (const rule of rules) {
+        const next = asm.newLabel()
+        compileRule(asm, rule, maxAttributes, accept, next)
+        asm.label(next)
+    }
+    asm.op(BPF_RET | BPF_K, 0)
+
+    asm.label(accept)
+    asm.op(BPF_RET | BPF_K, 0xFFFFFFFF)
+    return asm.assemble()
+}
@@ -0,0 +1,233 @@
+/**
+ * This module implements {@link NetlinkFleet}, which drives many
+ * netlink sockets (typically one per network namespace) from a single
+ * poll handle.
+ * @module
+ */
+
+import { EventEmitter } from 'events'
+import { MessageBatch, MessageInfo, ErrnoException } from './raw'
+import { NetlinkMessage, StreamData, serializeMessage, parseMessages, parseIndexedMessages } from './structs'
+import { Attributes, Flags } from './constants'
+
+const binding = require('node-gyp-build')(__dirname + '/..')
+
+type NativeNetlinkFleet = any
+
+export interface NetlinkFleetOptions {
+    /**
+     * Validate the framing of received datagrams natively, and pass
+     * a framing index along with them (default: true).
+     */
+    indexMessages?: boolean
+}
+
+export interface FleetMemberOptions {
+    /**
+     * Network namespace to create the socket in, as an open file
+     * descriptor or a path (default: ours). See
+     * {@link RawNetlinkSocketOptions.netns}.
+     */
+    netns?: number | string
+    /** Multicast groups to join */
+    groups?: number[]
+    /** Sets the `SO_RCVBUF` socket value */
+    recvBufferSize?: number
+    /**
+     * Enable {@link Attributes.LISTEN_ALL_NSID}, so that the socket
+     * receives notifications from all namespaces that have an ID
+     * assigned in its own, with {@link MessageInfo.nsid} set
+     */
+    listenAllNsid?: boolean
+}
+
+export interface FleetSendOptions {
+    /** Flags (default: REQUEST) */
+    flags?: number
+    /** Sequence number (default: 0) */
+    seq?: number
+    /** Destination port (default: 0, the kernel) */
+    port?: number
+    /** Destination multicast groups (default: 0) */
+    groups?: number
+}
+
+interface EventMap {
+    messages(batch: MessageBatch): void
+    message(member: number, msg: NetlinkMessage[], rinfo: MessageInfo): void
+    invalid(member: number, err: any, msg: Buffer, rinfo: MessageInfo): void
+    truncatedMessage(member: number, msg: Buffer, rinfo: MessageInfo): void
+    error(err: ErrnoException, member?: number): void
+    close(): void
+}
+
+/**
+ * Set of netlink sockets of the same protocol ("members"), usually
+ * one per network namespace, that share a single `epoll` set and
+ * poll handle. Every wakeup reads the ready members (with `recvmmsg`)
+ * and delivers everything in one {@link MessageBatch}, where
+ * {@link MessageBatch.member} tells which member each datagram
+ * came from. This makes it practical to watch hundreds of
+ * namespaces (e.g. containers) without a handle per socket.
+ *
+ * Members are bound to a kernel-assigned port. Messages are sent
+ * synchronously, and there's no request / reply tracking: match
+ * replies by sequence number on the `message` event.
+ */
+export class NetlinkFleet extends EventEmitter {
+    // copy-pasted code for type-safe events
+    emit<E extends keyof EventMap>(event: E, ...args: Parameters<EventMap[E]>) { return super.emit(event, ...args) }
+    on<E extends keyof EventMap>(event: E, listener: EventMap[E]) { return super.on(event, listener) }
+    once<E extends keyof EventMap>(event: E, listener: EventMap[E]) { return super.once(event, listener) }
+    off<E extends keyof EventMap>(event: E, listener: EventMap[E]) { return super.off(event, listener) }
+    addListener<E extends keyof EventMap>(event: E, listener: EventMap[E]) { return super.addListener(event, listener) }
+    removeListener<E extends keyof EventMap>(event: E, listener: EventMap[E]) { return super.removeListener(event, listener) }
+
+    private readonly __native: NativeNetlinkFleet
+
+    /**
+     * @param protocol Netlink protocol of the members (see {@link Protocol})
+     * @param options Fleet options
+     */
+    constructor(protocol: number, options?: NetlinkFleetOptions) {
+        super()
+        if (typeof protocol !== 'number')
+            throw TypeError('Expected number')
+        this.__native = new binding.NativeNetlinkFleet(protocol, this._receiveBatch.bind(this), this._error.bind(this), {
+            index: !(options && options.indexMessages === false),
+        })
+    }
+
+    private _receiveBatch(data: Buffer, table: Uint32Array, index: Uint32Array) {
+        const batch = new MessageBatch(data, table, index)
+        this.emit('messages', batch)
+        // only parse into messages if somebody is listening
+        const wantMessages = this.listenerCount('message') > 0
+        const wantTruncated = this.listenerCount('truncatedMessage') > 0
+        if (!wantMessages && !wantTruncated) return
+        for (let n = 0; n < batch.length; n++) {
+            const member = batch.member(n)
+            if (batch.truncated(n)) {
+                if (wantTruncated)
+                    this.emit('truncatedMessage', member, batch.message(n), batch.info(n))
+                continue
+            }
+            if (!wantMessages) continue
+            const messageIndex = batch.messageIndex(n)
+            let msgs
+            try {
+                msgs = messageIndex ? parseIndexedMessages(data, messageIndex) : parseMessages(batch.message(n))
+            } catch (e) {
+                this.emit('invalid', member, e, batch.message(n), batch.info(n))
+                continue
+            }
+            this.emit('message', member, msgs, batch.info(n))
+        }
+    }
+
+    private _error(error: ErrnoException, member?: number) {
+        this.emit('error', error, member)
+    }
+
+    /**
+     * Creates a new member socket, binds it and adds it to the fleet.
+     * If setting it up fails, the member is removed before throwing.
+     *
+     * @returns ID of the member
+     */
+    add(options?: FleetMemberOptions): number {
+        const member: number = this.__native.add(options && options.netns)
+        try {
+            if (options && options.recvBufferSize)
+                this.__native.setRecvBufferSize(member, options.recvBufferSize)
+            if (options && options.listenAllNsid)
+                this.__native.setNetlinkOption(member, Attributes.LISTEN_ALL_NSID, 1)
+            for (const group of (options && options.groups) || [])
+                this.addMembership(member, group)
+        } catch (e) {
+            this.__native.remove(member)
+            throw e
+        }
+        return member
+    }
+
+    /** Closes a member socket and removes it from the fleet */
+    remove(member: number) {
+        this.__native.remove(member)
+    }
+
+    /**
+     * Sends a message from a member. The header length is
+     * calculated automatically.
+     *
+     * @param member ID of the member to send from
+     * @param type Message type
+     * @param data Message payload
+     * @param options Header fields and destination
+     */
+    send(member: number, type: number, data: StreamData, options?: FleetSendOptions) {
+        const msg = serializeMessage({
+            type,
+            flags: options && options.flags !== undefined ? options.flags : Flags.REQUEST,
+            seq: (options && options.seq) || 0,
+            port: 0,
+            data,
+        })
+        this.sendRaw(member, msg, options)
+    }
+
+    /** Sends an already serialized datagram from a member */
+    sendRaw(member: number, msg: Buffer, options?: Pick<FleetSendOptions, 'port' | 'groups'>) {
+        this.__native.send(member, (options && options.port) || 0, (options && options.groups) || 0, msg)
+    }
+
+    /** Returns the address a member is bound at */
+    address(member: number): { port: number, groups: number } {
+        return this.__native.address(member)
+    }
+
+    /** Joins a member to the specified multicast group */
+    addMembership(member: number, group: number) {
+        if (typeof group !== 'number')
+            throw TypeError('Expected number')
+        this.__native.addMembership(member, group)
+    }
+
+    /** Makes a member leave the specified multicast group */
+    dropMembership(member: number, group: number) {
+        if (typeof group !== 'number')
+            throw TypeError('Expected number')
+        this.__native.dropMembership(member, group)
+    }
+
+    /** Sets an integer `SOL_NETLINK` option on a member socket */
+    setNetlinkOption(member: number, option: Attributes, value: number | boolean) {
+        if (typeof option !== 'number')
+            throw TypeError('Expected number')
+        this.__native.setNetlinkOption(member, option, Number(value))
+    }
+
+    /** Sets the `SO_RCVBUF` value of a member socket */
+    setRecvBufferSize(member: number, size: number) {
+        this.__native.setRecvBufferSize(member, size)
+    }
+
+    /** Closes all members. After this, no other methods can be called. */
+    close() {
+        this.__native.close()
+        this.emit('close')
+    }
+
+    /**
+     * References the fleet, preventing the event loop from exiting
+     * while it is active. The fleet is referenced when created.
+     */
+    ref() {
+        this.__native.ref()
+    }
+
+    /** Unreferences the fleet, see {@link ref} */
+    unref() {
+        this.__native.unref()
+    }
+}
@@ -5,10 +5,10 @@
 
 import { EventEmitter } from 'events'
 
-import { MessageInfo, RawNetlinkSocketOptions } from '../raw'
-import { createNetlink, NetlinkSocket, NetlinkSocketOptions, NetlinkSendOptions, RequestOptions } from '../netlink'
+import { MessageInfo, RawNetlinkSocketOptions, ErrnoException } from '../raw'
+import { createNetlink, NetlinkSocket, NetlinkSocketOptions, NetlinkSendOptions, RequestOptions, DumpOptions } from '../netlink'
 import { Protocol, MIN_TYPE } from '../constants'
-import { formatGenlHeader, ensureArray, NetlinkMessage, parseGenlHeader, AttrStream } from '../structs'
+import { formatGenlHeader, ensureArray, NetlinkMessage, parseGenlHeader, StreamData } from '../structs'
 import { Commands, Message, formatMessage, parseMessage } from './structs'
 
 // Based on <linux/genetlink.h> at 6f52b16
@@ -25,6 +25,9 @@ export const GENL_ID_PMCRAID = MIN_TYPE + 2
 /* must be last reserved + 1 */
 export const GENL_START_ALLOC = MIN_TYPE + 3
 
+/** Multicast group of the controller (`notify`), which gets the same id as the controller */
+export const GENL_CTRL_NOTIFY_GROUP = GENL_ID_CTRL
+
 
 export interface GenericNetlinkSocketOptions {
 }
@@ -45,6 +48,9 @@ export interface GenericNetlinkMessage {
 
 export const CTRL_VERSION = 1
 
+/** Listener for messages of a family, see {@link GenericNetlinkSocket.subscribe} */
+export type FamilyListener = (msgs: GenericNetlinkMessage[], rinfo: MessageInfo) => void
+
 /**
  * TODO
  *
@@ -52,6 +58,8 @@ export const CTRL_VERSION = 1
  */
 export class GenericNetlinkSocket extends EventEmitter {
     readonly socket: NetlinkSocket
+    protected familyListeners: Map<number, Set<FamilyListener>> = new Map()
+    private familyCache?: FamilyCache
 
     constructor(socket: NetlinkSocket, options?: GenericNetlinkSocketOptions) {
         super()
@@ -69,19 +77,61 @@ export class GenericNetlinkSocket extends EventEmitter {
     }
 
     private _receive(omsg: NetlinkMessage[], rinfo: MessageInfo) {
-        this.emit('message', omsg.map(x =>
-            (x.type >= GENL_MIN_ID && x.type <= GENL_MAX_ID) ? this.parseMessage(x) : x), rinfo)
+        const msgs = omsg.map(x =>
+            (x.type >= GENL_MIN_ID && x.type <= GENL_MAX_ID) ? this.parseMessage(x) : x)
+        // demultiplex by family for subscribed clients
+        if (this.familyListeners.size) {
+            const families: Map<number, GenericNetlinkMessage[]> = new Map()
+            for (const msg of msgs) {
+                if (!('family' in msg)) continue
+                const list = families.get(msg.family)
+                list ? list.push(msg) : families.set(msg.family, [msg])
+            }
+            families.forEach((list, family) => {
+                const listeners = this.familyListeners.get(family)
+                listeners && listeners.forEach(listener => listener(list, rinfo))
+            })
+        }
+        this.emit('message', msgs, rinfo)
+    }
+
+    /**
+     * Calls `listener` with received messages (that aren't replies
+     * to a request) of a family. This lets many family clients
+     * share (multiplex over) one socket without each of them
+     * looking at every message.
+     */
+    subscribe(family: number, listener: FamilyListener) {
+        const listeners = this.familyListeners.get(family)
+        listeners ? listeners.add(listener) : this.familyListeners.set(family, new Set([listener]))
+    }
+
+    /** Removes a listener added with {@link subscribe} */
+    unsubscribe(family: number, listener: FamilyListener) {
+        const listeners = this.familyListeners.get(family)
+        if (listeners && listeners.delete(listener) && !listeners.size)
+            this.familyListeners.delete(family)
+    }
+
+    /**
+     * Family cache bound to this socket (created on first use,
+     * which subscribes the socket to controller notifications).
+     * See {@link getFamilyCache} for the process-wide one.
+     */
+    get families(): FamilyCache {
+        if (!this.familyCache)
+            this.familyCache = new FamilyCache(this)
+        return this.familyCache
     }
 
     send(
         family: number,
         cmd: number,
         version: number,
-        data: Uint8Array | Uint8Array[],
+        data: StreamData,
         options?: GenericNetlinkSendOptions
     ) {
-        const header = formatGenlHeader({ cmd, version })
-        data = [header as Uint8Array].concat(ensureArray(data))
+        data = withGenlHeader(formatGenlHeader({ cmd, version }), data)
         return this.socket.send(family, data, options)
     }
 
@@ -89,11 +139,10 @@ export class GenericNetlinkSocket extends EventEmitter {
         family: number,
         cmd: number,
         version: number,
-        data: Uint8Array | Uint8Array[],
+        data: StreamData,
         options?: GenericNetlinkSendOptions & RequestOptions
     ): Promise<[GenericNetlinkMessage[], MessageInfo]> {
-        const header = formatGenlHeader({ cmd, version })
-        data = [header as Uint8Array].concat(ensureArray(data))
+        data = withGenlHeader(formatGenlHeader({ cmd, version }), data)
         const [msg, rinfo] = await this.socket.request(family, data, options)
         const parsed = msg.map(x => {
             if (msg[0].type !== family)
@@ -103,6 +152,28 @@ export class GenericNetlinkSocket extends EventEmitter {
         return [parsed, rinfo]
     }
 
+    /**
+     * Sends a dump request, and yields the parsed replies as they
+     * arrive, see {@link NetlinkSocket.dump}.
+     */
+    async *dump(
+        family: number,
+        cmd: number,
+        version: number,
+        data: StreamData,
+        options?: GenericNetlinkSendOptions & DumpOptions
+    ): AsyncGenerator<[GenericNetlinkMessage[], MessageInfo], void, undefined> {
+        data = withGenlHeader(formatGenlHeader({ cmd, version }), data)
+        for await (const [msg, rinfo] of this.socket.dump(family, data, options)) {
+            const parsed = msg.map(x => {
+                if (x.type !== family)
+                    throw Error(`Received reply with different family (${x.type}) than original (${family})`)
+                return this.parseMessage(x)
+            })
+            yield [parsed, rinfo]
+        }
+    }
+
     /**
      * Send a request to the controller
      * @param cmd
@@ -114,13 +185,118 @@ export class GenericNetlinkSocket extends EventEmitter {
         msg?: Message,
         options?: GenericNetlinkSendOptions & RequestOptions
     ): Promise<Message[]> {
-        const data = new AttrStream()
-        data.emit(formatMessage(msg || {}))
-        const [omsg, _] = await this.request(GENL_ID_CTRL, cmd, CTRL_VERSION, data.bufs, options)
+        const [omsg, _] = await this.request(GENL_ID_CTRL, cmd, CTRL_VERSION, formatMessage(msg || {}), options)
         return omsg.map(x => parseMessage(x.data))
     }
 }
 
+/**
+ * Cache of family information (id, version, multicast groups...) by
+ * name, resolved with non-dump `GET_FAMILY` requests. The socket is
+ * subscribed to the controller's `notify` group, and entries are
+ * updated or dropped when families are registered or unregistered
+ * (or when notifications may have been lost).
+ */
+export class FamilyCache {
+    readonly socket: GenericNetlinkSocket
+    private readonly entries: Map<string, Promise<Message | undefined>> = new Map()
+
+    constructor(socket: GenericNetlinkSocket) {
+        this.socket = socket
+        socket.socket.addMembership(GENL_CTRL_NOTIFY_GROUP)
+        socket.subscribe(GENL_ID_CTRL, this._receive.bind(this))
+        // after an overrun we can't know what changed; other errors
+        // are rethrown if nobody else listens, as if we weren't here
+        socket.socket.on('error', error => {
+            if (error.code === 'ENOBUFS')
+                return this.invalidate()
+            if (socket.socket.listenerCount('error') === 1)
+                throw error
+        })
+    }
+
+    private _receive(msgs: GenericNetlinkMessage[]) {
+        for (const msg of msgs) {
+            const cmd = msg.cmd
+            if (cmd !== Commands.NEW_FAMILY && cmd !== Commands.DEL_FAMILY &&
+                cmd !== Commands.NEW_MCAST_GROUP && cmd !== Commands.DEL_MCAST_GROUP)
+                continue
+            const data = parseMessage(msg.data)
+            if (typeof data.familyName === 'undefined')
+                continue
+            // group notifications only carry the changed group
+            if (cmd === Commands.NEW_FAMILY)
+                this.entries.set(data.familyName, Promise.resolve(data))
+            else
+                this.entries.delete(data.familyName)
+        }
+    }
+
+    /**
+     * Returns the information of a family, requesting it if it isn't
+     * cached. Resolves with undefined if the family doesn't exist
+     * (which isn't cached).
+     */
+    resolve(name: string, options?: GenericNetlinkSendOptions & RequestOptions): Promise<Message | undefined> {
+        let entry = this.entries.get(name)
+        if (!entry) {
+            const request: Promise<Message | undefined> = this.socket.ctrlRequest(Commands.GET_FAMILY, { familyName: name }, options)
+                .then(msgs => msgs[0], error => {
+                    if ((error as ErrnoException).code !== 'ENOENT') throw error
+                    return undefined
+                })
+            this.entries.set(name, entry = request)
+            // don't cache failures
+            const forget = () => { this.entries.get(name) === request && this.entries.delete(name) }
+            request.then(x => typeof x === 'undefined' && forget(), forget)
+        }
+        return entry
+    }
+
+    /** Resolves the id of a multicast group of a family (undefined if not found) */
+    async resolveGroup(name: string, group: string, options?: GenericNetlinkSendOptions & RequestOptions): Promise<number | undefined> {
+        const family = await this.resolve(name, options)
+        const entry = family && family.mcastGroups && family.mcastGroups.find(x => x.name === group)
+        return entry && entry.id
+    }
+
+    /** Drops an entry (or all of them) */
+    invalidate(name?: string) {
+        typeof name === 'undefined' ? this.entries.clear() : this.entries.delete(name)
+    }
+}
+
+let sharedSocket: GenericNetlinkSocket | undefined
+
+/**
+ * Returns a process-wide generic netlink socket, creating it on
+ * first use. Family clients (see {@link createWireGuard}) can
+ * multiplex over it instead of opening a socket each. It doesn't
+ * keep the event loop alive unless requests are pending. If it's
+ * closed, the next call creates a new one.
+ */
+export function getSharedGenericNetlink(): GenericNetlinkSocket {
+    if (!sharedSocket) {
+        const socket = sharedSocket = createGenericNetlink()
+        socket.socket.on('close', () => {
+            if (sharedSocket === socket) sharedSocket = undefined
+        })
+    }
+    return sharedSocket
+}
+
+/** Process-wide family cache, bound to {@link getSharedGenericNetlink} */
+export function getFamilyCache(): FamilyCache {
+    return getSharedGenericNetlink().families
+}
+
+/** Prepends the header to the payload, keeping functions as such (see {@link NetlinkSocket.send}) */
+function withGenlHeader(header: Buffer, data: StreamData): StreamData {
+    if (typeof data === 'function')
+        return out => (out.emit(header), out.emit(data))
+    return [header as Uint8Array].concat(ensureArray(data))
+}
+
 export function createGenericNetlink(
     options?: GenericNetlinkSocketOptions & NetlinkSocketOptions & RawNetlinkSocketOptions
 ): GenericNetlinkSocket {
@@ -2,10 +2,19 @@ export * from './constants'
 export * from './raw'
 export * from './structs'
 export * from './netlink'
+export * from './fleet'
+export * from './filter'
+export * from './cache'
 export * from './genl/genl'
 export * from './nl80211/nl80211'
+export * from './nl80211/dump'
+export * from './nl80211/cache'
 export * from './rt/rt'
+export * from './rt/cache'
+export * from './rt/columnar'
+export * from './rt/native'
 export * from './wg/wg'
+export * from './wg/stats'
 
 import * as genl from './genl/structs'
 import * as nl80211 from './nl80211/structs'
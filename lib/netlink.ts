@@ -8,15 +8,20 @@
 
 import { EventEmitter } from 'events'
 import * as util from 'util'
+import { constants } from 'os'
 const { getSystemErrorName } = (util as any) // FIXME?
 
 import { RawNetlinkSocket,
          RawNetlinkSocketOptions,
          RawNetlinkSendOptions,
          MessageInfo,
-         ErrnoException } from './raw'
-import { Flags, FlagsAck, MessageType } from './constants'
-import { parseMessages, formatMessage, NetlinkMessage, parseError, NetlinkMessage_ } from './structs'
+         MessageBatch,
+         ErrnoException,
+         CaptureOptions,
+         CaptureStats } from './raw'
+import { Flags, FlagsAck, FlagsGet, MessageType, Attributes } from './constants'
+import { compileFilter, FilterRule, FilterOptions } from './filter'
+import { parseMessages, parseIndexedMessages, formatMessage, serializeMessage, NetlinkMessage, parseError, NetlinkMessage_, countLength, NetlinkErrorMessage, parseDoneError, StreamData } from './structs'
 
 export interface NetlinkSocketOptions {
     /**
@@ -25,6 +30,31 @@ export interface NetlinkSocketOptions {
      * you need to listen for notifications. See the {@link NetlinkSocket.ref} method.
      */
     ref?: boolean
+    /**
+     * If set, sent messages are held for this many milliseconds and
+     * then coalesced into as few datagrams as possible (see
+     * {@link NetlinkSocket.cork}). Default: disabled.
+     */
+    coalesceWindow?: number
+    /**
+     * Enable extended ACKs (`NETLINK_EXT_ACK`), so that errors include
+     * an explanation from the kernel, if supported (default: true)
+     */
+    extendedAck?: boolean
+    /**
+     * Enable capped ACKs (`NETLINK_CAP_ACK`), so that errors don't
+     * echo the full request payload, if supported (default: true)
+     */
+    capAck?: boolean
+    /**
+     * Match replies to {@link NetlinkSocket.request} natively (see
+     * {@link RawNetlinkSocket.request}), rather than in JS (default:
+     * false). This is cheaper at high request rates. It isn't used
+     * for requests that set `seq` or `localPort`, or while messages
+     * are being corked or coalesced. Only replies from the kernel
+     * are matched.
+     */
+    nativeRequests?: boolean
 }
 
 export interface NetlinkSendOptions extends RawNetlinkSendOptions {
@@ -49,6 +79,54 @@ export interface RequestOptions {
     checkError?: boolean
 }
 
+export interface DumpOptions {
+    /** Timeout in ms for the whole dump (default: no timeout) */
+    timeout?: number
+    /**
+     * Number of received datagrams to buffer before reading from
+     * the socket is paused, until the consumer catches up (default: 16)
+     */
+    highWaterMark?: number
+}
+
+/** Message to send with {@link NetlinkSocket.bulk} */
+export interface BulkMessage {
+    type: number
+    data: StreamData
+    /** Message flags, REQUEST is always added (default: 0) */
+    flags?: number
+}
+
+export interface BulkOptions {
+    /** Maximum number of messages in flight (default: 1024) */
+    window?: number
+    /** Timeout in ms for the whole operation (default: no timeout) */
+    timeout?: number
+}
+
+/** Failed message, as reported by {@link NetlinkSocket.bulk} */
+export interface BulkFailure {
+    /** Position of the message in the input */
+    index: number
+    /**
+     * {@link NetlinkError} if the kernel rejected the message,
+     * {@link ErrnoException} if it couldn't be sent, or the error
+     * thrown when serializing it
+     */
+    error: Error
+}
+
+interface DumpStream {
+    chunks: [NetlinkMessage[], MessageInfo][]
+    done: boolean
+    /** No more replies will arrive (DONE or ERROR received, or the request wasn't sent) */
+    finished: boolean
+    error?: Error
+    paused: boolean
+    highWaterMark: number
+    wake?: () => void
+}
+
 interface EventMap {
     invalid(err: any, msg: Buffer | NetlinkMessage[], rinfo: MessageInfo): void
     message(msg: NetlinkMessage[], rinfo: MessageInfo): void
@@ -58,11 +136,19 @@ interface EventMap {
     close(): void
 }
 
+interface PendingDatagram {
+    port: number
+    groups: number
+    data: Uint8Array[]
+    /** Length of data, including padding */
+    length: number
+    callbacks: (((error?: ErrnoException) => void) | undefined)[]
+}
+
 /**
  * TODO
  *
  * This socket silently discards invalid messages (see `invalid` event).
- * FIXME: cork / uncork api
  * FIXME: debug option, common for all sockets
  */
 export class NetlinkSocket extends EventEmitter {
@@ -78,12 +164,37 @@ export class NetlinkSocket extends EventEmitter {
     seq: number = 1
     protected referenced: boolean = false
     protected requests: Map<number, (err: Error|null, msg?: NetlinkMessage[], rinfo?: MessageInfo) => any> = new Map()
-    protected multipartMessage?: NetlinkMessage[]
+    /** Multipart messages being received for requests, by sequence number */
+    protected multipart: Map<number, NetlinkMessage[]> = new Map()
+    /** Multipart message being received with no request waiting for it */
+    protected unclaimedMultipart?: NetlinkMessage[]
+    protected corked: number = 0
+    protected coalesceWindow?: number
+    protected coalesceTimer?: NodeJS.Timeout
+    protected pendingDatagrams: PendingDatagram[] = []
+    protected maxDatagramSize?: number
+    protected streams: Map<number, DumpStream> = new Map()
+    /** Sequence numbers of abandoned dumps, whose replies are discarded until they end */
+    protected draining: Set<number> = new Set()
+    protected pauseCount: number = 0
+    protected closed: boolean = false
+    protected nativeRequests: boolean
+    /** Number of requests waiting for replies in the binding */
+    protected nativePending: number = 0
 
     constructor(socket: RawNetlinkSocket, options?: NetlinkSocketOptions) {
         super()
         this.socket = socket
-        this.socket.on('message', this._receive.bind(this))
+        this.coalesceWindow = options && options.coalesceWindow
+        this.nativeRequests = !!(options && options.nativeRequests)
+        if (!(options && options.extendedAck === false))
+            this.trySetNetlinkOption(Attributes.EXT_ACK, true)
+        if (!(options && options.capAck === false))
+            this.trySetNetlinkOption(Attributes.CAP_ACK, true)
+        if (this.socket.batching)
+            this.socket.on('messages', this._receiveBatch.bind(this))
+        else
+            this.socket.on('message', this._receive.bind(this))
         this.ref(!!(options && options.ref))
         // re-emit events
         this.socket.on('close', (...args) => this.emit('close', ...args))
@@ -91,45 +202,78 @@ export class NetlinkSocket extends EventEmitter {
         this.socket.on('truncatedMessage', (...args) => this.emit('truncatedMessage', ...args))
     }
 
-    private _receive(msg: Buffer, rinfo: MessageInfo) {
+    private _receive(msg: Buffer, rinfo: MessageInfo, index?: Uint32Array) {
         let msgs
         try {
-            msgs = parseMessages(msg)
+            // if the binding already validated the framing, use its index
+            msgs = index ? parseIndexedMessages(msg, index) : parseMessages(msg)
         } catch (e) {
             return this.emit('invalid', e, msg, rinfo)
         }
         this.handleMessages(msgs, rinfo)
     }
 
+    private _receiveBatch(batch: MessageBatch) {
+        for (let n = 0; n < batch.length; n++) {
+            // truncated datagrams are re-emitted through the raw socket
+            if (batch.truncated(n)) continue
+            const index = batch.messageIndex(n)
+            if (index)
+                this.handleMessages(parseIndexedMessages(batch.data, index), batch.info(n))
+            else
+                this._receive(batch.message(n), batch.info(n))
+        }
+    }
+
     /**
      * Handles zero or more messages received over the socket,
      * doing multipart grouping and calling {@link emitMessage} as
      * appropriate.
      */
     protected handleMessages(msgs: NetlinkMessage[], rinfo: MessageInfo) {
-        // FIXME: do actual sequence checking, etc
+        if (this.draining.size)
+            msgs = this.drain(msgs)
+        if (this.streams.size)
+            msgs = this.feedStreams(msgs, rinfo)
+        // parts are grouped by sequence number, so that
+        // replies to concurrent requests can interleave
         msgs.forEach(msg => {
+            // other multipart messages (i.e. multicast ones) may never get
+            // a DONE, so they end when a different message arrives
+            if (this.unclaimedMultipart) {
+                const unclaimed = this.unclaimedMultipart
+                if (msg.type !== MessageType.DONE && msg.flags & Flags.MULTI && msg.seq === unclaimed[0].seq)
+                    return unclaimed.push(msg)
+                this.unclaimedMultipart = undefined
+                if (msg.type === MessageType.DONE && msg.seq === unclaimed[0].seq)
+                    return this.emitMessage((unclaimed.push(msg), unclaimed), rinfo)
+                this.emitMessage(unclaimed, rinfo)
+            }
+            if (!this.requests.has(msg.seq) && !this.streams.has(msg.seq)) {
+                if (msg.type !== MessageType.DONE && msg.flags & Flags.MULTI)
+                    this.unclaimedMultipart = [msg]
+                else
+                    this.emitMessage(msg.type === MessageType.DONE ? [msg] : msg, rinfo)
+                return
+            }
+            const parts = this.multipart.get(msg.seq)
             // We do NOT check for the MULTI flag, since
             // apparently some broken kernels don't set it on DONE
             if (msg.type === MessageType.DONE) {
                 // DONE can be the only message in a multipart message
-                const parts = this.multipartMessage || []
-                delete this.multipartMessage
-                parts.push(msg)
-                this.emitMessage(parts, rinfo)
+                this.multipart.delete(msg.seq)
+                this.emitMessage(parts ? (parts.push(msg), parts) : [msg], rinfo)
                 return
             }
-            if (this.multipartMessage) {
-                if (msg.flags & Flags.MULTI && msg.seq === this.multipartMessage[0].seq)
-                    return this.multipartMessage.push(msg)
-                const parts = this.multipartMessage
-                delete this.multipartMessage
-                this.emitMessage(parts, rinfo)
-            }
             if (msg.flags & Flags.MULTI) {
-                this.multipartMessage = [msg]
+                parts ? parts.push(msg) : this.multipart.set(msg.seq, [msg])
                 return
             }
+            // a message without MULTI ends a multipart message (improperly)
+            if (parts) {
+                this.multipart.delete(msg.seq)
+                this.emitMessage(parts, rinfo)
+            }
             this.emitMessage(msg, rinfo)
         })
     }
@@ -141,6 +285,12 @@ export class NetlinkSocket extends EventEmitter {
      * called.
      */
     close() {
+        this.closed = true
+        this.streams.forEach(stream => this.endStream(stream, Error('Socket has been closed')))
+        this.pendingDatagrams = []
+        if (typeof this.coalesceTimer !== 'undefined')
+            clearTimeout(this.coalesceTimer)
+        this.coalesceTimer = undefined
         return this.socket.close()
     }
 
@@ -154,14 +304,24 @@ export class NetlinkSocket extends EventEmitter {
     }
 
     /**
-     * Generate a unique sequence number to use in a message
+     * Returns the counters of the underlying socket
+     * (see {@link RawNetlinkSocket.stats}).
+     */
+    stats() {
+        return this.socket.stats()
+    }
+
+    /**
+     * Generate a unique sequence number to use in a message.
+     * Numbers that are still being waited for (by a request or
+     * dump) are skipped. Numbers are below 0x80000000, the rest
+     * are assigned by {@link RawNetlinkSocket.request}.
      */
     generateSeq() {
-        // FIXME: how does libnl generate / check seq?
-        //while (this.requests.has(this.seq))
-        //    this.seq = this.seq % 0xFFFFFFFF + 1
-        const r = this.seq
-        this.seq = this.seq % 0xFFFFFFFF + 1
+        let r = this.seq
+        while (this.requests.has(r) || this.streams.has(r) || this.draining.has(r))
+            r = r % 0x7FFFFFFF + 1
+        this.seq = r % 0x7FFFFFFF + 1
         return r
     }
 
@@ -171,7 +331,8 @@ export class NetlinkSocket extends EventEmitter {
      * and port will be filled automatically.
      *
      * @param type Message type
-     * @param data Message payload
+     * @param data Message payload. If a function is passed, the
+     * message is serialized into a single buffer (see {@link serialize}).
      * @param options Message send options
      * @param callback Callback will be called after
      * the message has been sent (or failed to be sent)
@@ -180,7 +341,7 @@ export class NetlinkSocket extends EventEmitter {
      */
     send(
         type: number,
-        data: Uint8Array | Uint8Array[],
+        data: StreamData,
         options?: NetlinkSendOptions,
         callback?: (error?: ErrnoException) => void,
     ): number {
@@ -192,11 +353,99 @@ export class NetlinkSocket extends EventEmitter {
         if (typeof port === 'undefined')
             port = this.socket.address().port
 
-        data = formatMessage({ type, flags, seq, port, data })
-        this.socket.send(data, options, callback)
+        const msg = (typeof data === 'function') ?
+            [ serializeMessage({ type, flags, seq, port, data }) as Uint8Array ] :
+            formatMessage({ type, flags, seq, port, data })
+        if (this.corked || typeof this.coalesceWindow !== 'undefined')
+            this.enqueue(msg, options, callback)
+        else
+            this.socket.send(msg, options, callback)
         return seq
     }
 
+    /**
+     * Holds sent messages until {@link uncork} is called, then
+     * packs them into as few datagrams as possible (each one no
+     * bigger than what `SO_SNDBUF` allows), and sends them in a
+     * single batch. Completion callbacks are still called once
+     * per message. Calls nest, i.e. each call to `cork()` must be
+     * matched with a call to `uncork()`.
+     *
+     * Keep in mind that the kernel processes all messages of a
+     * datagram in a row, and that only one dump can be running at
+     * a time per socket.
+     */
+    cork() {
+        this.corked++
+    }
+
+    /** See {@link cork} */
+    uncork() {
+        if (this.corked > 0 && --this.corked === 0)
+            this.flush()
+    }
+
+    /**
+     * Sends the messages held by {@link cork} or the coalescing
+     * window right away.
+     */
+    flush() {
+        if (typeof this.coalesceTimer !== 'undefined')
+            clearTimeout(this.coalesceTimer)
+        this.coalesceTimer = undefined
+        const pending = this.pendingDatagrams
+        this.pendingDatagrams = []
+        this.maxDatagramSize = undefined
+        if (!pending.length) return
+
+        this.socket.cork()
+        try {
+            for (const { port, groups, data, callbacks } of pending) {
+                this.socket.send(data, { port, groups }, error => {
+                    let handled = true
+                    for (const callback of callbacks)
+                        callback ? callback(error) : (handled = false)
+                    if (typeof error !== 'undefined' && !handled)
+                        this.emit('error', error)
+                })
+            }
+        } finally {
+            this.socket.uncork()
+        }
+    }
+
+    protected enqueue(
+        msg: Uint8Array[],
+        options?: RawNetlinkSendOptions,
+        callback?: (error?: ErrnoException) => void,
+    ) {
+        const port = (options && options.port) || 0
+        const groups = (options && options.groups) || 0
+        const length = countLength(msg)
+        const paddedLength = (length + 3) & ~3
+        if (typeof this.maxDatagramSize === 'undefined')
+            // the kernel rejects datagrams bigger than this (EMSGSIZE)
+            this.maxDatagramSize = this.socket.getSendBufferSize() - 32
+
+        let datagram = this.pendingDatagrams[this.pendingDatagrams.length - 1]
+        if (!datagram || datagram.port !== port || datagram.groups !== groups ||
+                datagram.length + paddedLength > this.maxDatagramSize) {
+            datagram = { port, groups, data: [], length: 0, callbacks: [] }
+            this.pendingDatagrams.push(datagram)
+        }
+        datagram.data.push(...msg)
+        if (paddedLength > length)
+            datagram.data.push(Buffer.alloc(paddedLength - length))
+        datagram.length += paddedLength
+        datagram.callbacks.push(callback)
+
+        if (!this.corked && typeof this.coalesceTimer === 'undefined')
+            this.coalesceTimer = setTimeout(() => {
+                this.coalesceTimer = undefined
+                if (!this.corked) this.flush()
+            }, this.coalesceWindow)
+    }
+
     /**
      * Sends a message with the REQUEST and ACK flags set,
      * and waits for a reply for the same sequence number.
@@ -220,9 +469,12 @@ export class NetlinkSocket extends EventEmitter {
      */
     request(
         type: number,
-        data: Uint8Array | Uint8Array[],
+        data: StreamData,
         options?: NetlinkSendOptions & RequestOptions
     ): Promise<[NetlinkMessage[], MessageInfo]> {
+        if (this.nativeRequests && !this.corked && typeof this.coalesceWindow === 'undefined' &&
+                !(options && (typeof options.seq !== 'undefined' || typeof options.localPort !== 'undefined')))
+            return this.nativeRequest(type, data, options)
         const flags = Number(options && options.flags) | Flags.REQUEST | Flags.ACK
         let seq: number
         let timeout: NodeJS.Timeout
@@ -242,6 +494,314 @@ export class NetlinkSocket extends EventEmitter {
             x.then(x => (x[0].length && !checkError(x[0][0])) ? x : [[], x[1]])
     }
 
+    /**
+     * {@link request} through {@link RawNetlinkSocket.request}. The
+     * replies end with the ACK (or DONE for dumps), which is removed.
+     */
+    protected nativeRequest(
+        type: number,
+        data: StreamData,
+        options?: NetlinkSendOptions & RequestOptions
+    ): Promise<[NetlinkMessage[], MessageInfo]> {
+        const flags = (options && options.flags) || 0
+        const msg = (typeof data === 'function') ?
+            [ serializeMessage({ type, flags, seq: 0, port: 0, data }) as Uint8Array ] :
+            formatMessage({ type, flags, seq: 0, port: 0, data })
+        const check = !(options && options.checkError === false)
+        return new Promise((resolve, reject) => {
+            const ref = !this.referenced && !this.pendingRequests
+            this.socket.request(msg, options, (error, replies, rinfo) => {
+                if (!--this.nativePending && !this.referenced && !this.pendingRequests && !this.closed)
+                    this.socket.unref()
+                if (error) return reject(error)
+                try {
+                    const msgs = parseMessages(replies!)
+                    const last = msgs[msgs.length - 1]
+                    if (last.type === MessageType.DONE) {
+                        msgs.pop()
+                        const ack = check && parseDoneError(last)
+                        if (ack) throw new NetlinkError(ack)
+                    } else if (msgs.length > 1) {
+                        // replies followed by the ACK
+                        msgs.pop()
+                        check && checkError(last)
+                    }
+                    resolve((msgs.length && check && checkError(msgs[0])) ? [[], rinfo!] : [msgs, rinfo!])
+                } catch (e) {
+                    reject(e)
+                }
+            })
+            ref && this.socket.ref()
+            this.nativePending++
+        })
+    }
+
+    /**
+     * Sends many messages (such as mutations) in a pipelined way,
+     * keeping at most `window` of them in flight, and reports
+     * the ones that failed.
+     *
+     * Messages are sent without the ACK flag, so the kernel only
+     * replies to the ones that fail. To know when a group of
+     * messages has been processed, each group is followed by a
+     * NOOP message with the ACK flag (a barrier): since the kernel
+     * processes the messages of a socket in order, any errors for
+     * the group arrive before the barrier is acknowledged. Groups
+     * are corked (see {@link cork}) so that they're packed into few
+     * datagrams.
+     *
+     * Messages are pulled from `messages` as the window allows,
+     * so it can be a generator producing them on the fly.
+     *
+     * @param messages Messages to send
+     * @param options Options
+     * @returns Promise that resolves, when all messages have been
+     * processed, with the failed ones (ordered by index). It only
+     * rejects if the timeout expires or `messages` throws.
+     */
+    bulk(messages: Iterable<BulkMessage>, options?: BulkOptions): Promise<BulkFailure[]> {
+        const window = Math.max((options && options.window) || 1024, 1)
+        const groupSize = Math.max(window >> 2, 1)
+        const iterator = messages[Symbol.iterator]()
+        const failures: BulkFailure[] = []
+        const groups: Set<number[]> = new Set()
+        let inFlight = 0, index = 0, exhausted = false, finished = false
+        let timeout: NodeJS.Timeout | undefined
+
+        return new Promise((resolve, reject) => {
+            const finish = (error?: Error) => {
+                if (finished) return
+                finished = true
+                if (typeof timeout !== 'undefined')
+                    clearTimeout(timeout)
+                groups.forEach(seqs => seqs.forEach(seq => this.dropRef(seq)))
+                groups.clear()
+                error ? reject(error) : resolve(failures.sort((a, b) => a.index - b.index))
+            }
+            const fail = (index: number, error: Error) => {
+                finished || failures.push({ index, error })
+            }
+
+            const sendGroup = () => {
+                const seqs: number[] = []
+                const complete = () => {
+                    if (!groups.delete(seqs)) return
+                    seqs.forEach(seq => this.dropRef(seq))
+                    inFlight -= seqs.length - 1
+                    pump()
+                }
+                groups.add(seqs)
+                this.cork()
+                try {
+                    while (seqs.length < groupSize) {
+                        const next = iterator.next()
+                        if (next.done) {
+                            exhausted = true
+                            break
+                        }
+                        const i = index++
+                        const { type, data, flags } = next.value
+                        const seq = this.makeRef(this.generateSeq(), (err, msg) => {
+                            try {
+                                msg && msg.length && checkError(msg[0])
+                            } catch (e) {
+                                fail(i, e as Error)
+                            }
+                        })
+                        seqs.push(seq)
+                        try {
+                            this.send(type, data, { seq, flags: Number(flags) | Flags.REQUEST }, error => {
+                                error && fail(i, error)
+                            })
+                        } catch (e) {
+                            fail(i, e as Error)
+                        }
+                    }
+                    if (!seqs.length) {
+                        groups.delete(seqs)
+                        return
+                    }
+                    // the group is done when the barrier is acknowledged (or couldn't be sent)
+                    const barrier = this.makeRef(this.generateSeq(), complete)
+                    seqs.push(barrier)
+                    inFlight += seqs.length - 1
+                    this.send(MessageType.NOOP, [], { seq: barrier, flags: Flags.REQUEST | Flags.ACK }, error => {
+                        error && complete()
+                    })
+                } finally {
+                    this.uncork()
+                }
+            }
+
+            const pump = () => {
+                try {
+                    while (!finished && !exhausted && inFlight + groupSize <= window)
+                        sendGroup()
+                } catch (e) {
+                    return finish(e as Error)
+                }
+                if (exhausted && !inFlight)
+                    finish()
+            }
+
+            if (options && options.timeout)
+                timeout = setTimeout(() => finish(Error('Timeout has been reached')), options.timeout)
+            pump()
+        })
+    }
+
+    /**
+     * Sends a dump request (with the REQUEST, ACK and DUMP flags
+     * set), and returns an iterator yielding the replies as they
+     * arrive, one array of messages per datagram (the final DONE
+     * message is not included). Unlike {@link request}, replies
+     * aren't accumulated in memory: if the consumer falls behind,
+     * reading from the socket is paused (which affects any other
+     * traffic on it) until it catches up.
+     *
+     * The request is sent when iteration starts. If the kernel
+     * rejects the request or the dump fails, the iterator throws
+     * a {@link NetlinkError}. Breaking out of the loop early (or
+     * a timeout) discards the rest of the replies: they're dropped
+     * as they arrive, until the kernel ends the dump.
+     *
+     * @param type Message type
+     * @param data Message payload
+     * @param options Options
+     */
+    async *dump(
+        type: number,
+        data: StreamData,
+        options?: NetlinkSendOptions & DumpOptions
+    ): AsyncGenerator<[NetlinkMessage[], MessageInfo], void, undefined> {
+        const flags = Number(options && options.flags) | Flags.REQUEST | Flags.ACK | FlagsGet.DUMP
+        const highWaterMark = (options && options.highWaterMark) || 16
+        const stream: DumpStream = { chunks: [], done: false, finished: false, paused: false, highWaterMark }
+        const seq = this.send(type, data, { ...options, flags }, error => {
+            if (!error) return
+            stream.finished = true
+            this.endStream(stream, error)
+        })
+        if (this.requests.has(seq) || this.streams.has(seq) || this.draining.has(seq))
+            throw Error('Sequence number is already being waited for')
+        if (!this.referenced && !this.pendingRequests)
+            this.socket.ref()
+        this.streams.set(seq, stream)
+        let timeout: NodeJS.Timeout | undefined
+        if (options && options.timeout)
+            timeout = setTimeout(() => this.endStream(stream, Error('Timeout has been reached')), options.timeout)
+
+        try {
+            while (true) {
+                const chunk = stream.chunks.shift()
+                if (chunk) {
+                    if (stream.paused && stream.chunks.length <= highWaterMark / 2) {
+                        stream.paused = false
+                        this.resumeReading()
+                    }
+                    yield chunk
+                } else if (stream.error) {
+                    throw stream.error
+                } else if (stream.done) {
+                    return
+                } else {
+                    await new Promise<void>(resolve => stream.wake = resolve)
+                }
+            }
+        } finally {
+            (typeof timeout !== 'undefined') && clearTimeout(timeout)
+            this.streams.delete(seq)
+            // the kernel keeps sending the rest of an abandoned dump
+            if (!stream.finished && !this.closed)
+                this.draining.add(seq)
+            if (stream.paused)
+                this.resumeReading()
+            if (!this.referenced && !this.pendingRequests && !this.closed)
+                this.socket.unref()
+        }
+    }
+
+    /**
+     * Passes replies for running dumps to their streams, and
+     * returns the rest of the messages.
+     */
+    private feedStreams(msgs: NetlinkMessage[], rinfo: MessageInfo): NetlinkMessage[] {
+        const rest: NetlinkMessage[] = []
+        const chunks: Map<DumpStream, NetlinkMessage[]> = new Map()
+        for (const msg of msgs) {
+            const stream = this.streams.get(msg.seq)
+            if (!stream || (msg.flags & Flags.REQUEST)) {
+                rest.push(msg)
+                continue
+            }
+            if (msg.type === MessageType.DONE || msg.type === MessageType.ERROR)
+                stream.finished = true
+            if (stream.done) continue
+            if (msg.type === MessageType.DONE) {
+                const ack = parseDoneError(msg)
+                this.endStream(stream, ack && new NetlinkError(ack))
+            } else if (msg.type === MessageType.ERROR) {
+                try {
+                    checkError(msg)
+                    this.endStream(stream)
+                } catch (e) {
+                    this.endStream(stream, e as Error)
+                }
+            } else {
+                chunks.has(stream) ? chunks.get(stream)!.push(msg) : chunks.set(stream, [msg])
+            }
+        }
+        chunks.forEach((chunk, stream) => {
+            // put the chunk before a possible error / end (it's already set)
+            stream.chunks.push([chunk, rinfo])
+            if (!stream.paused && stream.chunks.length >= stream.highWaterMark) {
+                stream.paused = true
+                this.pauseReading()
+            }
+            this.wakeStream(stream)
+        })
+        return rest
+    }
+
+    /** Discards replies to abandoned dumps, and returns the rest of the messages */
+    private drain(msgs: NetlinkMessage[]): NetlinkMessage[] {
+        return msgs.filter(msg => {
+            if (!this.draining.has(msg.seq) || (msg.flags & Flags.REQUEST))
+                return true
+            if (msg.type === MessageType.DONE || msg.type === MessageType.ERROR)
+                this.draining.delete(msg.seq)
+            return false
+        })
+    }
+
+    private endStream(stream: DumpStream, error?: Error) {
+        if (stream.done) return
+        stream.done = true
+        stream.error = error
+        this.wakeStream(stream)
+    }
+
+    private wakeStream(stream: DumpStream) {
+        const wake = stream.wake
+        stream.wake = undefined
+        wake && wake()
+    }
+
+    protected pauseReading() {
+        if (this.pauseCount++ === 0 && !this.closed)
+            this.socket.pause()
+    }
+
+    protected resumeReading() {
+        if (--this.pauseCount === 0 && !this.closed)
+            this.socket.resume()
+    }
+
+    /** Number of requests and dumps waiting for replies */
+    protected get pendingRequests() {
+        return this.requests.size + this.streams.size + this.nativePending
+    }
+
     /**
      * If true is passed, the socket will be kept referenced
      * (preventing the event loop from exiting) even when there
@@ -252,13 +812,13 @@ export class NetlinkSocket extends EventEmitter {
      */
     ref(ref?: boolean) {
         this.referenced = ref !== false
-        if (!this.requests.size) {
+        if (!this.pendingRequests) {
             this.referenced ? this.socket.ref() : this.socket.unref()
         }
     }
 
     protected makeRef(seq: number, callback: (err: Error|null, msg?: NetlinkMessage[], rinfo?: MessageInfo) => void) {
-        if (!this.referenced && !this.requests.size)
+        if (!this.referenced && !this.pendingRequests)
             this.socket.ref()
         if (this.requests.has(seq))
             throw Error('Sequence number is already being waited for')
@@ -310,7 +870,9 @@ export class NetlinkSocket extends EventEmitter {
         if (!this.requests.has(seq))
             throw Error('Should never happen')
         this.requests.delete(seq)
-        if (!this.referenced && !this.requests.size)
+        // discard an unfinished reply (i.e. on timeout)
+        this.multipart.delete(seq)
+        if (!this.referenced && !this.pendingRequests)
             this.socket.unref()
     }
 
@@ -332,6 +894,62 @@ export class NetlinkSocket extends EventEmitter {
         return this.socket.dropMembership(group)
     }
 
+    /** Sets an integer `SOL_NETLINK` socket option, see {@link RawNetlinkSocket.setNetlinkOption} */
+    setNetlinkOption(option: Attributes, value: number | boolean) {
+        return this.socket.setNetlinkOption(option, value)
+    }
+
+    /** Returns the value of an integer `SOL_NETLINK` socket option */
+    getNetlinkOption(option: Attributes): number {
+        return this.socket.getNetlinkOption(option)
+    }
+
+    /**
+     * Like {@link setNetlinkOption}, but returns false instead of
+     * throwing if the kernel doesn't support the option
+     */
+    trySetNetlinkOption(option: Attributes, value: number | boolean): boolean {
+        try {
+            this.socket.setNetlinkOption(option, value)
+            return true
+        } catch (e) {
+            if ((e as any).errno === constants.errno.ENOPROTOOPT)
+                return false
+            throw e
+        }
+    }
+
+    /**
+     * Attaches a socket filter, see {@link RawNetlinkSocket.attachFilter}.
+     * Rules are compiled with {@link compileFilter}, accepting replies
+     * addressed to our port by default.
+     */
+    attachFilter(filter: Uint8Array | FilterRule[], options?: FilterOptions) {
+        if (filter instanceof Array)
+            filter = compileFilter(filter, { port: this.socket.address().port, ...options })
+        return this.socket.attachFilter(filter)
+    }
+
+    /** Removes the attached socket filter */
+    detachFilter() {
+        return this.socket.detachFilter()
+    }
+
+    /** Prevents the socket filter from being changed or removed */
+    lockFilter() {
+        return this.socket.lockFilter()
+    }
+
+    /** Starts capturing traffic into a pcap file, see {@link RawNetlinkSocket.startCapture} */
+    startCapture(path: string, options?: CaptureOptions) {
+        return this.socket.startCapture(path, options)
+    }
+
+    /** Stops the running capture, see {@link RawNetlinkSocket.stopCapture} */
+    stopCapture(): CaptureStats | undefined {
+        return this.socket.stopCapture()
+    }
+
     /** Returns the `SO_RCVBUF` socket receive buffer size in bytes */
     getRecvBufferSize(): number {
         return this.socket.getRecvBufferSize()
@@ -363,15 +981,42 @@ export class NetlinkSocket extends EventEmitter {
  */
 export function checkError(x: NetlinkMessage) {
     if (x.type !== MessageType.ERROR) return
-    const { errno } = parseError(x.data, x.flags)
-    if (errno === 0) return true
-
-    let code = errno.toString()
-    try {
-        code = getSystemErrorName(errno)
-    } catch (e) {}
-    // FIXME: do this correctly
-    throw Error(`Request rejected: ${code}`)
+    const ack = parseError(x.data, x.flags)
+    if (ack.errno === 0) return true
+    throw new NetlinkError(ack)
+}
+
+/**
+ * Error thrown by {@link checkError} when a request is rejected.
+ * If extended ACKs are enabled (see {@link NetlinkSocketOptions.extendedAck}),
+ * the kernel's explanation is included in the message.
+ */
+export class NetlinkError extends Error {
+    /** error number (positive) */
+    readonly errno: number
+    /** string constant corresponding to {@link errno} */
+    readonly code: string
+    /** parsed ERROR message, including extended ACK attributes */
+    readonly ack: NetlinkErrorMessage
+
+    constructor(ack: NetlinkErrorMessage) {
+        let code = (-ack.errno).toString()
+        try {
+            code = getSystemErrorName(ack.errno)
+        } catch (e) {}
+        let message = `Request rejected: ${code}`
+        if (typeof ack.message !== 'undefined')
+            message += `: ${ack.message}`
+        if (typeof ack.offset !== 'undefined')
+            message += ` (at offset ${ack.offset})`
+        if (typeof ack.missingType !== 'undefined')
+            message += ` (missing attribute ${ack.missingType})`
+        super(message)
+        this.name = 'NetlinkError'
+        this.errno = -ack.errno
+        this.code = code
+        this.ack = { ...ack, code }
+    }
 }
 
 export function createNetlink(
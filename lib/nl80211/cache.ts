@@ -0,0 +1,507 @@
+/**
+ * This module implements a per-radio cache of the nl80211 interfaces,
+ * stations and scan results, kept up to date from multicast events.
+ * @module
+ */
+
+import { MessageInfo, RawNetlinkSocketOptions } from '../raw'
+import { NetlinkSocketOptions, NetlinkError } from '../netlink'
+import { SyncedCache } from '../cache'
+import { GenericNetlinkMessage, GenericNetlinkSocketOptions } from '../genl/genl'
+import { Commands, Message, Bss, parseBssLazy, parseMessageLazy } from './structs'
+import { Nl80211Socket, Nl80211MulticastGroups, NL80211_GENL_NAME, createNl80211 } from './nl80211'
+import { DumpKind, DumpSelection, DumpMerger, DumpedObject, MessageField, StationInfoField, BssField, DUMP_COMMANDS } from './dump'
+
+export interface Nl80211CacheOptions {
+    /** Fields to keep from the wiphys (default: `wiphy` and `wiphyName`) */
+    wiphyFields?: MessageField[]
+    /** Fields to keep from the interfaces (default: all of them); `wiphy` and `ifindex` are always kept */
+    interfaceFields?: MessageField[]
+    /**
+     * Fields to keep from the stations (default: `mac` and `staInfo`).
+     * Changes to any of them are reported, so leave out the ones
+     * that change on every dump (like `generation`).
+     */
+    stationFields?: MessageField[]
+    /**
+     * Fields to keep from the `staInfo` of stations (default: all
+     * of them). Since `inactiveTime` and `connectedTime` change all
+     * the time, select only the counters of interest.
+     */
+    stationInfoFields?: StationInfoField[]
+    /** Keep the scan results too (default: true) */
+    scan?: boolean
+    /** Fields to keep from the `bss` of scan results (default: all of them) */
+    bssFields?: BssField[]
+    /**
+     * If set, dump the stations every this many milliseconds, since
+     * the kernel doesn't notify changes to their counters.
+     */
+    stationPollInterval?: number
+}
+
+/** State of a radio (wiphy) */
+export interface Radio {
+    wiphy: number
+    /** Selected fields of the wiphy, decoded when first read */
+    phy?: Message
+    /** Interfaces of the radio, by ifindex */
+    interfaces: Map<number, Message>
+    /** Stations on the interfaces of the radio, by key */
+    stations: Map<string, Nl80211CacheEntry>
+    /** Scan results of the interfaces of the radio, by key */
+    bsses: Map<string, Nl80211CacheEntry>
+}
+
+export type Nl80211CacheEntryKind = 'station' | 'bss'
+
+/** Station or scan result */
+export interface Nl80211CacheEntry {
+    kind: Nl80211CacheEntryKind
+    /** `<ifindex>/<MAC address or BSSID in hex>` */
+    key: string
+    wiphy: number
+    ifindex: number
+    /** Selected fields, decoded when first read */
+    message: Message
+    /** Selected fields of `bss` (for scan results), decoded when first read */
+    bss?: Bss
+    /** Selected attributes in wire format, used to detect changes */
+    raw: Buffer
+}
+
+/** Changes since the last call to {@link Nl80211Cache.takeDelta} */
+export interface Nl80211CacheDelta {
+    /** Entries that appeared or changed (current value) */
+    changed: Nl80211CacheEntry[]
+    /** Entries that are gone (last value) */
+    removed: Nl80211CacheEntry[]
+}
+
+interface EventMap {
+    /**
+     * Emitted for every change to a station or scan result. `before` is
+     * undefined for new entries, `after` is undefined for removed ones.
+     */
+    change(before: Nl80211CacheEntry | undefined, after: Nl80211CacheEntry | undefined): void
+    /** Emitted after a resync (caused by lost notifications, interface or wiphy changes) completes */
+    resync(): void
+    /** Emitted when a resync or a refresh fails, or re-emitted from the socket */
+    error(err: Error): void
+    /** Emitted when a notification can't be parsed; it is ignored */
+    invalid(err: any, msg: GenericNetlinkMessage, rinfo: MessageInfo): void
+}
+
+/** Errors that mean an interface has no stations or scan results to dump */
+const IGNORED_ERRORS = new Set([ 'EOPNOTSUPP', 'ENODEV', 'ENETDOWN', 'EINVAL' ])
+
+const DUMP_KINDS: { [K in Nl80211CacheEntryKind]: DumpKind } = { station: 'station', bss: 'scan' }
+
+/** Mutable state of the cache, swapped as a whole on resync */
+class CacheState {
+    radios: Map<number, Radio> = new Map()
+    /** Wiphy of each interface, by ifindex */
+    interfaces: Map<number, number> = new Map()
+
+    radio(wiphy: number): Radio {
+        let radio = this.radios.get(wiphy)
+        if (!radio)
+            this.radios.set(wiphy, radio = { wiphy, interfaces: new Map(), stations: new Map(), bsses: new Map() })
+        return radio
+    }
+
+    entries(radio: Radio, kind: Nl80211CacheEntryKind) {
+        return kind === 'station' ? radio.stations : radio.bsses
+    }
+}
+
+/**
+ * Cache of the wireless interfaces, their stations and scan results,
+ * grouped by radio. It is populated with dumps (see {@link DumpMerger},
+ * so only the selected attributes are kept and decoded) and then
+ * updated from events:
+ *
+ *  - `mlme` station events add and remove stations,
+ *  - `scan` results events cause the scan results of that interface
+ *    (and only that one) to be dumped again,
+ *  - `config` interface and wiphy events cause a resync.
+ *
+ * Station counters aren't notified by the kernel, so they're only
+ * updated by {@link pollStations} (or `stationPollInterval`); an entry
+ * only changes if its selected attributes did, compared in wire
+ * format. Consumers can listen for `change` events or call
+ * {@link takeDelta} periodically to get the accumulated changes.
+ *
+ * Entries must not be modified.
+ */
+export class Nl80211Cache extends SyncedCache<CacheState, GenericNetlinkMessage> {
+    // copy-pasted code for type-safe events
+    emit<E extends keyof EventMap>(event: E, ...args: Parameters<EventMap[E]>) { return super.emit(event, ...args) }
+    on<E extends keyof EventMap>(event: E, listener: EventMap[E]) { return super.on(event, listener) }
+    once<E extends keyof EventMap>(event: E, listener: EventMap[E]) { return super.once(event, listener) }
+    off<E extends keyof EventMap>(event: E, listener: EventMap[E]) { return super.off(event, listener) }
+    addListener<E extends keyof EventMap>(event: E, listener: EventMap[E]) { return super.addListener(event, listener) }
+    removeListener<E extends keyof EventMap>(event: E, listener: EventMap[E]) { return super.removeListener(event, listener) }
+
+    readonly socket: Nl80211Socket
+    readonly scan: boolean
+    private readonly selections: { [K in DumpKind]: DumpSelection }
+
+    private joined = false
+    /** Refreshes in progress, and whether they have to be repeated, by `<kind>/<ifindex>` */
+    private refreshes: Map<string, Promise<void>> = new Map()
+    private refreshRequested: Set<string> = new Set()
+    /** Entries changed since the last delta, with their value back then */
+    private delta: Map<string, [Nl80211CacheEntry | undefined, Nl80211CacheEntry | undefined]> = new Map()
+    private pollTimer?: NodeJS.Timeout
+    private readonly listeners_: { message: any, error: any }
+
+    /**
+     * Creates a cache on top of an existing socket, which is closed
+     * along with the cache. Call {@link sync} to populate it (or use
+     * {@link createNl80211Cache}).
+     */
+    constructor(socket: Nl80211Socket, options?: Nl80211CacheOptions) {
+        super(new CacheState())
+        this.socket = socket
+        this.scan = !(options && options.scan === false)
+        const interfaceFields = options && options.interfaceFields
+        this.selections = {
+            wiphy: { fields: (options && options.wiphyFields) || [ 'wiphy', 'wiphyName' ] },
+            interface: { fields: interfaceFields && [ ...interfaceFields, 'wiphy', 'ifindex' ] },
+            station: {
+                fields: (options && options.stationFields) || [ 'mac', 'staInfo' ],
+                stationInfoFields: options && options.stationInfoFields,
+            },
+            scan: { fields: [ 'bss' ], bssFields: options && options.bssFields },
+        }
+        this.listeners_ = {
+            message: this._receive.bind(this),
+            error: this._error.bind(this),
+        }
+        this.socket.on('message', this.listeners_.message)
+        this.socket.socket.socket.on('error', this.listeners_.error)
+        const interval = options && options.stationPollInterval
+        if (interval) {
+            this.pollTimer = setInterval(() => {
+                this.pollStations().catch(error => this.emit('error', error))
+            }, interval)
+            this.pollTimer.unref()
+        }
+    }
+
+    /** Stops listening and closes the socket */
+    close() {
+        this.closed = true
+        if (typeof this.pollTimer !== 'undefined')
+            clearInterval(this.pollTimer)
+        this.socket.off('message', this.listeners_.message)
+        this.socket.socket.socket.off('error', this.listeners_.error)
+        this.socket.detach()
+        this.socket.socket.socket.close()
+    }
+
+    // Lookups
+
+    get radios(): ReadonlyMap<number, Radio> {
+        return this.state.radios
+    }
+
+    /** Returns the radio an interface belongs to */
+    getRadio(ifindex: number): Radio | undefined {
+        const wiphy = this.state.interfaces.get(ifindex)
+        return typeof wiphy === 'number' ? this.state.radios.get(wiphy) : undefined
+    }
+
+    getInterface(ifindex: number): Message | undefined {
+        const radio = this.getRadio(ifindex)
+        return radio && radio.interfaces.get(ifindex)
+    }
+
+    getStation(ifindex: number, mac: Uint8Array): Nl80211CacheEntry | undefined {
+        const radio = this.getRadio(ifindex)
+        return radio && radio.stations.get(`${ifindex}/${Buffer.from(mac).toString('hex')}`)
+    }
+
+    getBss(ifindex: number, bssid: Uint8Array): Nl80211CacheEntry | undefined {
+        const radio = this.getRadio(ifindex)
+        return radio && radio.bsses.get(`${ifindex}/${Buffer.from(bssid).toString('hex')}`)
+    }
+
+    /**
+     * Returns the stations and scan results that changed since the
+     * previous call (the initial sync doesn't count as a change). An
+     * entry that changed many times is only reported once, with its
+     * current value.
+     */
+    takeDelta(): Nl80211CacheDelta {
+        const delta: Nl80211CacheDelta = { changed: [], removed: [] }
+        for (const [before, after] of this.delta.values()) {
+            if (after)
+                delta.changed.push(after)
+            else if (before)
+                delta.removed.push(before)
+        }
+        this.delta.clear()
+        return delta
+    }
+
+    // Synchronization
+
+    /**
+     * Dumps the stations of every interface, applying the changes.
+     * Only the selected attributes are decoded, and only for the
+     * stations that changed.
+     */
+    async pollStations(): Promise<void> {
+        await Promise.all([...this.state.interfaces.keys()].map(ifindex => this.refresh('station', ifindex)))
+    }
+
+    /** Joins the multicast groups (their ids have to be resolved) */
+    protected async prepareSync() {
+        if (this.joined) return
+        const groups = [ Nl80211MulticastGroups.CONFIG, Nl80211MulticastGroups.MLME ]
+        if (this.scan)
+            groups.push(Nl80211MulticastGroups.SCAN)
+        for (const group of groups) {
+            const id = await this.socket.socket.families.resolveGroup(NL80211_GENL_NAME, group)
+            if (typeof id === 'undefined')
+                throw Error(`nl80211 multicast group "${group}" not available`)
+            this.socket.socket.socket.addMembership(id)
+        }
+        this.joined = true
+    }
+
+    /**
+     * Dumps the wiphys, interfaces, and the stations and scan results
+     * of every interface into a new state, requesting a new pass if a
+     * dump was interrupted
+     */
+    protected async dumpState(): Promise<CacheState> {
+        const state = new CacheState()
+        const [ phys, physInterrupted ] = await this.dump('wiphy', { splitWiphyDump: true })
+        for (const obj of phys)
+            state.radio(Number(obj.key)).phy = obj.message
+        const [ interfaces, interfacesInterrupted ] = await this.dump('interface', {})
+        for (const obj of interfaces) {
+            // interfaces without a netdev (like P2P devices) are left out
+            const { wiphy, ifindex } = obj.message
+            if (typeof wiphy !== 'number' || typeof ifindex !== 'number') continue
+            state.radio(wiphy).interfaces.set(ifindex, obj.message)
+            state.interfaces.set(ifindex, wiphy)
+        }
+        if (physInterrupted || interfacesInterrupted)
+            this.resyncRequested = true
+        const kinds: Nl80211CacheEntryKind[] = this.scan ? [ 'station', 'bss' ] : [ 'station' ]
+        for (const [ifindex, wiphy] of state.interfaces) {
+            for (const kind of kinds) {
+                if (this.resyncRequested) return state
+                const [ entries, interrupted ] = await this.dumpEntries(kind, ifindex, wiphy)
+                if (interrupted)
+                    this.resyncRequested = true
+                const map = state.entries(state.radio(wiphy), kind)
+                entries.forEach((entry, key) => map.set(key, entry))
+            }
+        }
+        return state
+    }
+
+    /** Dumps and assembles objects, returning whether the dump was interrupted */
+    private async dump(kind: DumpKind, msg: Message): Promise<[DumpedObject[], boolean]> {
+        const merger = new DumpMerger(kind, this.selections[kind])
+        const objs: DumpedObject[] = []
+        for await (const omsg of this.socket.dumpRaw(DUMP_COMMANDS[kind], msg)) {
+            for (const x of omsg) {
+                const obj = merger.push(x.data, x.flags)
+                obj && objs.push(obj)
+            }
+        }
+        const last = merger.end()
+        last && objs.push(last)
+        return [ objs, merger.interrupted ]
+    }
+
+    private async dumpEntries(
+        kind: Nl80211CacheEntryKind, ifindex: number, wiphy: number
+    ): Promise<[Map<string, Nl80211CacheEntry>, boolean]> {
+        const entries: Map<string, Nl80211CacheEntry> = new Map()
+        let objs: DumpedObject[], interrupted: boolean
+        try {
+            [ objs, interrupted ] = await this.dump(DUMP_KINDS[kind], { ifindex })
+        } catch (e) {
+            if (e instanceof NetlinkError && IGNORED_ERRORS.has(e.code))
+                return [ entries, false ]
+            throw e
+        }
+        for (const obj of objs) {
+            const entry: Nl80211CacheEntry = { kind, key: obj.key, wiphy, ifindex, message: obj.message, raw: obj.raw }
+            if (kind === 'bss' && obj.message.bss)
+                entry.bss = parseBssLazy(obj.message.bss)
+            entries.set(obj.key, entry)
+        }
+        return [ entries, interrupted ]
+    }
+
+    /**
+     * Dumps the stations or scan results of an interface again, and
+     * applies the differences. If a refresh of them is in progress,
+     * another one is done after it.
+     */
+    private refresh(kind: Nl80211CacheEntryKind, ifindex: number): Promise<void> {
+        const id = `${kind}/${ifindex}`
+        const current = this.refreshes.get(id)
+        if (current) {
+            this.refreshRequested.add(id)
+            return current
+        }
+        const run = async () => {
+            do {
+                this.refreshRequested.delete(id)
+                const state = this.state
+                const wiphy = state.interfaces.get(ifindex)
+                if (typeof wiphy === 'undefined' || this.closed) return
+                const [ entries, interrupted ] = await this.dumpEntries(kind, ifindex, wiphy)
+                // a resync happened meanwhile, which dumped them too
+                if (this.state !== state || this.syncing) return
+                this.applyEntries(kind, ifindex, wiphy, entries, !interrupted)
+                if (interrupted)
+                    this.refreshRequested.add(id)
+            } while (this.refreshRequested.has(id))
+        }
+        const promise = run().finally(() => this.refreshes.delete(id))
+        this.refreshes.set(id, promise)
+        return promise
+    }
+
+    /** Replaces the entries of an interface, emitting the changes */
+    private applyEntries(
+        kind: Nl80211CacheEntryKind, ifindex: number, wiphy: number,
+        entries: Map<string, Nl80211CacheEntry>, prune: boolean
+    ) {
+        const radio = this.state.radios.get(wiphy)
+        if (!radio) return
+        const map = this.state.entries(radio, kind)
+        if (prune) {
+            for (const [key, before] of map) {
+                if (before.ifindex === ifindex && !entries.has(key)) {
+                    map.delete(key)
+                    this.changed(before, undefined)
+                }
+            }
+        }
+        for (const [key, after] of entries) {
+            const before = map.get(key)
+            if (before && before.raw.equals(after.raw)) continue
+            map.set(key, after)
+            this.changed(before, after)
+        }
+    }
+
+    /** Swaps the state, emitting changes (nothing is emitted for the first sync) */
+    protected replaceState(state: CacheState) {
+        const old = this.state
+        this.state = state
+        if (!old.radios.size) return
+        const collect = (x: CacheState, kind: Nl80211CacheEntryKind) => {
+            const entries: Map<string, Nl80211CacheEntry> = new Map()
+            x.radios.forEach(radio => x.entries(radio, kind).forEach((entry, key) => entries.set(key, entry)))
+            return entries
+        }
+        for (const kind of [ 'station', 'bss' ] as Nl80211CacheEntryKind[]) {
+            const before = collect(old, kind), after = collect(state, kind)
+            for (const [key, x] of before) {
+                const y = after.get(key)
+                if (!y) this.changed(x, undefined)
+                // keep the old entry (and what was decoded from it) if nothing changed
+                else if (x.raw.equals(y.raw)) state.entries(state.radio(y.wiphy), kind).set(key, x)
+                else this.changed(x, y)
+            }
+            for (const [key, y] of after)
+                if (!before.has(key)) this.changed(undefined, y)
+        }
+    }
+
+    private changed(before: Nl80211CacheEntry | undefined, after: Nl80211CacheEntry | undefined) {
+        const entry = (before || after)!
+        const id = `${entry.kind}/${entry.key}`
+        const recorded = this.delta.get(id)
+        if (recorded)
+            recorded[1] = after
+        else
+            this.delta.set(id, [ before, after ])
+        this.emit('change', before, after)
+    }
+
+    protected applyMessage(x: GenericNetlinkMessage, rinfo: MessageInfo) {
+        switch (x.cmd) {
+            case Commands.NEW_STATION:
+            case Commands.DEL_STATION:
+                break
+            case Commands.NEW_SCAN_RESULTS:
+                if (this.scan)
+                    this.refreshFromEvent('bss', x, rinfo)
+                return
+            case Commands.NEW_INTERFACE: case Commands.DEL_INTERFACE:
+            case Commands.NEW_WIPHY: case Commands.DEL_WIPHY:
+                return this.resync()
+            default:
+                return
+        }
+        let obj: DumpedObject
+        try {
+            const merger = new DumpMerger('station', this.selections.station)
+            merger.push(x.data)
+            obj = merger.end()!
+        } catch (e) {
+            this.emit('invalid', e, x, rinfo)
+            return
+        }
+        const ifindex = Number(obj.key.split('/')[0])
+        const radio = this.getRadio(ifindex)
+        if (!radio) return
+        const before = radio.stations.get(obj.key)
+        if (x.cmd === Commands.DEL_STATION) {
+            if (!before) return
+            radio.stations.delete(obj.key)
+            this.changed(before, undefined)
+        } else if (!before) {
+            // the event only carries part of the station info; known
+            // stations are left for the next poll to update
+            const after: Nl80211CacheEntry = {
+                kind: 'station', key: obj.key, wiphy: radio.wiphy, ifindex,
+                message: obj.message, raw: obj.raw,
+            }
+            radio.stations.set(obj.key, after)
+            this.changed(undefined, after)
+        }
+    }
+
+    private refreshFromEvent(kind: Nl80211CacheEntryKind, x: GenericNetlinkMessage, rinfo: MessageInfo) {
+        let ifindex: number | undefined
+        try {
+            ifindex = parseMessageLazy(x.data).ifindex
+        } catch (e) {
+            this.emit('invalid', e, x, rinfo)
+            return
+        }
+        if (typeof ifindex === 'number')
+            this.refresh(kind, ifindex).catch(error => this.emit('error', error))
+    }
+}
+
+/**
+ * Creates an nl80211 socket and a cache on top of it, and
+ * waits for the initial sync to complete.
+ */
+export async function createNl80211Cache(
+    options?: Nl80211CacheOptions & GenericNetlinkSocketOptions & NetlinkSocketOptions & RawNetlinkSocketOptions
+): Promise<Nl80211Cache> {
+    const cache = new Nl80211Cache(await createNl80211(options), options)
+    try {
+        await cache.sync()
+    } catch (e) {
+        cache.close()
+        throw e
+    }
+    return cache
+}
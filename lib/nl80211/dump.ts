@@ -0,0 +1,346 @@
+/**
+ * Streaming assembly of the big nl80211 dumps (wiphys, interfaces,
+ * stations and scan results): the parts of split dumps are merged as
+ * they arrive, working on the attributes in wire format, and only the
+ * selected attributes are kept and decoded.
+ * @module
+ */
+
+import { Flags } from '../constants'
+import { readU16, readU32, readU64, writeU16, align, getLazyObject, LazyFields } from '../structs'
+import { Commands, Message, StationInfo, Bss, __LAZY_Message, __LAZY_StationInfo, __LAZY_Bss } from './structs'
+
+// Attribute types (see ./structs)
+const ATTR_WIPHY = 1
+const ATTR_IFINDEX = 3
+const ATTR_MAC = 6
+const ATTR_STA_INFO = 21
+const ATTR_WIPHY_BANDS = 22
+const ATTR_BSS = 47
+const ATTR_WDEV = 153
+const BAND_ATTR_FREQS = 1
+const BAND_ATTR_RATES = 2
+const BSS_BSSID = 1
+
+const ATTR_TYPE_MASK = (1 << 14) - 1
+
+export type MessageField = Exclude<keyof Message, '__unparsed'>
+export type StationInfoField = Exclude<keyof StationInfo, '__unparsed'>
+export type BssField = Exclude<keyof Bss, '__unparsed'>
+
+/**
+ * Kind of dump. Objects are identified by a key, which is:
+ *
+ *  - `wiphy`: the wiphy index
+ *  - `interface`: the wdev id (decimal)
+ *  - `station`: `<ifindex>/<MAC address in hex>`
+ *  - `scan`: `<ifindex>/<BSSID in hex>`
+ */
+export type DumpKind = 'wiphy' | 'interface' | 'station' | 'scan'
+
+/** Command used to dump each kind of object */
+export const DUMP_COMMANDS: { [K in DumpKind]: Commands } = {
+    wiphy: Commands.GET_WIPHY,
+    interface: Commands.GET_INTERFACE,
+    station: Commands.GET_STATION,
+    scan: Commands.GET_SCAN,
+}
+
+/** Attributes to keep from the dumped objects */
+export interface DumpSelection {
+    /** Fields to keep (default: all of them) */
+    fields?: MessageField[]
+    /** Fields to keep from `staInfo` (default: all of them) */
+    stationInfoFields?: StationInfoField[]
+    /** Fields to keep from `bss` (default: all of them) */
+    bssFields?: BssField[]
+}
+
+/** Object assembled from the parts of a dump */
+export interface DumpedObject {
+    /** Identity of the object (see {@link DumpKind}) */
+    key: string
+    /** Selected fields, decoded when first read (see {@link getLazyObject}) */
+    message: Message
+    /**
+     * Selected attributes, merged, in wire format (a copy, not a view
+     * of the received data). Objects dumped with the same selection
+     * are equal if these bytes are.
+     */
+    raw: Buffer
+}
+
+/** Objects completed by a batch of replies (see {@link Nl80211Socket.dumpObjects}) */
+export type DumpedBatch = DumpedObject[] & {
+    /**
+     * A reply so far was flagged with `DUMP_INTR`, so the dump (and
+     * objects merged from its parts) may be inconsistent
+     */
+    interrupted: boolean
+}
+
+/**
+ * Nested attributes whose contents are spread over the parts of a
+ * split dump, by type (`'*'` matches any type). The rest are taken
+ * from the last part carrying them.
+ */
+interface MergeSpec {
+    [type: number]: MergeSpec
+    '*'?: MergeSpec
+}
+
+/**
+ * In split wiphy dumps, every part repeats the wiphy index and name,
+ * and bands are sent a few frequencies at a time.
+ */
+const MERGE_SPECS: { [K in DumpKind]: MergeSpec } = {
+    wiphy: { [ATTR_WIPHY_BANDS]: { '*': { [BAND_ATTR_FREQS]: {}, [BAND_ATTR_RATES]: {} } } },
+    interface: {},
+    station: {},
+    scan: {},
+}
+
+/** Attribute types to keep at some level (all of them if `types` is unset), and selections for nested ones */
+interface Selection {
+    types?: Set<number>
+    nested: Map<number, Selection>
+}
+
+const ALL: Selection = { nested: new Map() }
+
+function compileSelection(table: LazyFields, fields?: string[]): Selection {
+    if (!fields) return { nested: new Map() }
+    const types: Map<string, number> = new Map()
+    Object.keys(table).forEach(type => types.set(table[Number(type)][0], Number(type)))
+    return {
+        types: new Set(fields.map(name => {
+            const type = types.get(name)
+            if (typeof type === 'undefined')
+                throw Error(`Unknown field "${name}"`)
+            return type
+        })),
+        nested: new Map(),
+    }
+}
+
+/** Returns the value bounds of the first attribute of a type in `data[start, end)` */
+function findAttribute(data: Buffer, start: number, end: number, type: number): [number, number] | undefined {
+    for (let offset = start; offset + 4 <= end; ) {
+        const length = readU16.call(data, offset)
+        if (length < 4 || offset + length > end)
+            return
+        if ((readU16.call(data, offset + 2) & ATTR_TYPE_MASK) === type)
+            return [offset + 4, offset + length]
+        offset += align(length)
+    }
+}
+
+function readIfindex(data: Buffer): number {
+    const x = findAttribute(data, 0, data.length, ATTR_IFINDEX)
+    return x && x[1] - x[0] === 4 ? readU32.call(data, x[0]) : 0
+}
+
+const KEYS: { [K in DumpKind]: (data: Buffer) => string | undefined } = {
+    wiphy: data => {
+        const x = findAttribute(data, 0, data.length, ATTR_WIPHY)
+        return x && x[1] - x[0] === 4 ? String(readU32.call(data, x[0])) : undefined
+    },
+    interface: data => {
+        const x = findAttribute(data, 0, data.length, ATTR_WDEV)
+        return x && x[1] - x[0] === 8 ? String(readU64.call(data, x[0])) : undefined
+    },
+    station: data => {
+        const x = findAttribute(data, 0, data.length, ATTR_MAC)
+        return x && `${readIfindex(data)}/${data.toString('hex', x[0], x[1])}`
+    },
+    scan: data => {
+        const bss = findAttribute(data, 0, data.length, ATTR_BSS)
+        const x = bss && findAttribute(data, bss[0], bss[1], BSS_BSSID)
+        return x && `${readIfindex(data)}/${data.toString('hex', x[0], x[1])}`
+    },
+}
+
+const KEY_NAMES: { [K in DumpKind]: string } = {
+    wiphy: 'wiphy', interface: 'wdev', station: 'mac', scan: 'bssid',
+}
+
+/**
+ * Assembles the objects of a dump from its parts, as they arrive.
+ * The parts of an object are sent back to back, so an object is
+ * complete when a part of another object arrives (or the dump ends).
+ *
+ * Parts are merged without decoding them (see {@link MergeSpec}),
+ * and then the selected attributes are copied out; only those are
+ * decoded, and only when read. This also means that the objects
+ * don't keep the received datagrams alive.
+ */
+export class DumpMerger {
+    readonly kind: DumpKind
+    /** Set once a part flagged with `DUMP_INTR` is pushed: the dump may be inconsistent */
+    interrupted: boolean = false
+    private readonly selection: Selection
+    private key?: string
+    private parts: Buffer[] = []
+
+    constructor(kind: DumpKind, selection?: DumpSelection) {
+        this.kind = kind
+        this.selection = compileSelection(__LAZY_Message, selection && selection.fields)
+        if (selection && selection.stationInfoFields)
+            this.selection.nested.set(ATTR_STA_INFO, compileSelection(__LAZY_StationInfo, selection.stationInfoFields))
+        if (selection && selection.bssFields)
+            this.selection.nested.set(ATTR_BSS, compileSelection(__LAZY_Bss, selection.bssFields))
+    }
+
+    /**
+     * Feeds the next part (the payload of a reply).
+     *
+     * @param data Attributes of the part
+     * @param flags Flags of the reply
+     * @returns The object completed by this part, if any
+     */
+    push(data: Buffer, flags: number = 0): DumpedObject | undefined {
+        if (flags & Flags.DUMP_INTR)
+            this.interrupted = true
+        const key = KEYS[this.kind](data)
+        if (typeof key === 'undefined')
+            throw Error(`Invalid message part -- no ${KEY_NAMES[this.kind]}`)
+        const done = (this.parts.length && key !== this.key) ? this.end() : undefined
+        this.key = key
+        this.parts.push(data)
+        return done
+    }
+
+    /** Completes the pending object, if any (call when the dump ends) */
+    end(): DumpedObject | undefined {
+        const parts = this.parts
+        if (!parts.length) return
+        this.parts = []
+        outLength = 0
+        if (parts.length === 1) {
+            selectRange(parts[0], 0, parts[0].length, this.selection)
+        } else {
+            const root = new MergeNode(0)
+            const spec = MERGE_SPECS[this.kind]
+            parts.forEach((data, part) => mergeRange(root, spec, data, 0, data.length, part))
+            selectNode(root, this.selection)
+        }
+        const raw = Buffer.allocUnsafe(outLength)
+        out.copy(raw, 0, 0, outLength)
+        return { key: this.key!, message: getLazyObject(raw, __LAZY_Message), raw }
+    }
+}
+
+// Merging
+
+/** Contents of a nested attribute that is being merged */
+class MergeNode {
+    /** Attributes (including header) or nodes being merged, by type */
+    readonly attrs: Map<number, Buffer[] | MergeNode> = new Map()
+    /** Part that each (non-merged) attribute was last taken from */
+    readonly parts: Map<number, number> = new Map()
+
+    constructor(readonly typeAndFlags: number) {}
+}
+
+function mergeRange(node: MergeNode, spec: MergeSpec, data: Buffer, start: number, end: number, part: number) {
+    for (let offset = start; offset < end; ) {
+        const length = checkAttribute(data, offset, end)
+        const typeAndFlags = readU16.call(data, offset + 2)
+        const type = typeAndFlags & ATTR_TYPE_MASK
+        const childSpec = spec[type] || spec['*']
+        const current = node.attrs.get(type)
+        if (childSpec) {
+            let child = current instanceof MergeNode ? current : undefined
+            if (!child)
+                node.attrs.set(type, child = new MergeNode(typeAndFlags))
+            mergeRange(child, childSpec, data, offset + 4, offset + length, part)
+        } else if (current instanceof Array && node.parts.get(type) === part) {
+            current.push(data.subarray(offset, offset + length))
+        } else {
+            node.attrs.set(type, [ data.subarray(offset, offset + length) ])
+            node.parts.set(type, part)
+        }
+        offset += align(length)
+    }
+}
+
+// Selection (written into a buffer reused across objects)
+
+let out = Buffer.alloc(65536)
+let outLength = 0
+
+function reserve(n: number) {
+    if (outLength + n <= out.length) return
+    const grown = Buffer.alloc(Math.max(out.length * 2, outLength + n))
+    out.copy(grown, 0, 0, outLength)
+    out = grown
+}
+
+function writeAttribute(data: Buffer, start: number, end: number) {
+    const size = align(end - start)
+    reserve(size)
+    data.copy(out, outLength, start, end)
+    out.fill(0, outLength + end - start, outLength + size)
+    outLength += size
+}
+
+function beginNest(typeAndFlags: number): number {
+    reserve(4)
+    writeU16.call(out, typeAndFlags, outLength + 2)
+    return (outLength += 4) - 4
+}
+
+function endNest(header: number) {
+    const length = outLength - header
+    if (length >= 0x10000)
+        throw Error('Maximum attribute length exceeded')
+    writeU16.call(out, length, header)
+}
+
+function checkAttribute(data: Buffer, offset: number, end: number): number {
+    if (end - offset < 4)
+        throw Error('Not enough data')
+    const length = readU16.call(data, offset)
+    if (length < 4 || offset + length > end)
+        throw Error(`Invalid attribute length (${length})`)
+    return length
+}
+
+function selectRange(data: Buffer, start: number, end: number, selection: Selection) {
+    for (let offset = start; offset < end; ) {
+        const length = checkAttribute(data, offset, end)
+        const typeAndFlags = readU16.call(data, offset + 2)
+        const type = typeAndFlags & ATTR_TYPE_MASK
+        if (!selection.types || selection.types.has(type)) {
+            const nested = selection.nested.get(type)
+            if (nested) {
+                const header = beginNest(typeAndFlags)
+                selectRange(data, offset + 4, offset + length, nested)
+                endNest(header)
+            } else {
+                writeAttribute(data, offset, offset + length)
+            }
+        }
+        offset += align(length)
+    }
+}
+
+function selectNode(node: MergeNode, selection: Selection) {
+    for (const [type, value] of node.attrs) {
+        if (selection.types && !selection.types.has(type)) continue
+        const nested = selection.nested.get(type)
+        if (value instanceof MergeNode) {
+            const header = beginNest(value.typeAndFlags)
+            selectNode(value, nested || ALL)
+            endNest(header)
+        } else if (nested) {
+            value.forEach(x => {
+                const header = beginNest(readU16.call(x, 2))
+                selectRange(x, 4, x.length, nested)
+                endNest(header)
+            })
+        } else {
+            value.forEach(x => writeAttribute(x, 0, x.length))
+        }
+    }
+}
@@ -6,17 +6,20 @@
 import { EventEmitter } from 'events'
 
 import { MessageInfo, RawNetlinkSocketOptions } from '../raw'
-import { NetlinkSocket, NetlinkSocketOptions, NetlinkSendOptions, RequestOptions } from '../netlink'
+import { NetlinkSocket, NetlinkSocketOptions, NetlinkSendOptions, RequestOptions, DumpOptions } from '../netlink'
 import { Flags, FlagsGet } from '../constants'
-import { NetlinkMessage, AttrStream } from '../structs'
 import { Commands, Message, formatMessage, parseMessage } from './structs'
-import { GenericNetlinkSocketOptions, GenericNetlinkSocket, GenericNetlinkSendOptions, createGenericNetlink } from '../genl/genl'
+import { DumpKind, DumpSelection, DumpedObject, DumpedBatch, DumpMerger, DUMP_COMMANDS } from './dump'
+import { GenericNetlinkSocketOptions, GenericNetlinkSocket, GenericNetlinkSendOptions, GenericNetlinkMessage, createGenericNetlink, getSharedGenericNetlink } from '../genl/genl'
 import { genl } from '..'
 
 // Based on <linux/nl80211.h> at 14f34e3
 
 export const NL80211_GENL_NAME = "nl80211"
 
+/** Times {@link Nl80211Socket.getPhys} and friends dump again if interrupted */
+const DUMP_ATTEMPTS = 3
+
 export enum Nl80211MulticastGroups {
     CONFIG = "config",
     SCAN = "scan",
@@ -56,6 +59,13 @@ export const NL80211_CQM_TXE_MAX_INTVL = 1800
 
 
 export interface Nl80211SocketOptions {
+    /**
+     * Generic netlink socket to use, possibly shared with other
+     * clients (default: a new socket is created, unless `shared` is set)
+     */
+    socket?: GenericNetlinkSocket
+    /** Use the process-wide socket (see {@link getSharedGenericNetlink}) */
+    shared?: boolean
 }
 
 export interface Nl80211SendOptions extends GenericNetlinkSendOptions {
@@ -73,11 +83,20 @@ export class Nl80211Socket extends EventEmitter {
         this.familyId = familyData.familyId
         this.version = familyData.version
         this.socket = socket
-        this.socket.on('message', this._receive.bind(this))
+        this._receive = this._receive.bind(this)
+        this.socket.subscribe(this.familyId, this._receive)
+    }
+
+    private _receive(msgs: GenericNetlinkMessage[], rinfo: MessageInfo) {
+        this.emit('message', msgs, rinfo)
     }
 
-    private _receive(omsg: NetlinkMessage[], rinfo: MessageInfo) {
-        // TODO
+    /**
+     * Stops receiving messages from the socket. The socket itself is
+     * left open, since it may be shared with other clients.
+     */
+    detach() {
+        this.socket.unsubscribe(this.familyId, this._receive)
     }
 
     send(
@@ -85,9 +104,7 @@ export class Nl80211Socket extends EventEmitter {
         msg: Message,
         options?: Nl80211SendOptions
     ) {
-        const attrs = new AttrStream()
-        attrs.emit(formatMessage(msg))
-        return this.socket.send(this.familyId, cmd, this.version, attrs.bufs, options)
+        return this.socket.send(this.familyId, cmd, this.version, formatMessage(msg), options)
     }
 
     async request(
@@ -95,50 +112,111 @@ export class Nl80211Socket extends EventEmitter {
         msg?: Message,
         options?: Nl80211SendOptions & RequestOptions
     ): Promise<Message[]> {
-        const attrs = new AttrStream()
-        attrs.emit(formatMessage(msg || {}))
         // rinfo isn't very useful here; this is a kernel interface
         const [omsg, _] = await this.socket.request(
-            this.familyId, cmd, this.version, attrs.bufs, options)
+            this.familyId, cmd, this.version, formatMessage(msg || {}), options)
         return omsg.map(x => parseMessage(x.data))
     }
 
-    async getPhys() {
-        const parts = await this.request(
-            Commands.GET_WIPHY, {}, { flags: FlagsGet.DUMP })
-        const objs: Map<number, Message> = new Map()
-        parts.forEach(part => {
-            const key = part.wiphy
-            if (typeof key === 'undefined')
-                throw Error('Invalid message part -- no wiphy')
-            if (!objs.has(key))
-                return objs.set(key, part)
-            const obj = objs.get(key)!
-            Object.keys(part).forEach(field => {
-                // FIXME: perform some consistency check?
-                (obj as any)[field] = (part as any)[field]
-            })
-        })
-        return objs
+    /**
+     * Sends a dump request, and yields the parsed replies as they
+     * arrive, see {@link NetlinkSocket.dump}.
+     */
+    async *dump(
+        cmd: Commands,
+        msg?: Message,
+        options?: Nl80211SendOptions & DumpOptions
+    ): AsyncGenerator<Message[], void, undefined> {
+        for await (const [omsg, _] of this.socket.dump(this.familyId, cmd, this.version, formatMessage(msg || {}), options))
+            yield omsg.map(x => parseMessage(x.data))
     }
 
-    async getInterfaces() {
-        const parts = await this.request(
-            Commands.GET_INTERFACE, {}, { flags: FlagsGet.DUMP })
-        const objs: Map<bigint, Message> = new Map()
-        parts.forEach(part => {
-            const key = part.wdev
-            if (typeof key === 'undefined')
-                throw Error('Invalid message part -- no wdev')
-            if (!objs.has(key))
-                return objs.set(key, part)
-            const obj = objs.get(key)!
-            Object.keys(part).forEach(field => {
-                // FIXME: perform some consistency check?
-                (obj as any)[field] = (part as any)[field]
-            })
-        })
-        return objs
+    /**
+     * Sends a dump request, and yields the replies as they arrive,
+     * without parsing them.
+     */
+    async *dumpRaw(
+        cmd: Commands,
+        msg?: Message,
+        options?: Nl80211SendOptions & DumpOptions
+    ): AsyncGenerator<GenericNetlinkMessage[], void, undefined> {
+        for await (const [omsg, _] of this.socket.dump(this.familyId, cmd, this.version, formatMessage(msg || {}), options))
+            yield omsg
+    }
+
+    /**
+     * Dumps wiphys, interfaces, stations or scan results, and yields
+     * the objects completed by each batch of replies. Split parts are
+     * merged as they arrive, and only the selected fields are kept
+     * (see {@link DumpMerger}). Wiphys are requested as a split dump.
+     * Batches tell whether the dump was interrupted so far, so the
+     * last one (which may be empty) tells it for the whole dump.
+     *
+     * @param kind Objects to dump
+     * @param msg Request attributes (stations and scan results need
+     * `ifindex` or `wdev`)
+     * @param options Selection and request options
+     */
+    async *dumpObjects(
+        kind: DumpKind,
+        msg?: Message,
+        options?: DumpSelection & Nl80211SendOptions & DumpOptions
+    ): AsyncGenerator<DumpedBatch, void, undefined> {
+        const merger = new DumpMerger(kind, options)
+        if (kind === 'wiphy')
+            msg = { splitWiphyDump: true, ...msg }
+        for await (const omsg of this.dumpRaw(DUMP_COMMANDS[kind], msg, options)) {
+            const objs: DumpedObject[] = []
+            for (const x of omsg) {
+                const obj = merger.push(x.data, x.flags)
+                obj && objs.push(obj)
+            }
+            if (objs.length) yield Object.assign(objs, { interrupted: merger.interrupted })
+        }
+        const last = merger.end()
+        if (last || merger.interrupted)
+            yield Object.assign(last ? [ last ] : [], { interrupted: merger.interrupted })
+    }
+
+    /**
+     * Returns the wiphys by index, see {@link dumpObjects}. Fields
+     * are decoded when first read. If the dump is interrupted, it's
+     * repeated (throwing if it keeps being interrupted).
+     */
+    getPhys(options?: DumpSelection & Nl80211SendOptions & DumpOptions) {
+        return this.collectObjects('wiphy', options, obj => Number(obj.key))
+    }
+
+    /**
+     * Returns the interfaces by wdev id, see {@link dumpObjects}.
+     * Fields are decoded when first read; `wdev` is always kept.
+     * If the dump is interrupted, it's repeated (throwing if it
+     * keeps being interrupted).
+     */
+    getInterfaces(options?: DumpSelection & Nl80211SendOptions & DumpOptions) {
+        if (options && options.fields && options.fields.indexOf('wdev') === -1)
+            options = { ...options, fields: [ ...options.fields, 'wdev' ] }
+        return this.collectObjects('interface', options, obj => obj.message.wdev!)
+    }
+
+    /** Collects the objects of a dump by key, dumping again while it's interrupted */
+    private async collectObjects<K>(
+        kind: DumpKind,
+        options: (DumpSelection & Nl80211SendOptions & DumpOptions) | undefined,
+        key: (obj: DumpedObject) => K,
+    ): Promise<Map<K, Message>> {
+        for (let attempt = 1; ; attempt++) {
+            const objs: Map<K, Message> = new Map()
+            let interrupted = false
+            for await (const batch of this.dumpObjects(kind, {}, options)) {
+                batch.forEach(obj => objs.set(key(obj), obj.message))
+                interrupted = batch.interrupted
+            }
+            if (!interrupted)
+                return objs
+            if (attempt >= DUMP_ATTEMPTS)
+                throw Error(`The ${kind} dump was interrupted ${attempt} times`)
+        }
     }
 
     async newInterface(
@@ -168,10 +246,9 @@ export class Nl80211Socket extends EventEmitter {
 export async function createNl80211(
     options?: Nl80211SocketOptions & GenericNetlinkSocketOptions & NetlinkSocketOptions & RawNetlinkSocketOptions
 ): Promise<Nl80211Socket> {
-    const socket = createGenericNetlink(options)
-    // FIXME: do this correctly, check version, etc.
-    const families = await socket.ctrlRequest(genl.Commands.GET_FAMILY, {}, { flags: FlagsGet.DUMP })
-    const family = families.filter(x => x.familyName === NL80211_GENL_NAME)[0]
+    const socket = (options && options.socket) ||
+        ((options && options.shared) ? getSharedGenericNetlink() : createGenericNetlink(options))
+    const family = await socket.families.resolve(NL80211_GENL_NAME)
     if (typeof family === 'undefined')
         throw Error('nl80211 genl family not available')
     return new Nl80211Socket(socket, family, options)
@@ -3469,291 +3469,582 @@ export function parseMessage(r: Buffer): Message {
     })
 }
 
+/** Decoders of the attributes of a {@link Message} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Message: structs.LazyFields = {
+    1: ['wiphy', data => structs.getU32(data)],
+    2: ['wiphyName', data => structs.getString(data)],
+    3: ['ifindex', data => structs.getU32(data)],
+    4: ['ifname', data => structs.getString(data)],
+    5: ['iftype', data => structs.getEnum(InterfaceType, structs.getU32(data))],
+    6: ['mac', data => data],
+    7: ['keyData', data => data],
+    8: ['keyIdx', data => structs.getU8(data)],
+    9: ['keyCipher', data => structs.getU32(data)],
+    10: ['keySeq', data => data],
+    11: ['keyDefault', data => structs.getFlag(data)],
+    12: ['beaconInterval', data => structs.getU32(data)],
+    13: ['dtimPeriod', data => structs.getU32(data)],
+    14: ['beaconHead', data => data],
+    15: ['beaconTail', data => data],
+    16: ['staAid', data => structs.getU16(data)],
+    17: ['staFlags', data => parseStationFlagsLazy(data)],
+    18: ['staListenInterval', data => structs.getU16(data)],
+    19: ['staSupportedRates', data => data],
+    20: ['staVlan', data => structs.getU32(data)],
+    21: ['staInfo', data => parseStationInfoLazy(data)],
+    22: ['wiphyBands', data => structs.getArray(data, x => parseBandLazy(x), { zero: true })],
+    23: ['mntrFlags', data => parseMonitorFlagsLazy(data)],
+    24: ['meshId', data => data],
+    25: ['staPlinkAction', data => structs.getEnum(PlinkAction, structs.getU8(data))],
+    26: ['mpathNextHop', data => data],
+    27: ['mpathInfo', data => parseMpathInfoLazy(data)],
+    28: ['bssCtsProt', data => structs.getBool(data)],
+    29: ['bssShortPreamble', data => structs.getBool(data)],
+    30: ['bssShortSlotTime', data => structs.getBool(data)],
+    31: ['htCapability', data => data],
+    32: ['supportedIftypes', data => parseInterfaceTypeSetAttr(data)],
+    33: ['regAlpha2', data => structs.getString(data)],
+    34: ['regRules', data => structs.getArray(data, x => parseRegulatoryRuleLazy(x))],
+    35: ['meshConfig', data => parseMeshconfParamsLazy(data)],
+    36: ['bssBasicRates', data => data],
+    37: ['wiphyTxqParams', data => structs.getArray(data, x => parseTxqLazy(x))],
+    38: ['wiphyFreq', data => structs.getU32(data)],
+    39: ['wiphyChannelType', data => structs.getEnum(ChannelType, structs.getU32(data))],
+    40: ['keyDefaultMgmt', data => structs.getFlag(data)],
+    41: ['mgmtSubtype', data => structs.getU8(data)],
+    42: ['ie', data => data],
+    43: ['maxNumScanSsids', data => structs.getU8(data)],
+    44: ['scanFrequencies', data => data],
+    45: ['scanSsids', data => data],
+    46: ['generation', data => structs.getU32(data)],
+    47: ['bss', data => data],
+    48: ['regInitiator', data => data],
+    49: ['regType', data => structs.getEnum(RegulatoryType, structs.getU8(data))],
+    50: ['supportedCommands', data => structs.getArray(data, x => structs.getU32(x))],
+    51: ['frame', data => data],
+    52: ['ssid', data => data],
+    53: ['authType', data => structs.getEnum(AuthType, structs.getU32(data))],
+    54: ['reasonCode', data => structs.getU16(data)],
+    55: ['keyType', data => structs.getEnum(KeyType, structs.getU32(data))],
+    56: ['maxScanIeLen', data => structs.getU16(data)],
+    57: ['cipherSuites', data => data],
+    58: ['freqBefore', data => data],
+    59: ['freqAfter', data => data],
+    60: ['freqFixed', data => structs.getFlag(data)],
+    61: ['wiphyRetryShort', data => structs.getU8(data)],
+    62: ['wiphyRetryLong', data => structs.getU8(data)],
+    63: ['wiphyFragThreshold', data => structs.getU32(data)],
+    64: ['wiphyRtsThreshold', data => structs.getU32(data)],
+    65: ['timedOut', data => structs.getFlag(data)],
+    66: ['useMfp', data => structs.getEnum(Mfp, structs.getU32(data))],
+    67: ['staFlags2', data => data],
+    68: ['controlPort', data => structs.getFlag(data)],
+    69: ['testdata', data => data],
+    70: ['privacy', data => structs.getFlag(data)],
+    71: ['disconnectedByAp', data => structs.getFlag(data)],
+    72: ['statusCode', data => structs.getU16(data)],
+    73: ['cipherSuitesPairwise', data => structs.getU32(data)],
+    74: ['cipherSuiteGroup', data => structs.getU32(data)],
+    75: ['wpaVersions', data => parseWpaVersions(structs.getU32(data))],
+    76: ['akmSuites', data => structs.getU32(data)],
+    77: ['reqIe', data => data],
+    78: ['respIe', data => data],
+    79: ['prevBssid', data => data],
+    80: ['key', data => data],
+    81: ['keys', data => data],
+    82: ['pid', data => structs.getU32(data)],
+    83: ['_4addr', data => structs.getU8(data)],
+    84: ['surveyInfo', data => parseSurveyInfoLazy(data)],
+    85: ['pmkid', data => data],
+    86: ['maxNumPmkids', data => structs.getU8(data)],
+    87: ['duration', data => structs.getU32(data)],
+    88: ['cookie', data => structs.getU64(data)],
+    89: ['wiphyCoverageClass', data => structs.getU8(data)],
+    90: ['txRates', data => structs.getMap(data, x => parseTxRateLazy(x))],
+    91: ['frameMatch', data => data],
+    92: ['ack', data => structs.getFlag(data)],
+    93: ['psState', data => structs.getEnum(PsState, structs.getU32(data))],
+    94: ['cqm', data => parseCqmLazy(data)],
+    95: ['localStateChange', data => structs.getFlag(data)],
+    96: ['apIsolate', data => structs.getFlag(data)],
+    97: ['wiphyTxPowerSetting', data => structs.getEnum(TxPowerSetting, structs.getU32(data))],
+    98: ['wiphyTxPowerLevel', data => structs.getS32(data)],
+    99: ['txFrameTypes', data => structs.getArray(data, x => parseMessageLazy(x), { zero: true })],
+    100: ['rxFrameTypes', data => structs.getArray(data, x => parseMessageLazy(x), { zero: true })],
+    101: ['frameType', data => structs.getU16(data), true],
+    102: ['controlPortEthertype', data => data],
+    103: ['controlPortNoEncrypt', data => structs.getFlag(data)],
+    104: ['supportIbssRsn', data => structs.getFlag(data)],
+    105: ['wiphyAntennaTx', data => structs.getU32(data)],
+    106: ['wiphyAntennaRx', data => structs.getU32(data)],
+    107: ['mcastRate', data => structs.getU32(data)],
+    108: ['offchannelTxOk', data => structs.getFlag(data)],
+    109: ['bssHtOpmode', data => structs.getU16(data)],
+    110: ['keyDefaultTypes', data => parseKeyDefaultTypesLazy(data)],
+    111: ['maxRemainOnChannelDuration', data => structs.getU32(data)],
+    112: ['meshSetup', data => data],
+    113: ['wiphyAntennaAvailTx', data => structs.getU32(data)],
+    114: ['wiphyAntennaAvailRx', data => structs.getU32(data)],
+    115: ['supportMeshAuth', data => structs.getFlag(data)],
+    116: ['staPlinkState', data => data],
+    117: ['wowlanTriggers', data => parseWowlanTriggersLazy(data)],
+    118: ['wowlanTriggersSupported', data => parseWowlanTriggersLazy(data)],
+    119: ['schedScanInterval', data => structs.getU32(data)],
+    120: ['interfaceCombinations', data => structs.getArray(data, x => parseInterfaceCombinationLazy(x))],
+    121: ['softwareIftypes', data => parseInterfaceTypeSetAttr(data)],
+    122: ['rekeyData', data => parseRekeyDataLazy(data)],
+    123: ['maxNumSchedScanSsids', data => structs.getU8(data)],
+    124: ['maxSchedScanIeLen', data => structs.getU16(data)],
+    125: ['scanSuppRates', data => structs.getArray(data, x => x)],
+    126: ['hiddenSsid', data => structs.getEnum(HiddenSsid, structs.getU32(data))],
+    127: ['ieProbeResp', data => data],
+    128: ['ieAssocResp', data => data],
+    129: ['staWme', data => parseStationWmeLazy(data)],
+    130: ['supportApUapsd', data => structs.getFlag(data)],
+    131: ['roamSupport', data => structs.getFlag(data)],
+    132: ['schedScanMatch', data => structs.getArray(data, x => x)],
+    133: ['maxMatchSets', data => structs.getU8(data)],
+    134: ['pmksaCandidate', data => parsePmksaCandidateLazy(data)],
+    135: ['txNoCckRate', data => data],
+    136: ['tdlsAction', data => data],
+    137: ['tdlsDialogToken', data => data],
+    138: ['tdlsOperation', data => structs.getEnum(TdlsOperation, structs.getU8(data))],
+    139: ['tdlsSupport', data => structs.getFlag(data)],
+    140: ['tdlsExternalSetup', data => data],
+    141: ['deviceApSme', data => structs.getU32(data)],
+    142: ['dontWaitForAck', data => structs.getFlag(data)],
+    143: ['featureFlags', data => parseFeatureFlags(structs.getU32(data))],
+    144: ['probeRespOffload', data => data],
+    145: ['probeResp', data => data],
+    146: ['dfsRegion', data => structs.getU8(data)],
+    147: ['disableHt', data => structs.getFlag(data)],
+    148: ['htCapabilityMask', data => data],
+    149: ['noackMap', data => structs.getU16(data)],
+    150: ['inactivityTimeout', data => structs.getU16(data)],
+    151: ['rxSignalDbm', data => structs.getU32(data)],
+    152: ['bgScanPeriod', data => data],
+    153: ['wdev', data => structs.getU64(data)],
+    154: ['userRegHintType', data => data],
+    155: ['connFailedReason', data => data],
+    156: ['authData', data => data],
+    157: ['vhtCapability', data => data],
+    158: ['scanFlags', data => structs.getU32(data)],
+    159: ['channelWidth', data => structs.getEnum(ChannelWidth, structs.getU32(data))],
+    160: ['centerFreq1', data => structs.getU32(data)],
+    161: ['centerFreq2', data => structs.getU32(data)],
+    162: ['p2pCtwindow', data => structs.getU8(data)],
+    163: ['p2pOppps', data => structs.getU8(data)],
+    164: ['localMeshPowerMode', data => structs.getEnum(MeshPowerMode, structs.getU32(data))],
+    165: ['aclPolicy', data => structs.getEnum(AclPolicy, structs.getU32(data))],
+    166: ['macAddrs', data => structs.getArray(data, x => x)],
+    167: ['macAclMax', data => structs.getU32(data)],
+    168: ['radarEvent', data => structs.getEnum(RadarEvent, structs.getU32(data))],
+    169: ['extCapa', data => data],
+    170: ['extCapaMask', data => data],
+    171: ['staCapability', data => structs.getU16(data)],
+    172: ['staExtCapability', data => data],
+    173: ['protocolFeatures', data => parseProtocolFeatures(structs.getU32(data))],
+    174: ['splitWiphyDump', data => structs.getFlag(data)],
+    175: ['disableVht', data => structs.getFlag(data)],
+    176: ['vhtCapabilityMask', data => data],
+    177: ['mdid', data => data],
+    178: ['ieRic', data => data],
+    179: ['critProtId', data => structs.getEnum(CritProtoId, structs.getU16(data))],
+    180: ['maxCritProtDuration', data => structs.getU16(data)],
+    181: ['peerAid', data => structs.getU16(data)],
+    182: ['coalesceRule', data => data],
+    183: ['chSwitchCount', data => structs.getU32(data)],
+    184: ['chSwitchBlockTx', data => structs.getFlag(data)],
+    185: ['csaIes', data => data],
+    186: ['csaCOffBeacon', data => structs.getU16(data)],
+    187: ['csaCOffPresp', data => structs.getU16(data)],
+    188: ['rxmgmtFlags', data => parseRxmgmtFlags(structs.getU32(data))],
+    189: ['staSupportedChannels', data => data],
+    190: ['staSupportedOperClasses', data => data],
+    191: ['handleDfs', data => structs.getFlag(data)],
+    192: ['support5Mhz', data => structs.getFlag(data)],
+    193: ['support10Mhz', data => structs.getFlag(data)],
+    194: ['opmodeNotif', data => structs.getU8(data)],
+    195: ['vendorId', data => structs.getU32(data)],
+    196: ['vendorSubcmd', data => structs.getU32(data)],
+    197: ['vendorData', data => data],
+    198: ['vendorEvents', data => data],
+    199: ['qosMap', data => data],
+    200: ['macHint', data => data],
+    201: ['wiphyFreqHint', data => data],
+    202: ['maxApAssocSta', data => structs.getU32(data)],
+    203: ['tdlsPeerCapability', data => parseTdlsPeerCapability(structs.getU32(data))],
+    204: ['socketOwner', data => structs.getFlag(data)],
+    205: ['csaCOffsetsTx', data => structs.getU16(data)],
+    206: ['maxCsaCounters', data => structs.getU8(data)],
+    207: ['tdlsInitiator', data => structs.getFlag(data)],
+    208: ['useRrm', data => structs.getFlag(data)],
+    209: ['wiphyDynAck', data => structs.getFlag(data)],
+    210: ['tsid', data => structs.getU8(data)],
+    211: ['userPrio', data => structs.getU8(data)],
+    212: ['admittedTime', data => structs.getU16(data)],
+    213: ['smpsMode', data => data],
+    214: ['operClass', data => data],
+    215: ['macMask', data => data],
+    216: ['wiphySelfManagedReg', data => structs.getFlag(data)],
+    217: ['extFeatures', data => data],
+    218: ['surveyRadioStats', data => data],
+    219: ['netnsFd', data => structs.getU32(data)],
+    220: ['schedScanDelay', data => structs.getU32(data)],
+    221: ['regIndoor', data => structs.getFlag(data)],
+    222: ['maxNumSchedScanPlans', data => structs.getU32(data)],
+    223: ['maxScanPlanInterval', data => structs.getU32(data)],
+    224: ['maxScanPlanIterations', data => structs.getU32(data)],
+    225: ['schedScanPlans', data => parseScheduledScanPlanLazy(data)],
+    226: ['pbss', data => structs.getFlag(data)],
+    227: ['bssSelect', data => parseBssSelectLazy(data)],
+    228: ['staSupportP2pPs', data => structs.getEnum(StationP2pPsStatus, structs.getU8(data))],
+    229: ['__pad', data => data],
+    230: ['iftypeExtCapa', data => data],
+    231: ['muMimoGroupData', data => data],
+    232: ['muMimoFollowMacAddr', data => data],
+    233: ['scanStartTimeTsf', data => structs.getU64(data)],
+    234: ['scanStartTimeTsfBssid', data => data],
+    235: ['measurementDuration', data => structs.getU16(data)],
+    236: ['measurementDurationMandatory', data => structs.getFlag(data)],
+    237: ['meshPeerAid', data => structs.getU16(data)],
+    238: ['nanMasterPref', data => structs.getU8(data)],
+    239: ['bands', data => parseBandIdSet(structs.getU32(data))],
+    240: ['nanFunc', data => parseNanFunctionLazy(data)],
+    241: ['nanMatch', data => parseNanMatchLazy(data)],
+    242: ['filsKek', data => data],
+    243: ['filsNonces', data => data],
+    244: ['multicastToUnicastEnabled', data => structs.getFlag(data)],
+    245: ['bssid', data => data],
+    246: ['schedScanRelativeRssi', data => data],
+    247: ['schedScanRssiAdjust', data => data],
+    248: ['timeoutReason', data => structs.getEnum(TimeoutReason, structs.getU32(data))],
+    249: ['filsErpUsername', data => data],
+    250: ['filsErpRealm', data => data],
+    251: ['filsErpNextSeqNum', data => data],
+    252: ['filsErpRrk', data => data],
+    253: ['filsCacheId', data => data],
+    254: ['pmk', data => data],
+    255: ['schedScanMulti', data => structs.getFlag(data)],
+    256: ['schedScanMaxReqs', data => structs.getU32(data)],
+    257: ['want1x4wayHs', data => structs.getFlag(data)],
+    258: ['pmkr0Name', data => data],
+    259: ['portAuthorized', data => data],
+    260: ['externalAuthAction', data => structs.getEnum(ExternalAuthAction, structs.getU32(data))],
+    261: ['externalAuthSupport', data => structs.getFlag(data)],
+    262: ['nss', data => structs.getU8(data)],
+    263: ['ackSignal', data => data],
+    264: ['controlPortOverNl80211', data => structs.getFlag(data)],
+    265: ['txqStats', data => parseTxqStatsLazy(data)],
+    266: ['txqLimit', data => structs.getU32(data)],
+    267: ['txqMemoryLimit', data => structs.getU32(data)],
+    268: ['txqQuantum', data => structs.getU32(data)],
+    269: ['heCapability', data => data],
+    270: ['ftmResponder', data => data],
+    271: ['ftmResponderStats', data => parseFtmResponderStatsLazy(data)],
+    272: ['timeout', data => structs.getU32(data)],
+    273: ['peerMeasurements', data => parsePeerMeasurementLazy(data)],
+    274: ['airtimeWeight', data => structs.getU16(data)],
+    275: ['staTxPowerSetting', data => structs.getEnum(TxPowerSetting, structs.getU8(data))],
+    276: ['staTxPower', data => structs.getS16(data)],
+    277: ['saePassword', data => data],
+    278: ['twtResponder', data => data],
+    279: ['heObssPd', data => data],
+    280: ['wiphyEdmgChannels', data => structs.getU8(data)],
+    281: ['wiphyEdmgBwConfig', data => structs.getU8(data)],
+    282: ['vlanId', data => structs.getU16(data)],
+}
+
+/** Like {@link parseMessage}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseMessageLazy(r: Buffer): Message {
+    return structs.getLazyObject(r, __LAZY_Message)
+}
+
 /** Encodes a {@link Message} object into a stream of attributes */
 export function formatMessage(x: Message): StreamData {
     return structs.putObject(x, {
-        wiphy: (data, obj) => data.push(1, structs.putU32(obj.wiphy!)),
-        wiphyName: (data, obj) => data.push(2, structs.putString(obj.wiphyName!)),
-        ifindex: (data, obj) => data.push(3, structs.putU32(obj.ifindex!)),
-        ifname: (data, obj) => data.push(4, structs.putString(obj.ifname!)),
-        iftype: (data, obj) => data.push(5, structs.putU32(structs.putEnum(InterfaceType, obj.iftype!))),
+        wiphy: (data, obj) => data.pushU32(1, obj.wiphy!),
+        wiphyName: (data, obj) => data.pushString(2, obj.wiphyName!),
+        ifindex: (data, obj) => data.pushU32(3, obj.ifindex!),
+        ifname: (data, obj) => data.pushString(4, obj.ifname!),
+        iftype: (data, obj) => data.pushU32(5, structs.putEnum(InterfaceType, obj.iftype!)),
         mac: (data, obj) => data.push(6, obj.mac!),
         keyData: (data, obj) => data.push(7, obj.keyData!),
-        keyIdx: (data, obj) => data.push(8, structs.putU8(obj.keyIdx!)),
-        keyCipher: (data, obj) => data.push(9, structs.putU32(obj.keyCipher!)),
+        keyIdx: (data, obj) => data.pushU8(8, obj.keyIdx!),
+        keyCipher: (data, obj) => data.pushU32(9, obj.keyCipher!),
         keySeq: (data, obj) => data.push(10, obj.keySeq!),
-        keyDefault: (data, obj) => data.push(11, structs.putFlag(obj.keyDefault!)),
-        beaconInterval: (data, obj) => data.push(12, structs.putU32(obj.beaconInterval!)),
-        dtimPeriod: (data, obj) => data.push(13, structs.putU32(obj.dtimPeriod!)),
+        keyDefault: (data, obj) => data.pushFlag(11, obj.keyDefault!),
+        beaconInterval: (data, obj) => data.pushU32(12, obj.beaconInterval!),
+        dtimPeriod: (data, obj) => data.pushU32(13, obj.dtimPeriod!),
         beaconHead: (data, obj) => data.push(14, obj.beaconHead!),
         beaconTail: (data, obj) => data.push(15, obj.beaconTail!),
-        staAid: (data, obj) => data.push(16, structs.putU16(obj.staAid!)),
+        staAid: (data, obj) => data.pushU16(16, obj.staAid!),
         staFlags: (data, obj) => data.push(17, formatStationFlags(obj.staFlags!)),
-        staListenInterval: (data, obj) => data.push(18, structs.putU16(obj.staListenInterval!)),
+        staListenInterval: (data, obj) => data.pushU16(18, obj.staListenInterval!),
         staSupportedRates: (data, obj) => data.push(19, obj.staSupportedRates!),
-        staVlan: (data, obj) => data.push(20, structs.putU32(obj.staVlan!)),
+        staVlan: (data, obj) => data.pushU32(20, obj.staVlan!),
         staInfo: (data, obj) => data.push(21, formatStationInfo(obj.staInfo!)),
         wiphyBands: (data, obj) => data.push(22, structs.putArray(obj.wiphyBands!, x => formatBand(x), { zero: true })),
         mntrFlags: (data, obj) => data.push(23, formatMonitorFlags(obj.mntrFlags!)),
         meshId: (data, obj) => data.push(24, obj.meshId!),
-        staPlinkAction: (data, obj) => data.push(25, structs.putU8(structs.putEnum(PlinkAction, obj.staPlinkAction!))),
+        staPlinkAction: (data, obj) => data.pushU8(25, structs.putEnum(PlinkAction, obj.staPlinkAction!)),
         mpathNextHop: (data, obj) => data.push(26, obj.mpathNextHop!),
         mpathInfo: (data, obj) => data.push(27, formatMpathInfo(obj.mpathInfo!)),
-        bssCtsProt: (data, obj) => data.push(28, structs.putBool(obj.bssCtsProt!)),
-        bssShortPreamble: (data, obj) => data.push(29, structs.putBool(obj.bssShortPreamble!)),
-        bssShortSlotTime: (data, obj) => data.push(30, structs.putBool(obj.bssShortSlotTime!)),
+        bssCtsProt: (data, obj) => data.pushBool(28, obj.bssCtsProt!),
+        bssShortPreamble: (data, obj) => data.pushBool(29, obj.bssShortPreamble!),
+        bssShortSlotTime: (data, obj) => data.pushBool(30, obj.bssShortSlotTime!),
         htCapability: (data, obj) => data.push(31, obj.htCapability!),
         supportedIftypes: (data, obj) => data.push(32, formatInterfaceTypeSetAttr(obj.supportedIftypes!)),
-        regAlpha2: (data, obj) => data.push(33, structs.putString(obj.regAlpha2!)),
+        regAlpha2: (data, obj) => data.pushString(33, obj.regAlpha2!),
         regRules: (data, obj) => data.push(34, structs.putArray(obj.regRules!, x => formatRegulatoryRule(x))),
         meshConfig: (data, obj) => data.push(35, formatMeshconfParams(obj.meshConfig!)),
         bssBasicRates: (data, obj) => data.push(36, obj.bssBasicRates!),
         wiphyTxqParams: (data, obj) => data.push(37, structs.putArray(obj.wiphyTxqParams!, x => formatTxq(x))),
-        wiphyFreq: (data, obj) => data.push(38, structs.putU32(obj.wiphyFreq!)),
-        wiphyChannelType: (data, obj) => data.push(39, structs.putU32(structs.putEnum(ChannelType, obj.wiphyChannelType!))),
-        keyDefaultMgmt: (data, obj) => data.push(40, structs.putFlag(obj.keyDefaultMgmt!)),
-        mgmtSubtype: (data, obj) => data.push(41, structs.putU8(obj.mgmtSubtype!)),
+        wiphyFreq: (data, obj) => data.pushU32(38, obj.wiphyFreq!),
+        wiphyChannelType: (data, obj) => data.pushU32(39, structs.putEnum(ChannelType, obj.wiphyChannelType!)),
+        keyDefaultMgmt: (data, obj) => data.pushFlag(40, obj.keyDefaultMgmt!),
+        mgmtSubtype: (data, obj) => data.pushU8(41, obj.mgmtSubtype!),
         ie: (data, obj) => data.push(42, obj.ie!),
-        maxNumScanSsids: (data, obj) => data.push(43, structs.putU8(obj.maxNumScanSsids!)),
+        maxNumScanSsids: (data, obj) => data.pushU8(43, obj.maxNumScanSsids!),
         scanFrequencies: (data, obj) => data.push(44, obj.scanFrequencies!),
         scanSsids: (data, obj) => data.push(45, obj.scanSsids!),
-        generation: (data, obj) => data.push(46, structs.putU32(obj.generation!)),
+        generation: (data, obj) => data.pushU32(46, obj.generation!),
         bss: (data, obj) => data.push(47, obj.bss!),
         regInitiator: (data, obj) => data.push(48, obj.regInitiator!),
-        regType: (data, obj) => data.push(49, structs.putU8(structs.putEnum(RegulatoryType, obj.regType!))),
+        regType: (data, obj) => data.pushU8(49, structs.putEnum(RegulatoryType, obj.regType!)),
         supportedCommands: (data, obj) => data.push(50, structs.putArray(obj.supportedCommands!, x => structs.putU32(x))),
         frame: (data, obj) => data.push(51, obj.frame!),
         ssid: (data, obj) => data.push(52, obj.ssid!),
-        authType: (data, obj) => data.push(53, structs.putU32(structs.putEnum(AuthType, obj.authType!))),
-        reasonCode: (data, obj) => data.push(54, structs.putU16(obj.reasonCode!)),
-        keyType: (data, obj) => data.push(55, structs.putU32(structs.putEnum(KeyType, obj.keyType!))),
-        maxScanIeLen: (data, obj) => data.push(56, structs.putU16(obj.maxScanIeLen!)),
+        authType: (data, obj) => data.pushU32(53, structs.putEnum(AuthType, obj.authType!)),
+        reasonCode: (data, obj) => data.pushU16(54, obj.reasonCode!),
+        keyType: (data, obj) => data.pushU32(55, structs.putEnum(KeyType, obj.keyType!)),
+        maxScanIeLen: (data, obj) => data.pushU16(56, obj.maxScanIeLen!),
         cipherSuites: (data, obj) => data.push(57, obj.cipherSuites!),
         freqBefore: (data, obj) => data.push(58, obj.freqBefore!),
         freqAfter: (data, obj) => data.push(59, obj.freqAfter!),
-        freqFixed: (data, obj) => data.push(60, structs.putFlag(obj.freqFixed!)),
-        wiphyRetryShort: (data, obj) => data.push(61, structs.putU8(obj.wiphyRetryShort!)),
-        wiphyRetryLong: (data, obj) => data.push(62, structs.putU8(obj.wiphyRetryLong!)),
-        wiphyFragThreshold: (data, obj) => data.push(63, structs.putU32(obj.wiphyFragThreshold!)),
-        wiphyRtsThreshold: (data, obj) => data.push(64, structs.putU32(obj.wiphyRtsThreshold!)),
-        timedOut: (data, obj) => data.push(65, structs.putFlag(obj.timedOut!)),
-        useMfp: (data, obj) => data.push(66, structs.putU32(structs.putEnum(Mfp, obj.useMfp!))),
+        freqFixed: (data, obj) => data.pushFlag(60, obj.freqFixed!),
+        wiphyRetryShort: (data, obj) => data.pushU8(61, obj.wiphyRetryShort!),
+        wiphyRetryLong: (data, obj) => data.pushU8(62, obj.wiphyRetryLong!),
+        wiphyFragThreshold: (data, obj) => data.pushU32(63, obj.wiphyFragThreshold!),
+        wiphyRtsThreshold: (data, obj) => data.pushU32(64, obj.wiphyRtsThreshold!),
+        timedOut: (data, obj) => data.pushFlag(65, obj.timedOut!),
+        useMfp: (data, obj) => data.pushU32(66, structs.putEnum(Mfp, obj.useMfp!)),
         staFlags2: (data, obj) => data.push(67, obj.staFlags2!),
-        controlPort: (data, obj) => data.push(68, structs.putFlag(obj.controlPort!)),
+        controlPort: (data, obj) => data.pushFlag(68, obj.controlPort!),
         testdata: (data, obj) => data.push(69, obj.testdata!),
-        privacy: (data, obj) => data.push(70, structs.putFlag(obj.privacy!)),
-        disconnectedByAp: (data, obj) => data.push(71, structs.putFlag(obj.disconnectedByAp!)),
-        statusCode: (data, obj) => data.push(72, structs.putU16(obj.statusCode!)),
-        cipherSuitesPairwise: (data, obj) => data.push(73, structs.putU32(obj.cipherSuitesPairwise!)),
-        cipherSuiteGroup: (data, obj) => data.push(74, structs.putU32(obj.cipherSuiteGroup!)),
-        wpaVersions: (data, obj) => data.push(75, structs.putU32(formatWpaVersions(obj.wpaVersions!))),
-        akmSuites: (data, obj) => data.push(76, structs.putU32(obj.akmSuites!)),
+        privacy: (data, obj) => data.pushFlag(70, obj.privacy!),
+        disconnectedByAp: (data, obj) => data.pushFlag(71, obj.disconnectedByAp!),
+        statusCode: (data, obj) => data.pushU16(72, obj.statusCode!),
+        cipherSuitesPairwise: (data, obj) => data.pushU32(73, obj.cipherSuitesPairwise!),
+        cipherSuiteGroup: (data, obj) => data.pushU32(74, obj.cipherSuiteGroup!),
+        wpaVersions: (data, obj) => data.pushU32(75, formatWpaVersions(obj.wpaVersions!)),
+        akmSuites: (data, obj) => data.pushU32(76, obj.akmSuites!),
         reqIe: (data, obj) => data.push(77, obj.reqIe!),
         respIe: (data, obj) => data.push(78, obj.respIe!),
         prevBssid: (data, obj) => data.push(79, obj.prevBssid!),
         key: (data, obj) => data.push(80, obj.key!),
         keys: (data, obj) => data.push(81, obj.keys!),
-        pid: (data, obj) => data.push(82, structs.putU32(obj.pid!)),
-        _4addr: (data, obj) => data.push(83, structs.putU8(obj._4addr!)),
+        pid: (data, obj) => data.pushU32(82, obj.pid!),
+        _4addr: (data, obj) => data.pushU8(83, obj._4addr!),
         surveyInfo: (data, obj) => data.push(84, formatSurveyInfo(obj.surveyInfo!)),
         pmkid: (data, obj) => data.push(85, obj.pmkid!),
-        maxNumPmkids: (data, obj) => data.push(86, structs.putU8(obj.maxNumPmkids!)),
-        duration: (data, obj) => data.push(87, structs.putU32(obj.duration!)),
-        cookie: (data, obj) => data.push(88, structs.putU64(obj.cookie!)),
-        wiphyCoverageClass: (data, obj) => data.push(89, structs.putU8(obj.wiphyCoverageClass!)),
+        maxNumPmkids: (data, obj) => data.pushU8(86, obj.maxNumPmkids!),
+        duration: (data, obj) => data.pushU32(87, obj.duration!),
+        cookie: (data, obj) => data.pushU64(88, obj.cookie!),
+        wiphyCoverageClass: (data, obj) => data.pushU8(89, obj.wiphyCoverageClass!),
         txRates: (data, obj) => data.push(90, structs.putMap(obj.txRates!, x => formatTxRate(x))),
         frameMatch: (data, obj) => data.push(91, obj.frameMatch!),
-        ack: (data, obj) => data.push(92, structs.putFlag(obj.ack!)),
-        psState: (data, obj) => data.push(93, structs.putU32(structs.putEnum(PsState, obj.psState!))),
+        ack: (data, obj) => data.pushFlag(92, obj.ack!),
+        psState: (data, obj) => data.pushU32(93, structs.putEnum(PsState, obj.psState!)),
         cqm: (data, obj) => data.push(94, formatCqm(obj.cqm!)),
-        localStateChange: (data, obj) => data.push(95, structs.putFlag(obj.localStateChange!)),
-        apIsolate: (data, obj) => data.push(96, structs.putFlag(obj.apIsolate!)),
-        wiphyTxPowerSetting: (data, obj) => data.push(97, structs.putU32(structs.putEnum(TxPowerSetting, obj.wiphyTxPowerSetting!))),
-        wiphyTxPowerLevel: (data, obj) => data.push(98, structs.putS32(obj.wiphyTxPowerLevel!)),
+        localStateChange: (data, obj) => data.pushFlag(95, obj.localStateChange!),
+        apIsolate: (data, obj) => data.pushFlag(96, obj.apIsolate!),
+        wiphyTxPowerSetting: (data, obj) => data.pushU32(97, structs.putEnum(TxPowerSetting, obj.wiphyTxPowerSetting!)),
+        wiphyTxPowerLevel: (data, obj) => data.pushS32(98, obj.wiphyTxPowerLevel!),
         txFrameTypes: (data, obj) => data.push(99, structs.putArray(obj.txFrameTypes!, x => formatMessage(x), { zero: true })),
         rxFrameTypes: (data, obj) => data.push(100, structs.putArray(obj.rxFrameTypes!, x => formatMessage(x), { zero: true })),
-        frameType: (data, obj) => obj.frameType!.forEach(x => data.push(101, structs.putU16(x))),
+        frameType: (data, obj) => obj.frameType!.forEach(x => data.pushU16(101, x)),
         controlPortEthertype: (data, obj) => data.push(102, obj.controlPortEthertype!),
-        controlPortNoEncrypt: (data, obj) => data.push(103, structs.putFlag(obj.controlPortNoEncrypt!)),
-        supportIbssRsn: (data, obj) => data.push(104, structs.putFlag(obj.supportIbssRsn!)),
-        wiphyAntennaTx: (data, obj) => data.push(105, structs.putU32(obj.wiphyAntennaTx!)),
-        wiphyAntennaRx: (data, obj) => data.push(106, structs.putU32(obj.wiphyAntennaRx!)),
-        mcastRate: (data, obj) => data.push(107, structs.putU32(obj.mcastRate!)),
-        offchannelTxOk: (data, obj) => data.push(108, structs.putFlag(obj.offchannelTxOk!)),
-        bssHtOpmode: (data, obj) => data.push(109, structs.putU16(obj.bssHtOpmode!)),
+        controlPortNoEncrypt: (data, obj) => data.pushFlag(103, obj.controlPortNoEncrypt!),
+        supportIbssRsn: (data, obj) => data.pushFlag(104, obj.supportIbssRsn!),
+        wiphyAntennaTx: (data, obj) => data.pushU32(105, obj.wiphyAntennaTx!),
+        wiphyAntennaRx: (data, obj) => data.pushU32(106, obj.wiphyAntennaRx!),
+        mcastRate: (data, obj) => data.pushU32(107, obj.mcastRate!),
+        offchannelTxOk: (data, obj) => data.pushFlag(108, obj.offchannelTxOk!),
+        bssHtOpmode: (data, obj) => data.pushU16(109, obj.bssHtOpmode!),
         keyDefaultTypes: (data, obj) => data.push(110, formatKeyDefaultTypes(obj.keyDefaultTypes!)),
-        maxRemainOnChannelDuration: (data, obj) => data.push(111, structs.putU32(obj.maxRemainOnChannelDuration!)),
+        maxRemainOnChannelDuration: (data, obj) => data.pushU32(111, obj.maxRemainOnChannelDuration!),
         meshSetup: (data, obj) => data.push(112, obj.meshSetup!),
-        wiphyAntennaAvailTx: (data, obj) => data.push(113, structs.putU32(obj.wiphyAntennaAvailTx!)),
-        wiphyAntennaAvailRx: (data, obj) => data.push(114, structs.putU32(obj.wiphyAntennaAvailRx!)),
-        supportMeshAuth: (data, obj) => data.push(115, structs.putFlag(obj.supportMeshAuth!)),
+        wiphyAntennaAvailTx: (data, obj) => data.pushU32(113, obj.wiphyAntennaAvailTx!),
+        wiphyAntennaAvailRx: (data, obj) => data.pushU32(114, obj.wiphyAntennaAvailRx!),
+        supportMeshAuth: (data, obj) => data.pushFlag(115, obj.supportMeshAuth!),
         staPlinkState: (data, obj) => data.push(116, obj.staPlinkState!),
         wowlanTriggers: (data, obj) => data.push(117, formatWowlanTriggers(obj.wowlanTriggers!)),
         wowlanTriggersSupported: (data, obj) => data.push(118, formatWowlanTriggers(obj.wowlanTriggersSupported!)),
-        schedScanInterval: (data, obj) => data.push(119, structs.putU32(obj.schedScanInterval!)),
+        schedScanInterval: (data, obj) => data.pushU32(119, obj.schedScanInterval!),
         interfaceCombinations: (data, obj) => data.push(120, structs.putArray(obj.interfaceCombinations!, x => formatInterfaceCombination(x))),
         softwareIftypes: (data, obj) => data.push(121, formatInterfaceTypeSetAttr(obj.softwareIftypes!)),
         rekeyData: (data, obj) => data.push(122, formatRekeyData(obj.rekeyData!)),
-        maxNumSchedScanSsids: (data, obj) => data.push(123, structs.putU8(obj.maxNumSchedScanSsids!)),
-        maxSchedScanIeLen: (data, obj) => data.push(124, structs.putU16(obj.maxSchedScanIeLen!)),
+        maxNumSchedScanSsids: (data, obj) => data.pushU8(123, obj.maxNumSchedScanSsids!),
+        maxSchedScanIeLen: (data, obj) => data.pushU16(124, obj.maxSchedScanIeLen!),
         scanSuppRates: (data, obj) => data.push(125, structs.putArray(obj.scanSuppRates!, x => x)),
-        hiddenSsid: (data, obj) => data.push(126, structs.putU32(structs.putEnum(HiddenSsid, obj.hiddenSsid!))),
+        hiddenSsid: (data, obj) => data.pushU32(126, structs.putEnum(HiddenSsid, obj.hiddenSsid!)),
         ieProbeResp: (data, obj) => data.push(127, obj.ieProbeResp!),
         ieAssocResp: (data, obj) => data.push(128, obj.ieAssocResp!),
         staWme: (data, obj) => data.push(129, formatStationWme(obj.staWme!)),
-        supportApUapsd: (data, obj) => data.push(130, structs.putFlag(obj.supportApUapsd!)),
-        roamSupport: (data, obj) => data.push(131, structs.putFlag(obj.roamSupport!)),
+        supportApUapsd: (data, obj) => data.pushFlag(130, obj.supportApUapsd!),
+        roamSupport: (data, obj) => data.pushFlag(131, obj.roamSupport!),
         schedScanMatch: (data, obj) => data.push(132, structs.putArray(obj.schedScanMatch!, x => x)),
-        maxMatchSets: (data, obj) => data.push(133, structs.putU8(obj.maxMatchSets!)),
+        maxMatchSets: (data, obj) => data.pushU8(133, obj.maxMatchSets!),
         pmksaCandidate: (data, obj) => data.push(134, formatPmksaCandidate(obj.pmksaCandidate!)),
         txNoCckRate: (data, obj) => data.push(135, obj.txNoCckRate!),
         tdlsAction: (data, obj) => data.push(136, obj.tdlsAction!),
         tdlsDialogToken: (data, obj) => data.push(137, obj.tdlsDialogToken!),
-        tdlsOperation: (data, obj) => data.push(138, structs.putU8(structs.putEnum(TdlsOperation, obj.tdlsOperation!))),
-        tdlsSupport: (data, obj) => data.push(139, structs.putFlag(obj.tdlsSupport!)),
+        tdlsOperation: (data, obj) => data.pushU8(138, structs.putEnum(TdlsOperation, obj.tdlsOperation!)),
+        tdlsSupport: (data, obj) => data.pushFlag(139, obj.tdlsSupport!),
         tdlsExternalSetup: (data, obj) => data.push(140, obj.tdlsExternalSetup!),
-        deviceApSme: (data, obj) => data.push(141, structs.putU32(obj.deviceApSme!)),
-        dontWaitForAck: (data, obj) => data.push(142, structs.putFlag(obj.dontWaitForAck!)),
-        featureFlags: (data, obj) => data.push(143, structs.putU32(formatFeatureFlags(obj.featureFlags!))),
+        deviceApSme: (data, obj) => data.pushU32(141, obj.deviceApSme!),
+        dontWaitForAck: (data, obj) => data.pushFlag(142, obj.dontWaitForAck!),
+        featureFlags: (data, obj) => data.pushU32(143, formatFeatureFlags(obj.featureFlags!)),
         probeRespOffload: (data, obj) => data.push(144, obj.probeRespOffload!),
         probeResp: (data, obj) => data.push(145, obj.probeResp!),
-        dfsRegion: (data, obj) => data.push(146, structs.putU8(obj.dfsRegion!)),
-        disableHt: (data, obj) => data.push(147, structs.putFlag(obj.disableHt!)),
+        dfsRegion: (data, obj) => data.pushU8(146, obj.dfsRegion!),
+        disableHt: (data, obj) => data.pushFlag(147, obj.disableHt!),
         htCapabilityMask: (data, obj) => data.push(148, obj.htCapabilityMask!),
-        noackMap: (data, obj) => data.push(149, structs.putU16(obj.noackMap!)),
-        inactivityTimeout: (data, obj) => data.push(150, structs.putU16(obj.inactivityTimeout!)),
-        rxSignalDbm: (data, obj) => data.push(151, structs.putU32(obj.rxSignalDbm!)),
+        noackMap: (data, obj) => data.pushU16(149, obj.noackMap!),
+        inactivityTimeout: (data, obj) => data.pushU16(150, obj.inactivityTimeout!),
+        rxSignalDbm: (data, obj) => data.pushU32(151, obj.rxSignalDbm!),
         bgScanPeriod: (data, obj) => data.push(152, obj.bgScanPeriod!),
-        wdev: (data, obj) => data.push(153, structs.putU64(obj.wdev!)),
+        wdev: (data, obj) => data.pushU64(153, obj.wdev!),
         userRegHintType: (data, obj) => data.push(154, obj.userRegHintType!),
         connFailedReason: (data, obj) => data.push(155, obj.connFailedReason!),
         authData: (data, obj) => data.push(156, obj.authData!),
         vhtCapability: (data, obj) => data.push(157, obj.vhtCapability!),
-        scanFlags: (data, obj) => data.push(158, structs.putU32(obj.scanFlags!)),
-        channelWidth: (data, obj) => data.push(159, structs.putU32(structs.putEnum(ChannelWidth, obj.channelWidth!))),
-        centerFreq1: (data, obj) => data.push(160, structs.putU32(obj.centerFreq1!)),
-        centerFreq2: (data, obj) => data.push(161, structs.putU32(obj.centerFreq2!)),
-        p2pCtwindow: (data, obj) => data.push(162, structs.putU8(obj.p2pCtwindow!)),
-        p2pOppps: (data, obj) => data.push(163, structs.putU8(obj.p2pOppps!)),
-        localMeshPowerMode: (data, obj) => data.push(164, structs.putU32(structs.putEnum(MeshPowerMode, obj.localMeshPowerMode!))),
-        aclPolicy: (data, obj) => data.push(165, structs.putU32(structs.putEnum(AclPolicy, obj.aclPolicy!))),
+        scanFlags: (data, obj) => data.pushU32(158, obj.scanFlags!),
+        channelWidth: (data, obj) => data.pushU32(159, structs.putEnum(ChannelWidth, obj.channelWidth!)),
+        centerFreq1: (data, obj) => data.pushU32(160, obj.centerFreq1!),
+        centerFreq2: (data, obj) => data.pushU32(161, obj.centerFreq2!),
+        p2pCtwindow: (data, obj) => data.pushU8(162, obj.p2pCtwindow!),
+        p2pOppps: (data, obj) => data.pushU8(163, obj.p2pOppps!),
+        localMeshPowerMode: (data, obj) => data.pushU32(164, structs.putEnum(MeshPowerMode, obj.localMeshPowerMode!)),
+        aclPolicy: (data, obj) => data.pushU32(165, structs.putEnum(AclPolicy, obj.aclPolicy!)),
         macAddrs: (data, obj) => data.push(166, structs.putArray(obj.macAddrs!, x => x)),
-        macAclMax: (data, obj) => data.push(167, structs.putU32(obj.macAclMax!)),
-        radarEvent: (data, obj) => data.push(168, structs.putU32(structs.putEnum(RadarEvent, obj.radarEvent!))),
+        macAclMax: (data, obj) => data.pushU32(167, obj.macAclMax!),
+        radarEvent: (data, obj) => data.pushU32(168, structs.putEnum(RadarEvent, obj.radarEvent!)),
         extCapa: (data, obj) => data.push(169, obj.extCapa!),
         extCapaMask: (data, obj) => data.push(170, obj.extCapaMask!),
-        staCapability: (data, obj) => data.push(171, structs.putU16(obj.staCapability!)),
+        staCapability: (data, obj) => data.pushU16(171, obj.staCapability!),
         staExtCapability: (data, obj) => data.push(172, obj.staExtCapability!),
-        protocolFeatures: (data, obj) => data.push(173, structs.putU32(formatProtocolFeatures(obj.protocolFeatures!))),
-        splitWiphyDump: (data, obj) => data.push(174, structs.putFlag(obj.splitWiphyDump!)),
-        disableVht: (data, obj) => data.push(175, structs.putFlag(obj.disableVht!)),
+        protocolFeatures: (data, obj) => data.pushU32(173, formatProtocolFeatures(obj.protocolFeatures!)),
+        splitWiphyDump: (data, obj) => data.pushFlag(174, obj.splitWiphyDump!),
+        disableVht: (data, obj) => data.pushFlag(175, obj.disableVht!),
         vhtCapabilityMask: (data, obj) => data.push(176, obj.vhtCapabilityMask!),
         mdid: (data, obj) => data.push(177, obj.mdid!),
         ieRic: (data, obj) => data.push(178, obj.ieRic!),
-        critProtId: (data, obj) => data.push(179, structs.putU16(structs.putEnum(CritProtoId, obj.critProtId!))),
-        maxCritProtDuration: (data, obj) => data.push(180, structs.putU16(obj.maxCritProtDuration!)),
-        peerAid: (data, obj) => data.push(181, structs.putU16(obj.peerAid!)),
+        critProtId: (data, obj) => data.pushU16(179, structs.putEnum(CritProtoId, obj.critProtId!)),
+        maxCritProtDuration: (data, obj) => data.pushU16(180, obj.maxCritProtDuration!),
+        peerAid: (data, obj) => data.pushU16(181, obj.peerAid!),
         coalesceRule: (data, obj) => data.push(182, obj.coalesceRule!),
-        chSwitchCount: (data, obj) => data.push(183, structs.putU32(obj.chSwitchCount!)),
-        chSwitchBlockTx: (data, obj) => data.push(184, structs.putFlag(obj.chSwitchBlockTx!)),
+        chSwitchCount: (data, obj) => data.pushU32(183, obj.chSwitchCount!),
+        chSwitchBlockTx: (data, obj) => data.pushFlag(184, obj.chSwitchBlockTx!),
         csaIes: (data, obj) => data.push(185, obj.csaIes!),
-        csaCOffBeacon: (data, obj) => data.push(186, structs.putU16(obj.csaCOffBeacon!)),
-        csaCOffPresp: (data, obj) => data.push(187, structs.putU16(obj.csaCOffPresp!)),
-        rxmgmtFlags: (data, obj) => data.push(188, structs.putU32(formatRxmgmtFlags(obj.rxmgmtFlags!))),
+        csaCOffBeacon: (data, obj) => data.pushU16(186, obj.csaCOffBeacon!),
+        csaCOffPresp: (data, obj) => data.pushU16(187, obj.csaCOffPresp!),
+        rxmgmtFlags: (data, obj) => data.pushU32(188, formatRxmgmtFlags(obj.rxmgmtFlags!)),
         staSupportedChannels: (data, obj) => data.push(189, obj.staSupportedChannels!),
         staSupportedOperClasses: (data, obj) => data.push(190, obj.staSupportedOperClasses!),
-        handleDfs: (data, obj) => data.push(191, structs.putFlag(obj.handleDfs!)),
-        support5Mhz: (data, obj) => data.push(192, structs.putFlag(obj.support5Mhz!)),
-        support10Mhz: (data, obj) => data.push(193, structs.putFlag(obj.support10Mhz!)),
-        opmodeNotif: (data, obj) => data.push(194, structs.putU8(obj.opmodeNotif!)),
-        vendorId: (data, obj) => data.push(195, structs.putU32(obj.vendorId!)),
-        vendorSubcmd: (data, obj) => data.push(196, structs.putU32(obj.vendorSubcmd!)),
+        handleDfs: (data, obj) => data.pushFlag(191, obj.handleDfs!),
+        support5Mhz: (data, obj) => data.pushFlag(192, obj.support5Mhz!),
+        support10Mhz: (data, obj) => data.pushFlag(193, obj.support10Mhz!),
+        opmodeNotif: (data, obj) => data.pushU8(194, obj.opmodeNotif!),
+        vendorId: (data, obj) => data.pushU32(195, obj.vendorId!),
+        vendorSubcmd: (data, obj) => data.pushU32(196, obj.vendorSubcmd!),
         vendorData: (data, obj) => data.push(197, obj.vendorData!),
         vendorEvents: (data, obj) => data.push(198, obj.vendorEvents!),
         qosMap: (data, obj) => data.push(199, obj.qosMap!),
         macHint: (data, obj) => data.push(200, obj.macHint!),
         wiphyFreqHint: (data, obj) => data.push(201, obj.wiphyFreqHint!),
-        maxApAssocSta: (data, obj) => data.push(202, structs.putU32(obj.maxApAssocSta!)),
-        tdlsPeerCapability: (data, obj) => data.push(203, structs.putU32(formatTdlsPeerCapability(obj.tdlsPeerCapability!))),
-        socketOwner: (data, obj) => data.push(204, structs.putFlag(obj.socketOwner!)),
-        csaCOffsetsTx: (data, obj) => data.push(205, structs.putU16(obj.csaCOffsetsTx!)),
-        maxCsaCounters: (data, obj) => data.push(206, structs.putU8(obj.maxCsaCounters!)),
-        tdlsInitiator: (data, obj) => data.push(207, structs.putFlag(obj.tdlsInitiator!)),
-        useRrm: (data, obj) => data.push(208, structs.putFlag(obj.useRrm!)),
-        wiphyDynAck: (data, obj) => data.push(209, structs.putFlag(obj.wiphyDynAck!)),
-        tsid: (data, obj) => data.push(210, structs.putU8(obj.tsid!)),
-        userPrio: (data, obj) => data.push(211, structs.putU8(obj.userPrio!)),
-        admittedTime: (data, obj) => data.push(212, structs.putU16(obj.admittedTime!)),
+        maxApAssocSta: (data, obj) => data.pushU32(202, obj.maxApAssocSta!),
+        tdlsPeerCapability: (data, obj) => data.pushU32(203, formatTdlsPeerCapability(obj.tdlsPeerCapability!)),
+        socketOwner: (data, obj) => data.pushFlag(204, obj.socketOwner!),
+        csaCOffsetsTx: (data, obj) => data.pushU16(205, obj.csaCOffsetsTx!),
+        maxCsaCounters: (data, obj) => data.pushU8(206, obj.maxCsaCounters!),
+        tdlsInitiator: (data, obj) => data.pushFlag(207, obj.tdlsInitiator!),
+        useRrm: (data, obj) => data.pushFlag(208, obj.useRrm!),
+        wiphyDynAck: (data, obj) => data.pushFlag(209, obj.wiphyDynAck!),
+        tsid: (data, obj) => data.pushU8(210, obj.tsid!),
+        userPrio: (data, obj) => data.pushU8(211, obj.userPrio!),
+        admittedTime: (data, obj) => data.pushU16(212, obj.admittedTime!),
         smpsMode: (data, obj) => data.push(213, obj.smpsMode!),
         operClass: (data, obj) => data.push(214, obj.operClass!),
         macMask: (data, obj) => data.push(215, obj.macMask!),
-        wiphySelfManagedReg: (data, obj) => data.push(216, structs.putFlag(obj.wiphySelfManagedReg!)),
+        wiphySelfManagedReg: (data, obj) => data.pushFlag(216, obj.wiphySelfManagedReg!),
         extFeatures: (data, obj) => data.push(217, obj.extFeatures!),
         surveyRadioStats: (data, obj) => data.push(218, obj.surveyRadioStats!),
-        netnsFd: (data, obj) => data.push(219, structs.putU32(obj.netnsFd!)),
-        schedScanDelay: (data, obj) => data.push(220, structs.putU32(obj.schedScanDelay!)),
-        regIndoor: (data, obj) => data.push(221, structs.putFlag(obj.regIndoor!)),
-        maxNumSchedScanPlans: (data, obj) => data.push(222, structs.putU32(obj.maxNumSchedScanPlans!)),
-        maxScanPlanInterval: (data, obj) => data.push(223, structs.putU32(obj.maxScanPlanInterval!)),
-        maxScanPlanIterations: (data, obj) => data.push(224, structs.putU32(obj.maxScanPlanIterations!)),
+        netnsFd: (data, obj) => data.pushU32(219, obj.netnsFd!),
+        schedScanDelay: (data, obj) => data.pushU32(220, obj.schedScanDelay!),
+        regIndoor: (data, obj) => data.pushFlag(221, obj.regIndoor!),
+        maxNumSchedScanPlans: (data, obj) => data.pushU32(222, obj.maxNumSchedScanPlans!),
+        maxScanPlanInterval: (data, obj) => data.pushU32(223, obj.maxScanPlanInterval!),
+        maxScanPlanIterations: (data, obj) => data.pushU32(224, obj.maxScanPlanIterations!),
         schedScanPlans: (data, obj) => data.push(225, formatScheduledScanPlan(obj.schedScanPlans!)),
-        pbss: (data, obj) => data.push(226, structs.putFlag(obj.pbss!)),
+        pbss: (data, obj) => data.pushFlag(226, obj.pbss!),
         bssSelect: (data, obj) => data.push(227, formatBssSelect(obj.bssSelect!)),
-        staSupportP2pPs: (data, obj) => data.push(228, structs.putU8(structs.putEnum(StationP2pPsStatus, obj.staSupportP2pPs!))),
+        staSupportP2pPs: (data, obj) => data.pushU8(228, structs.putEnum(StationP2pPsStatus, obj.staSupportP2pPs!)),
         __pad: (data, obj) => data.push(229, obj.__pad!),
         iftypeExtCapa: (data, obj) => data.push(230, obj.iftypeExtCapa!),
         muMimoGroupData: (data, obj) => data.push(231, obj.muMimoGroupData!),
         muMimoFollowMacAddr: (data, obj) => data.push(232, obj.muMimoFollowMacAddr!),
-        scanStartTimeTsf: (data, obj) => data.push(233, structs.putU64(obj.scanStartTimeTsf!)),
+        scanStartTimeTsf: (data, obj) => data.pushU64(233, obj.scanStartTimeTsf!),
         scanStartTimeTsfBssid: (data, obj) => data.push(234, obj.scanStartTimeTsfBssid!),
-        measurementDuration: (data, obj) => data.push(235, structs.putU16(obj.measurementDuration!)),
-        measurementDurationMandatory: (data, obj) => data.push(236, structs.putFlag(obj.measurementDurationMandatory!)),
-        meshPeerAid: (data, obj) => data.push(237, structs.putU16(obj.meshPeerAid!)),
-        nanMasterPref: (data, obj) => data.push(238, structs.putU8(obj.nanMasterPref!)),
-        bands: (data, obj) => data.push(239, structs.putU32(formatBandIdSet(obj.bands!))),
+        measurementDuration: (data, obj) => data.pushU16(235, obj.measurementDuration!),
+        measurementDurationMandatory: (data, obj) => data.pushFlag(236, obj.measurementDurationMandatory!),
+        meshPeerAid: (data, obj) => data.pushU16(237, obj.meshPeerAid!),
+        nanMasterPref: (data, obj) => data.pushU8(238, obj.nanMasterPref!),
+        bands: (data, obj) => data.pushU32(239, formatBandIdSet(obj.bands!)),
         nanFunc: (data, obj) => data.push(240, formatNanFunction(obj.nanFunc!)),
         nanMatch: (data, obj) => data.push(241, formatNanMatch(obj.nanMatch!)),
         filsKek: (data, obj) => data.push(242, obj.filsKek!),
         filsNonces: (data, obj) => data.push(243, obj.filsNonces!),
-        multicastToUnicastEnabled: (data, obj) => data.push(244, structs.putFlag(obj.multicastToUnicastEnabled!)),
+        multicastToUnicastEnabled: (data, obj) => data.pushFlag(244, obj.multicastToUnicastEnabled!),
         bssid: (data, obj) => data.push(245, obj.bssid!),
         schedScanRelativeRssi: (data, obj) => data.push(246, obj.schedScanRelativeRssi!),
         schedScanRssiAdjust: (data, obj) => data.push(247, obj.schedScanRssiAdjust!),
-        timeoutReason: (data, obj) => data.push(248, structs.putU32(structs.putEnum(TimeoutReason, obj.timeoutReason!))),
+        timeoutReason: (data, obj) => data.pushU32(248, structs.putEnum(TimeoutReason, obj.timeoutReason!)),
         filsErpUsername: (data, obj) => data.push(249, obj.filsErpUsername!),
         filsErpRealm: (data, obj) => data.push(250, obj.filsErpRealm!),
         filsErpNextSeqNum: (data, obj) => data.push(251, obj.filsErpNextSeqNum!),
         filsErpRrk: (data, obj) => data.push(252, obj.filsErpRrk!),
         filsCacheId: (data, obj) => data.push(253, obj.filsCacheId!),
         pmk: (data, obj) => data.push(254, obj.pmk!),
-        schedScanMulti: (data, obj) => data.push(255, structs.putFlag(obj.schedScanMulti!)),
-        schedScanMaxReqs: (data, obj) => data.push(256, structs.putU32(obj.schedScanMaxReqs!)),
-        want1x4wayHs: (data, obj) => data.push(257, structs.putFlag(obj.want1x4wayHs!)),
+        schedScanMulti: (data, obj) => data.pushFlag(255, obj.schedScanMulti!),
+        schedScanMaxReqs: (data, obj) => data.pushU32(256, obj.schedScanMaxReqs!),
+        want1x4wayHs: (data, obj) => data.pushFlag(257, obj.want1x4wayHs!),
         pmkr0Name: (data, obj) => data.push(258, obj.pmkr0Name!),
         portAuthorized: (data, obj) => data.push(259, obj.portAuthorized!),
-        externalAuthAction: (data, obj) => data.push(260, structs.putU32(structs.putEnum(ExternalAuthAction, obj.externalAuthAction!))),
-        externalAuthSupport: (data, obj) => data.push(261, structs.putFlag(obj.externalAuthSupport!)),
-        nss: (data, obj) => data.push(262, structs.putU8(obj.nss!)),
+        externalAuthAction: (data, obj) => data.pushU32(260, structs.putEnum(ExternalAuthAction, obj.externalAuthAction!)),
+        externalAuthSupport: (data, obj) => data.pushFlag(261, obj.externalAuthSupport!),
+        nss: (data, obj) => data.pushU8(262, obj.nss!),
         ackSignal: (data, obj) => data.push(263, obj.ackSignal!),
-        controlPortOverNl80211: (data, obj) => data.push(264, structs.putFlag(obj.controlPortOverNl80211!)),
+        controlPortOverNl80211: (data, obj) => data.pushFlag(264, obj.controlPortOverNl80211!),
         txqStats: (data, obj) => data.push(265, formatTxqStats(obj.txqStats!)),
-        txqLimit: (data, obj) => data.push(266, structs.putU32(obj.txqLimit!)),
-        txqMemoryLimit: (data, obj) => data.push(267, structs.putU32(obj.txqMemoryLimit!)),
-        txqQuantum: (data, obj) => data.push(268, structs.putU32(obj.txqQuantum!)),
+        txqLimit: (data, obj) => data.pushU32(266, obj.txqLimit!),
+        txqMemoryLimit: (data, obj) => data.pushU32(267, obj.txqMemoryLimit!),
+        txqQuantum: (data, obj) => data.pushU32(268, obj.txqQuantum!),
         heCapability: (data, obj) => data.push(269, obj.heCapability!),
         ftmResponder: (data, obj) => data.push(270, obj.ftmResponder!),
         ftmResponderStats: (data, obj) => data.push(271, formatFtmResponderStats(obj.ftmResponderStats!)),
-        timeout: (data, obj) => data.push(272, structs.putU32(obj.timeout!)),
+        timeout: (data, obj) => data.pushU32(272, obj.timeout!),
         peerMeasurements: (data, obj) => data.push(273, formatPeerMeasurement(obj.peerMeasurements!)),
-        airtimeWeight: (data, obj) => data.push(274, structs.putU16(obj.airtimeWeight!)),
-        staTxPowerSetting: (data, obj) => data.push(275, structs.putU8(structs.putEnum(TxPowerSetting, obj.staTxPowerSetting!))),
-        staTxPower: (data, obj) => data.push(276, structs.putS16(obj.staTxPower!)),
+        airtimeWeight: (data, obj) => data.pushU16(274, obj.airtimeWeight!),
+        staTxPowerSetting: (data, obj) => data.pushU8(275, structs.putEnum(TxPowerSetting, obj.staTxPowerSetting!)),
+        staTxPower: (data, obj) => data.pushS16(276, obj.staTxPower!),
         saePassword: (data, obj) => data.push(277, obj.saePassword!),
         twtResponder: (data, obj) => data.push(278, obj.twtResponder!),
         heObssPd: (data, obj) => data.push(279, obj.heObssPd!),
-        wiphyEdmgChannels: (data, obj) => data.push(280, structs.putU8(obj.wiphyEdmgChannels!)),
-        wiphyEdmgBwConfig: (data, obj) => data.push(281, structs.putU8(obj.wiphyEdmgBwConfig!)),
-        vlanId: (data, obj) => data.push(282, structs.putU16(obj.vlanId!)),
+        wiphyEdmgChannels: (data, obj) => data.pushU8(280, obj.wiphyEdmgChannels!),
+        wiphyEdmgBwConfig: (data, obj) => data.pushU8(281, obj.wiphyEdmgBwConfig!),
+        vlanId: (data, obj) => data.pushU16(282, obj.vlanId!),
     })
 }
 
@@ -3894,19 +4185,19 @@ export function parseInterfaceTypeSetAttr(r: Buffer): InterfaceTypeSet {
 /** Encodes a set of {@link InterfaceType} flags into a stream of attributes */
 export function formatInterfaceTypeSetAttr(x: InterfaceTypeSet): StreamData {
     return structs.putObject(x, {
-        unspecified: (data, obj) => data.push(InterfaceType.UNSPECIFIED, structs.putFlag(obj.unspecified!)),
-        adhoc: (data, obj) => data.push(InterfaceType.ADHOC, structs.putFlag(obj.adhoc!)),
-        station: (data, obj) => data.push(InterfaceType.STATION, structs.putFlag(obj.station!)),
-        ap: (data, obj) => data.push(InterfaceType.AP, structs.putFlag(obj.ap!)),
-        apVlan: (data, obj) => data.push(InterfaceType.AP_VLAN, structs.putFlag(obj.apVlan!)),
-        wds: (data, obj) => data.push(InterfaceType.WDS, structs.putFlag(obj.wds!)),
-        monitor: (data, obj) => data.push(InterfaceType.MONITOR, structs.putFlag(obj.monitor!)),
-        meshPoint: (data, obj) => data.push(InterfaceType.MESH_POINT, structs.putFlag(obj.meshPoint!)),
-        p2pClient: (data, obj) => data.push(InterfaceType.P2P_CLIENT, structs.putFlag(obj.p2pClient!)),
-        p2pGo: (data, obj) => data.push(InterfaceType.P2P_GO, structs.putFlag(obj.p2pGo!)),
-        p2pDevice: (data, obj) => data.push(InterfaceType.P2P_DEVICE, structs.putFlag(obj.p2pDevice!)),
-        ocb: (data, obj) => data.push(InterfaceType.OCB, structs.putFlag(obj.ocb!)),
-        nan: (data, obj) => data.push(InterfaceType.NAN, structs.putFlag(obj.nan!)),
+        unspecified: (data, obj) => data.pushFlag(InterfaceType.UNSPECIFIED, obj.unspecified!),
+        adhoc: (data, obj) => data.pushFlag(InterfaceType.ADHOC, obj.adhoc!),
+        station: (data, obj) => data.pushFlag(InterfaceType.STATION, obj.station!),
+        ap: (data, obj) => data.pushFlag(InterfaceType.AP, obj.ap!),
+        apVlan: (data, obj) => data.pushFlag(InterfaceType.AP_VLAN, obj.apVlan!),
+        wds: (data, obj) => data.pushFlag(InterfaceType.WDS, obj.wds!),
+        monitor: (data, obj) => data.pushFlag(InterfaceType.MONITOR, obj.monitor!),
+        meshPoint: (data, obj) => data.pushFlag(InterfaceType.MESH_POINT, obj.meshPoint!),
+        p2pClient: (data, obj) => data.pushFlag(InterfaceType.P2P_CLIENT, obj.p2pClient!),
+        p2pGo: (data, obj) => data.pushFlag(InterfaceType.P2P_GO, obj.p2pGo!),
+        p2pDevice: (data, obj) => data.pushFlag(InterfaceType.P2P_DEVICE, obj.p2pDevice!),
+        ocb: (data, obj) => data.pushFlag(InterfaceType.OCB, obj.ocb!),
+        nan: (data, obj) => data.pushFlag(InterfaceType.NAN, obj.nan!),
     })
 }
 
@@ -3965,16 +4256,32 @@ export function parseStationFlags(r: Buffer): StationFlags {
     })
 }
 
+/** Decoders of the attributes of a {@link StationFlags} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_StationFlags: structs.LazyFields = {
+    1: ['authorized', data => structs.getFlag(data)],
+    2: ['shortPreamble', data => structs.getFlag(data)],
+    3: ['wme', data => structs.getFlag(data)],
+    4: ['mfp', data => structs.getFlag(data)],
+    5: ['authenticated', data => structs.getFlag(data)],
+    6: ['tdlsPeer', data => structs.getFlag(data)],
+    7: ['associated', data => structs.getFlag(data)],
+}
+
+/** Like {@link parseStationFlags}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseStationFlagsLazy(r: Buffer): StationFlags {
+    return structs.getLazyObject(r, __LAZY_StationFlags)
+}
+
 /** Encodes a {@link StationFlags} object into a stream of attributes */
 export function formatStationFlags(x: StationFlags): StreamData {
     return structs.putObject(x, {
-        authorized: (data, obj) => data.push(1, structs.putFlag(obj.authorized!)),
-        shortPreamble: (data, obj) => data.push(2, structs.putFlag(obj.shortPreamble!)),
-        wme: (data, obj) => data.push(3, structs.putFlag(obj.wme!)),
-        mfp: (data, obj) => data.push(4, structs.putFlag(obj.mfp!)),
-        authenticated: (data, obj) => data.push(5, structs.putFlag(obj.authenticated!)),
-        tdlsPeer: (data, obj) => data.push(6, structs.putFlag(obj.tdlsPeer!)),
-        associated: (data, obj) => data.push(7, structs.putFlag(obj.associated!)),
+        authorized: (data, obj) => data.pushFlag(1, obj.authorized!),
+        shortPreamble: (data, obj) => data.pushFlag(2, obj.shortPreamble!),
+        wme: (data, obj) => data.pushFlag(3, obj.wme!),
+        mfp: (data, obj) => data.pushFlag(4, obj.mfp!),
+        authenticated: (data, obj) => data.pushFlag(5, obj.authenticated!),
+        tdlsPeer: (data, obj) => data.pushFlag(6, obj.tdlsPeer!),
+        associated: (data, obj) => data.pushFlag(7, obj.associated!),
     })
 }
 
@@ -4132,26 +4439,52 @@ export function parseRateInfo(r: Buffer): RateInfo {
     })
 }
 
+/** Decoders of the attributes of a {@link RateInfo} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_RateInfo: structs.LazyFields = {
+    1: ['bitrate', data => structs.getU16(data)],
+    2: ['mcs', data => structs.getU8(data)],
+    3: ['_40MhzWidth', data => data],
+    4: ['shortGi', data => data],
+    5: ['bitrate32', data => structs.getU32(data)],
+    6: ['vhtMcs', data => structs.getU8(data)],
+    7: ['vhtNss', data => structs.getU8(data)],
+    8: ['_80MhzWidth', data => data],
+    9: ['_80p80MhzWidth', data => data],
+    10: ['_160MhzWidth', data => data],
+    11: ['_10MhzWidth', data => data],
+    12: ['_5MhzWidth', data => data],
+    13: ['heMcs', data => structs.getU8(data)],
+    14: ['heNss', data => structs.getU8(data)],
+    15: ['heGi', data => structs.getEnum(HeGuardInterval, structs.getU8(data))],
+    16: ['heDcm', data => structs.getU8(data)],
+    17: ['heRuAlloc', data => structs.getEnum(HeRuAllocation, structs.getU8(data))],
+}
+
+/** Like {@link parseRateInfo}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseRateInfoLazy(r: Buffer): RateInfo {
+    return structs.getLazyObject(r, __LAZY_RateInfo)
+}
+
 /** Encodes a {@link RateInfo} object into a stream of attributes */
 export function formatRateInfo(x: RateInfo): StreamData {
     return structs.putObject(x, {
-        bitrate: (data, obj) => data.push(1, structs.putU16(obj.bitrate!)),
-        mcs: (data, obj) => data.push(2, structs.putU8(obj.mcs!)),
+        bitrate: (data, obj) => data.pushU16(1, obj.bitrate!),
+        mcs: (data, obj) => data.pushU8(2, obj.mcs!),
         _40MhzWidth: (data, obj) => data.push(3, obj._40MhzWidth!),
         shortGi: (data, obj) => data.push(4, obj.shortGi!),
-        bitrate32: (data, obj) => data.push(5, structs.putU32(obj.bitrate32!)),
-        vhtMcs: (data, obj) => data.push(6, structs.putU8(obj.vhtMcs!)),
-        vhtNss: (data, obj) => data.push(7, structs.putU8(obj.vhtNss!)),
+        bitrate32: (data, obj) => data.pushU32(5, obj.bitrate32!),
+        vhtMcs: (data, obj) => data.pushU8(6, obj.vhtMcs!),
+        vhtNss: (data, obj) => data.pushU8(7, obj.vhtNss!),
         _80MhzWidth: (data, obj) => data.push(8, obj._80MhzWidth!),
         _80p80MhzWidth: (data, obj) => data.push(9, obj._80p80MhzWidth!),
         _160MhzWidth: (data, obj) => data.push(10, obj._160MhzWidth!),
         _10MhzWidth: (data, obj) => data.push(11, obj._10MhzWidth!),
         _5MhzWidth: (data, obj) => data.push(12, obj._5MhzWidth!),
-        heMcs: (data, obj) => data.push(13, structs.putU8(obj.heMcs!)),
-        heNss: (data, obj) => data.push(14, structs.putU8(obj.heNss!)),
-        heGi: (data, obj) => data.push(15, structs.putU8(structs.putEnum(HeGuardInterval, obj.heGi!))),
-        heDcm: (data, obj) => data.push(16, structs.putU8(obj.heDcm!)),
-        heRuAlloc: (data, obj) => data.push(17, structs.putU8(structs.putEnum(HeRuAllocation, obj.heRuAlloc!))),
+        heMcs: (data, obj) => data.pushU8(13, obj.heMcs!),
+        heNss: (data, obj) => data.pushU8(14, obj.heNss!),
+        heGi: (data, obj) => data.pushU8(15, structs.putEnum(HeGuardInterval, obj.heGi!)),
+        heDcm: (data, obj) => data.pushU8(16, obj.heDcm!),
+        heRuAlloc: (data, obj) => data.pushU8(17, structs.putEnum(HeRuAllocation, obj.heRuAlloc!)),
     })
 }
 
@@ -4195,14 +4528,28 @@ export function parseStationBssParam(r: Buffer): StationBssParam {
     })
 }
 
+/** Decoders of the attributes of a {@link StationBssParam} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_StationBssParam: structs.LazyFields = {
+    1: ['ctsProt', data => structs.getFlag(data)],
+    2: ['shortPreamble', data => structs.getFlag(data)],
+    3: ['shortSlotTime', data => structs.getFlag(data)],
+    4: ['dtimPeriod', data => structs.getU8(data)],
+    5: ['beaconInterval', data => structs.getU16(data)],
+}
+
+/** Like {@link parseStationBssParam}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseStationBssParamLazy(r: Buffer): StationBssParam {
+    return structs.getLazyObject(r, __LAZY_StationBssParam)
+}
+
 /** Encodes a {@link StationBssParam} object into a stream of attributes */
 export function formatStationBssParam(x: StationBssParam): StreamData {
     return structs.putObject(x, {
-        ctsProt: (data, obj) => data.push(1, structs.putFlag(obj.ctsProt!)),
-        shortPreamble: (data, obj) => data.push(2, structs.putFlag(obj.shortPreamble!)),
-        shortSlotTime: (data, obj) => data.push(3, structs.putFlag(obj.shortSlotTime!)),
-        dtimPeriod: (data, obj) => data.push(4, structs.putU8(obj.dtimPeriod!)),
-        beaconInterval: (data, obj) => data.push(5, structs.putU16(obj.beaconInterval!)),
+        ctsProt: (data, obj) => data.pushFlag(1, obj.ctsProt!),
+        shortPreamble: (data, obj) => data.pushFlag(2, obj.shortPreamble!),
+        shortSlotTime: (data, obj) => data.pushFlag(3, obj.shortSlotTime!),
+        dtimPeriod: (data, obj) => data.pushU8(4, obj.dtimPeriod!),
+        beaconInterval: (data, obj) => data.pushU16(5, obj.beaconInterval!),
     })
 }
 
@@ -4465,51 +4812,102 @@ export function parseStationInfo(r: Buffer): StationInfo {
     })
 }
 
+/** Decoders of the attributes of a {@link StationInfo} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_StationInfo: structs.LazyFields = {
+    1: ['inactiveTime', data => structs.getU32(data)],
+    2: ['rxBytes', data => structs.getU32(data)],
+    3: ['txBytes', data => structs.getU32(data)],
+    4: ['llid', data => structs.getU16(data)],
+    5: ['plid', data => structs.getU16(data)],
+    6: ['plinkState', data => structs.getEnum(PlinkState, structs.getU8(data))],
+    7: ['signal', data => structs.getU8(data)],
+    8: ['txBitrate', data => parseRateInfoLazy(data)],
+    9: ['rxPackets', data => structs.getU32(data)],
+    10: ['txPackets', data => structs.getU32(data)],
+    11: ['txRetries', data => structs.getU32(data)],
+    12: ['txFailed', data => structs.getU32(data)],
+    13: ['signalAvg', data => structs.getU8(data)],
+    14: ['rxBitrate', data => data],
+    15: ['bssParam', data => parseStationBssParamLazy(data)],
+    16: ['connectedTime', data => structs.getU32(data)],
+    17: ['staFlags', data => data],
+    18: ['beaconLoss', data => structs.getU32(data)],
+    19: ['tOffset', data => structs.getS64(data)],
+    20: ['localPm', data => data],
+    21: ['peerPm', data => data],
+    22: ['nonpeerPm', data => data],
+    23: ['rxBytes64', data => structs.getU64(data)],
+    24: ['txBytes64', data => structs.getU64(data)],
+    25: ['chainSignal', data => structs.getU8(data)],
+    26: ['chainSignalAvg', data => data],
+    27: ['expectedThroughput', data => structs.getU32(data)],
+    28: ['rxDropMisc', data => structs.getU64(data)],
+    29: ['beaconRx', data => structs.getU64(data)],
+    30: ['beaconSignalAvg', data => structs.getU8(data)],
+    31: ['tidStats', data => structs.getMap(data, x => parseTidStatsLazy(x))],
+    32: ['rxDuration', data => structs.getU64(data)],
+    33: ['__pad', data => data],
+    34: ['ackSignal', data => structs.getU8(data)],
+    35: ['ackSignalAvg', data => structs.getS8(data)],
+    36: ['rxMpdus', data => structs.getU32(data)],
+    37: ['fcsErrorCount', data => structs.getU32(data)],
+    38: ['connectedToGate', data => structs.getU8(data)],
+    39: ['txDuration', data => structs.getU64(data)],
+    40: ['airtimeWeight', data => structs.getU16(data)],
+    41: ['airtimeLinkMetric', data => data],
+    42: ['assocAtBoottime', data => structs.getU64(data)],
+}
+
+/** Like {@link parseStationInfo}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseStationInfoLazy(r: Buffer): StationInfo {
+    return structs.getLazyObject(r, __LAZY_StationInfo)
+}
+
 /** Encodes a {@link StationInfo} object into a stream of attributes */
 export function formatStationInfo(x: StationInfo): StreamData {
     return structs.putObject(x, {
-        inactiveTime: (data, obj) => data.push(1, structs.putU32(obj.inactiveTime!)),
-        rxBytes: (data, obj) => data.push(2, structs.putU32(obj.rxBytes!)),
-        txBytes: (data, obj) => data.push(3, structs.putU32(obj.txBytes!)),
-        llid: (data, obj) => data.push(4, structs.putU16(obj.llid!)),
-        plid: (data, obj) => data.push(5, structs.putU16(obj.plid!)),
-        plinkState: (data, obj) => data.push(6, structs.putU8(structs.putEnum(PlinkState, obj.plinkState!))),
-        signal: (data, obj) => data.push(7, structs.putU8(obj.signal!)),
+        inactiveTime: (data, obj) => data.pushU32(1, obj.inactiveTime!),
+        rxBytes: (data, obj) => data.pushU32(2, obj.rxBytes!),
+        txBytes: (data, obj) => data.pushU32(3, obj.txBytes!),
+        llid: (data, obj) => data.pushU16(4, obj.llid!),
+        plid: (data, obj) => data.pushU16(5, obj.plid!),
+        plinkState: (data, obj) => data.pushU8(6, structs.putEnum(PlinkState, obj.plinkState!)),
+        signal: (data, obj) => data.pushU8(7, obj.signal!),
         txBitrate: (data, obj) => data.push(8, formatRateInfo(obj.txBitrate!)),
-        rxPackets: (data, obj) => data.push(9, structs.putU32(obj.rxPackets!)),
-        txPackets: (data, obj) => data.push(10, structs.putU32(obj.txPackets!)),
-        txRetries: (data, obj) => data.push(11, structs.putU32(obj.txRetries!)),
-        txFailed: (data, obj) => data.push(12, structs.putU32(obj.txFailed!)),
-        signalAvg: (data, obj) => data.push(13, structs.putU8(obj.signalAvg!)),
+        rxPackets: (data, obj) => data.pushU32(9, obj.rxPackets!),
+        txPackets: (data, obj) => data.pushU32(10, obj.txPackets!),
+        txRetries: (data, obj) => data.pushU32(11, obj.txRetries!),
+        txFailed: (data, obj) => data.pushU32(12, obj.txFailed!),
+        signalAvg: (data, obj) => data.pushU8(13, obj.signalAvg!),
         rxBitrate: (data, obj) => data.push(14, obj.rxBitrate!),
         bssParam: (data, obj) => data.push(15, formatStationBssParam(obj.bssParam!)),
-        connectedTime: (data, obj) => data.push(16, structs.putU32(obj.connectedTime!)),
+        connectedTime: (data, obj) => data.pushU32(16, obj.connectedTime!),
         staFlags: (data, obj) => data.push(17, obj.staFlags!),
-        beaconLoss: (data, obj) => data.push(18, structs.putU32(obj.beaconLoss!)),
-        tOffset: (data, obj) => data.push(19, structs.putS64(obj.tOffset!)),
+        beaconLoss: (data, obj) => data.pushU32(18, obj.beaconLoss!),
+        tOffset: (data, obj) => data.pushS64(19, obj.tOffset!),
         localPm: (data, obj) => data.push(20, obj.localPm!),
         peerPm: (data, obj) => data.push(21, obj.peerPm!),
         nonpeerPm: (data, obj) => data.push(22, obj.nonpeerPm!),
-        rxBytes64: (data, obj) => data.push(23, structs.putU64(obj.rxBytes64!)),
-        txBytes64: (data, obj) => data.push(24, structs.putU64(obj.txBytes64!)),
-        chainSignal: (data, obj) => data.push(25, structs.putU8(obj.chainSignal!)),
+        rxBytes64: (data, obj) => data.pushU64(23, obj.rxBytes64!),
+        txBytes64: (data, obj) => data.pushU64(24, obj.txBytes64!),
+        chainSignal: (data, obj) => data.pushU8(25, obj.chainSignal!),
         chainSignalAvg: (data, obj) => data.push(26, obj.chainSignalAvg!),
-        expectedThroughput: (data, obj) => data.push(27, structs.putU32(obj.expectedThroughput!)),
-        rxDropMisc: (data, obj) => data.push(28, structs.putU64(obj.rxDropMisc!)),
-        beaconRx: (data, obj) => data.push(29, structs.putU64(obj.beaconRx!)),
-        beaconSignalAvg: (data, obj) => data.push(30, structs.putU8(obj.beaconSignalAvg!)),
+        expectedThroughput: (data, obj) => data.pushU32(27, obj.expectedThroughput!),
+        rxDropMisc: (data, obj) => data.pushU64(28, obj.rxDropMisc!),
+        beaconRx: (data, obj) => data.pushU64(29, obj.beaconRx!),
+        beaconSignalAvg: (data, obj) => data.pushU8(30, obj.beaconSignalAvg!),
         tidStats: (data, obj) => data.push(31, structs.putMap(obj.tidStats!, x => formatTidStats(x))),
-        rxDuration: (data, obj) => data.push(32, structs.putU64(obj.rxDuration!)),
+        rxDuration: (data, obj) => data.pushU64(32, obj.rxDuration!),
         __pad: (data, obj) => data.push(33, obj.__pad!),
-        ackSignal: (data, obj) => data.push(34, structs.putU8(obj.ackSignal!)),
-        ackSignalAvg: (data, obj) => data.push(35, structs.putS8(obj.ackSignalAvg!)),
-        rxMpdus: (data, obj) => data.push(36, structs.putU32(obj.rxMpdus!)),
-        fcsErrorCount: (data, obj) => data.push(37, structs.putU32(obj.fcsErrorCount!)),
-        connectedToGate: (data, obj) => data.push(38, structs.putU8(obj.connectedToGate!)),
-        txDuration: (data, obj) => data.push(39, structs.putU64(obj.txDuration!)),
-        airtimeWeight: (data, obj) => data.push(40, structs.putU16(obj.airtimeWeight!)),
+        ackSignal: (data, obj) => data.pushU8(34, obj.ackSignal!),
+        ackSignalAvg: (data, obj) => data.pushS8(35, obj.ackSignalAvg!),
+        rxMpdus: (data, obj) => data.pushU32(36, obj.rxMpdus!),
+        fcsErrorCount: (data, obj) => data.pushU32(37, obj.fcsErrorCount!),
+        connectedToGate: (data, obj) => data.pushU8(38, obj.connectedToGate!),
+        txDuration: (data, obj) => data.pushU64(39, obj.txDuration!),
+        airtimeWeight: (data, obj) => data.pushU16(40, obj.airtimeWeight!),
         airtimeLinkMetric: (data, obj) => data.push(41, obj.airtimeLinkMetric!),
-        assocAtBoottime: (data, obj) => data.push(42, structs.putU64(obj.assocAtBoottime!)),
+        assocAtBoottime: (data, obj) => data.pushU64(42, obj.assocAtBoottime!),
     })
 }
 
@@ -4555,13 +4953,28 @@ export function parseTidStats(r: Buffer): TidStats {
     })
 }
 
+/** Decoders of the attributes of a {@link TidStats} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_TidStats: structs.LazyFields = {
+    1: ['rxMsdu', data => structs.getU64(data)],
+    2: ['txMsdu', data => structs.getU64(data)],
+    3: ['txMsduRetries', data => structs.getU64(data)],
+    4: ['txMsduFailed', data => structs.getU64(data)],
+    5: ['__pad', data => data],
+    6: ['txqStats', data => parseTxqStatsLazy(data)],
+}
+
+/** Like {@link parseTidStats}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseTidStatsLazy(r: Buffer): TidStats {
+    return structs.getLazyObject(r, __LAZY_TidStats)
+}
+
 /** Encodes a {@link TidStats} object into a stream of attributes */
 export function formatTidStats(x: TidStats): StreamData {
     return structs.putObject(x, {
-        rxMsdu: (data, obj) => data.push(1, structs.putU64(obj.rxMsdu!)),
-        txMsdu: (data, obj) => data.push(2, structs.putU64(obj.txMsdu!)),
-        txMsduRetries: (data, obj) => data.push(3, structs.putU64(obj.txMsduRetries!)),
-        txMsduFailed: (data, obj) => data.push(4, structs.putU64(obj.txMsduFailed!)),
+        rxMsdu: (data, obj) => data.pushU64(1, obj.rxMsdu!),
+        txMsdu: (data, obj) => data.pushU64(2, obj.txMsdu!),
+        txMsduRetries: (data, obj) => data.pushU64(3, obj.txMsduRetries!),
+        txMsduFailed: (data, obj) => data.pushU64(4, obj.txMsduFailed!),
         __pad: (data, obj) => data.push(5, obj.__pad!),
         txqStats: (data, obj) => data.push(6, formatTxqStats(obj.txqStats!)),
     })
@@ -4626,6 +5039,26 @@ export function parseTxqStats(r: Buffer): TxqStats {
     })
 }
 
+/** Decoders of the attributes of a {@link TxqStats} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_TxqStats: structs.LazyFields = {
+    1: ['backlogBytes', data => data],
+    2: ['backlogPackets', data => data],
+    3: ['flows', data => data],
+    4: ['drops', data => data],
+    5: ['ecnMarks', data => data],
+    6: ['overlimit', data => data],
+    7: ['overmemory', data => data],
+    8: ['collisions', data => data],
+    9: ['txBytes', data => data],
+    10: ['txPackets', data => data],
+    11: ['maxFlows', data => data],
+}
+
+/** Like {@link parseTxqStats}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseTxqStatsLazy(r: Buffer): TxqStats {
+    return structs.getLazyObject(r, __LAZY_TxqStats)
+}
+
 /** Encodes a {@link TxqStats} object into a stream of attributes */
 export function formatTxqStats(x: TxqStats): StreamData {
     return structs.putObject(x, {
@@ -4739,16 +5172,34 @@ export function parseMpathInfo(r: Buffer): MpathInfo {
     })
 }
 
+/** Decoders of the attributes of a {@link MpathInfo} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_MpathInfo: structs.LazyFields = {
+    1: ['frameQlen', data => structs.getU32(data)],
+    2: ['sn', data => structs.getU32(data)],
+    3: ['metric', data => structs.getU32(data)],
+    4: ['exptime', data => structs.getU32(data)],
+    5: ['flags', data => parseMpathFlags(structs.getU8(data))],
+    6: ['discoveryTimeout', data => structs.getU32(data)],
+    7: ['discoveryRetries', data => structs.getU8(data)],
+    8: ['hopCount', data => data],
+    9: ['pathChange', data => data],
+}
+
+/** Like {@link parseMpathInfo}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseMpathInfoLazy(r: Buffer): MpathInfo {
+    return structs.getLazyObject(r, __LAZY_MpathInfo)
+}
+
 /** Encodes a {@link MpathInfo} object into a stream of attributes */
 export function formatMpathInfo(x: MpathInfo): StreamData {
     return structs.putObject(x, {
-        frameQlen: (data, obj) => data.push(1, structs.putU32(obj.frameQlen!)),
-        sn: (data, obj) => data.push(2, structs.putU32(obj.sn!)),
-        metric: (data, obj) => data.push(3, structs.putU32(obj.metric!)),
-        exptime: (data, obj) => data.push(4, structs.putU32(obj.exptime!)),
-        flags: (data, obj) => data.push(5, structs.putU8(formatMpathFlags(obj.flags!))),
-        discoveryTimeout: (data, obj) => data.push(6, structs.putU32(obj.discoveryTimeout!)),
-        discoveryRetries: (data, obj) => data.push(7, structs.putU8(obj.discoveryRetries!)),
+        frameQlen: (data, obj) => data.pushU32(1, obj.frameQlen!),
+        sn: (data, obj) => data.pushU32(2, obj.sn!),
+        metric: (data, obj) => data.pushU32(3, obj.metric!),
+        exptime: (data, obj) => data.pushU32(4, obj.exptime!),
+        flags: (data, obj) => data.pushU8(5, formatMpathFlags(obj.flags!)),
+        discoveryTimeout: (data, obj) => data.pushU32(6, obj.discoveryTimeout!),
+        discoveryRetries: (data, obj) => data.pushU8(7, obj.discoveryRetries!),
         hopCount: (data, obj) => data.push(8, obj.hopCount!),
         pathChange: (data, obj) => data.push(9, obj.pathChange!),
     })
@@ -4798,6 +5249,20 @@ export function parseBandInterfaceType(r: Buffer): BandInterfaceType {
     })
 }
 
+/** Decoders of the attributes of a {@link BandInterfaceType} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_BandInterfaceType: structs.LazyFields = {
+    1: ['iftypes', data => parseInterfaceTypeSetAttr(data)],
+    2: ['heCapMac', data => data],
+    3: ['heCapPhy', data => data],
+    4: ['heCapMcsSet', data => data],
+    5: ['heCapPpe', data => data],
+}
+
+/** Like {@link parseBandInterfaceType}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseBandInterfaceTypeLazy(r: Buffer): BandInterfaceType {
+    return structs.getLazyObject(r, __LAZY_BandInterfaceType)
+}
+
 /** Encodes a {@link BandInterfaceType} object into a stream of attributes */
 export function formatBandInterfaceType(x: BandInterfaceType): StreamData {
     return structs.putObject(x, {
@@ -4885,17 +5350,37 @@ export function parseBand(r: Buffer): Band {
     })
 }
 
+/** Decoders of the attributes of a {@link Band} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Band: structs.LazyFields = {
+    1: ['freqs', data => structs.getArray(data, x => parseFrequencyLazy(x), { zero: true })],
+    2: ['rates', data => structs.getArray(data, x => parseBitrateLazy(x), { zero: true })],
+    3: ['htMcsSet', data => data],
+    4: ['htCapa', data => structs.getU16(data)],
+    5: ['htAmpduFactor', data => structs.getU8(data)],
+    6: ['htAmpduDensity', data => structs.getU8(data)],
+    7: ['vhtMcsSet', data => data],
+    8: ['vhtCapa', data => structs.getU32(data)],
+    9: ['iftypeData', data => structs.getArray(data, x => parseBandInterfaceTypeLazy(x))],
+    10: ['edmgChannels', data => data],
+    11: ['edmgBwConfig', data => data],
+}
+
+/** Like {@link parseBand}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseBandLazy(r: Buffer): Band {
+    return structs.getLazyObject(r, __LAZY_Band)
+}
+
 /** Encodes a {@link Band} object into a stream of attributes */
 export function formatBand(x: Band): StreamData {
     return structs.putObject(x, {
         freqs: (data, obj) => data.push(1, structs.putArray(obj.freqs!, x => formatFrequency(x), { zero: true })),
         rates: (data, obj) => data.push(2, structs.putArray(obj.rates!, x => formatBitrate(x), { zero: true })),
         htMcsSet: (data, obj) => data.push(3, obj.htMcsSet!),
-        htCapa: (data, obj) => data.push(4, structs.putU16(obj.htCapa!)),
-        htAmpduFactor: (data, obj) => data.push(5, structs.putU8(obj.htAmpduFactor!)),
-        htAmpduDensity: (data, obj) => data.push(6, structs.putU8(obj.htAmpduDensity!)),
+        htCapa: (data, obj) => data.pushU16(4, obj.htCapa!),
+        htAmpduFactor: (data, obj) => data.pushU8(5, obj.htAmpduFactor!),
+        htAmpduDensity: (data, obj) => data.pushU8(6, obj.htAmpduDensity!),
         vhtMcsSet: (data, obj) => data.push(7, obj.vhtMcsSet!),
-        vhtCapa: (data, obj) => data.push(8, structs.putU32(obj.vhtCapa!)),
+        vhtCapa: (data, obj) => data.pushU32(8, obj.vhtCapa!),
         iftypeData: (data, obj) => data.push(9, structs.putArray(obj.iftypeData!, x => formatBandInterfaceType(x))),
         edmgChannels: (data, obj) => data.push(10, obj.edmgChannels!),
         edmgBwConfig: (data, obj) => data.push(11, obj.edmgBwConfig!),
@@ -4927,6 +5412,19 @@ export function parseWmmRule(r: Buffer): WmmRule {
     })
 }
 
+/** Decoders of the attributes of a {@link WmmRule} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_WmmRule: structs.LazyFields = {
+    1: ['cwMin', data => data],
+    2: ['cwMax', data => data],
+    3: ['aifsn', data => data],
+    4: ['txop', data => data],
+}
+
+/** Like {@link parseWmmRule}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseWmmRuleLazy(r: Buffer): WmmRule {
+    return structs.getLazyObject(r, __LAZY_WmmRule)
+}
+
 /** Encodes a {@link WmmRule} object into a stream of attributes */
 export function formatWmmRule(x: WmmRule): StreamData {
     return structs.putObject(x, {
@@ -5086,26 +5584,53 @@ export function parseFrequency(r: Buffer): Frequency {
     })
 }
 
+/** Decoders of the attributes of a {@link Frequency} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Frequency: structs.LazyFields = {
+    1: ['freq', data => structs.getU32(data)],
+    2: ['disabled', data => structs.getFlag(data)],
+    3: ['noIr', data => structs.getFlag(data)],
+    4: ['__noIbss', data => structs.getFlag(data)],
+    5: ['radar', data => structs.getFlag(data)],
+    6: ['maxTxPower', data => structs.getU32(data)],
+    7: ['dfsState', data => structs.getEnum(DfsState, structs.getU32(data))],
+    8: ['dfsTime', data => structs.getU32(data)],
+    9: ['noHt40Minus', data => structs.getFlag(data)],
+    10: ['noHt40Plus', data => structs.getFlag(data)],
+    11: ['no80mhz', data => structs.getFlag(data)],
+    12: ['no160mhz', data => structs.getFlag(data)],
+    13: ['dfsCacTime', data => structs.getU32(data)],
+    14: ['indoorOnly', data => structs.getFlag(data)],
+    15: ['irConcurrent', data => structs.getFlag(data)],
+    16: ['no20mhz', data => structs.getFlag(data)],
+    17: ['no10mhz', data => structs.getFlag(data)],
+    18: ['wmm', data => parseWmmRuleLazy(data)],
+}
+
+/** Like {@link parseFrequency}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseFrequencyLazy(r: Buffer): Frequency {
+    return structs.getLazyObject(r, __LAZY_Frequency)
+}
+
 /** Encodes a {@link Frequency} object into a stream of attributes */
 export function formatFrequency(x: Frequency): StreamData {
     return structs.putObject(x, {
-        freq: (data, obj) => data.push(1, structs.putU32(obj.freq!)),
-        disabled: (data, obj) => data.push(2, structs.putFlag(obj.disabled!)),
-        noIr: (data, obj) => data.push(3, structs.putFlag(obj.noIr!)),
-        __noIbss: (data, obj) => data.push(4, structs.putFlag(obj.__noIbss!)),
-        radar: (data, obj) => data.push(5, structs.putFlag(obj.radar!)),
-        maxTxPower: (data, obj) => data.push(6, structs.putU32(obj.maxTxPower!)),
-        dfsState: (data, obj) => data.push(7, structs.putU32(structs.putEnum(DfsState, obj.dfsState!))),
-        dfsTime: (data, obj) => data.push(8, structs.putU32(obj.dfsTime!)),
-        noHt40Minus: (data, obj) => data.push(9, structs.putFlag(obj.noHt40Minus!)),
-        noHt40Plus: (data, obj) => data.push(10, structs.putFlag(obj.noHt40Plus!)),
-        no80mhz: (data, obj) => data.push(11, structs.putFlag(obj.no80mhz!)),
-        no160mhz: (data, obj) => data.push(12, structs.putFlag(obj.no160mhz!)),
-        dfsCacTime: (data, obj) => data.push(13, structs.putU32(obj.dfsCacTime!)),
-        indoorOnly: (data, obj) => data.push(14, structs.putFlag(obj.indoorOnly!)),
-        irConcurrent: (data, obj) => data.push(15, structs.putFlag(obj.irConcurrent!)),
-        no20mhz: (data, obj) => data.push(16, structs.putFlag(obj.no20mhz!)),
-        no10mhz: (data, obj) => data.push(17, structs.putFlag(obj.no10mhz!)),
+        freq: (data, obj) => data.pushU32(1, obj.freq!),
+        disabled: (data, obj) => data.pushFlag(2, obj.disabled!),
+        noIr: (data, obj) => data.pushFlag(3, obj.noIr!),
+        __noIbss: (data, obj) => data.pushFlag(4, obj.__noIbss!),
+        radar: (data, obj) => data.pushFlag(5, obj.radar!),
+        maxTxPower: (data, obj) => data.pushU32(6, obj.maxTxPower!),
+        dfsState: (data, obj) => data.pushU32(7, structs.putEnum(DfsState, obj.dfsState!)),
+        dfsTime: (data, obj) => data.pushU32(8, obj.dfsTime!),
+        noHt40Minus: (data, obj) => data.pushFlag(9, obj.noHt40Minus!),
+        noHt40Plus: (data, obj) => data.pushFlag(10, obj.noHt40Plus!),
+        no80mhz: (data, obj) => data.pushFlag(11, obj.no80mhz!),
+        no160mhz: (data, obj) => data.pushFlag(12, obj.no160mhz!),
+        dfsCacTime: (data, obj) => data.pushU32(13, obj.dfsCacTime!),
+        indoorOnly: (data, obj) => data.pushFlag(14, obj.indoorOnly!),
+        irConcurrent: (data, obj) => data.pushFlag(15, obj.irConcurrent!),
+        no20mhz: (data, obj) => data.pushFlag(16, obj.no20mhz!),
+        no10mhz: (data, obj) => data.pushFlag(17, obj.no10mhz!),
         wmm: (data, obj) => data.push(18, formatWmmRule(obj.wmm!)),
     })
 }
@@ -5130,11 +5655,22 @@ export function parseBitrate(r: Buffer): Bitrate {
     })
 }
 
+/** Decoders of the attributes of a {@link Bitrate} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Bitrate: structs.LazyFields = {
+    1: ['rate', data => structs.getU32(data)],
+    2: ['_2ghzShortpreamble', data => structs.getFlag(data)],
+}
+
+/** Like {@link parseBitrate}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseBitrateLazy(r: Buffer): Bitrate {
+    return structs.getLazyObject(r, __LAZY_Bitrate)
+}
+
 /** Encodes a {@link Bitrate} object into a stream of attributes */
 export function formatBitrate(x: Bitrate): StreamData {
     return structs.putObject(x, {
-        rate: (data, obj) => data.push(1, structs.putU32(obj.rate!)),
-        _2ghzShortpreamble: (data, obj) => data.push(2, structs.putFlag(obj._2ghzShortpreamble!)),
+        rate: (data, obj) => data.pushU32(1, obj.rate!),
+        _2ghzShortpreamble: (data, obj) => data.pushFlag(2, obj._2ghzShortpreamble!),
     })
 }
 
@@ -5264,16 +5800,32 @@ export function parseRegulatoryRule(r: Buffer): RegulatoryRule {
     })
 }
 
+/** Decoders of the attributes of a {@link RegulatoryRule} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_RegulatoryRule: structs.LazyFields = {
+    1: ['regRuleFlags', data => parseRegulatoryRuleFlags(structs.getU32(data))],
+    2: ['freqRangeStart', data => structs.getU32(data)],
+    3: ['freqRangeEnd', data => structs.getU32(data)],
+    4: ['freqRangeMaxBw', data => structs.getU32(data)],
+    5: ['powerRuleMaxAntGain', data => structs.getU32(data)],
+    6: ['powerRuleMaxEirp', data => structs.getU32(data)],
+    7: ['dfsCacTime', data => structs.getU32(data)],
+}
+
+/** Like {@link parseRegulatoryRule}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseRegulatoryRuleLazy(r: Buffer): RegulatoryRule {
+    return structs.getLazyObject(r, __LAZY_RegulatoryRule)
+}
+
 /** Encodes a {@link RegulatoryRule} object into a stream of attributes */
 export function formatRegulatoryRule(x: RegulatoryRule): StreamData {
     return structs.putObject(x, {
-        regRuleFlags: (data, obj) => data.push(1, structs.putU32(formatRegulatoryRuleFlags(obj.regRuleFlags!))),
-        freqRangeStart: (data, obj) => data.push(2, structs.putU32(obj.freqRangeStart!)),
-        freqRangeEnd: (data, obj) => data.push(3, structs.putU32(obj.freqRangeEnd!)),
-        freqRangeMaxBw: (data, obj) => data.push(4, structs.putU32(obj.freqRangeMaxBw!)),
-        powerRuleMaxAntGain: (data, obj) => data.push(5, structs.putU32(obj.powerRuleMaxAntGain!)),
-        powerRuleMaxEirp: (data, obj) => data.push(6, structs.putU32(obj.powerRuleMaxEirp!)),
-        dfsCacTime: (data, obj) => data.push(7, structs.putU32(obj.dfsCacTime!)),
+        regRuleFlags: (data, obj) => data.pushU32(1, formatRegulatoryRuleFlags(obj.regRuleFlags!)),
+        freqRangeStart: (data, obj) => data.pushU32(2, obj.freqRangeStart!),
+        freqRangeEnd: (data, obj) => data.pushU32(3, obj.freqRangeEnd!),
+        freqRangeMaxBw: (data, obj) => data.pushU32(4, obj.freqRangeMaxBw!),
+        powerRuleMaxAntGain: (data, obj) => data.pushU32(5, obj.powerRuleMaxAntGain!),
+        powerRuleMaxEirp: (data, obj) => data.pushU32(6, obj.powerRuleMaxEirp!),
+        dfsCacTime: (data, obj) => data.pushU32(7, obj.dfsCacTime!),
     })
 }
 
@@ -5344,15 +5896,30 @@ export function parseScheduledScanMatch(r: Buffer): ScheduledScanMatch {
     })
 }
 
+/** Decoders of the attributes of a {@link ScheduledScanMatch} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_ScheduledScanMatch: structs.LazyFields = {
+    1: ['attrSsid', data => data],
+    2: ['attrRssi', data => data],
+    3: ['attrRelativeRssi', data => structs.getFlag(data)],
+    4: ['attrRssiAdjust', data => data],
+    5: ['attrBssid', data => data],
+    6: ['perBandRssi', data => structs.getEnum(BandId, structs.getS32(data))],
+}
+
+/** Like {@link parseScheduledScanMatch}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseScheduledScanMatchLazy(r: Buffer): ScheduledScanMatch {
+    return structs.getLazyObject(r, __LAZY_ScheduledScanMatch)
+}
+
 /** Encodes a {@link ScheduledScanMatch} object into a stream of attributes */
 export function formatScheduledScanMatch(x: ScheduledScanMatch): StreamData {
     return structs.putObject(x, {
         attrSsid: (data, obj) => data.push(1, obj.attrSsid!),
         attrRssi: (data, obj) => data.push(2, obj.attrRssi!),
-        attrRelativeRssi: (data, obj) => data.push(3, structs.putFlag(obj.attrRelativeRssi!)),
+        attrRelativeRssi: (data, obj) => data.pushFlag(3, obj.attrRelativeRssi!),
         attrRssiAdjust: (data, obj) => data.push(4, obj.attrRssiAdjust!),
         attrBssid: (data, obj) => data.push(5, obj.attrBssid!),
-        perBandRssi: (data, obj) => data.push(6, structs.putS32(structs.putEnum(BandId, obj.perBandRssi!))),
+        perBandRssi: (data, obj) => data.pushS32(6, structs.putEnum(BandId, obj.perBandRssi!)),
     })
 }
 
@@ -5578,17 +6145,37 @@ export function parseSurveyInfo(r: Buffer): SurveyInfo {
     })
 }
 
+/** Decoders of the attributes of a {@link SurveyInfo} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_SurveyInfo: structs.LazyFields = {
+    1: ['frequency', data => structs.getU32(data)],
+    2: ['noise', data => structs.getU8(data)],
+    3: ['inUse', data => data],
+    4: ['time', data => structs.getU64(data)],
+    5: ['timeBusy', data => structs.getU64(data)],
+    6: ['timeExtBusy', data => structs.getU64(data)],
+    7: ['timeRx', data => structs.getU64(data)],
+    8: ['timeTx', data => structs.getU64(data)],
+    9: ['timeScan', data => data],
+    10: ['__pad', data => data],
+    11: ['timeBssRx', data => data],
+}
+
+/** Like {@link parseSurveyInfo}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseSurveyInfoLazy(r: Buffer): SurveyInfo {
+    return structs.getLazyObject(r, __LAZY_SurveyInfo)
+}
+
 /** Encodes a {@link SurveyInfo} object into a stream of attributes */
 export function formatSurveyInfo(x: SurveyInfo): StreamData {
     return structs.putObject(x, {
-        frequency: (data, obj) => data.push(1, structs.putU32(obj.frequency!)),
-        noise: (data, obj) => data.push(2, structs.putU8(obj.noise!)),
+        frequency: (data, obj) => data.pushU32(1, obj.frequency!),
+        noise: (data, obj) => data.pushU8(2, obj.noise!),
         inUse: (data, obj) => data.push(3, obj.inUse!),
-        time: (data, obj) => data.push(4, structs.putU64(obj.time!)),
-        timeBusy: (data, obj) => data.push(5, structs.putU64(obj.timeBusy!)),
-        timeExtBusy: (data, obj) => data.push(6, structs.putU64(obj.timeExtBusy!)),
-        timeRx: (data, obj) => data.push(7, structs.putU64(obj.timeRx!)),
-        timeTx: (data, obj) => data.push(8, structs.putU64(obj.timeTx!)),
+        time: (data, obj) => data.pushU64(4, obj.time!),
+        timeBusy: (data, obj) => data.pushU64(5, obj.timeBusy!),
+        timeExtBusy: (data, obj) => data.pushU64(6, obj.timeExtBusy!),
+        timeRx: (data, obj) => data.pushU64(7, obj.timeRx!),
+        timeTx: (data, obj) => data.pushU64(8, obj.timeTx!),
         timeScan: (data, obj) => data.push(9, obj.timeScan!),
         __pad: (data, obj) => data.push(10, obj.__pad!),
         timeBssRx: (data, obj) => data.push(11, obj.timeBssRx!),
@@ -5638,15 +6225,30 @@ export function parseMonitorFlags(r: Buffer): MonitorFlags {
     })
 }
 
+/** Decoders of the attributes of a {@link MonitorFlags} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_MonitorFlags: structs.LazyFields = {
+    1: ['fcsfail', data => structs.getFlag(data)],
+    2: ['plcpfail', data => structs.getFlag(data)],
+    3: ['control', data => structs.getFlag(data)],
+    4: ['otherBss', data => structs.getFlag(data)],
+    5: ['cookFrames', data => structs.getFlag(data)],
+    6: ['active', data => structs.getFlag(data)],
+}
+
+/** Like {@link parseMonitorFlags}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseMonitorFlagsLazy(r: Buffer): MonitorFlags {
+    return structs.getLazyObject(r, __LAZY_MonitorFlags)
+}
+
 /** Encodes a {@link MonitorFlags} object into a stream of attributes */
 export function formatMonitorFlags(x: MonitorFlags): StreamData {
     return structs.putObject(x, {
-        fcsfail: (data, obj) => data.push(1, structs.putFlag(obj.fcsfail!)),
-        plcpfail: (data, obj) => data.push(2, structs.putFlag(obj.plcpfail!)),
-        control: (data, obj) => data.push(3, structs.putFlag(obj.control!)),
-        otherBss: (data, obj) => data.push(4, structs.putFlag(obj.otherBss!)),
-        cookFrames: (data, obj) => data.push(5, structs.putFlag(obj.cookFrames!)),
-        active: (data, obj) => data.push(6, structs.putFlag(obj.active!)),
+        fcsfail: (data, obj) => data.pushFlag(1, obj.fcsfail!),
+        plcpfail: (data, obj) => data.pushFlag(2, obj.plcpfail!),
+        control: (data, obj) => data.pushFlag(3, obj.control!),
+        otherBss: (data, obj) => data.pushFlag(4, obj.otherBss!),
+        cookFrames: (data, obj) => data.pushFlag(5, obj.cookFrames!),
+        active: (data, obj) => data.pushFlag(6, obj.active!),
     })
 }
 
@@ -5909,6 +6511,44 @@ export function parseMeshconfParams(r: Buffer): MeshconfParams {
     })
 }
 
+/** Decoders of the attributes of a {@link MeshconfParams} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_MeshconfParams: structs.LazyFields = {
+    1: ['retryTimeout', data => data],
+    2: ['confirmTimeout', data => data],
+    3: ['holdingTimeout', data => data],
+    4: ['maxPeerLinks', data => data],
+    5: ['maxRetries', data => data],
+    6: ['ttl', data => data],
+    7: ['autoOpenPlinks', data => data],
+    8: ['hwmpMaxPreqRetries', data => data],
+    9: ['pathRefreshTime', data => data],
+    10: ['minDiscoveryTimeout', data => data],
+    11: ['hwmpActivePathTimeout', data => data],
+    12: ['hwmpPreqMinInterval', data => data],
+    13: ['hwmpNetDiamTrvsTime', data => data],
+    14: ['hwmpRootmode', data => data],
+    15: ['elementTtl', data => data],
+    16: ['hwmpRannInterval', data => data],
+    17: ['gateAnnouncements', data => data],
+    18: ['hwmpPerrMinInterval', data => data],
+    19: ['forwarding', data => data],
+    20: ['rssiThreshold', data => data],
+    21: ['syncOffsetMaxNeighbor', data => data],
+    22: ['htOpmode', data => data],
+    23: ['hwmpPathToRootTimeout', data => data],
+    24: ['hwmpRootInterval', data => data],
+    25: ['hwmpConfirmationInterval', data => data],
+    26: ['powerMode', data => structs.getEnum(MeshPowerMode, structs.getU32(data))],
+    27: ['awakeWindow', data => data],
+    28: ['plinkTimeout', data => structs.getBool(data)],
+    29: ['connectedToGate', data => structs.getFlag(data)],
+}
+
+/** Like {@link parseMeshconfParams}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseMeshconfParamsLazy(r: Buffer): MeshconfParams {
+    return structs.getLazyObject(r, __LAZY_MeshconfParams)
+}
+
 /** Encodes a {@link MeshconfParams} object into a stream of attributes */
 export function formatMeshconfParams(x: MeshconfParams): StreamData {
     return structs.putObject(x, {
@@ -5937,10 +6577,10 @@ export function formatMeshconfParams(x: MeshconfParams): StreamData {
         hwmpPathToRootTimeout: (data, obj) => data.push(23, obj.hwmpPathToRootTimeout!),
         hwmpRootInterval: (data, obj) => data.push(24, obj.hwmpRootInterval!),
         hwmpConfirmationInterval: (data, obj) => data.push(25, obj.hwmpConfirmationInterval!),
-        powerMode: (data, obj) => data.push(26, structs.putU32(structs.putEnum(MeshPowerMode, obj.powerMode!))),
+        powerMode: (data, obj) => data.pushU32(26, structs.putEnum(MeshPowerMode, obj.powerMode!)),
         awakeWindow: (data, obj) => data.push(27, obj.awakeWindow!),
-        plinkTimeout: (data, obj) => data.push(28, structs.putBool(obj.plinkTimeout!)),
-        connectedToGate: (data, obj) => data.push(29, structs.putFlag(obj.connectedToGate!)),
+        plinkTimeout: (data, obj) => data.pushBool(28, obj.plinkTimeout!),
+        connectedToGate: (data, obj) => data.pushFlag(29, obj.connectedToGate!),
     })
 }
 
@@ -6027,17 +6667,34 @@ export function parseMeshSetupParams(r: Buffer): MeshSetupParams {
     })
 }
 
+/** Decoders of the attributes of a {@link MeshSetupParams} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_MeshSetupParams: structs.LazyFields = {
+    1: ['enableVendorPathSel', data => structs.getFlag(data)],
+    2: ['enableVendorMetric', data => structs.getFlag(data)],
+    3: ['ie', data => data],
+    4: ['userspaceAuth', data => structs.getFlag(data)],
+    5: ['userspaceAmpe', data => structs.getFlag(data)],
+    6: ['enableVendorSync', data => structs.getU8(data)],
+    7: ['userspaceMpm', data => data],
+    8: ['authProtocol', data => structs.getU8(data)],
+}
+
+/** Like {@link parseMeshSetupParams}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseMeshSetupParamsLazy(r: Buffer): MeshSetupParams {
+    return structs.getLazyObject(r, __LAZY_MeshSetupParams)
+}
+
 /** Encodes a {@link MeshSetupParams} object into a stream of attributes */
 export function formatMeshSetupParams(x: MeshSetupParams): StreamData {
     return structs.putObject(x, {
-        enableVendorPathSel: (data, obj) => data.push(1, structs.putFlag(obj.enableVendorPathSel!)),
-        enableVendorMetric: (data, obj) => data.push(2, structs.putFlag(obj.enableVendorMetric!)),
+        enableVendorPathSel: (data, obj) => data.pushFlag(1, obj.enableVendorPathSel!),
+        enableVendorMetric: (data, obj) => data.pushFlag(2, obj.enableVendorMetric!),
         ie: (data, obj) => data.push(3, obj.ie!),
-        userspaceAuth: (data, obj) => data.push(4, structs.putFlag(obj.userspaceAuth!)),
-        userspaceAmpe: (data, obj) => data.push(5, structs.putFlag(obj.userspaceAmpe!)),
-        enableVendorSync: (data, obj) => data.push(6, structs.putU8(obj.enableVendorSync!)),
+        userspaceAuth: (data, obj) => data.pushFlag(4, obj.userspaceAuth!),
+        userspaceAmpe: (data, obj) => data.pushFlag(5, obj.userspaceAmpe!),
+        enableVendorSync: (data, obj) => data.pushU8(6, obj.enableVendorSync!),
         userspaceMpm: (data, obj) => data.push(7, obj.userspaceMpm!),
-        authProtocol: (data, obj) => data.push(8, structs.putU8(obj.authProtocol!)),
+        authProtocol: (data, obj) => data.pushU8(8, obj.authProtocol!),
     })
 }
 
@@ -6079,14 +6736,28 @@ export function parseTxq(r: Buffer): Txq {
     })
 }
 
+/** Decoders of the attributes of a {@link Txq} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Txq: structs.LazyFields = {
+    1: ['ac', data => data],
+    2: ['txop', data => data],
+    3: ['cwmin', data => structs.getS16(data)],
+    4: ['cwmax', data => structs.getS16(data)],
+    5: ['aifs', data => structs.getU8(data)],
+}
+
+/** Like {@link parseTxq}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseTxqLazy(r: Buffer): Txq {
+    return structs.getLazyObject(r, __LAZY_Txq)
+}
+
 /** Encodes a {@link Txq} object into a stream of attributes */
 export function formatTxq(x: Txq): StreamData {
     return structs.putObject(x, {
         ac: (data, obj) => data.push(1, obj.ac!),
         txop: (data, obj) => data.push(2, obj.txop!),
-        cwmin: (data, obj) => data.push(3, structs.putS16(obj.cwmin!)),
-        cwmax: (data, obj) => data.push(4, structs.putS16(obj.cwmax!)),
-        aifs: (data, obj) => data.push(5, structs.putU8(obj.aifs!)),
+        cwmin: (data, obj) => data.pushS16(3, obj.cwmin!),
+        cwmax: (data, obj) => data.pushS16(4, obj.cwmax!),
+        aifs: (data, obj) => data.pushU8(5, obj.aifs!),
     })
 }
 
@@ -6410,28 +7081,56 @@ export function parseBss(r: Buffer): Bss {
     })
 }
 
+/** Decoders of the attributes of a {@link Bss} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Bss: structs.LazyFields = {
+    1: ['bssid', data => data],
+    2: ['frequency', data => structs.getU32(data)],
+    3: ['tsf', data => structs.getU64(data)],
+    4: ['beaconInterval', data => structs.getU16(data)],
+    5: ['capability', data => structs.getU16(data)],
+    6: ['informationElements', data => data],
+    7: ['signalMbm', data => structs.getS32(data)],
+    8: ['signalUnspec', data => structs.getU8(data)],
+    9: ['status', data => structs.getU32(data)],
+    10: ['seenMsAgo', data => structs.getU32(data)],
+    11: ['beaconIes', data => data],
+    12: ['chanWidth', data => structs.getEnum(BssScanWidth, structs.getU32(data))],
+    13: ['beaconTsf', data => structs.getU64(data)],
+    14: ['prespData', data => structs.getFlag(data)],
+    15: ['lastSeenBoottime', data => structs.getU64(data)],
+    16: ['__pad', data => data],
+    17: ['parentTsf', data => structs.getU64(data)],
+    18: ['parentBssid', data => data],
+    19: ['chainSignal', data => structs.getU8(data)],
+}
+
+/** Like {@link parseBss}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseBssLazy(r: Buffer): Bss {
+    return structs.getLazyObject(r, __LAZY_Bss)
+}
+
 /** Encodes a {@link Bss} object into a stream of attributes */
 export function formatBss(x: Bss): StreamData {
     return structs.putObject(x, {
         bssid: (data, obj) => data.push(1, obj.bssid!),
-        frequency: (data, obj) => data.push(2, structs.putU32(obj.frequency!)),
-        tsf: (data, obj) => data.push(3, structs.putU64(obj.tsf!)),
-        beaconInterval: (data, obj) => data.push(4, structs.putU16(obj.beaconInterval!)),
-        capability: (data, obj) => data.push(5, structs.putU16(obj.capability!)),
+        frequency: (data, obj) => data.pushU32(2, obj.frequency!),
+        tsf: (data, obj) => data.pushU64(3, obj.tsf!),
+        beaconInterval: (data, obj) => data.pushU16(4, obj.beaconInterval!),
+        capability: (data, obj) => data.pushU16(5, obj.capability!),
         informationElements: (data, obj) => data.push(6, obj.informationElements!),
-        signalMbm: (data, obj) => data.push(7, structs.putS32(obj.signalMbm!)),
-        signalUnspec: (data, obj) => data.push(8, structs.putU8(obj.signalUnspec!)),
-        status: (data, obj) => data.push(9, structs.putU32(obj.status!)),
-        seenMsAgo: (data, obj) => data.push(10, structs.putU32(obj.seenMsAgo!)),
+        signalMbm: (data, obj) => data.pushS32(7, obj.signalMbm!),
+        signalUnspec: (data, obj) => data.pushU8(8, obj.signalUnspec!),
+        status: (data, obj) => data.pushU32(9, obj.status!),
+        seenMsAgo: (data, obj) => data.pushU32(10, obj.seenMsAgo!),
         beaconIes: (data, obj) => data.push(11, obj.beaconIes!),
-        chanWidth: (data, obj) => data.push(12, structs.putU32(structs.putEnum(BssScanWidth, obj.chanWidth!))),
-        beaconTsf: (data, obj) => data.push(13, structs.putU64(obj.beaconTsf!)),
-        prespData: (data, obj) => data.push(14, structs.putFlag(obj.prespData!)),
-        lastSeenBoottime: (data, obj) => data.push(15, structs.putU64(obj.lastSeenBoottime!)),
+        chanWidth: (data, obj) => data.pushU32(12, structs.putEnum(BssScanWidth, obj.chanWidth!)),
+        beaconTsf: (data, obj) => data.pushU64(13, obj.beaconTsf!),
+        prespData: (data, obj) => data.pushFlag(14, obj.prespData!),
+        lastSeenBoottime: (data, obj) => data.pushU64(15, obj.lastSeenBoottime!),
         __pad: (data, obj) => data.push(16, obj.__pad!),
-        parentTsf: (data, obj) => data.push(17, structs.putU64(obj.parentTsf!)),
+        parentTsf: (data, obj) => data.pushU64(17, obj.parentTsf!),
         parentBssid: (data, obj) => data.push(18, obj.parentBssid!),
-        chainSignal: (data, obj) => data.push(19, structs.putU8(obj.chainSignal!)),
+        chainSignal: (data, obj) => data.pushU8(19, obj.chainSignal!),
     })
 }
 
@@ -6567,11 +7266,22 @@ export function parseKeyDefaultTypes(r: Buffer): KeyDefaultTypes {
     })
 }
 
+/** Decoders of the attributes of a {@link KeyDefaultTypes} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_KeyDefaultTypes: structs.LazyFields = {
+    1: ['unicast', data => structs.getFlag(data)],
+    2: ['multicast', data => structs.getFlag(data)],
+}
+
+/** Like {@link parseKeyDefaultTypes}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseKeyDefaultTypesLazy(r: Buffer): KeyDefaultTypes {
+    return structs.getLazyObject(r, __LAZY_KeyDefaultTypes)
+}
+
 /** Encodes a {@link KeyDefaultTypes} object into a stream of attributes */
 export function formatKeyDefaultTypes(x: KeyDefaultTypes): StreamData {
     return structs.putObject(x, {
-        unicast: (data, obj) => data.push(1, structs.putFlag(obj.unicast!)),
-        multicast: (data, obj) => data.push(2, structs.putFlag(obj.multicast!)),
+        unicast: (data, obj) => data.pushFlag(1, obj.unicast!),
+        multicast: (data, obj) => data.pushFlag(2, obj.multicast!),
     })
 }
 
@@ -6641,16 +7351,34 @@ export function parseKey(r: Buffer): Key {
     })
 }
 
+/** Decoders of the attributes of a {@link Key} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Key: structs.LazyFields = {
+    1: ['data', data => data],
+    2: ['idx', data => structs.getU8(data)],
+    3: ['cipher', data => structs.getU32(data)],
+    4: ['seq', data => data],
+    5: ['default', data => structs.getFlag(data)],
+    6: ['defaultMgmt', data => structs.getFlag(data)],
+    7: ['type', data => structs.getEnum(KeyType, structs.getU32(data))],
+    8: ['defaultTypes', data => parseKeyDefaultTypesLazy(data)],
+    9: ['mode', data => data],
+}
+
+/** Like {@link parseKey}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseKeyLazy(r: Buffer): Key {
+    return structs.getLazyObject(r, __LAZY_Key)
+}
+
 /** Encodes a {@link Key} object into a stream of attributes */
 export function formatKey(x: Key): StreamData {
     return structs.putObject(x, {
         data: (data, obj) => data.push(1, obj.data!),
-        idx: (data, obj) => data.push(2, structs.putU8(obj.idx!)),
-        cipher: (data, obj) => data.push(3, structs.putU32(obj.cipher!)),
+        idx: (data, obj) => data.pushU8(2, obj.idx!),
+        cipher: (data, obj) => data.pushU32(3, obj.cipher!),
         seq: (data, obj) => data.push(4, obj.seq!),
-        default: (data, obj) => data.push(5, structs.putFlag(obj.default!)),
-        defaultMgmt: (data, obj) => data.push(6, structs.putFlag(obj.defaultMgmt!)),
-        type: (data, obj) => data.push(7, structs.putU32(structs.putEnum(KeyType, obj.type!))),
+        default: (data, obj) => data.pushFlag(5, obj.default!),
+        defaultMgmt: (data, obj) => data.pushFlag(6, obj.defaultMgmt!),
+        type: (data, obj) => data.pushU32(7, structs.putEnum(KeyType, obj.type!)),
         defaultTypes: (data, obj) => data.push(8, formatKeyDefaultTypes(obj.defaultTypes!)),
         mode: (data, obj) => data.push(9, obj.mode!),
     })
@@ -6692,6 +7420,19 @@ export function parseTxRate(r: Buffer): TxRate {
     })
 }
 
+/** Decoders of the attributes of a {@link TxRate} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_TxRate: structs.LazyFields = {
+    1: ['legacy', data => data],
+    2: ['ht', data => data],
+    3: ['vht', data => data],
+    4: ['gi', data => data],
+}
+
+/** Like {@link parseTxRate}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseTxRateLazy(r: Buffer): TxRate {
+    return structs.getLazyObject(r, __LAZY_TxRate)
+}
+
 /** Encodes a {@link TxRate} object into a stream of attributes */
 export function formatTxRate(x: TxRate): StreamData {
     return structs.putObject(x, {
@@ -6848,17 +7589,35 @@ export function parseCqm(r: Buffer): Cqm {
     })
 }
 
+/** Decoders of the attributes of a {@link Cqm} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Cqm: structs.LazyFields = {
+    1: ['rssiThold', data => structs.getU32(data)],
+    2: ['rssiHyst', data => structs.getU32(data)],
+    3: ['rssiThresholdEvent', data => structs.getU32(data)],
+    4: ['pktLossEvent', data => structs.getU32(data)],
+    5: ['txeRate', data => data],
+    6: ['txePkts', data => data],
+    7: ['txeIntvl', data => data],
+    8: ['beaconLossEvent', data => structs.getFlag(data)],
+    9: ['rssiLevel', data => data],
+}
+
+/** Like {@link parseCqm}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseCqmLazy(r: Buffer): Cqm {
+    return structs.getLazyObject(r, __LAZY_Cqm)
+}
+
 /** Encodes a {@link Cqm} object into a stream of attributes */
 export function formatCqm(x: Cqm): StreamData {
     return structs.putObject(x, {
-        rssiThold: (data, obj) => data.push(1, structs.putU32(obj.rssiThold!)),
-        rssiHyst: (data, obj) => data.push(2, structs.putU32(obj.rssiHyst!)),
-        rssiThresholdEvent: (data, obj) => data.push(3, structs.putU32(obj.rssiThresholdEvent!)),
-        pktLossEvent: (data, obj) => data.push(4, structs.putU32(obj.pktLossEvent!)),
+        rssiThold: (data, obj) => data.pushU32(1, obj.rssiThold!),
+        rssiHyst: (data, obj) => data.pushU32(2, obj.rssiHyst!),
+        rssiThresholdEvent: (data, obj) => data.pushU32(3, obj.rssiThresholdEvent!),
+        pktLossEvent: (data, obj) => data.pushU32(4, obj.pktLossEvent!),
         txeRate: (data, obj) => data.push(5, obj.txeRate!),
         txePkts: (data, obj) => data.push(6, obj.txePkts!),
         txeIntvl: (data, obj) => data.push(7, obj.txeIntvl!),
-        beaconLossEvent: (data, obj) => data.push(8, structs.putFlag(obj.beaconLossEvent!)),
+        beaconLossEvent: (data, obj) => data.pushFlag(8, obj.beaconLossEvent!),
         rssiLevel: (data, obj) => data.push(9, obj.rssiLevel!),
     })
 }
@@ -6932,12 +7691,24 @@ export function parsePacketPattern(r: Buffer): PacketPattern {
     })
 }
 
+/** Decoders of the attributes of a {@link PacketPattern} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_PacketPattern: structs.LazyFields = {
+    1: ['mask', data => data],
+    2: ['pattern', data => data],
+    3: ['offset', data => structs.getU32(data)],
+}
+
+/** Like {@link parsePacketPattern}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parsePacketPatternLazy(r: Buffer): PacketPattern {
+    return structs.getLazyObject(r, __LAZY_PacketPattern)
+}
+
 /** Encodes a {@link PacketPattern} object into a stream of attributes */
 export function formatPacketPattern(x: PacketPattern): StreamData {
     return structs.putObject(x, {
         mask: (data, obj) => data.push(1, obj.mask!),
         pattern: (data, obj) => data.push(2, obj.pattern!),
-        offset: (data, obj) => data.push(3, structs.putU32(obj.offset!)),
+        offset: (data, obj) => data.pushU32(3, obj.offset!),
     })
 }
 
@@ -7128,26 +7899,54 @@ export function parseWowlanTriggers(r: Buffer): WowlanTriggers {
     })
 }
 
+/** Decoders of the attributes of a {@link WowlanTriggers} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_WowlanTriggers: structs.LazyFields = {
+    1: ['any', data => structs.getFlag(data)],
+    2: ['disconnect', data => structs.getFlag(data)],
+    3: ['magicPkt', data => structs.getFlag(data)],
+    4: ['pktPattern', data => data],
+    5: ['gtkRekeySupported', data => structs.getFlag(data)],
+    6: ['gtkRekeyFailure', data => structs.getFlag(data)],
+    7: ['eapIdentRequest', data => structs.getFlag(data)],
+    8: ['_4wayHandshake', data => structs.getFlag(data)],
+    9: ['rfkillRelease', data => structs.getFlag(data)],
+    10: ['wakeupPkt80211', data => data],
+    11: ['wakeupPkt80211Len', data => data],
+    12: ['wakeupPkt8023', data => data],
+    13: ['wakeupPkt8023Len', data => data],
+    14: ['tcpConnection', data => data],
+    15: ['wakeupTcpMatch', data => structs.getFlag(data)],
+    16: ['wakeupTcpConnlost', data => structs.getFlag(data)],
+    17: ['wakeupTcpNomoretokens', data => structs.getFlag(data)],
+    18: ['netDetect', data => data],
+    19: ['netDetectResults', data => structs.getArray(data, x => parseMessageLazy(x))],
+}
+
+/** Like {@link parseWowlanTriggers}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseWowlanTriggersLazy(r: Buffer): WowlanTriggers {
+    return structs.getLazyObject(r, __LAZY_WowlanTriggers)
+}
+
 /** Encodes a {@link WowlanTriggers} object into a stream of attributes */
 export function formatWowlanTriggers(x: WowlanTriggers): StreamData {
     return structs.putObject(x, {
-        any: (data, obj) => data.push(1, structs.putFlag(obj.any!)),
-        disconnect: (data, obj) => data.push(2, structs.putFlag(obj.disconnect!)),
-        magicPkt: (data, obj) => data.push(3, structs.putFlag(obj.magicPkt!)),
+        any: (data, obj) => data.pushFlag(1, obj.any!),
+        disconnect: (data, obj) => data.pushFlag(2, obj.disconnect!),
+        magicPkt: (data, obj) => data.pushFlag(3, obj.magicPkt!),
         pktPattern: (data, obj) => data.push(4, obj.pktPattern!),
-        gtkRekeySupported: (data, obj) => data.push(5, structs.putFlag(obj.gtkRekeySupported!)),
-        gtkRekeyFailure: (data, obj) => data.push(6, structs.putFlag(obj.gtkRekeyFailure!)),
-        eapIdentRequest: (data, obj) => data.push(7, structs.putFlag(obj.eapIdentRequest!)),
-        _4wayHandshake: (data, obj) => data.push(8, structs.putFlag(obj._4wayHandshake!)),
-        rfkillRelease: (data, obj) => data.push(9, structs.putFlag(obj.rfkillRelease!)),
+        gtkRekeySupported: (data, obj) => data.pushFlag(5, obj.gtkRekeySupported!),
+        gtkRekeyFailure: (data, obj) => data.pushFlag(6, obj.gtkRekeyFailure!),
+        eapIdentRequest: (data, obj) => data.pushFlag(7, obj.eapIdentRequest!),
+        _4wayHandshake: (data, obj) => data.pushFlag(8, obj._4wayHandshake!),
+        rfkillRelease: (data, obj) => data.pushFlag(9, obj.rfkillRelease!),
         wakeupPkt80211: (data, obj) => data.push(10, obj.wakeupPkt80211!),
         wakeupPkt80211Len: (data, obj) => data.push(11, obj.wakeupPkt80211Len!),
         wakeupPkt8023: (data, obj) => data.push(12, obj.wakeupPkt8023!),
         wakeupPkt8023Len: (data, obj) => data.push(13, obj.wakeupPkt8023Len!),
         tcpConnection: (data, obj) => data.push(14, obj.tcpConnection!),
-        wakeupTcpMatch: (data, obj) => data.push(15, structs.putFlag(obj.wakeupTcpMatch!)),
-        wakeupTcpConnlost: (data, obj) => data.push(16, structs.putFlag(obj.wakeupTcpConnlost!)),
-        wakeupTcpNomoretokens: (data, obj) => data.push(17, structs.putFlag(obj.wakeupTcpNomoretokens!)),
+        wakeupTcpMatch: (data, obj) => data.pushFlag(15, obj.wakeupTcpMatch!),
+        wakeupTcpConnlost: (data, obj) => data.pushFlag(16, obj.wakeupTcpConnlost!),
+        wakeupTcpNomoretokens: (data, obj) => data.pushFlag(17, obj.wakeupTcpNomoretokens!),
         netDetect: (data, obj) => data.push(18, obj.netDetect!),
         netDetectResults: (data, obj) => data.push(19, structs.putArray(obj.netDetectResults!, x => formatMessage(x))),
     })
@@ -7239,18 +8038,38 @@ export function parseWowlanTcp(r: Buffer): WowlanTcp {
     })
 }
 
+/** Decoders of the attributes of a {@link WowlanTcp} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_WowlanTcp: structs.LazyFields = {
+    1: ['srcIpv4', data => structs.getU32(data)],
+    2: ['dstIpv4', data => structs.getU32(data)],
+    3: ['dstMac', data => data],
+    4: ['srcPort', data => structs.getU16(data)],
+    5: ['dstPort', data => structs.getU16(data)],
+    6: ['dataPayload', data => data],
+    7: ['dataPayloadSeq', data => data],
+    8: ['dataPayloadToken', data => data],
+    9: ['dataInterval', data => structs.getU32(data)],
+    10: ['wakePayload', data => data],
+    11: ['wakeMask', data => data],
+}
+
+/** Like {@link parseWowlanTcp}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseWowlanTcpLazy(r: Buffer): WowlanTcp {
+    return structs.getLazyObject(r, __LAZY_WowlanTcp)
+}
+
 /** Encodes a {@link WowlanTcp} object into a stream of attributes */
 export function formatWowlanTcp(x: WowlanTcp): StreamData {
     return structs.putObject(x, {
-        srcIpv4: (data, obj) => data.push(1, structs.putU32(obj.srcIpv4!)),
-        dstIpv4: (data, obj) => data.push(2, structs.putU32(obj.dstIpv4!)),
+        srcIpv4: (data, obj) => data.pushU32(1, obj.srcIpv4!),
+        dstIpv4: (data, obj) => data.pushU32(2, obj.dstIpv4!),
         dstMac: (data, obj) => data.push(3, obj.dstMac!),
-        srcPort: (data, obj) => data.push(4, structs.putU16(obj.srcPort!)),
-        dstPort: (data, obj) => data.push(5, structs.putU16(obj.dstPort!)),
+        srcPort: (data, obj) => data.pushU16(4, obj.srcPort!),
+        dstPort: (data, obj) => data.pushU16(5, obj.dstPort!),
         dataPayload: (data, obj) => data.push(6, obj.dataPayload!),
         dataPayloadSeq: (data, obj) => data.push(7, obj.dataPayloadSeq!),
         dataPayloadToken: (data, obj) => data.push(8, obj.dataPayloadToken!),
-        dataInterval: (data, obj) => data.push(9, structs.putU32(obj.dataInterval!)),
+        dataInterval: (data, obj) => data.pushU32(9, obj.dataInterval!),
         wakePayload: (data, obj) => data.push(10, obj.wakePayload!),
         wakeMask: (data, obj) => data.push(11, obj.wakeMask!),
     })
@@ -7283,11 +8102,23 @@ export function parseCoalesceRule(r: Buffer): CoalesceRule {
     })
 }
 
+/** Decoders of the attributes of a {@link CoalesceRule} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_CoalesceRule: structs.LazyFields = {
+    1: ['delay', data => structs.getU32(data)],
+    2: ['condition', data => structs.getEnum(CoalesceCondition, structs.getU32(data))],
+    3: ['pktPattern', data => data],
+}
+
+/** Like {@link parseCoalesceRule}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseCoalesceRuleLazy(r: Buffer): CoalesceRule {
+    return structs.getLazyObject(r, __LAZY_CoalesceRule)
+}
+
 /** Encodes a {@link CoalesceRule} object into a stream of attributes */
 export function formatCoalesceRule(x: CoalesceRule): StreamData {
     return structs.putObject(x, {
-        delay: (data, obj) => data.push(1, structs.putU32(obj.delay!)),
-        condition: (data, obj) => data.push(2, structs.putU32(structs.putEnum(CoalesceCondition, obj.condition!))),
+        delay: (data, obj) => data.pushU32(1, obj.delay!),
+        condition: (data, obj) => data.pushU32(2, structs.putEnum(CoalesceCondition, obj.condition!)),
         pktPattern: (data, obj) => data.push(3, obj.pktPattern!),
     })
 }
@@ -7330,10 +8161,21 @@ export function parseInterfaceLimit(r: Buffer): InterfaceLimit {
     })
 }
 
+/** Decoders of the attributes of a {@link InterfaceLimit} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_InterfaceLimit: structs.LazyFields = {
+    1: ['max', data => structs.getU32(data)],
+    2: ['types', data => parseInterfaceTypeSetAttr(data)],
+}
+
+/** Like {@link parseInterfaceLimit}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseInterfaceLimitLazy(r: Buffer): InterfaceLimit {
+    return structs.getLazyObject(r, __LAZY_InterfaceLimit)
+}
+
 /** Encodes a {@link InterfaceLimit} object into a stream of attributes */
 export function formatInterfaceLimit(x: InterfaceLimit): StreamData {
     return structs.putObject(x, {
-        max: (data, obj) => data.push(1, structs.putU32(obj.max!)),
+        max: (data, obj) => data.pushU32(1, obj.max!),
         types: (data, obj) => data.push(2, formatInterfaceTypeSetAttr(obj.types!)),
     })
 }
@@ -7426,16 +8268,32 @@ export function parseInterfaceCombination(r: Buffer): InterfaceCombination {
     })
 }
 
+/** Decoders of the attributes of a {@link InterfaceCombination} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_InterfaceCombination: structs.LazyFields = {
+    1: ['limits', data => structs.getArray(data, x => parseInterfaceLimitLazy(x))],
+    2: ['maxnum', data => structs.getU32(data)],
+    3: ['staApBiMatch', data => structs.getFlag(data)],
+    4: ['numChannels', data => structs.getU32(data)],
+    5: ['radarDetectWidths', data => parseChannelWidthSet(structs.getU32(data))],
+    6: ['radarDetectRegions', data => structs.getU32(data)],
+    7: ['biMinGcd', data => structs.getU32(data)],
+}
+
+/** Like {@link parseInterfaceCombination}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseInterfaceCombinationLazy(r: Buffer): InterfaceCombination {
+    return structs.getLazyObject(r, __LAZY_InterfaceCombination)
+}
+
 /** Encodes a {@link InterfaceCombination} object into a stream of attributes */
 export function formatInterfaceCombination(x: InterfaceCombination): StreamData {
     return structs.putObject(x, {
         limits: (data, obj) => data.push(1, structs.putArray(obj.limits!, x => formatInterfaceLimit(x))),
-        maxnum: (data, obj) => data.push(2, structs.putU32(obj.maxnum!)),
-        staApBiMatch: (data, obj) => data.push(3, structs.putFlag(obj.staApBiMatch!)),
-        numChannels: (data, obj) => data.push(4, structs.putU32(obj.numChannels!)),
-        radarDetectWidths: (data, obj) => data.push(5, structs.putU32(formatChannelWidthSet(obj.radarDetectWidths!))),
-        radarDetectRegions: (data, obj) => data.push(6, structs.putU32(obj.radarDetectRegions!)),
-        biMinGcd: (data, obj) => data.push(7, structs.putU32(obj.biMinGcd!)),
+        maxnum: (data, obj) => data.pushU32(2, obj.maxnum!),
+        staApBiMatch: (data, obj) => data.pushFlag(3, obj.staApBiMatch!),
+        numChannels: (data, obj) => data.pushU32(4, obj.numChannels!),
+        radarDetectWidths: (data, obj) => data.pushU32(5, formatChannelWidthSet(obj.radarDetectWidths!)),
+        radarDetectRegions: (data, obj) => data.pushU32(6, obj.radarDetectRegions!),
+        biMinGcd: (data, obj) => data.pushU32(7, obj.biMinGcd!),
     })
 }
 
@@ -7511,6 +8369,18 @@ export function parseRekeyData(r: Buffer): RekeyData {
     })
 }
 
+/** Decoders of the attributes of a {@link RekeyData} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_RekeyData: structs.LazyFields = {
+    1: ['kek', data => data],
+    2: ['kck', data => data],
+    3: ['replayCtr', data => data],
+}
+
+/** Like {@link parseRekeyData}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseRekeyDataLazy(r: Buffer): RekeyData {
+    return structs.getLazyObject(r, __LAZY_RekeyData)
+}
+
 /** Encodes a {@link RekeyData} object into a stream of attributes */
 export function formatRekeyData(x: RekeyData): StreamData {
     return structs.putObject(x, {
@@ -7564,6 +8434,17 @@ export function parseStationWme(r: Buffer): StationWme {
     })
 }
 
+/** Decoders of the attributes of a {@link StationWme} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_StationWme: structs.LazyFields = {
+    1: ['uapsdQueues', data => data],
+    2: ['maxSp', data => data],
+}
+
+/** Like {@link parseStationWme}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseStationWmeLazy(r: Buffer): StationWme {
+    return structs.getLazyObject(r, __LAZY_StationWme)
+}
+
 /** Encodes a {@link StationWme} object into a stream of attributes */
 export function formatStationWme(x: StationWme): StreamData {
     return structs.putObject(x, {
@@ -7596,12 +8477,24 @@ export function parsePmksaCandidate(r: Buffer): PmksaCandidate {
     })
 }
 
+/** Decoders of the attributes of a {@link PmksaCandidate} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_PmksaCandidate: structs.LazyFields = {
+    1: ['index', data => structs.getU32(data)],
+    2: ['bssid', data => data],
+    3: ['preauth', data => structs.getFlag(data)],
+}
+
+/** Like {@link parsePmksaCandidate}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parsePmksaCandidateLazy(r: Buffer): PmksaCandidate {
+    return structs.getLazyObject(r, __LAZY_PmksaCandidate)
+}
+
 /** Encodes a {@link PmksaCandidate} object into a stream of attributes */
 export function formatPmksaCandidate(x: PmksaCandidate): StreamData {
     return structs.putObject(x, {
-        index: (data, obj) => data.push(1, structs.putU32(obj.index!)),
+        index: (data, obj) => data.pushU32(1, obj.index!),
         bssid: (data, obj) => data.push(2, obj.bssid!),
-        preauth: (data, obj) => data.push(3, structs.putFlag(obj.preauth!)),
+        preauth: (data, obj) => data.pushFlag(3, obj.preauth!),
     })
 }
 
@@ -8634,11 +9527,22 @@ export function parseScheduledScanPlan(r: Buffer): ScheduledScanPlan {
     })
 }
 
+/** Decoders of the attributes of a {@link ScheduledScanPlan} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_ScheduledScanPlan: structs.LazyFields = {
+    1: ['nterval', data => structs.getU32(data)],
+    2: ['terations', data => structs.getU32(data)],
+}
+
+/** Like {@link parseScheduledScanPlan}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseScheduledScanPlanLazy(r: Buffer): ScheduledScanPlan {
+    return structs.getLazyObject(r, __LAZY_ScheduledScanPlan)
+}
+
 /** Encodes a {@link ScheduledScanPlan} object into a stream of attributes */
 export function formatScheduledScanPlan(x: ScheduledScanPlan): StreamData {
     return structs.putObject(x, {
-        nterval: (data, obj) => data.push(1, structs.putU32(obj.nterval!)),
-        terations: (data, obj) => data.push(2, structs.putU32(obj.terations!)),
+        nterval: (data, obj) => data.pushU32(1, obj.nterval!),
+        terations: (data, obj) => data.pushU32(2, obj.terations!),
     })
 }
 
@@ -8683,10 +9587,22 @@ export function parseBssSelect(r: Buffer): BssSelect {
     })
 }
 
+/** Decoders of the attributes of a {@link BssSelect} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_BssSelect: structs.LazyFields = {
+    1: ['rssi', data => structs.getFlag(data)],
+    2: ['bandPref', data => data],
+    3: ['rssiAdjust', data => data],
+}
+
+/** Like {@link parseBssSelect}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseBssSelectLazy(r: Buffer): BssSelect {
+    return structs.getLazyObject(r, __LAZY_BssSelect)
+}
+
 /** Encodes a {@link BssSelect} object into a stream of attributes */
 export function formatBssSelect(x: BssSelect): StreamData {
     return structs.putObject(x, {
-        rssi: (data, obj) => data.push(1, structs.putFlag(obj.rssi!)),
+        rssi: (data, obj) => data.pushFlag(1, obj.rssi!),
         bandPref: (data, obj) => data.push(2, obj.bandPref!),
         rssiAdjust: (data, obj) => data.push(3, obj.rssiAdjust!),
     })
@@ -8878,25 +9794,50 @@ export function parseNanFunction(r: Buffer): NanFunction {
     })
 }
 
+/** Decoders of the attributes of a {@link NanFunction} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_NanFunction: structs.LazyFields = {
+    1: ['type', data => structs.getEnum(NanFunctionType, structs.getU8(data))],
+    2: ['serviceId', data => data],
+    3: ['publishType', data => parseNanPublishType(structs.getU8(data))],
+    4: ['publishBcast', data => structs.getFlag(data)],
+    5: ['subscribeActive', data => structs.getFlag(data)],
+    6: ['followUpId', data => structs.getU8(data)],
+    7: ['followUpReqId', data => structs.getU8(data)],
+    8: ['followUpDest', data => data],
+    9: ['closeRange', data => structs.getFlag(data)],
+    10: ['ttl', data => structs.getU32(data)],
+    11: ['serviceInfo', data => data],
+    12: ['srf', data => parseNanSrfLazy(data)],
+    13: ['rxMatchFilter', data => data],
+    14: ['txMatchFilter', data => data],
+    15: ['instanceId', data => structs.getU8(data)],
+    16: ['termReason', data => structs.getEnum(NanFunctionTerminationReason, structs.getU8(data))],
+}
+
+/** Like {@link parseNanFunction}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseNanFunctionLazy(r: Buffer): NanFunction {
+    return structs.getLazyObject(r, __LAZY_NanFunction)
+}
+
 /** Encodes a {@link NanFunction} object into a stream of attributes */
 export function formatNanFunction(x: NanFunction): StreamData {
     return structs.putObject(x, {
-        type: (data, obj) => data.push(1, structs.putU8(structs.putEnum(NanFunctionType, obj.type!))),
+        type: (data, obj) => data.pushU8(1, structs.putEnum(NanFunctionType, obj.type!)),
         serviceId: (data, obj) => data.push(2, obj.serviceId!),
-        publishType: (data, obj) => data.push(3, structs.putU8(formatNanPublishType(obj.publishType!))),
-        publishBcast: (data, obj) => data.push(4, structs.putFlag(obj.publishBcast!)),
-        subscribeActive: (data, obj) => data.push(5, structs.putFlag(obj.subscribeActive!)),
-        followUpId: (data, obj) => data.push(6, structs.putU8(obj.followUpId!)),
-        followUpReqId: (data, obj) => data.push(7, structs.putU8(obj.followUpReqId!)),
+        publishType: (data, obj) => data.pushU8(3, formatNanPublishType(obj.publishType!)),
+        publishBcast: (data, obj) => data.pushFlag(4, obj.publishBcast!),
+        subscribeActive: (data, obj) => data.pushFlag(5, obj.subscribeActive!),
+        followUpId: (data, obj) => data.pushU8(6, obj.followUpId!),
+        followUpReqId: (data, obj) => data.pushU8(7, obj.followUpReqId!),
         followUpDest: (data, obj) => data.push(8, obj.followUpDest!),
-        closeRange: (data, obj) => data.push(9, structs.putFlag(obj.closeRange!)),
-        ttl: (data, obj) => data.push(10, structs.putU32(obj.ttl!)),
+        closeRange: (data, obj) => data.pushFlag(9, obj.closeRange!),
+        ttl: (data, obj) => data.pushU32(10, obj.ttl!),
         serviceInfo: (data, obj) => data.push(11, obj.serviceInfo!),
         srf: (data, obj) => data.push(12, formatNanSrf(obj.srf!)),
         rxMatchFilter: (data, obj) => data.push(13, obj.rxMatchFilter!),
         txMatchFilter: (data, obj) => data.push(14, obj.txMatchFilter!),
-        instanceId: (data, obj) => data.push(15, structs.putU8(obj.instanceId!)),
-        termReason: (data, obj) => data.push(16, structs.putU8(structs.putEnum(NanFunctionTerminationReason, obj.termReason!))),
+        instanceId: (data, obj) => data.pushU8(15, obj.instanceId!),
+        termReason: (data, obj) => data.pushU8(16, structs.putEnum(NanFunctionTerminationReason, obj.termReason!)),
     })
 }
 
@@ -8938,12 +9879,25 @@ export function parseNanSrf(r: Buffer): NanSrf {
     })
 }
 
+/** Decoders of the attributes of a {@link NanSrf} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_NanSrf: structs.LazyFields = {
+    1: ['include', data => structs.getFlag(data)],
+    2: ['bf', data => data],
+    3: ['bfIdx', data => structs.getU8(data)],
+    4: ['macAddrs', data => structs.getArray(data, x => x)],
+}
+
+/** Like {@link parseNanSrf}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseNanSrfLazy(r: Buffer): NanSrf {
+    return structs.getLazyObject(r, __LAZY_NanSrf)
+}
+
 /** Encodes a {@link NanSrf} object into a stream of attributes */
 export function formatNanSrf(x: NanSrf): StreamData {
     return structs.putObject(x, {
-        include: (data, obj) => data.push(1, structs.putFlag(obj.include!)),
+        include: (data, obj) => data.pushFlag(1, obj.include!),
         bf: (data, obj) => data.push(2, obj.bf!),
-        bfIdx: (data, obj) => data.push(3, structs.putU8(obj.bfIdx!)),
+        bfIdx: (data, obj) => data.pushU8(3, obj.bfIdx!),
         macAddrs: (data, obj) => data.push(4, structs.putArray(obj.macAddrs!, x => x)),
     })
 }
@@ -8973,6 +9927,17 @@ export function parseNanMatch(r: Buffer): NanMatch {
     })
 }
 
+/** Decoders of the attributes of a {@link NanMatch} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_NanMatch: structs.LazyFields = {
+    1: ['local', data => parseNanFunctionLazy(data)],
+    2: ['peer', data => parseNanFunctionLazy(data)],
+}
+
+/** Like {@link parseNanMatch}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseNanMatchLazy(r: Buffer): NanMatch {
+    return structs.getLazyObject(r, __LAZY_NanMatch)
+}
+
 /** Encodes a {@link NanMatch} object into a stream of attributes */
 export function formatNanMatch(x: NanMatch): StreamData {
     return structs.putObject(x, {
@@ -9025,6 +9990,18 @@ export function parseFtmResponder(r: Buffer): FtmResponder {
     })
 }
 
+/** Decoders of the attributes of a {@link FtmResponder} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_FtmResponder: structs.LazyFields = {
+    1: ['enabled', data => data],
+    2: ['lci', data => data],
+    3: ['civicloc', data => data],
+}
+
+/** Like {@link parseFtmResponder}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseFtmResponderLazy(r: Buffer): FtmResponder {
+    return structs.getLazyObject(r, __LAZY_FtmResponder)
+}
+
 /** Encodes a {@link FtmResponder} object into a stream of attributes */
 export function formatFtmResponder(x: FtmResponder): StreamData {
     return structs.putObject(x, {
@@ -9108,18 +10085,37 @@ export function parseFtmResponderStats(r: Buffer): FtmResponderStats {
     })
 }
 
+/** Decoders of the attributes of a {@link FtmResponderStats} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_FtmResponderStats: structs.LazyFields = {
+    1: ['successNum', data => structs.getU32(data)],
+    2: ['partialNum', data => structs.getU32(data)],
+    3: ['failedNum', data => structs.getU32(data)],
+    4: ['asapNum', data => structs.getU32(data)],
+    5: ['nonAsapNum', data => structs.getU32(data)],
+    6: ['totalDurationMsec', data => structs.getU64(data)],
+    7: ['unknownTriggersNum', data => structs.getU32(data)],
+    8: ['rescheduleRequestsNum', data => structs.getU32(data)],
+    9: ['outOfWindowTriggersNum', data => structs.getU32(data)],
+    10: ['__pad', data => data],
+}
+
+/** Like {@link parseFtmResponderStats}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseFtmResponderStatsLazy(r: Buffer): FtmResponderStats {
+    return structs.getLazyObject(r, __LAZY_FtmResponderStats)
+}
+
 /** Encodes a {@link FtmResponderStats} object into a stream of attributes */
 export function formatFtmResponderStats(x: FtmResponderStats): StreamData {
     return structs.putObject(x, {
-        successNum: (data, obj) => data.push(1, structs.putU32(obj.successNum!)),
-        partialNum: (data, obj) => data.push(2, structs.putU32(obj.partialNum!)),
-        failedNum: (data, obj) => data.push(3, structs.putU32(obj.failedNum!)),
-        asapNum: (data, obj) => data.push(4, structs.putU32(obj.asapNum!)),
-        nonAsapNum: (data, obj) => data.push(5, structs.putU32(obj.nonAsapNum!)),
-        totalDurationMsec: (data, obj) => data.push(6, structs.putU64(obj.totalDurationMsec!)),
-        unknownTriggersNum: (data, obj) => data.push(7, structs.putU32(obj.unknownTriggersNum!)),
-        rescheduleRequestsNum: (data, obj) => data.push(8, structs.putU32(obj.rescheduleRequestsNum!)),
-        outOfWindowTriggersNum: (data, obj) => data.push(9, structs.putU32(obj.outOfWindowTriggersNum!)),
+        successNum: (data, obj) => data.pushU32(1, obj.successNum!),
+        partialNum: (data, obj) => data.pushU32(2, obj.partialNum!),
+        failedNum: (data, obj) => data.pushU32(3, obj.failedNum!),
+        asapNum: (data, obj) => data.pushU32(4, obj.asapNum!),
+        nonAsapNum: (data, obj) => data.pushU32(5, obj.nonAsapNum!),
+        totalDurationMsec: (data, obj) => data.pushU64(6, obj.totalDurationMsec!),
+        unknownTriggersNum: (data, obj) => data.pushU32(7, obj.unknownTriggersNum!),
+        rescheduleRequestsNum: (data, obj) => data.pushU32(8, obj.rescheduleRequestsNum!),
+        outOfWindowTriggersNum: (data, obj) => data.pushU32(9, obj.outOfWindowTriggersNum!),
         __pad: (data, obj) => data.push(10, obj.__pad!),
     })
 }
@@ -9228,11 +10224,22 @@ export function parsePeerMeasurementRequest(r: Buffer): PeerMeasurementRequest {
     })
 }
 
+/** Decoders of the attributes of a {@link PeerMeasurementRequest} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_PeerMeasurementRequest: structs.LazyFields = {
+    1: ['data', data => data],
+    2: ['getApTsf', data => structs.getFlag(data)],
+}
+
+/** Like {@link parsePeerMeasurementRequest}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parsePeerMeasurementRequestLazy(r: Buffer): PeerMeasurementRequest {
+    return structs.getLazyObject(r, __LAZY_PeerMeasurementRequest)
+}
+
 /** Encodes a {@link PeerMeasurementRequest} object into a stream of attributes */
 export function formatPeerMeasurementRequest(x: PeerMeasurementRequest): StreamData {
     return structs.putObject(x, {
         data: (data, obj) => data.push(1, obj.data!),
-        getApTsf: (data, obj) => data.push(2, structs.putFlag(obj.getApTsf!)),
+        getApTsf: (data, obj) => data.pushFlag(2, obj.getApTsf!),
     })
 }
 
@@ -9290,14 +10297,29 @@ export function parsePeerMeasurementResponse(r: Buffer): PeerMeasurementResponse
     })
 }
 
+/** Decoders of the attributes of a {@link PeerMeasurementResponse} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_PeerMeasurementResponse: structs.LazyFields = {
+    1: ['data', data => data],
+    2: ['status', data => structs.getEnum(PeerMeasurementStatus, structs.getU32(data))],
+    3: ['hostTime', data => structs.getU64(data)],
+    4: ['apTsf', data => structs.getU64(data)],
+    5: ['final', data => structs.getFlag(data)],
+    6: ['__pad', data => data],
+}
+
+/** Like {@link parsePeerMeasurementResponse}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parsePeerMeasurementResponseLazy(r: Buffer): PeerMeasurementResponse {
+    return structs.getLazyObject(r, __LAZY_PeerMeasurementResponse)
+}
+
 /** Encodes a {@link PeerMeasurementResponse} object into a stream of attributes */
 export function formatPeerMeasurementResponse(x: PeerMeasurementResponse): StreamData {
     return structs.putObject(x, {
         data: (data, obj) => data.push(1, obj.data!),
-        status: (data, obj) => data.push(2, structs.putU32(structs.putEnum(PeerMeasurementStatus, obj.status!))),
-        hostTime: (data, obj) => data.push(3, structs.putU64(obj.hostTime!)),
-        apTsf: (data, obj) => data.push(4, structs.putU64(obj.apTsf!)),
-        final: (data, obj) => data.push(5, structs.putFlag(obj.final!)),
+        status: (data, obj) => data.pushU32(2, structs.putEnum(PeerMeasurementStatus, obj.status!)),
+        hostTime: (data, obj) => data.pushU64(3, obj.hostTime!),
+        apTsf: (data, obj) => data.pushU64(4, obj.apTsf!),
+        final: (data, obj) => data.pushFlag(5, obj.final!),
         __pad: (data, obj) => data.push(6, obj.__pad!),
     })
 }
@@ -9338,6 +10360,19 @@ export function parsePeerMeasurementPeerAttrs(r: Buffer): PeerMeasurementPeerAtt
     })
 }
 
+/** Decoders of the attributes of a {@link PeerMeasurementPeerAttrs} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_PeerMeasurementPeerAttrs: structs.LazyFields = {
+    1: ['addr', data => data],
+    2: ['chan', data => parseMessageLazy(data)],
+    3: ['req', data => structs.getMap(data, x => parsePeerMeasurementRequestLazy(x))],
+    4: ['resp', data => structs.getMap(data, x => parsePeerMeasurementResponseLazy(x))],
+}
+
+/** Like {@link parsePeerMeasurementPeerAttrs}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parsePeerMeasurementPeerAttrsLazy(r: Buffer): PeerMeasurementPeerAttrs {
+    return structs.getLazyObject(r, __LAZY_PeerMeasurementPeerAttrs)
+}
+
 /** Encodes a {@link PeerMeasurementPeerAttrs} object into a stream of attributes */
 export function formatPeerMeasurementPeerAttrs(x: PeerMeasurementPeerAttrs): StreamData {
     return structs.putObject(x, {
@@ -9398,12 +10433,26 @@ export function parsePeerMeasurement(r: Buffer): PeerMeasurement {
     })
 }
 
+/** Decoders of the attributes of a {@link PeerMeasurement} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_PeerMeasurement: structs.LazyFields = {
+    1: ['maxPeers', data => structs.getU32(data)],
+    2: ['reportApTsf', data => structs.getFlag(data)],
+    3: ['randomizeMacAddr', data => structs.getFlag(data)],
+    4: ['typeCapa', data => data],
+    5: ['peers', data => parsePeerMeasurementPeerAttrsLazy(data)],
+}
+
+/** Like {@link parsePeerMeasurement}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parsePeerMeasurementLazy(r: Buffer): PeerMeasurement {
+    return structs.getLazyObject(r, __LAZY_PeerMeasurement)
+}
+
 /** Encodes a {@link PeerMeasurement} object into a stream of attributes */
 export function formatPeerMeasurement(x: PeerMeasurement): StreamData {
     return structs.putObject(x, {
-        maxPeers: (data, obj) => data.push(1, structs.putU32(obj.maxPeers!)),
-        reportApTsf: (data, obj) => data.push(2, structs.putFlag(obj.reportApTsf!)),
-        randomizeMacAddr: (data, obj) => data.push(3, structs.putFlag(obj.randomizeMacAddr!)),
+        maxPeers: (data, obj) => data.pushU32(1, obj.maxPeers!),
+        reportApTsf: (data, obj) => data.pushFlag(2, obj.reportApTsf!),
+        randomizeMacAddr: (data, obj) => data.pushFlag(3, obj.randomizeMacAddr!),
         typeCapa: (data, obj) => data.push(4, obj.typeCapa!),
         peers: (data, obj) => data.push(5, formatPeerMeasurementPeerAttrs(obj.peers!)),
     })
@@ -9478,17 +10527,34 @@ export function parsePeerMeasurementFtmCapabilities(r: Buffer): PeerMeasurementF
     })
 }
 
+/** Decoders of the attributes of a {@link PeerMeasurementFtmCapabilities} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_PeerMeasurementFtmCapabilities: structs.LazyFields = {
+    1: ['asap', data => structs.getFlag(data)],
+    2: ['nonAsap', data => structs.getFlag(data)],
+    3: ['reqLci', data => structs.getFlag(data)],
+    4: ['reqCivicloc', data => structs.getFlag(data)],
+    5: ['preambles', data => parsePreambleSet(structs.getU32(data))],
+    6: ['bandwidths', data => data],
+    7: ['maxBurstsExponent', data => structs.getU32(data)],
+    8: ['maxFtmsPerBurst', data => structs.getU32(data)],
+}
+
+/** Like {@link parsePeerMeasurementFtmCapabilities}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parsePeerMeasurementFtmCapabilitiesLazy(r: Buffer): PeerMeasurementFtmCapabilities {
+    return structs.getLazyObject(r, __LAZY_PeerMeasurementFtmCapabilities)
+}
+
 /** Encodes a {@link PeerMeasurementFtmCapabilities} object into a stream of attributes */
 export function formatPeerMeasurementFtmCapabilities(x: PeerMeasurementFtmCapabilities): StreamData {
     return structs.putObject(x, {
-        asap: (data, obj) => data.push(1, structs.putFlag(obj.asap!)),
-        nonAsap: (data, obj) => data.push(2, structs.putFlag(obj.nonAsap!)),
-        reqLci: (data, obj) => data.push(3, structs.putFlag(obj.reqLci!)),
-        reqCivicloc: (data, obj) => data.push(4, structs.putFlag(obj.reqCivicloc!)),
-        preambles: (data, obj) => data.push(5, structs.putU32(formatPreambleSet(obj.preambles!))),
+        asap: (data, obj) => data.pushFlag(1, obj.asap!),
+        nonAsap: (data, obj) => data.pushFlag(2, obj.nonAsap!),
+        reqLci: (data, obj) => data.pushFlag(3, obj.reqLci!),
+        reqCivicloc: (data, obj) => data.pushFlag(4, obj.reqCivicloc!),
+        preambles: (data, obj) => data.pushU32(5, formatPreambleSet(obj.preambles!)),
         bandwidths: (data, obj) => data.push(6, obj.bandwidths!),
-        maxBurstsExponent: (data, obj) => data.push(7, structs.putU32(obj.maxBurstsExponent!)),
-        maxFtmsPerBurst: (data, obj) => data.push(8, structs.putU32(obj.maxFtmsPerBurst!)),
+        maxBurstsExponent: (data, obj) => data.pushU32(7, obj.maxBurstsExponent!),
+        maxFtmsPerBurst: (data, obj) => data.pushU32(8, obj.maxFtmsPerBurst!),
     })
 }
 
@@ -9561,18 +10627,36 @@ export function parsePeerMeasurementFtmRequest(r: Buffer): PeerMeasurementFtmReq
     })
 }
 
+/** Decoders of the attributes of a {@link PeerMeasurementFtmRequest} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_PeerMeasurementFtmRequest: structs.LazyFields = {
+    1: ['asap', data => structs.getFlag(data)],
+    2: ['preamble', data => structs.getEnum(Preamble, structs.getU32(data))],
+    3: ['numBurstsExp', data => structs.getU8(data)],
+    4: ['burstPeriod', data => structs.getU16(data)],
+    5: ['burstDuration', data => structs.getU8(data)],
+    6: ['ftmsPerBurst', data => structs.getU8(data)],
+    7: ['numFtmrRetries', data => structs.getU8(data)],
+    8: ['requestLci', data => structs.getFlag(data)],
+    9: ['requestCivicloc', data => structs.getFlag(data)],
+}
+
+/** Like {@link parsePeerMeasurementFtmRequest}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parsePeerMeasurementFtmRequestLazy(r: Buffer): PeerMeasurementFtmRequest {
+    return structs.getLazyObject(r, __LAZY_PeerMeasurementFtmRequest)
+}
+
 /** Encodes a {@link PeerMeasurementFtmRequest} object into a stream of attributes */
 export function formatPeerMeasurementFtmRequest(x: PeerMeasurementFtmRequest): StreamData {
     return structs.putObject(x, {
-        asap: (data, obj) => data.push(1, structs.putFlag(obj.asap!)),
-        preamble: (data, obj) => data.push(2, structs.putU32(structs.putEnum(Preamble, obj.preamble!))),
-        numBurstsExp: (data, obj) => data.push(3, structs.putU8(obj.numBurstsExp!)),
-        burstPeriod: (data, obj) => data.push(4, structs.putU16(obj.burstPeriod!)),
-        burstDuration: (data, obj) => data.push(5, structs.putU8(obj.burstDuration!)),
-        ftmsPerBurst: (data, obj) => data.push(6, structs.putU8(obj.ftmsPerBurst!)),
-        numFtmrRetries: (data, obj) => data.push(7, structs.putU8(obj.numFtmrRetries!)),
-        requestLci: (data, obj) => data.push(8, structs.putFlag(obj.requestLci!)),
-        requestCivicloc: (data, obj) => data.push(9, structs.putFlag(obj.requestCivicloc!)),
+        asap: (data, obj) => data.pushFlag(1, obj.asap!),
+        preamble: (data, obj) => data.pushU32(2, structs.putEnum(Preamble, obj.preamble!)),
+        numBurstsExp: (data, obj) => data.pushU8(3, obj.numBurstsExp!),
+        burstPeriod: (data, obj) => data.pushU16(4, obj.burstPeriod!),
+        burstDuration: (data, obj) => data.pushU8(5, obj.burstDuration!),
+        ftmsPerBurst: (data, obj) => data.pushU8(6, obj.ftmsPerBurst!),
+        numFtmrRetries: (data, obj) => data.pushU8(7, obj.numFtmrRetries!),
+        requestLci: (data, obj) => data.pushFlag(8, obj.requestLci!),
+        requestCivicloc: (data, obj) => data.pushFlag(9, obj.requestCivicloc!),
     })
 }
 
@@ -9773,27 +10857,57 @@ export function parsePeerMeasurementFtmResponse(r: Buffer): PeerMeasurementFtmRe
     })
 }
 
+/** Decoders of the attributes of a {@link PeerMeasurementFtmResponse} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_PeerMeasurementFtmResponse: structs.LazyFields = {
+    1: ['failReason', data => structs.getU32(data)],
+    2: ['burstIndex', data => structs.getU32(data)],
+    3: ['numFtmrAttempts', data => structs.getU32(data)],
+    4: ['numFtmrSuccesses', data => structs.getU32(data)],
+    5: ['busyRetryTime', data => structs.getU32(data)],
+    6: ['numBurstsExp', data => structs.getU8(data)],
+    7: ['burstDuration', data => structs.getU8(data)],
+    8: ['ftmsPerBurst', data => structs.getU8(data)],
+    9: ['rssiAvg', data => structs.getS32(data)],
+    10: ['rssiSpread', data => structs.getS32(data)],
+    11: ['txRate', data => parseRateInfoLazy(data)],
+    12: ['rxRate', data => parseRateInfoLazy(data)],
+    13: ['rttAvg', data => structs.getS64(data)],
+    14: ['rttVariance', data => structs.getU64(data)],
+    15: ['rttSpread', data => structs.getU64(data)],
+    16: ['distAvg', data => structs.getS64(data)],
+    17: ['distVariance', data => structs.getU64(data)],
+    18: ['distSpread', data => structs.getU64(data)],
+    19: ['lci', data => data],
+    20: ['civicloc', data => data],
+    21: ['__pad', data => data],
+}
+
+/** Like {@link parsePeerMeasurementFtmResponse}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parsePeerMeasurementFtmResponseLazy(r: Buffer): PeerMeasurementFtmResponse {
+    return structs.getLazyObject(r, __LAZY_PeerMeasurementFtmResponse)
+}
+
 /** Encodes a {@link PeerMeasurementFtmResponse} object into a stream of attributes */
 export function formatPeerMeasurementFtmResponse(x: PeerMeasurementFtmResponse): StreamData {
     return structs.putObject(x, {
-        failReason: (data, obj) => data.push(1, structs.putU32(obj.failReason!)),
-        burstIndex: (data, obj) => data.push(2, structs.putU32(obj.burstIndex!)),
-        numFtmrAttempts: (data, obj) => data.push(3, structs.putU32(obj.numFtmrAttempts!)),
-        numFtmrSuccesses: (data, obj) => data.push(4, structs.putU32(obj.numFtmrSuccesses!)),
-        busyRetryTime: (data, obj) => data.push(5, structs.putU32(obj.busyRetryTime!)),
-        numBurstsExp: (data, obj) => data.push(6, structs.putU8(obj.numBurstsExp!)),
-        burstDuration: (data, obj) => data.push(7, structs.putU8(obj.burstDuration!)),
-        ftmsPerBurst: (data, obj) => data.push(8, structs.putU8(obj.ftmsPerBurst!)),
-        rssiAvg: (data, obj) => data.push(9, structs.putS32(obj.rssiAvg!)),
-        rssiSpread: (data, obj) => data.push(10, structs.putS32(obj.rssiSpread!)),
+        failReason: (data, obj) => data.pushU32(1, obj.failReason!),
+        burstIndex: (data, obj) => data.pushU32(2, obj.burstIndex!),
+        numFtmrAttempts: (data, obj) => data.pushU32(3, obj.numFtmrAttempts!),
+        numFtmrSuccesses: (data, obj) => data.pushU32(4, obj.numFtmrSuccesses!),
+        busyRetryTime: (data, obj) => data.pushU32(5, obj.busyRetryTime!),
+        numBurstsExp: (data, obj) => data.pushU8(6, obj.numBurstsExp!),
+        burstDuration: (data, obj) => data.pushU8(7, obj.burstDuration!),
+        ftmsPerBurst: (data, obj) => data.pushU8(8, obj.ftmsPerBurst!),
+        rssiAvg: (data, obj) => data.pushS32(9, obj.rssiAvg!),
+        rssiSpread: (data, obj) => data.pushS32(10, obj.rssiSpread!),
         txRate: (data, obj) => data.push(11, formatRateInfo(obj.txRate!)),
         rxRate: (data, obj) => data.push(12, formatRateInfo(obj.rxRate!)),
-        rttAvg: (data, obj) => data.push(13, structs.putS64(obj.rttAvg!)),
-        rttVariance: (data, obj) => data.push(14, structs.putU64(obj.rttVariance!)),
-        rttSpread: (data, obj) => data.push(15, structs.putU64(obj.rttSpread!)),
-        distAvg: (data, obj) => data.push(16, structs.putS64(obj.distAvg!)),
-        distVariance: (data, obj) => data.push(17, structs.putU64(obj.distVariance!)),
-        distSpread: (data, obj) => data.push(18, structs.putU64(obj.distSpread!)),
+        rttAvg: (data, obj) => data.pushS64(13, obj.rttAvg!),
+        rttVariance: (data, obj) => data.pushU64(14, obj.rttVariance!),
+        rttSpread: (data, obj) => data.pushU64(15, obj.rttSpread!),
+        distAvg: (data, obj) => data.pushS64(16, obj.distAvg!),
+        distVariance: (data, obj) => data.pushU64(17, obj.distVariance!),
+        distSpread: (data, obj) => data.pushU64(18, obj.distSpread!),
         lci: (data, obj) => data.push(19, obj.lci!),
         civicloc: (data, obj) => data.push(20, obj.civicloc!),
         __pad: (data, obj) => data.push(21, obj.__pad!),
@@ -9817,6 +10931,17 @@ export function parseObssPd(r: Buffer): ObssPd {
     })
 }
 
+/** Decoders of the attributes of a {@link ObssPd} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_ObssPd: structs.LazyFields = {
+    1: ['inOffset', data => data],
+    2: ['axOffset', data => data],
+}
+
+/** Like {@link parseObssPd}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseObssPdLazy(r: Buffer): ObssPd {
+    return structs.getLazyObject(r, __LAZY_ObssPd)
+}
+
 /** Encodes a {@link ObssPd} object into a stream of attributes */
 export function formatObssPd(x: ObssPd): StreamData {
     return structs.putObject(x, {
@@ -8,6 +8,8 @@
 
 import { EventEmitter } from 'events'
 import { constants } from 'os'
+import { INDEX_ENTRY_SIZE } from './structs'
+import { Attributes } from './constants'
 
 // Load the native binding
 const binding = require('node-gyp-build')(__dirname + '/..')
@@ -43,10 +45,62 @@ export interface RawNetlinkSocketOptions {
     localPort?: number
     /** Local groups mask, deprecated (default: 0, i.e. no groups) */
     localGroups?: number
-    /** Enable message peeking (default: true) */
-    messagePeeking?: boolean
+    /**
+     * Message peeking mode (default: true). If true, the size of
+     * every datagram is determined with a `MSG_PEEK` read before reading
+     * it, so nothing is ever truncated, at the cost of two `recvmsg`
+     * calls per datagram. If 'adaptive', datagrams are read in a single
+     * call (halving the syscalls) into pooled buffers of a learned size,
+     * starting at 32kb, which the kernel doesn't exceed for dump replies
+     * and notifications of usual size. A datagram that doesn't fit is
+     * lost (reported as truncated) and the buffers grow for later reads,
+     * so only use it if an occasional lost datagram is acceptable. If
+     * false, buffers of `msgBufferSize` are used.
+     */
+    messagePeeking?: boolean | 'adaptive'
     /** Buffer size when receiving messages (ignored if message peeking is enabled) (default: 4kb) */
     msgBufferSize?: number
+    /**
+     * Read datagrams in batches (using `recvmmsg`) and deliver them
+     * through the `messages` event, one {@link MessageBatch} per
+     * poll wakeup (default: false). If message peeking is enabled,
+     * each datagram is read into a slot as big as the receive buffer,
+     * of which only the used memory is committed, so datagrams aren't
+     * truncated.
+     */
+    batchReceive?: boolean
+    /**
+     * Validate the framing of received datagrams natively, and pass
+     * a framing index (see {@link parseIndexedMessages}) along with
+     * them (default: true).
+     */
+    indexMessages?: boolean
+    /**
+     * Receive datagrams in a dedicated thread, which copies them into a
+     * bounded ring and notifies the event loop. This keeps the socket
+     * drained (avoiding `ENOBUFS`) while the event loop is busy, at the
+     * cost of a copy. Message peeking is always used unless
+     * `messagePeeking` is false.
+     */
+    receiveThread?: boolean | ReceiveThreadOptions
+    /**
+     * Use this already open socket instead of creating one. Ownership
+     * is transferred (it will be closed along with this socket). If it
+     * isn't a netlink socket (i.e. one end of {@link createSocketPair}),
+     * it isn't bound, memberships are ignored and netlink options fail
+     * with `ENOPROTOOPT`; messages from the peer appear to come from
+     * the kernel (port 0).
+     */
+    fd?: number
+    /**
+     * Create the socket inside this network namespace, given as an
+     * open file descriptor or a path (like `/run/netns/<name>` or
+     * `/proc/<pid>/ns/net`). The socket is created from a helper
+     * thread that enters the namespace, which requires
+     * `CAP_SYS_ADMIN`; it then stays in that namespace. Can't be
+     * combined with `fd`.
+     */
+    netns?: number | string
 
     /** Sets the `SO_RCVBUF` socket value. */
     recvBufferSize: number
@@ -54,6 +108,35 @@ export interface RawNetlinkSocketOptions {
     sendBufferSize: number
 }
 
+export interface ReceiveThreadOptions {
+    /** Capacity of the ring, in datagrams (rounded up to a power of two) (default: 1024) */
+    ringSize?: number
+    /**
+     * What to do when a datagram arrives and the ring is full (default: 'flag'):
+     *
+     *  - 'drop-oldest': discard the oldest queued datagram
+     *  - 'block': stop reading until there's room, letting the kernel drop instead
+     *  - 'flag': discard the new datagram
+     *
+     * With 'drop-oldest' and 'flag', an `ENOBUFS` error is emitted after the
+     * fact, just like the kernel does when its queue overflows.
+     */
+    overflow?: 'drop-oldest' | 'block' | 'flag'
+}
+
+/**
+ * Creates a pair of connected `AF_UNIX` `SOCK_SEQPACKET` sockets,
+ * which (like netlink sockets) preserve datagram boundaries. Pass
+ * them as the `fd` option to get two sockets talking to each other,
+ * so that one can stand in for the kernel (to replay captured
+ * traffic in tests or benchmarks, for instance).
+ *
+ * @returns The file descriptors
+ */
+export function createSocketPair(): [number, number] {
+    return binding.socketpair()
+}
+
 function tryBind(native: NativeNetlink, ...args: any[]) {
     try {
         native.bind(...args)
@@ -73,6 +156,97 @@ function retryBind(native: NativeNetlink, groups: number, maxTries: number = 100
     throw Error("Couldn't find a free address")
 }
 
+/**
+ * Histogram of callback durations. Bucket 0 counts calls under 1µs,
+ * bucket N counts calls in [2^(N-1), 2^N) µs, the last bucket also
+ * counts anything longer.
+ */
+export interface LatencyHistogram {
+    count: number
+    totalNs: number
+    maxNs: number
+    buckets: number[]
+}
+
+/** Options for {@link RawNetlinkSocket.startCapture} */
+export interface CaptureOptions {
+    /**
+     * Maximum amount of captured data waiting to be written, in bytes.
+     * Datagrams that don't fit are dropped (default: 4MiB).
+     */
+    bufferSize?: number
+    /** Maximum bytes to capture of each datagram (default: 262144) */
+    snapLength?: number
+}
+
+/** Capture counters, see {@link RawNetlinkSocket.startCapture} */
+export interface CaptureStats {
+    /** Captured datagrams */
+    packets: number
+    /** Size of captured datagrams (before truncating to the snap length) */
+    bytes: number
+    /** Datagrams dropped because the buffer was full */
+    dropped: number
+}
+
+/** Socket counters, see {@link RawNetlinkSocket.stats} */
+export interface SocketStats {
+    recv: {
+        /** `recvmsg` / `recvmmsg` calls (including peeks and failed calls) */
+        calls: number
+        datagrams: number
+        bytes: number
+        eagain: number
+        enobufs: number
+        /** Other receive errors */
+        errors: number
+        truncated: number
+        /** Times reading stopped because of the per-wakeup limit, to prevent loop starvation */
+        readLimitHits: number
+        /** Datagrams discarded because the receive thread's ring was full */
+        ringOverflows: number
+    }
+    send: {
+        /** `sendmsg` calls (including failed calls) */
+        calls: number
+        datagrams: number
+        bytes: number
+        eagain: number
+        enobufs: number
+        /** Other send errors */
+        errors: number
+        /** Current length of the queue of requests pending to be sent */
+        writeQueue: number
+        writeQueueMax: number
+        /** Current length of the queue of requests pending to have their callback called */
+        completedQueue: number
+        completedQueueMax: number
+    }
+    /** Requests sent with {@link RawNetlinkSocket.request} */
+    requests: {
+        sent: number
+        /** Requests waiting for replies */
+        pending: number
+        timeouts: number
+    }
+    /** Duration of receive callbacks (i.e. message handling) */
+    readCallback: LatencyHistogram
+    /** Duration of send completion callbacks */
+    sendCallback: LatencyHistogram
+    /** Kernel-side socket counters (`SO_MEMINFO`), if supported */
+    kernel?: {
+        rmemAlloc: number
+        rcvbuf: number
+        wmemAlloc: number
+        sndbuf: number
+        backlog: number
+        /** Datagrams dropped by the kernel, i.e. socket overruns */
+        drops: number
+    }
+    /** Counters of the running capture, if any */
+    capture?: CaptureStats
+}
+
 export interface MessageInfo {
     /** The sender port */
     port: number
@@ -80,6 +254,81 @@ export interface MessageInfo {
     groups: number
     /** Set if the message was truncated, indicates original size */
     truncated?: number
+    /**
+     * ID of the sender's network namespace (as assigned in ours), if
+     * {@link Attributes.LISTEN_ALL_NSID} is enabled, and the
+     * namespace has one
+     */
+    nsid?: number
+}
+
+/** Number of table entries per datagram in a {@link MessageBatch} */
+const BATCH_ENTRY_SIZE = 9
+
+/**
+ * Set of datagrams received in a single read, when `batchReceive`
+ * is enabled. All datagrams are stored in a single Buffer, and
+ * are only sliced when requested.
+ */
+export class MessageBatch {
+    /**
+     * @param data Concatenated datagrams
+     * @param table For each datagram: offset, length, port, groups,
+     * original size if truncated (or zero), first message and message
+     * count in `index` (or 0xFFFFFFFF if the datagram wasn't indexed),
+     * nsid (or 0xFFFFFFFF) and fleet member (or zero)
+     * @param index Framing index of the messages, with offsets relative
+     * to `data` (see {@link parseIndexedMessages})
+     */
+    constructor(readonly data: Buffer, readonly table: Uint32Array, readonly index: Uint32Array) {}
+
+    /** Number of datagrams in the batch */
+    get length(): number {
+        return this.table.length / BATCH_ENTRY_SIZE
+    }
+
+    /** Returns the data of the n-th datagram */
+    message(n: number): Buffer {
+        const offset = this.table[n * BATCH_ENTRY_SIZE]
+        return this.data.subarray(offset, offset + this.table[n * BATCH_ENTRY_SIZE + 1])
+    }
+
+    /** Returns the info of the n-th datagram */
+    info(n: number): MessageInfo {
+        const e = n * BATCH_ENTRY_SIZE
+        const rinfo: MessageInfo = { port: this.table[e + 2], groups: this.table[e + 3] }
+        if (this.table[e + 4])
+            rinfo.truncated = this.table[e + 4]
+        if (this.table[e + 7] !== 0xFFFFFFFF)
+            rinfo.nsid = this.table[e + 7] | 0
+        return rinfo
+    }
+
+    /** Returns the {@link NetlinkFleet} member the n-th datagram was received from */
+    member(n: number): number {
+        return this.table[n * BATCH_ENTRY_SIZE + 8]
+    }
+
+    /** Returns true if the n-th datagram was truncated */
+    truncated(n: number): boolean {
+        return this.table[n * BATCH_ENTRY_SIZE + 4] !== 0
+    }
+
+    /**
+     * Returns the framing index of the n-th datagram (with offsets
+     * relative to {@link data}), or undefined if it wasn't indexed.
+     */
+    messageIndex(n: number): Uint32Array | undefined {
+        const e = n * BATCH_ENTRY_SIZE
+        const first = this.table[e + 5], count = this.table[e + 6]
+        if (count === 0xFFFFFFFF) return
+        return this.index.subarray(first * INDEX_ENTRY_SIZE, (first + count) * INDEX_ENTRY_SIZE)
+    }
+
+    forEach(fn: (msg: Buffer, rinfo: MessageInfo) => any) {
+        for (let n = 0; n < this.length; n++)
+            fn(this.message(n), this.info(n))
+    }
 }
 
 export interface RawNetlinkSendOptions {
@@ -93,6 +342,11 @@ export interface RawNetlinkSendOptions {
     groups?: number
 }
 
+export interface RawNetlinkRequestOptions extends RawNetlinkSendOptions {
+    /** Timeout in ms (default: no timeout) */
+    timeout?: number
+}
+
 export interface ErrnoException extends Error {
     name: 'ErrnoException'
     /** name of the syscall that failed to execute */
@@ -104,7 +358,8 @@ export interface ErrnoException extends Error {
 }
 
 interface EventMap {
-    message(msg: Buffer, rinfo: MessageInfo): void
+    message(msg: Buffer, rinfo: MessageInfo, index?: Uint32Array): void
+    messages(batch: MessageBatch): void
     truncatedMessage(msg: Buffer, rinfo: MessageInfo): void
     error(err: ErrnoException): void
     close(): void
@@ -118,6 +373,7 @@ interface EventMap {
  *
  * events:
  * `message`
+ * `messages` (only if `batchReceive` is enabled)
  * `truncatedMessage`
  * `error`
  * `close`
@@ -133,6 +389,9 @@ export class RawNetlinkSocket extends EventEmitter {
 
     private readonly __native: NativeNetlink
 
+    /** True if the socket was created with `batchReceive` enabled */
+    readonly batching: boolean
+
     /**
      * Create a native Netlink socket, bound to the specified protocol
      * at the specified local address (port).
@@ -148,9 +407,21 @@ export class RawNetlinkSocket extends EventEmitter {
         let msgBuffer = 0 // by default, do message peeking
         if (options && options.messagePeeking === false)
             msgBuffer = (options && options.msgBufferSize) || 4096
+        const adaptive = !!(options && options.messagePeeking === 'adaptive')
         if (typeof protocol !== 'number' || typeof msgBuffer !== 'number')
             throw TypeError('Expected number')
-        this.__native = new binding.NativeNetlink(protocol, msgBuffer, this._receive.bind(this), this._error.bind(this))
+        this.batching = !!(options && options.batchReceive)
+        const receive = this.batching ? this._receiveBatch.bind(this) : this._receive.bind(this)
+        const thread = options && options.receiveThread
+        this.__native = new binding.NativeNetlink(protocol, msgBuffer, receive, this._error.bind(this), {
+            batch: this.batching,
+            adaptive,
+            index: !(options && options.indexMessages === false),
+            thread: !!thread,
+            ...(typeof thread === 'object' ? thread : {}),
+            fd: options && options.fd,
+            netns: options && options.netns,
+        })
         try {
             if (options && options.recvBufferSize)
                 this.setRecvBufferSize(options && options.recvBufferSize)
@@ -172,8 +443,25 @@ export class RawNetlinkSocket extends EventEmitter {
         }
     }
 
-    private _receive(msg: Buffer, rinfo: MessageInfo) {
-        this.emit(rinfo.truncated ? 'truncatedMessage' : 'message', msg, rinfo)
+    private _receive(msg: Buffer, rinfo: MessageInfo, index?: Uint32Array) {
+        if (rinfo.truncated)
+            this.emit('truncatedMessage', msg, rinfo)
+        else
+            this.emit('message', msg, rinfo, index)
+    }
+
+    private _receiveBatch(data: Buffer, table: Uint32Array, index: Uint32Array) {
+        const batch = new MessageBatch(data, table, index)
+        this.emit('messages', batch)
+        // only slice into individual datagrams if somebody is listening
+        const wantMessages = this.listenerCount('message') > 0
+        const wantTruncated = this.listenerCount('truncatedMessage') > 0
+        if (!wantMessages && !wantTruncated) return
+        for (let n = 0; n < batch.length; n++) {
+            const truncated = batch.truncated(n)
+            if (truncated ? wantTruncated : wantMessages)
+                this._receive(batch.message(n), batch.info(n))
+        }
     }
 
     private _error(error: ErrnoException) {
@@ -199,11 +487,76 @@ export class RawNetlinkSocket extends EventEmitter {
         })
     }
 
+    /**
+     * Sends a request, and collects its replies natively: the
+     * sequence number and port of the (first) message header are
+     * filled in, along with the REQUEST and ACK flags, and the
+     * messages the kernel sends for that sequence number are held
+     * until the final DONE or ERROR message. Then the callback is
+     * called once, with all of them (including the final one).
+     * They aren't emitted as `message` events.
+     *
+     * Sequence numbers are assigned from the upper half of the
+     * space (0x80000000 and above), so they don't collide with the
+     * ones generated by {@link NetlinkSocket}. Timeouts are kept by
+     * the binding as well.
+     *
+     * @param msg Datagram, starting with the message header
+     * @param options Destination and timeout
+     * @param callback Called with the replies, or with an error if
+     * the message couldn't be sent, the timeout expired or the
+     * socket was closed
+     * @returns The assigned sequence number
+     */
+    request(
+        msg: Uint8Array | Uint8Array[],
+        options: RawNetlinkRequestOptions | undefined,
+        callback: (error: Error | undefined, replies?: Buffer, rinfo?: MessageInfo) => void
+    ): number {
+        const port = (options && options.port) || 0
+        const groups = (options && options.groups) || 0
+        const timeout = (options && options.timeout) || 0
+        if (typeof port !== 'number' || typeof groups !== 'number' || typeof timeout !== 'number')
+            throw TypeError('Expected number')
+        return this.__native.request(port, groups, msg, timeout, callback)
+    }
+
+    /**
+     * Holds sent datagrams in the queue, instead of sending them
+     * right away, until {@link uncork} is called. Unlike
+     * `net.Socket`, calls don't nest.
+     */
+    cork() {
+        this.__native.cork()
+    }
+
+    /**
+     * Sends the datagrams queued since {@link cork} was called,
+     * batching them into as few `sendmmsg` calls as possible.
+     */
+    uncork() {
+        this.__native.uncork()
+    }
+
+    /**
+     * Stops delivering received datagrams until {@link resume} is
+     * called. They queue up in the socket (or in the ring, if the
+     * receive thread is used) and may be dropped if it fills up.
+     */
+    pause() {
+        this.__native.pause()
+    }
+
+    /** Resumes delivering received datagrams, see {@link pause} */
+    resume() {
+        this.__native.resume()
+    }
+
     /**
      * Close the Netlink socket. After this, all other methods
      * can no longer be called. Messages pending to be sent
      * will be discarded, and its completion callback won't be
-     * called.
+     * called. Pending requests (see {@link request}) fail.
      */
     close() {
         this.__native.close()
@@ -260,6 +613,83 @@ export class RawNetlinkSocket extends EventEmitter {
         return this.__native.getSendBufferSize()
     }
 
+    /**
+     * Returns the socket counters. These are cheap to read, and are
+     * cumulative since the socket was created.
+     */
+    stats(): SocketStats {
+        return this.__native.stats()
+    }
+
+    /**
+     * Sets an integer `SOL_NETLINK` socket option, such as
+     * {@link Attributes.EXT_ACK} or {@link Attributes.GET_STRICT_CHK}.
+     */
+    setNetlinkOption(option: Attributes, value: number | boolean) {
+        if (typeof option !== 'number')
+            throw TypeError('Expected number')
+        this.__native.setNetlinkOption(option, Number(value))
+    }
+
+    /** Returns the value of an integer `SOL_NETLINK` socket option */
+    getNetlinkOption(option: Attributes): number {
+        if (typeof option !== 'number')
+            throw TypeError('Expected number')
+        return this.__native.getNetlinkOption(option)
+    }
+
+    /**
+     * Attaches a classic BPF program to the socket (`SO_ATTACH_FILTER`),
+     * replacing the current one. See {@link compileFilter}.
+     *
+     * @param program Array of `struct sock_filter`
+     */
+    attachFilter(program: Uint8Array) {
+        if (!(program instanceof Uint8Array))
+            throw TypeError('Expected Uint8Array')
+        this.__native.attachFilter(program)
+    }
+
+    /** Removes the attached socket filter (`SO_DETACH_FILTER`) */
+    detachFilter() {
+        this.__native.detachFilter()
+    }
+
+    /** Prevents the socket filter from being changed or removed (`SO_LOCK_FILTER`) */
+    lockFilter() {
+        this.__native.lockFilter()
+    }
+
+    /**
+     * Starts writing every sent and received datagram into a pcap file
+     * at `path` (truncating it), in the format of `nlmon` captures, so
+     * it can be inspected with Wireshark or tcpdump. Each datagram
+     * includes its direction, the peer's port and groups, and a
+     * nanosecond timestamp.
+     *
+     * Datagrams are copied into a bounded buffer which a background
+     * thread writes out; if the disk can't keep up, datagrams are
+     * dropped (see {@link CaptureStats.dropped}) rather than slowing
+     * the socket down. Only one capture can run at a time.
+     */
+    startCapture(path: string, options?: CaptureOptions) {
+        if (typeof path !== 'string')
+            throw TypeError('Expected string')
+        const bufferSize = (options && options.bufferSize) || (4 << 20)
+        const snapLength = (options && options.snapLength) || 262144
+        this.__native.startCapture(path, bufferSize, snapLength)
+    }
+
+    /**
+     * Stops the running capture, waiting until the file has been
+     * written. Throws if writing failed.
+     *
+     * @returns Counters of the capture, or undefined if there wasn't one
+     */
+    stopCapture(): CaptureStats | undefined {
+        return this.__native.stopCapture()
+    }
+
     /** Sets the `SO_RCVBUF` socket option. Sets the maximum socket receive buffer in bytes. */
     setRecvBufferSize(size: number) {
         if (typeof size !== 'number')
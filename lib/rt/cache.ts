@@ -0,0 +1,532 @@
+/**
+ * This module implements a cache of the kernel's link, address,
+ * route and neighbor tables, kept in sync through notifications.
+ * @module
+ */
+
+import { isDeepStrictEqual } from 'util'
+
+import { MessageInfo, RawNetlinkSocketOptions } from '../raw'
+import { NetlinkSocketOptions } from '../netlink'
+import { SyncedCache } from '../cache'
+import { Flags } from '../constants'
+import { NetlinkMessage, AttrStream } from '../structs'
+import { RtNetlinkSocket, RtNetlinkSocketOptions, createRtNetlink } from './rt'
+import { parseMessage, MessageType, MulticastGroups, RoutingTableClass } from './structs'
+import * as rt from './structs'
+
+const AF_UNSPEC = 0
+const AF_INET = 2
+const AF_INET6 = 10
+
+export type CacheKind = 'link' | 'address' | 'route' | 'neighbor'
+
+export interface CacheEntryMap {
+    link: rt.LinkMessage
+    address: rt.AddressMessage
+    route: rt.RouteMessage
+    neighbor: rt.NeighborMessage
+}
+
+export type CacheEntry = CacheEntryMap[CacheKind]
+
+export interface RtCacheOptions {
+    /**
+     * Tables to keep (default: all of them). Memberships are only
+     * added, and dumps only requested, for these.
+     */
+    kinds?: CacheKind[]
+    /**
+     * If set, perform a full resync every this many milliseconds.
+     * Useful because the kernel doesn't notify every change (for
+     * instance, IPv4 routes flushed when a link goes down).
+     */
+    resyncInterval?: number
+}
+
+interface EventMap {
+    /**
+     * Emitted for every change to an entry. `before` is undefined for
+     * new entries, `after` is undefined for removed entries.
+     */
+    change(kind: CacheKind, before: CacheEntry | undefined, after: CacheEntry | undefined): void
+    /** Emitted after a resync (caused by lost notifications, an interrupted dump or `resyncInterval`) completes */
+    resync(): void
+    /**
+     * Emitted when a resync fails (the cache keeps the old state and
+     * retries on the next trigger), or re-emitted from the socket
+     */
+    error(err: Error): void
+    /** Emitted when a notification can't be parsed; it is ignored */
+    invalid(err: any, msg: NetlinkMessage, rinfo: MessageInfo): void
+}
+
+/** Mutable state of the cache, swapped as a whole on resync */
+class CacheState {
+    links: Map<number, rt.LinkMessage> = new Map()
+    linksByName: Map<string, number> = new Map()
+    addresses: Map<string, rt.AddressMessage> = new Map()
+    addressesByIndex: Map<number, Set<string>> = new Map()
+    routes: Map<string, rt.RouteMessage> = new Map()
+    /** LPM tries, by family and effective table */
+    routeTries: Map<string, PrefixTrie<string>> = new Map()
+    neighbors: Map<string, rt.NeighborMessage> = new Map()
+    neighborsByAddress: Map<string, Set<string>> = new Map()
+}
+
+/**
+ * Binary trie of prefixes, for longest-prefix-match lookups. Each
+ * prefix holds a set of values (routes with the same prefix).
+ */
+export class PrefixTrie<T> {
+    private root: TrieNode<T> = {}
+    private count = 0
+
+    get size() {
+        return this.count
+    }
+
+    add(prefix: Uint8Array, length: number, value: T) {
+        let node = this.root
+        for (let i = 0; i < length; i++) {
+            const bit = getBit(prefix, i)
+            node = node[bit] || (node[bit] = {})
+        }
+        node.values = node.values || new Set()
+        if (!node.values.has(value)) {
+            node.values.add(value)
+            this.count++
+        }
+    }
+
+    delete(prefix: Uint8Array, length: number, value: T): boolean {
+        const path: TrieNode<T>[] = [this.root]
+        let node = this.root
+        for (let i = 0; i < length; i++) {
+            const next = node[getBit(prefix, i)]
+            if (!next) return false
+            path.push(node = next)
+        }
+        if (!(node.values && node.values.delete(value)))
+            return false
+        this.count--
+        if (!node.values.size)
+            node.values = undefined
+        // prune empty nodes
+        for (let i = length; i > 0; i--) {
+            const n = path[i]
+            if (n.values || n[0] || n[1]) break
+            path[i - 1][getBit(prefix, i - 1)] = undefined
+        }
+        return true
+    }
+
+    /** Returns the values of the longest prefix containing `address`, if any */
+    lookup(address: Uint8Array): Set<T> | undefined {
+        let node: TrieNode<T> | undefined = this.root
+        let best = this.root.values
+        for (let i = 0; node && i < address.length * 8; i++) {
+            node = node[getBit(address, i)]
+            if (node && node.values) best = node.values
+        }
+        return best
+    }
+
+    /** Returns the values of exactly this prefix, if any */
+    get(prefix: Uint8Array, length: number): Set<T> | undefined {
+        let node: TrieNode<T> | undefined = this.root
+        for (let i = 0; node && i < length; i++)
+            node = node[getBit(prefix, i)]
+        return node && node.values
+    }
+}
+
+interface TrieNode<T> {
+    0?: TrieNode<T>
+    1?: TrieNode<T>
+    values?: Set<T>
+}
+
+function getBit(x: Uint8Array, i: number): 0 | 1 {
+    return ((x[i >> 3] >> (7 - (i & 7))) & 1) as 0 | 1
+}
+
+const hex = (x?: Uint8Array) => x ? Buffer.from(x.buffer, x.byteOffset, x.length).toString('hex') : ''
+
+function addressKey(x: rt.AddressMessage) {
+    return `${x.data.family}/${x.data.index}/${hex(x.attrs.local || x.attrs.address)}/${x.data.prefixlen}`
+}
+
+/** Effective table of a route (`RTA_TABLE` overrides the header for ids above 255) */
+function routeTable(x: rt.RouteMessage) {
+    return typeof x.attrs.table === 'number' ? x.attrs.table : (x.data.table || 0)
+}
+
+function routeKey(x: rt.RouteMessage) {
+    return `${x.data.family}/${routeTable(x)}/${hex(x.attrs.dst)}/${x.data.dstLen}/${x.data.tos}/${x.attrs.priority || 0}`
+}
+
+function neighborKey(x: rt.NeighborMessage) {
+    return `${x.data.family}/${x.data.ifindex}/${hex(x.attrs.dst)}`
+}
+
+const GROUPS: { [K in CacheKind]: MulticastGroups[] } = {
+    link: [ MulticastGroups.LINK ],
+    address: [ MulticastGroups.IPV4_IFADDR, MulticastGroups.IPV6_IFADDR ],
+    route: [ MulticastGroups.IPV4_ROUTE, MulticastGroups.IPV6_ROUTE ],
+    neighbor: [ MulticastGroups.NEIGH ],
+}
+
+const KINDS: CacheKind[] = [ 'link', 'address', 'route', 'neighbor' ]
+
+/**
+ * Cache of the links, addresses, routes and neighbors in the
+ * kernel. It is populated with dumps, and then updated from
+ * NEW / DEL notifications. Lookups are synchronous and indexed:
+ * links by index and name, addresses by link, routes by
+ * longest-prefix match and neighbors by address.
+ *
+ * If notifications are lost (`ENOBUFS`) or a dump is interrupted
+ * (`DUMP_INTR`), the tables are dumped again and the differences
+ * with the cached state are emitted as `change` events, so
+ * listeners can treat changes uniformly.
+ *
+ * Entries are the parsed messages, and must not be modified.
+ */
+export class RtCache extends SyncedCache<CacheState, NetlinkMessage> {
+    // copy-pasted code for type-safe events
+    emit<E extends keyof EventMap>(event: E, ...args: Parameters<EventMap[E]>) { return super.emit(event, ...args) }
+    on<E extends keyof EventMap>(event: E, listener: EventMap[E]) { return super.on(event, listener) }
+    once<E extends keyof EventMap>(event: E, listener: EventMap[E]) { return super.once(event, listener) }
+    off<E extends keyof EventMap>(event: E, listener: EventMap[E]) { return super.off(event, listener) }
+    addListener<E extends keyof EventMap>(event: E, listener: EventMap[E]) { return super.addListener(event, listener) }
+    removeListener<E extends keyof EventMap>(event: E, listener: EventMap[E]) { return super.removeListener(event, listener) }
+
+    readonly socket: RtNetlinkSocket
+    readonly kinds: CacheKind[]
+
+    private resyncTimer?: NodeJS.Timeout
+    private readonly listeners_: { message: any, error: any }
+
+    /**
+     * Creates a cache on top of an existing socket. The socket
+     * shouldn't be joined to other groups. Call {@link sync} to
+     * populate it (or use {@link createRtCache}).
+     */
+    constructor(socket: RtNetlinkSocket, options?: RtCacheOptions) {
+        super(new CacheState())
+        this.socket = socket
+        this.kinds = (options && options.kinds) || KINDS
+        this.listeners_ = {
+            message: this._receive.bind(this),
+            error: this._error.bind(this),
+        }
+        this.socket.socket.on('message', this.listeners_.message)
+        this.socket.socket.on('error', this.listeners_.error)
+        for (const kind of this.kinds)
+            GROUPS[kind].forEach(group => this.socket.addMembership(group))
+        const interval = options && options.resyncInterval
+        if (interval) {
+            this.resyncTimer = setInterval(() => this.resync(), interval)
+            this.resyncTimer.unref()
+        }
+    }
+
+    /** Stops listening and closes the socket */
+    close() {
+        this.closed = true
+        if (typeof this.resyncTimer !== 'undefined')
+            clearInterval(this.resyncTimer)
+        this.socket.socket.off('message', this.listeners_.message)
+        this.socket.socket.off('error', this.listeners_.error)
+        this.socket.socket.close()
+    }
+
+    // Lookups
+
+    get links(): ReadonlyMap<number, rt.LinkMessage> {
+        return this.state.links
+    }
+
+    get addresses(): IterableIterator<rt.AddressMessage> {
+        return this.state.addresses.values()
+    }
+
+    get routes(): IterableIterator<rt.RouteMessage> {
+        return this.state.routes.values()
+    }
+
+    get neighbors(): IterableIterator<rt.NeighborMessage> {
+        return this.state.neighbors.values()
+    }
+
+    getLink(index: number): rt.LinkMessage | undefined {
+        return this.state.links.get(index)
+    }
+
+    getLinkByName(name: string): rt.LinkMessage | undefined {
+        const index = this.state.linksByName.get(name)
+        return typeof index === 'number' ? this.state.links.get(index) : undefined
+    }
+
+    /** Returns the addresses of a link */
+    getAddresses(index: number): rt.AddressMessage[] {
+        const keys = this.state.addressesByIndex.get(index)
+        return keys ? [...keys].map(k => this.state.addresses.get(k)!) : []
+    }
+
+    /**
+     * Finds the route that would be selected for a destination
+     * address in a table, by longest-prefix match (and lowest
+     * priority among routes with that prefix). Policy routing
+     * rules aren't taken into account.
+     *
+     * @param address Destination address (4 or 16 bytes)
+     * @param table Table to look into (default: main)
+     */
+    lookupRoute(address: Uint8Array, table: number = RoutingTableClass.MAIN): rt.RouteMessage | undefined {
+        const family = address.length === 4 ? AF_INET : address.length === 16 ? AF_INET6 : undefined
+        if (typeof family === 'undefined')
+            throw Error(`Invalid address length: ${address.length}`)
+        const trie = this.state.routeTries.get(`${family}/${table}`)
+        const keys = trie && trie.lookup(address)
+        if (!keys) return undefined
+        let best: rt.RouteMessage | undefined
+        for (const key of keys) {
+            const route = this.state.routes.get(key)!
+            if (!best || (route.attrs.priority || 0) < (best.attrs.priority || 0))
+                best = route
+        }
+        return best
+    }
+
+    /** Returns the neighbor entries for an address, optionally on a given link */
+    getNeighbors(address: Uint8Array, ifindex?: number): rt.NeighborMessage[] {
+        const family = address.length === 4 ? AF_INET : AF_INET6
+        const keys = this.state.neighborsByAddress.get(`${family}/${hex(address)}`)
+        if (!keys) return []
+        return [...keys].map(k => this.state.neighbors.get(k)!)
+            .filter(x => typeof ifindex === 'undefined' || x.data.ifindex === ifindex)
+    }
+
+    // Synchronization
+
+    /** Dumps every table into a new state (see {@link dumpInto}) */
+    protected async dumpState() {
+        const state = new CacheState()
+        for (const kind of this.kinds) {
+            if (this.resyncRequested) break
+            await this.dumpInto(state, kind)
+        }
+        return state
+    }
+
+    /** Dumps a table into `state`, requesting a new pass if the dump was interrupted */
+    private async dumpInto(state: CacheState, kind: CacheKind) {
+        const header = new AttrStream()
+        let type: MessageType
+        if (kind === 'link') {
+            rt.formatLinkMessage({ kind, data: {}, attrs: {} }, header)
+            type = MessageType.GETLINK
+        } else if (kind === 'address') {
+            rt.formatAddressMessage({ kind, data: {}, attrs: {} }, header)
+            type = MessageType.GETADDR
+        } else if (kind === 'route') {
+            rt.formatRouteMessage({ kind, data: {}, attrs: {} }, header)
+            type = MessageType.GETROUTE
+        } else {
+            rt.formatNeighborMessage({ kind, data: {}, attrs: {} }, header)
+            type = MessageType.GETNEIGH
+        }
+        for await (const [omsg] of this.socket.socket.dump(type, header.bufs)) {
+            for (const x of omsg) {
+                if (x.flags & Flags.DUMP_INTR)
+                    this.resyncRequested = true
+                const msg = parseMessage(x.type, x.data)
+                if (msg.kind !== kind)
+                    throw Error(`Unexpected ${msg.kind} message received`)
+                if (isPartialLink(msg)) continue
+                insert(state, msg)
+            }
+        }
+    }
+
+    /** Swaps the state, emitting changes (nothing is emitted for the first sync) */
+    protected replaceState(state: CacheState) {
+        const old = this.state
+        this.state = state
+        const empty = !old.links.size && !old.addresses.size && !old.routes.size && !old.neighbors.size
+        if (empty) return
+        const diff = <K extends CacheKind>(kind: K, before: Map<any, CacheEntryMap[K]>, after: Map<any, CacheEntryMap[K]>) => {
+            for (const [key, x] of before) {
+                const y = after.get(key)
+                if (!y) this.emit('change', kind, x, undefined)
+                else if (!isDeepStrictEqual(x, y)) this.emit('change', kind, x, y)
+            }
+            for (const [key, y] of after)
+                if (!before.has(key)) this.emit('change', kind, undefined, y)
+        }
+        diff('link', old.links, state.links)
+        diff('address', old.addresses, state.addresses)
+        diff('route', old.routes, state.routes)
+        diff('neighbor', old.neighbors, state.neighbors)
+    }
+
+    protected applyMessage(x: NetlinkMessage, rinfo: MessageInfo) {
+        let remove: boolean
+        switch (x.type) {
+            case MessageType.NEWLINK: case MessageType.NEWADDR:
+            case MessageType.NEWROUTE: case MessageType.NEWNEIGH:
+                remove = false
+                break
+            case MessageType.DELLINK: case MessageType.DELADDR:
+            case MessageType.DELROUTE: case MessageType.DELNEIGH:
+                remove = true
+                break
+            default:
+                return
+        }
+        let msg: rt.Message
+        try {
+            msg = parseMessage(x.type, x.data)
+        } catch (e) {
+            this.emit('invalid', e, x, rinfo)
+            return
+        }
+        if (msg.kind !== 'link' && msg.kind !== 'address' && msg.kind !== 'route' && msg.kind !== 'neighbor')
+            return
+        if (this.kinds.indexOf(msg.kind) === -1 || isPartialLink(msg))
+            return
+        if (remove) {
+            const before = remove_(this.state, msg)
+            if (before)
+                this.emit('change', msg.kind, before, undefined)
+            // the kernel doesn't notify IPv4 routes removed along with the link
+            if (msg.kind === 'link' && typeof msg.data.index === 'number')
+                this.purgeRoutes(msg.data.index)
+        } else {
+            const before = insert(this.state, msg)
+            this.emit('change', msg.kind, before, msg)
+        }
+    }
+
+    private purgeRoutes(index: number) {
+        for (const route of [...this.state.routes.values()]) {
+            if (route.attrs.oif === index) {
+                remove_(this.state, route)
+                this.emit('change', 'route', route, undefined)
+            }
+        }
+    }
+}
+
+/**
+ * Link messages of a specific family (i.e. AF_BRIDGE ones, sent when a
+ * port joins or leaves a bridge) only carry that family's view of the
+ * link, and a DELLINK of them doesn't mean the link is gone
+ */
+function isPartialLink(msg: CacheEntry) {
+    return msg.kind === 'link' && (msg.data.family || AF_UNSPEC) !== AF_UNSPEC
+}
+
+/** Adds or replaces an entry, returning the replaced one */
+function insert(state: CacheState, msg: CacheEntry): CacheEntry | undefined {
+    if (msg.kind === 'link') {
+        const index = msg.data.index!
+        const before = state.links.get(index)
+        if (before && typeof before.attrs.ifname === 'string')
+            state.linksByName.delete(before.attrs.ifname)
+        state.links.set(index, msg)
+        if (typeof msg.attrs.ifname === 'string')
+            state.linksByName.set(msg.attrs.ifname, index)
+        return before
+    } else if (msg.kind === 'address') {
+        const key = addressKey(msg)
+        const before = state.addresses.get(key)
+        state.addresses.set(key, msg)
+        const index = msg.data.index!
+        let keys = state.addressesByIndex.get(index)
+        if (!keys) state.addressesByIndex.set(index, keys = new Set())
+        keys.add(key)
+        return before
+    } else if (msg.kind === 'route') {
+        const key = routeKey(msg)
+        const before = state.routes.get(key)
+        state.routes.set(key, msg)
+        const trieKey = `${msg.data.family}/${routeTable(msg)}`
+        let trie = state.routeTries.get(trieKey)
+        if (!trie) state.routeTries.set(trieKey, trie = new PrefixTrie())
+        trie.add(msg.attrs.dst || new Uint8Array(0), msg.data.dstLen || 0, key)
+        return before
+    } else if (msg.kind === 'neighbor') {
+        const key = neighborKey(msg)
+        const before = state.neighbors.get(key)
+        state.neighbors.set(key, msg)
+        const addressKey = `${msg.data.family}/${hex(msg.attrs.dst)}`
+        let keys = state.neighborsByAddress.get(addressKey)
+        if (!keys) state.neighborsByAddress.set(addressKey, keys = new Set())
+        keys.add(key)
+        return before
+    }
+}
+
+/** Removes an entry, returning it if it was present */
+function remove_(state: CacheState, msg: CacheEntry): CacheEntry | undefined {
+    if (msg.kind === 'link') {
+        const index = msg.data.index!
+        const before = state.links.get(index)
+        if (!before) return
+        state.links.delete(index)
+        if (typeof before.attrs.ifname === 'string' && state.linksByName.get(before.attrs.ifname) === index)
+            state.linksByName.delete(before.attrs.ifname)
+        return before
+    } else if (msg.kind === 'address') {
+        const key = addressKey(msg)
+        const before = state.addresses.get(key)
+        if (!before) return
+        state.addresses.delete(key)
+        const keys = state.addressesByIndex.get(before.data.index!)
+        if (keys && keys.delete(key) && !keys.size)
+            state.addressesByIndex.delete(before.data.index!)
+        return before
+    } else if (msg.kind === 'route') {
+        const key = routeKey(msg)
+        const before = state.routes.get(key)
+        if (!before) return
+        state.routes.delete(key)
+        const trieKey = `${before.data.family}/${routeTable(before)}`
+        const trie = state.routeTries.get(trieKey)
+        if (trie) {
+            trie.delete(before.attrs.dst || new Uint8Array(0), before.data.dstLen || 0, key)
+            if (!trie.size) state.routeTries.delete(trieKey)
+        }
+        return before
+    } else if (msg.kind === 'neighbor') {
+        const key = neighborKey(msg)
+        const before = state.neighbors.get(key)
+        if (!before) return
+        state.neighbors.delete(key)
+        const addressKey = `${before.data.family}/${hex(before.attrs.dst)}`
+        const keys = state.neighborsByAddress.get(addressKey)
+        if (keys && keys.delete(key) && !keys.size)
+            state.neighborsByAddress.delete(addressKey)
+        return before
+    }
+}
+
+/**
+ * Creates an rtnetlink socket and a cache on top of it, and
+ * waits for the initial sync to complete.
+ */
+export async function createRtCache(
+    options?: RtCacheOptions & RtNetlinkSocketOptions & NetlinkSocketOptions & RawNetlinkSocketOptions
+): Promise<RtCache> {
+    const cache = new RtCache(createRtNetlink(options), options)
+    try {
+        await cache.sync()
+    } catch (e) {
+        cache.close()
+        throw e
+    }
+    return cache
+}
@@ -0,0 +1,390 @@
+/**
+ * Columnar (struct-of-arrays) export of rtnetlink dumps. Replies are
+ * decoded straight from the received buffers into typed arrays, one
+ * per selected field, without creating objects for each message.
+ * See {@link RtNetlinkSocket.getRoutesColumnar} and friends.
+ * @module
+ */
+
+import { readU8, readU16, readU32, align } from '../structs'
+
+/**
+ * Variable-length values (i.e. addresses) packed back to back. The
+ * value of row `i` is `data.subarray(offsets[i], offsets[i + 1])`,
+ * which is empty if the attribute wasn't present.
+ */
+export interface PackedBytes {
+    data: Uint8Array
+    offsets: Uint32Array
+}
+
+/**
+ * Dictionary-encoded strings. The value of row `i` is
+ * `dictionary[codes[i]]`, or absent if the code is {@link NO_STRING}.
+ */
+export interface DictionaryStrings {
+    codes: Uint32Array
+    dictionary: string[]
+}
+
+/** Code of absent values in {@link DictionaryStrings} */
+export const NO_STRING = 0xFFFFFFFF
+
+/**
+ * Columns of a dump, as selected by the caller. Numeric fields are
+ * `Uint32Array`s (absent attributes read as 0). The snapshot is plain
+ * data, so it can be posted to a worker as is; pass {@link transferList}
+ * as the transfer list to move the arrays instead of copying them.
+ */
+export interface ColumnarSnapshot<C, F extends keyof C = keyof C> {
+    kind: 'route' | 'link' | 'neighbor' | 'address'
+    /** Number of rows */
+    length: number
+    columns: Pick<C, F>
+}
+
+export interface RouteColumns {
+    family: Uint32Array
+    dstLen: Uint32Array
+    srcLen: Uint32Array
+    tos: Uint32Array
+    /** Table id (from the TABLE attribute if present, otherwise the header) */
+    table: Uint32Array
+    protocol: Uint32Array
+    scope: Uint32Array
+    type: Uint32Array
+    flags: Uint32Array
+    iif: Uint32Array
+    oif: Uint32Array
+    /** PRIORITY attribute */
+    metric: Uint32Array
+    dst: PackedBytes
+    src: PackedBytes
+    gateway: PackedBytes
+    prefsrc: PackedBytes
+}
+
+export interface LinkColumns {
+    family: Uint32Array
+    type: Uint32Array
+    ifindex: Uint32Array
+    flags: Uint32Array
+    mtu: Uint32Array
+    master: Uint32Array
+    txqlen: Uint32Array
+    operstate: Uint32Array
+    group: Uint32Array
+    address: PackedBytes
+    broadcast: PackedBytes
+    ifname: DictionaryStrings
+    ifalias: DictionaryStrings
+}
+
+export interface NeighborColumns {
+    family: Uint32Array
+    ifindex: Uint32Array
+    state: Uint32Array
+    flags: Uint32Array
+    type: Uint32Array
+    probes: Uint32Array
+    vlan: Uint32Array
+    master: Uint32Array
+    dst: PackedBytes
+    lladdr: PackedBytes
+}
+
+export interface AddressColumns {
+    family: Uint32Array
+    prefixlen: Uint32Array
+    /** Flags (from the FLAGS attribute if present, otherwise the header) */
+    flags: Uint32Array
+    scope: Uint32Array
+    ifindex: Uint32Array
+    address: PackedBytes
+    local: PackedBytes
+    broadcast: PackedBytes
+    label: DictionaryStrings
+}
+
+/**
+ * Returns the buffers of a snapshot, to be passed as the transfer list
+ * of `postMessage`. Once transferred, the snapshot can't be used anymore
+ * on the sending side.
+ */
+export function transferList(snapshot: ColumnarSnapshot<any, any>): ArrayBuffer[] {
+    const result: Set<ArrayBuffer> = new Set()
+    for (const column of Object.values(snapshot.columns) as Column[]) {
+        if (column instanceof Uint32Array) {
+            result.add(column.buffer as ArrayBuffer)
+        } else if ('offsets' in column) {
+            result.add(column.data.buffer as ArrayBuffer)
+            result.add(column.offsets.buffer as ArrayBuffer)
+        } else {
+            result.add(column.codes.buffer as ArrayBuffer)
+        }
+    }
+    return [...result]
+}
+
+/** Returns the value of row `i` of a string column */
+export function getColumnString(column: DictionaryStrings, i: number): string | undefined {
+    const code = column.codes[i]
+    return code === NO_STRING ? undefined : column.dictionary[code]
+}
+
+/** Returns the value of row `i` of a bytes column (a view, not a copy) */
+export function getColumnBytes(column: PackedBytes, i: number): Uint8Array {
+    return column.data.subarray(column.offsets[i], column.offsets[i + 1])
+}
+
+
+// Decoding
+
+type Column = Uint32Array | PackedBytes | DictionaryStrings
+
+/**
+ * Where a field comes from: an integer in the header (`offset`, of
+ * `size` bytes), an integer attribute (`attr`, falling back to the
+ * header if both are given), or a bytes / string attribute.
+ */
+type ColumnSpec =
+    { type: 'number', offset?: number, size?: 1 | 2 | 4, attr?: number } |
+    { type: 'bytes', attr: number } |
+    { type: 'string', attr: number }
+
+const header = (offset: number, size: 1 | 2 | 4, attr?: number): ColumnSpec => ({ type: 'number', offset, size, attr })
+/** Numeric header field, for {@link headerMatch} on messages without columns */
+export { header as headerField }
+const number = (attr: number): ColumnSpec => ({ type: 'number', attr })
+const bytes = (attr: number): ColumnSpec => ({ type: 'bytes', attr })
+const string = (attr: number): ColumnSpec => ({ type: 'string', attr })
+
+export type ColumnSpecs<C> = { [K in keyof C]: ColumnSpec }
+
+// Attribute types (see ./gen_structs and ./ifla)
+
+export const ROUTE_COLUMNS: ColumnSpecs<RouteColumns> = {
+    family: header(0, 1), dstLen: header(1, 1), srcLen: header(2, 1), tos: header(3, 1),
+    table: header(4, 1, 15), protocol: header(5, 1), scope: header(6, 1), type: header(7, 1),
+    flags: header(8, 4), iif: number(3), oif: number(4), metric: number(6),
+    dst: bytes(1), src: bytes(2), gateway: bytes(5), prefsrc: bytes(7),
+}
+
+export const LINK_COLUMNS: ColumnSpecs<LinkColumns> = {
+    family: header(0, 1), type: header(2, 2), ifindex: header(4, 4), flags: header(8, 4),
+    mtu: number(4), master: number(10), txqlen: number(13), operstate: number(16), group: number(27),
+    address: bytes(1), broadcast: bytes(2), ifname: string(3), ifalias: string(20),
+}
+
+export const NEIGHBOR_COLUMNS: ColumnSpecs<NeighborColumns> = {
+    family: header(0, 1), ifindex: header(4, 4), state: header(8, 2), flags: header(10, 1), type: header(11, 1),
+    probes: number(4), vlan: number(5), master: number(9), dst: bytes(1), lladdr: bytes(2),
+}
+
+export const ADDRESS_COLUMNS: ColumnSpecs<AddressColumns> = {
+    family: header(0, 1), prefixlen: header(1, 1), flags: header(2, 1, 8), scope: header(3, 1), ifindex: header(4, 4),
+    address: bytes(1), local: bytes(2), broadcast: bytes(4), label: string(3),
+}
+
+const ATTR_TYPE_MASK = (1 << 14) - 1
+/** Attributes with higher types are skipped (none of the columns use them) */
+const MAX_ATTR = 64
+const INITIAL_CAPACITY = 256
+
+function readInt(data: Buffer, start: number, size: number) {
+    return size >= 4 ? readU32.call(data, start) : size >= 2 ? readU16.call(data, start) : size ? readU8.call(data, start) : 0
+}
+
+function grow<T extends Uint8Array | Uint32Array>(array: T, needed: number): T {
+    if (needed <= array.length) return array
+    const result = new (array.constructor as any)(Math.max(needed, array.length * 2)) as T
+    result.set(array)
+    return result
+}
+
+/** FNV-1a, to look up strings in the dictionary without decoding them */
+function hashBytes(data: Buffer, start: number, end: number) {
+    let h = 0x811C9DC5
+    for (let i = start; i < end; i++)
+        h = Math.imul(h ^ data[i], 0x01000193)
+    return h >>> 0
+}
+
+class NumberBuilder {
+    values = new Uint32Array(INITIAL_CAPACITY)
+    push(row: number, value: number) {
+        this.values = grow(this.values, row + 1)
+        this.values[row] = value
+    }
+    finish(length: number): Uint32Array {
+        return this.values.subarray(0, length)
+    }
+}
+
+class BytesBuilder {
+    data = new Uint8Array(INITIAL_CAPACITY * 4)
+    offsets = new Uint32Array(INITIAL_CAPACITY + 1)
+    size = 0
+    push(row: number, source: Buffer, start: number, end: number) {
+        this.data = grow(this.data, this.size + end - start)
+        this.data.set(source.subarray(start, end), this.size)
+        this.size += end - start
+        this.offsets = grow(this.offsets, row + 2)
+        this.offsets[row + 1] = this.size
+    }
+    finish(length: number): PackedBytes {
+        return { data: this.data.subarray(0, this.size), offsets: this.offsets.subarray(0, length + 1) }
+    }
+}
+
+class StringBuilder {
+    codes = new Uint32Array(INITIAL_CAPACITY)
+    dictionary: string[] = []
+    /** Raw bytes of each dictionary entry, to compare against */
+    entries: Buffer[] = []
+    lookup: Map<number, number[]> = new Map()
+    push(row: number, source: Buffer, start: number, end: number) {
+        this.codes = grow(this.codes, row + 1)
+        if (start < 0) {
+            this.codes[row] = NO_STRING
+            return
+        }
+        while (end > start && source[end - 1] === 0) end--
+        const hash = hashBytes(source, start, end)
+        let candidates = this.lookup.get(hash)
+        if (candidates) {
+            for (const code of candidates) {
+                const entry = this.entries[code]
+                if (entry.length === end - start && source.compare(entry, 0, entry.length, start, end) === 0) {
+                    this.codes[row] = code
+                    return
+                }
+            }
+        } else {
+            this.lookup.set(hash, candidates = [])
+        }
+        const code = this.dictionary.length
+        this.entries.push(Buffer.from(source.subarray(start, end)))
+        this.dictionary.push(source.toString('utf8', start, end))
+        candidates.push(code)
+        this.codes[row] = code
+    }
+    finish(length: number): DictionaryStrings {
+        return { codes: this.codes.subarray(0, length), dictionary: this.dictionary }
+    }
+}
+
+/**
+ * Decodes messages of one kind into the selected columns. Each message
+ * is first loaded (which locates its attributes), then it may be
+ * inspected with {@link value} and appended with {@link commit}.
+ */
+export class ColumnarDecoder<C, F extends keyof C> {
+    private length = 0
+    private readonly builders: [ColumnSpec, NumberBuilder | BytesBuilder | StringBuilder][]
+    private data: Buffer = Buffer.alloc(0)
+    // location of each attribute of the loaded message, valid if its generation matches
+    private readonly attrStart = new Int32Array(MAX_ATTR)
+    private readonly attrEnd = new Int32Array(MAX_ATTR)
+    private readonly attrGeneration = new Uint32Array(MAX_ATTR)
+    private generation = 0
+
+    constructor(
+        readonly kind: ColumnarSnapshot<C>['kind'],
+        private readonly headerLength: number,
+        private readonly specs: ColumnSpecs<C>,
+        private readonly fields: F[],
+    ) {
+        this.builders = fields.map(field => {
+            const spec = specs[field]
+            if (!spec)
+                throw Error(`Unknown ${kind} field ${String(field)}`)
+            const builder = spec.type === 'number' ? new NumberBuilder() :
+                spec.type === 'bytes' ? new BytesBuilder() : new StringBuilder()
+            return [spec, builder] as [ColumnSpec, NumberBuilder | BytesBuilder | StringBuilder]
+        })
+    }
+
+    /** Loads the payload of a message, locating its attributes */
+    load(data: Buffer) {
+        if (data.length < this.headerLength)
+            throw Error(`Unexpected length for ${this.kind} message`)
+        this.data = data
+        const generation = this.generation = (this.generation + 1) >>> 0 || 1
+        for (let offset = align(this.headerLength); offset < data.length; ) {
+            if (data.length - offset < 4)
+                throw Error('Not enough data')
+            const length = readU16.call(data, offset)
+            if (length < 4 || offset + length > data.length)
+                throw Error(`Invalid attribute length (${length})`)
+            const type = readU16.call(data, offset + 2) & ATTR_TYPE_MASK
+            if (type < MAX_ATTR) {
+                this.attrStart[type] = offset + 4
+                this.attrEnd[type] = offset + length
+                this.attrGeneration[type] = generation
+            }
+            offset += align(length)
+        }
+    }
+
+    /** Value of a numeric field of the loaded message (selected or not) */
+    value(field: keyof C): number {
+        const spec = this.specs[field]
+        if (spec.type !== 'number')
+            throw Error(`Field ${String(field)} is not a number`)
+        return this.readNumber(spec)
+    }
+
+    /** Appends the loaded message as a new row */
+    commit() {
+        const row = this.length++
+        for (const [spec, builder] of this.builders) {
+            if (builder instanceof NumberBuilder) {
+                builder.push(row, this.readNumber(spec as ColumnSpec & { type: 'number' }))
+                continue
+            }
+            const attr = (spec as { attr: number }).attr
+            const present = this.attrGeneration[attr] === this.generation
+            if (builder instanceof BytesBuilder)
+                present ? builder.push(row, this.data, this.attrStart[attr], this.attrEnd[attr]) : builder.push(row, this.data, 0, 0)
+            else
+                present ? builder.push(row, this.data, this.attrStart[attr], this.attrEnd[attr]) : builder.push(row, this.data, -1, -1)
+        }
+    }
+
+    finish(): ColumnarSnapshot<C, F> {
+        const columns: { [key: string]: Column } = {}
+        this.builders.forEach(([, builder], i) => columns[this.fields[i] as any] = builder.finish(this.length))
+        return { kind: this.kind, length: this.length, columns: columns as any }
+    }
+
+    private readNumber(spec: ColumnSpec & { type: 'number' }) {
+        const { attr, offset, size } = spec
+        if (typeof attr !== 'undefined' && this.attrGeneration[attr] === this.generation)
+            return readInt(this.data, this.attrStart[attr], Math.min(this.attrEnd[attr] - this.attrStart[attr], 4))
+        return typeof offset !== 'undefined' ? readInt(this.data, offset, size!) : 0
+    }
+}
+
+/**
+ * Predicates for the header fields of a dump request that the kernel
+ * can't filter by (it rejects them with EINVAL under strict checking),
+ * so they're cleared from the request and matched locally. `filter`
+ * is the formatted request header; fields set in it must be equal in
+ * the replies, except for `flags`, whose bits must all be set.
+ */
+export function headerMatch<C>(specs: ColumnSpecs<C>, filter: Buffer, fields: (keyof C)[]) {
+    const tests = fields.map(field => {
+        const { offset, size } = specs[field] as { offset: number, size: 1 | 2 | 4 }
+        return { field, offset, size, value: readInt(filter, offset, size), flags: field === 'flags' }
+    }).filter(x => x.value)
+    if (!tests.length) return undefined
+    const test = (x: typeof tests[0], value: number) =>
+        x.flags ? ((value & x.value) >>> 0) === x.value : value === x.value
+    return {
+        /** Matches a formatted reply header */
+        header: (header: Buffer) => tests.every(x => test(x, readInt(header, x.offset, x.size))),
+        /** Matches the message loaded into a decoder */
+        decoder: (decoder: ColumnarDecoder<C, any>) => tests.every(x => test(x, decoder.value(x.field))),
+    }
+}
@@ -562,35 +562,74 @@ export function parseRouteAttrs(r: Buffer): RouteAttrs {
     })
 }
 
+/** Decoders of the attributes of a {@link RouteAttrs} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_RouteAttrs: structs.LazyFields = {
+    1: ['dst', data => data],
+    2: ['src', data => data],
+    3: ['iif', data => structs.getU32(data)],
+    4: ['oif', data => structs.getU32(data)],
+    5: ['gateway', data => data],
+    6: ['priority', data => structs.getU32(data)],
+    7: ['prefsrc', data => data],
+    8: ['metrics', data => parseRouteMetricsLazy(data)],
+    9: ['multipath', data => data],
+    10: ['protoinfo', data => data],
+    11: ['flow', data => structs.getU32(data)],
+    12: ['cacheInfo', data => parseRouteCacheInfo(data)],
+    13: ['session', data => parseRouteSession(data)],
+    14: ['mpAlgo', data => data],
+    15: ['table', data => structs.getU32(data)],
+    16: ['mark', data => data],
+    17: ['mfcStats', data => parseRouteMfcStats(data)],
+    18: ['via', data => parseRouteVia(data)],
+    19: ['newdst', data => data],
+    20: ['pref', data => data],
+    21: ['encapType', data => structs.getU16(data)],
+    22: ['encap', data => data],
+    23: ['expires', data => data],
+    24: ['__pad', data => data],
+    25: ['uid', data => data],
+    26: ['ttlPropagate', data => structs.getU8(data)],
+    27: ['ipProto', data => data],
+    28: ['sport', data => data],
+    29: ['dport', data => data],
+    30: ['nhId', data => data],
+}
+
+/** Like {@link parseRouteAttrs}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseRouteAttrsLazy(r: Buffer): RouteAttrs {
+    return structs.getLazyObject(r, __LAZY_RouteAttrs)
+}
+
 /** Encodes a {@link RouteAttrs} object into a stream of attributes */
 export function formatRouteAttrs(x: RouteAttrs): StreamData {
     return structs.putObject(x, {
         dst: (data, obj) => data.push(1, obj.dst!),
         src: (data, obj) => data.push(2, obj.src!),
-        iif: (data, obj) => data.push(3, structs.putU32(obj.iif!)),
-        oif: (data, obj) => data.push(4, structs.putU32(obj.oif!)),
+        iif: (data, obj) => data.pushU32(3, obj.iif!),
+        oif: (data, obj) => data.pushU32(4, obj.oif!),
         gateway: (data, obj) => data.push(5, obj.gateway!),
-        priority: (data, obj) => data.push(6, structs.putU32(obj.priority!)),
+        priority: (data, obj) => data.pushU32(6, obj.priority!),
         prefsrc: (data, obj) => data.push(7, obj.prefsrc!),
         metrics: (data, obj) => data.push(8, formatRouteMetrics(obj.metrics!)),
         multipath: (data, obj) => data.push(9, obj.multipath!),
         protoinfo: (data, obj) => data.push(10, obj.protoinfo!),
-        flow: (data, obj) => data.push(11, structs.putU32(obj.flow!)),
+        flow: (data, obj) => data.pushU32(11, obj.flow!),
         cacheInfo: (data, obj) => data.push(12, formatRouteCacheInfo(obj.cacheInfo!)),
         session: (data, obj) => data.push(13, formatRouteSession(obj.session!)),
         mpAlgo: (data, obj) => data.push(14, obj.mpAlgo!),
-        table: (data, obj) => data.push(15, structs.putU32(obj.table!)),
+        table: (data, obj) => data.pushU32(15, obj.table!),
         mark: (data, obj) => data.push(16, obj.mark!),
         mfcStats: (data, obj) => data.push(17, formatRouteMfcStats(obj.mfcStats!)),
         via: (data, obj) => data.push(18, formatRouteVia(obj.via!)),
         newdst: (data, obj) => data.push(19, obj.newdst!),
         pref: (data, obj) => data.push(20, obj.pref!),
-        encapType: (data, obj) => data.push(21, structs.putU16(obj.encapType!)),
+        encapType: (data, obj) => data.pushU16(21, obj.encapType!),
         encap: (data, obj) => data.push(22, obj.encap!),
         expires: (data, obj) => data.push(23, obj.expires!),
         __pad: (data, obj) => data.push(24, obj.__pad!),
         uid: (data, obj) => data.push(25, obj.uid!),
-        ttlPropagate: (data, obj) => data.push(26, structs.putU8(obj.ttlPropagate!)),
+        ttlPropagate: (data, obj) => data.pushU8(26, obj.ttlPropagate!),
         ipProto: (data, obj) => data.push(27, obj.ipProto!),
         sport: (data, obj) => data.push(28, obj.sport!),
         dport: (data, obj) => data.push(29, obj.dport!),
@@ -818,6 +857,32 @@ export function parseRouteMetrics(r: Buffer): RouteMetrics {
     })
 }
 
+/** Decoders of the attributes of a {@link RouteMetrics} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_RouteMetrics: structs.LazyFields = {
+    1: ['lock', data => data],
+    2: ['mtu', data => data],
+    3: ['window', data => data],
+    4: ['rtt', data => data],
+    5: ['rttvar', data => data],
+    6: ['ssthresh', data => data],
+    7: ['cwnd', data => data],
+    8: ['advmss', data => data],
+    9: ['reordering', data => data],
+    10: ['hoplimit', data => data],
+    11: ['initcwnd', data => data],
+    12: ['features', data => data],
+    13: ['rtoMin', data => data],
+    14: ['initrwnd', data => data],
+    15: ['quickack', data => data],
+    16: ['ccAlgo', data => data],
+    17: ['fastopenNoCookie', data => data],
+}
+
+/** Like {@link parseRouteMetrics}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseRouteMetricsLazy(r: Buffer): RouteMetrics {
+    return structs.getLazyObject(r, __LAZY_RouteMetrics)
+}
+
 /** Encodes a {@link RouteMetrics} object into a stream of attributes */
 export function formatRouteMetrics(x: RouteMetrics): StreamData {
     return structs.putObject(x, {
@@ -1029,18 +1094,37 @@ export function parseAddressAttrs(r: Buffer): AddressAttrs {
     })
 }
 
+/** Decoders of the attributes of a {@link AddressAttrs} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_AddressAttrs: structs.LazyFields = {
+    1: ['address', data => data],
+    2: ['local', data => data],
+    3: ['label', data => structs.getString(data)],
+    4: ['broadcast', data => data],
+    5: ['anycast', data => data],
+    6: ['cacheInfo', data => parseAddressCacheInfo(data)],
+    7: ['multicast', data => data],
+    8: ['flags', data => parseAddressFlags(structs.getU32(data))],
+    9: ['rtPriority', data => structs.getU32(data)],
+    10: ['targetNetnsid', data => data],
+}
+
+/** Like {@link parseAddressAttrs}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseAddressAttrsLazy(r: Buffer): AddressAttrs {
+    return structs.getLazyObject(r, __LAZY_AddressAttrs)
+}
+
 /** Encodes a {@link AddressAttrs} object into a stream of attributes */
 export function formatAddressAttrs(x: AddressAttrs): StreamData {
     return structs.putObject(x, {
         address: (data, obj) => data.push(1, obj.address!),
         local: (data, obj) => data.push(2, obj.local!),
-        label: (data, obj) => data.push(3, structs.putString(obj.label!)),
+        label: (data, obj) => data.pushString(3, obj.label!),
         broadcast: (data, obj) => data.push(4, obj.broadcast!),
         anycast: (data, obj) => data.push(5, obj.anycast!),
         cacheInfo: (data, obj) => data.push(6, formatAddressCacheInfo(obj.cacheInfo!)),
         multicast: (data, obj) => data.push(7, obj.multicast!),
-        flags: (data, obj) => data.push(8, structs.putU32(formatAddressFlags(obj.flags!))),
-        rtPriority: (data, obj) => data.push(9, structs.putU32(obj.rtPriority!)),
+        flags: (data, obj) => data.pushU32(8, formatAddressFlags(obj.flags!)),
+        rtPriority: (data, obj) => data.pushU32(9, obj.rtPriority!),
         targetNetnsid: (data, obj) => data.push(10, obj.targetNetnsid!),
     })
 }
@@ -1620,6 +1704,17 @@ export function parsePrefixAttrs(r: Buffer): PrefixAttrs {
     })
 }
 
+/** Decoders of the attributes of a {@link PrefixAttrs} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_PrefixAttrs: structs.LazyFields = {
+    1: ['address', data => data],
+    2: ['cacheInfo', data => parsePrefixCacheInfo(data)],
+}
+
+/** Like {@link parsePrefixAttrs}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parsePrefixAttrsLazy(r: Buffer): PrefixAttrs {
+    return structs.getLazyObject(r, __LAZY_PrefixAttrs)
+}
+
 /** Encodes a {@link PrefixAttrs} object into a stream of attributes */
 export function formatPrefixAttrs(x: PrefixAttrs): StreamData {
     return structs.putObject(x, {
@@ -1751,10 +1846,33 @@ export function parseTcAttrs(r: Buffer): TcAttrs {
     })
 }
 
+/** Decoders of the attributes of a {@link TcAttrs} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_TcAttrs: structs.LazyFields = {
+    1: ['kind', data => structs.getString(data)],
+    2: ['options', data => data],
+    3: ['stats', data => data],
+    4: ['xstats', data => data],
+    5: ['rate', data => data],
+    6: ['fcnt', data => data],
+    7: ['stats2', data => data],
+    8: ['stab', data => data],
+    9: ['__pad', data => data],
+    10: ['dumpInvisible', data => data],
+    11: ['chain', data => structs.getU32(data)],
+    12: ['hwOffload', data => data],
+    13: ['ingressBlock', data => data],
+    14: ['egressBlock', data => data],
+}
+
+/** Like {@link parseTcAttrs}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseTcAttrsLazy(r: Buffer): TcAttrs {
+    return structs.getLazyObject(r, __LAZY_TcAttrs)
+}
+
 /** Encodes a {@link TcAttrs} object into a stream of attributes */
 export function formatTcAttrs(x: TcAttrs): StreamData {
     return structs.putObject(x, {
-        kind: (data, obj) => data.push(1, structs.putString(obj.kind!)),
+        kind: (data, obj) => data.pushString(1, obj.kind!),
         options: (data, obj) => data.push(2, obj.options!),
         stats: (data, obj) => data.push(3, obj.stats!),
         xstats: (data, obj) => data.push(4, obj.xstats!),
@@ -1764,7 +1882,7 @@ export function formatTcAttrs(x: TcAttrs): StreamData {
         stab: (data, obj) => data.push(8, obj.stab!),
         __pad: (data, obj) => data.push(9, obj.__pad!),
         dumpInvisible: (data, obj) => data.push(10, obj.dumpInvisible!),
-        chain: (data, obj) => data.push(11, structs.putU32(obj.chain!)),
+        chain: (data, obj) => data.pushU32(11, obj.chain!),
         hwOffload: (data, obj) => data.push(12, obj.hwOffload!),
         ingressBlock: (data, obj) => data.push(13, obj.ingressBlock!),
         egressBlock: (data, obj) => data.push(14, obj.egressBlock!),
@@ -1822,6 +1940,19 @@ export function parseTcActionRoot(r: Buffer): TcActionRoot {
     })
 }
 
+/** Decoders of the attributes of a {@link TcActionRoot} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_TcActionRoot: structs.LazyFields = {
+    1: ['tab', data => data],
+    2: ['flags', data => data],
+    3: ['count', data => data],
+    4: ['timeDelta', data => data],
+}
+
+/** Like {@link parseTcActionRoot}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseTcActionRootLazy(r: Buffer): TcActionRoot {
+    return structs.getLazyObject(r, __LAZY_TcActionRoot)
+}
+
 /** Encodes a {@link TcActionRoot} object into a stream of attributes */
 export function formatTcActionRoot(x: TcActionRoot): StreamData {
     return structs.putObject(x, {
@@ -1920,6 +2051,16 @@ export function parseNdUserOptionAttrs(r: Buffer): NdUserOptionAttrs {
     })
 }
 
+/** Decoders of the attributes of a {@link NdUserOptionAttrs} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_NdUserOptionAttrs: structs.LazyFields = {
+    1: ['srcaddr', data => data],
+}
+
+/** Like {@link parseNdUserOptionAttrs}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseNdUserOptionAttrsLazy(r: Buffer): NdUserOptionAttrs {
+    return structs.getLazyObject(r, __LAZY_NdUserOptionAttrs)
+}
+
 /** Encodes a {@link NdUserOptionAttrs} object into a stream of attributes */
 export function formatNdUserOptionAttrs(x: NdUserOptionAttrs): StreamData {
     return structs.putObject(x, {
@@ -2017,18 +2158,39 @@ export function parseNeighborAttrs(r: Buffer): NeighborAttrs {
     })
 }
 
+/** Decoders of the attributes of a {@link NeighborAttrs} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_NeighborAttrs: structs.LazyFields = {
+    1: ['dst', data => data],
+    2: ['lladdr', data => data],
+    3: ['cacheInfo', data => parseNeighborCacheInfo(data)],
+    4: ['probes', data => structs.getU32(data)],
+    5: ['vlan', data => structs.getU16(data)],
+    6: ['port', data => data],
+    7: ['vni', data => data],
+    8: ['ifindex', data => data],
+    9: ['master', data => structs.getU32(data)],
+    10: ['linkNetnsid', data => data],
+    11: ['srcVni', data => data],
+    12: ['protocol', data => data],
+}
+
+/** Like {@link parseNeighborAttrs}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseNeighborAttrsLazy(r: Buffer): NeighborAttrs {
+    return structs.getLazyObject(r, __LAZY_NeighborAttrs)
+}
+
 /** Encodes a {@link NeighborAttrs} object into a stream of attributes */
 export function formatNeighborAttrs(x: NeighborAttrs): StreamData {
     return structs.putObject(x, {
         dst: (data, obj) => data.push(1, obj.dst!),
         lladdr: (data, obj) => data.push(2, obj.lladdr!),
         cacheInfo: (data, obj) => data.push(3, formatNeighborCacheInfo(obj.cacheInfo!)),
-        probes: (data, obj) => data.push(4, structs.putU32(obj.probes!)),
-        vlan: (data, obj) => data.push(5, structs.putU16(obj.vlan!)),
+        probes: (data, obj) => data.pushU32(4, obj.probes!),
+        vlan: (data, obj) => data.pushU16(5, obj.vlan!),
         port: (data, obj) => data.push(6, obj.port!),
         vni: (data, obj) => data.push(7, obj.vni!),
         ifindex: (data, obj) => data.push(8, obj.ifindex!),
-        master: (data, obj) => data.push(9, structs.putU32(obj.master!)),
+        master: (data, obj) => data.pushU32(9, obj.master!),
         linkNetnsid: (data, obj) => data.push(10, obj.linkNetnsid!),
         srcVni: (data, obj) => data.push(11, obj.srcVni!),
         protocol: (data, obj) => data.push(12, obj.protocol!),
@@ -2270,17 +2432,35 @@ export function parseNeighborTableAttrs(r: Buffer): NeighborTableAttrs {
     })
 }
 
+/** Decoders of the attributes of a {@link NeighborTableAttrs} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_NeighborTableAttrs: structs.LazyFields = {
+    1: ['name', data => structs.getString(data)],
+    2: ['thresh1', data => structs.getU32(data)],
+    3: ['thresh2', data => structs.getU32(data)],
+    4: ['thresh3', data => structs.getU32(data)],
+    5: ['config', data => parseNeighborTableConfig(data)],
+    6: ['parms', data => parseNeighborTableParamsLazy(data)],
+    7: ['stats', data => parseNeighborTableStats(data)],
+    8: ['gcInterval', data => structs.getU64(data)],
+    9: ['__pad', data => data],
+}
+
+/** Like {@link parseNeighborTableAttrs}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseNeighborTableAttrsLazy(r: Buffer): NeighborTableAttrs {
+    return structs.getLazyObject(r, __LAZY_NeighborTableAttrs)
+}
+
 /** Encodes a {@link NeighborTableAttrs} object into a stream of attributes */
 export function formatNeighborTableAttrs(x: NeighborTableAttrs): StreamData {
     return structs.putObject(x, {
-        name: (data, obj) => data.push(1, structs.putString(obj.name!)),
-        thresh1: (data, obj) => data.push(2, structs.putU32(obj.thresh1!)),
-        thresh2: (data, obj) => data.push(3, structs.putU32(obj.thresh2!)),
-        thresh3: (data, obj) => data.push(4, structs.putU32(obj.thresh3!)),
+        name: (data, obj) => data.pushString(1, obj.name!),
+        thresh1: (data, obj) => data.pushU32(2, obj.thresh1!),
+        thresh2: (data, obj) => data.pushU32(3, obj.thresh2!),
+        thresh3: (data, obj) => data.pushU32(4, obj.thresh3!),
         config: (data, obj) => data.push(5, formatNeighborTableConfig(obj.config!)),
         parms: (data, obj) => data.push(6, formatNeighborTableParams(obj.parms!)),
         stats: (data, obj) => data.push(7, formatNeighborTableStats(obj.stats!)),
-        gcInterval: (data, obj) => data.push(8, structs.putU64(obj.gcInterval!)),
+        gcInterval: (data, obj) => data.pushU64(8, obj.gcInterval!),
         __pad: (data, obj) => data.push(9, obj.__pad!),
     })
 }
@@ -2471,26 +2651,53 @@ export function parseNeighborTableParams(r: Buffer): NeighborTableParams {
     })
 }
 
+/** Decoders of the attributes of a {@link NeighborTableParams} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_NeighborTableParams: structs.LazyFields = {
+    1: ['ifindex', data => structs.getU32(data)],
+    2: ['refcnt', data => structs.getU32(data)],
+    3: ['reachableTime', data => structs.getU64(data)],
+    4: ['baseReachableTime', data => structs.getU64(data)],
+    5: ['retransTime', data => structs.getU64(data)],
+    6: ['gcStaletime', data => structs.getU64(data)],
+    7: ['delayProbeTime', data => structs.getU64(data)],
+    8: ['queueLen', data => structs.getU32(data)],
+    9: ['appProbes', data => structs.getU32(data)],
+    10: ['ucastProbes', data => structs.getU32(data)],
+    11: ['mcastProbes', data => structs.getU32(data)],
+    12: ['anycastDelay', data => structs.getU64(data)],
+    13: ['proxyDelay', data => structs.getU64(data)],
+    14: ['proxyQlen', data => structs.getU32(data)],
+    15: ['locktime', data => structs.getU64(data)],
+    16: ['queueLenbytes', data => structs.getU32(data)],
+    17: ['mcastReprobes', data => structs.getU32(data)],
+    18: ['__pad', data => data],
+}
+
+/** Like {@link parseNeighborTableParams}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseNeighborTableParamsLazy(r: Buffer): NeighborTableParams {
+    return structs.getLazyObject(r, __LAZY_NeighborTableParams)
+}
+
 /** Encodes a {@link NeighborTableParams} object into a stream of attributes */
 export function formatNeighborTableParams(x: NeighborTableParams): StreamData {
     return structs.putObject(x, {
-        ifindex: (data, obj) => data.push(1, structs.putU32(obj.ifindex!)),
-        refcnt: (data, obj) => data.push(2, structs.putU32(obj.refcnt!)),
-        reachableTime: (data, obj) => data.push(3, structs.putU64(obj.reachableTime!)),
-        baseReachableTime: (data, obj) => data.push(4, structs.putU64(obj.baseReachableTime!)),
-        retransTime: (data, obj) => data.push(5, structs.putU64(obj.retransTime!)),
-        gcStaletime: (data, obj) => data.push(6, structs.putU64(obj.gcStaletime!)),
-        delayProbeTime: (data, obj) => data.push(7, structs.putU64(obj.delayProbeTime!)),
-        queueLen: (data, obj) => data.push(8, structs.putU32(obj.queueLen!)),
-        appProbes: (data, obj) => data.push(9, structs.putU32(obj.appProbes!)),
-        ucastProbes: (data, obj) => data.push(10, structs.putU32(obj.ucastProbes!)),
-        mcastProbes: (data, obj) => data.push(11, structs.putU32(obj.mcastProbes!)),
-        anycastDelay: (data, obj) => data.push(12, structs.putU64(obj.anycastDelay!)),
-        proxyDelay: (data, obj) => data.push(13, structs.putU64(obj.proxyDelay!)),
-        proxyQlen: (data, obj) => data.push(14, structs.putU32(obj.proxyQlen!)),
-        locktime: (data, obj) => data.push(15, structs.putU64(obj.locktime!)),
-        queueLenbytes: (data, obj) => data.push(16, structs.putU32(obj.queueLenbytes!)),
-        mcastReprobes: (data, obj) => data.push(17, structs.putU32(obj.mcastReprobes!)),
+        ifindex: (data, obj) => data.pushU32(1, obj.ifindex!),
+        refcnt: (data, obj) => data.pushU32(2, obj.refcnt!),
+        reachableTime: (data, obj) => data.pushU64(3, obj.reachableTime!),
+        baseReachableTime: (data, obj) => data.pushU64(4, obj.baseReachableTime!),
+        retransTime: (data, obj) => data.pushU64(5, obj.retransTime!),
+        gcStaletime: (data, obj) => data.pushU64(6, obj.gcStaletime!),
+        delayProbeTime: (data, obj) => data.pushU64(7, obj.delayProbeTime!),
+        queueLen: (data, obj) => data.pushU32(8, obj.queueLen!),
+        appProbes: (data, obj) => data.pushU32(9, obj.appProbes!),
+        ucastProbes: (data, obj) => data.pushU32(10, obj.ucastProbes!),
+        mcastProbes: (data, obj) => data.pushU32(11, obj.mcastProbes!),
+        anycastDelay: (data, obj) => data.pushU64(12, obj.anycastDelay!),
+        proxyDelay: (data, obj) => data.pushU64(13, obj.proxyDelay!),
+        proxyQlen: (data, obj) => data.pushU32(14, obj.proxyQlen!),
+        locktime: (data, obj) => data.pushU64(15, obj.locktime!),
+        queueLenbytes: (data, obj) => data.pushU32(16, obj.queueLenbytes!),
+        mcastReprobes: (data, obj) => data.pushU32(17, obj.mcastReprobes!),
         __pad: (data, obj) => data.push(18, obj.__pad!),
     })
 }
@@ -2642,31 +2849,64 @@ export function parseRuleAttrs(r: Buffer): RuleAttrs {
     })
 }
 
+/** Decoders of the attributes of a {@link RuleAttrs} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_RuleAttrs: structs.LazyFields = {
+    1: ['dst', data => data],
+    2: ['src', data => data],
+    3: ['iifname', data => structs.getString(data)],
+    4: ['goto', data => structs.getU32(data)],
+    5: ['unused2', data => data],
+    6: ['priority', data => structs.getU32(data)],
+    7: ['unused3', data => data],
+    8: ['unused4', data => data],
+    9: ['unused5', data => data],
+    10: ['fwmark', data => structs.getU32(data)],
+    11: ['flow', data => structs.getU32(data)],
+    12: ['tunId', data => data],
+    13: ['suppressIfgroup', data => data],
+    14: ['suppressPrefixlen', data => data],
+    15: ['table', data => structs.getU32(data)],
+    16: ['fwmask', data => structs.getU32(data)],
+    17: ['oifname', data => structs.getString(data)],
+    18: ['__pad', data => data],
+    19: ['l3Mdev', data => structs.getU8(data)],
+    20: ['uidRange', data => parseRuleUidRange(data)],
+    21: ['protocol', data => structs.getU8(data)],
+    22: ['ipProto', data => structs.getU8(data)],
+    23: ['sportRange', data => parseRulePortRange(data)],
+    24: ['dportRange', data => parseRulePortRange(data)],
+}
+
+/** Like {@link parseRuleAttrs}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseRuleAttrsLazy(r: Buffer): RuleAttrs {
+    return structs.getLazyObject(r, __LAZY_RuleAttrs)
+}
+
 /** Encodes a {@link RuleAttrs} object into a stream of attributes */
 export function formatRuleAttrs(x: RuleAttrs): StreamData {
     return structs.putObject(x, {
         dst: (data, obj) => data.push(1, obj.dst!),
         src: (data, obj) => data.push(2, obj.src!),
-        iifname: (data, obj) => data.push(3, structs.putString(obj.iifname!)),
-        goto: (data, obj) => data.push(4, structs.putU32(obj.goto!)),
+        iifname: (data, obj) => data.pushString(3, obj.iifname!),
+        goto: (data, obj) => data.pushU32(4, obj.goto!),
         unused2: (data, obj) => data.push(5, obj.unused2!),
-        priority: (data, obj) => data.push(6, structs.putU32(obj.priority!)),
+        priority: (data, obj) => data.pushU32(6, obj.priority!),
         unused3: (data, obj) => data.push(7, obj.unused3!),
         unused4: (data, obj) => data.push(8, obj.unused4!),
         unused5: (data, obj) => data.push(9, obj.unused5!),
-        fwmark: (data, obj) => data.push(10, structs.putU32(obj.fwmark!)),
-        flow: (data, obj) => data.push(11, structs.putU32(obj.flow!)),
+        fwmark: (data, obj) => data.pushU32(10, obj.fwmark!),
+        flow: (data, obj) => data.pushU32(11, obj.flow!),
         tunId: (data, obj) => data.push(12, obj.tunId!),
         suppressIfgroup: (data, obj) => data.push(13, obj.suppressIfgroup!),
         suppressPrefixlen: (data, obj) => data.push(14, obj.suppressPrefixlen!),
-        table: (data, obj) => data.push(15, structs.putU32(obj.table!)),
-        fwmask: (data, obj) => data.push(16, structs.putU32(obj.fwmask!)),
-        oifname: (data, obj) => data.push(17, structs.putString(obj.oifname!)),
+        table: (data, obj) => data.pushU32(15, obj.table!),
+        fwmask: (data, obj) => data.pushU32(16, obj.fwmask!),
+        oifname: (data, obj) => data.pushString(17, obj.oifname!),
         __pad: (data, obj) => data.push(18, obj.__pad!),
-        l3Mdev: (data, obj) => data.push(19, structs.putU8(obj.l3Mdev!)),
+        l3Mdev: (data, obj) => data.pushU8(19, obj.l3Mdev!),
         uidRange: (data, obj) => data.push(20, formatRuleUidRange(obj.uidRange!)),
-        protocol: (data, obj) => data.push(21, structs.putU8(obj.protocol!)),
-        ipProto: (data, obj) => data.push(22, structs.putU8(obj.ipProto!)),
+        protocol: (data, obj) => data.pushU8(21, obj.protocol!),
+        ipProto: (data, obj) => data.pushU8(22, obj.ipProto!),
         sportRange: (data, obj) => data.push(23, formatRulePortRange(obj.sportRange!)),
         dportRange: (data, obj) => data.push(24, formatRulePortRange(obj.dportRange!)),
     })
@@ -2900,20 +3140,42 @@ export function parseNextHopAttrs(r: Buffer): NextHopAttrs {
     })
 }
 
+/** Decoders of the attributes of a {@link NextHopAttrs} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_NextHopAttrs: structs.LazyFields = {
+    1: ['id', data => structs.getU32(data)],
+    2: ['group', data => data],
+    3: ['groupType', data => structs.getEnum(NextHopGroupType, structs.getU16(data))],
+    4: ['blackhole', data => structs.getFlag(data)],
+    5: ['oif', data => structs.getU32(data)],
+    6: ['gateway', data => data],
+    7: ['encapType', data => structs.getU16(data)],
+    8: ['encap', data => data],
+    9: ['groups', data => structs.getFlag(data)],
+    10: ['master', data => structs.getU32(data)],
+    11: ['fdb', data => structs.getFlag(data)],
+    12: ['resGroup', data => parseNextHopResGroupLazy(data)],
+    13: ['resBucket', data => parseNextHopResBucketLazy(data)],
+}
+
+/** Like {@link parseNextHopAttrs}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseNextHopAttrsLazy(r: Buffer): NextHopAttrs {
+    return structs.getLazyObject(r, __LAZY_NextHopAttrs)
+}
+
 /** Encodes a {@link NextHopAttrs} object into a stream of attributes */
 export function formatNextHopAttrs(x: NextHopAttrs): StreamData {
     return structs.putObject(x, {
-        id: (data, obj) => data.push(1, structs.putU32(obj.id!)),
+        id: (data, obj) => data.pushU32(1, obj.id!),
         group: (data, obj) => data.push(2, obj.group!),
-        groupType: (data, obj) => data.push(3, structs.putU16(structs.putEnum(NextHopGroupType, obj.groupType!))),
-        blackhole: (data, obj) => data.push(4, structs.putFlag(obj.blackhole!)),
-        oif: (data, obj) => data.push(5, structs.putU32(obj.oif!)),
+        groupType: (data, obj) => data.pushU16(3, structs.putEnum(NextHopGroupType, obj.groupType!)),
+        blackhole: (data, obj) => data.pushFlag(4, obj.blackhole!),
+        oif: (data, obj) => data.pushU32(5, obj.oif!),
         gateway: (data, obj) => data.push(6, obj.gateway!),
-        encapType: (data, obj) => data.push(7, structs.putU16(obj.encapType!)),
+        encapType: (data, obj) => data.pushU16(7, obj.encapType!),
         encap: (data, obj) => data.push(8, obj.encap!),
-        groups: (data, obj) => data.push(9, structs.putFlag(obj.groups!)),
-        master: (data, obj) => data.push(10, structs.putU32(obj.master!)),
-        fdb: (data, obj) => data.push(11, structs.putFlag(obj.fdb!)),
+        groups: (data, obj) => data.pushFlag(9, obj.groups!),
+        master: (data, obj) => data.pushU32(10, obj.master!),
+        fdb: (data, obj) => data.pushFlag(11, obj.fdb!),
         resGroup: (data, obj) => data.push(12, formatNextHopResGroup(obj.resGroup!)),
         resBucket: (data, obj) => data.push(13, formatNextHopResBucket(obj.resBucket!)),
     })
@@ -2994,14 +3256,28 @@ export function parseNextHopResGroup(r: Buffer): NextHopResGroup {
     })
 }
 
+/** Decoders of the attributes of a {@link NextHopResGroup} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_NextHopResGroup: structs.LazyFields = {
+    0: ['__pad', data => data],
+    1: ['buckets', data => structs.getU16(data)],
+    2: ['idleTimer', data => structs.getU32(data)],
+    3: ['unbalancedTimer', data => structs.getU32(data)],
+    4: ['unbalancedTime', data => structs.getU64(data)],
+}
+
+/** Like {@link parseNextHopResGroup}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseNextHopResGroupLazy(r: Buffer): NextHopResGroup {
+    return structs.getLazyObject(r, __LAZY_NextHopResGroup)
+}
+
 /** Encodes a {@link NextHopResGroup} object into a stream of attributes */
 export function formatNextHopResGroup(x: NextHopResGroup): StreamData {
     return structs.putObject(x, {
         __pad: (data, obj) => data.push(0, obj.__pad!),
-        buckets: (data, obj) => data.push(1, structs.putU16(obj.buckets!)),
-        idleTimer: (data, obj) => data.push(2, structs.putU32(obj.idleTimer!)),
-        unbalancedTimer: (data, obj) => data.push(3, structs.putU32(obj.unbalancedTimer!)),
-        unbalancedTime: (data, obj) => data.push(4, structs.putU64(obj.unbalancedTime!)),
+        buckets: (data, obj) => data.pushU16(1, obj.buckets!),
+        idleTimer: (data, obj) => data.pushU32(2, obj.idleTimer!),
+        unbalancedTimer: (data, obj) => data.pushU32(3, obj.unbalancedTimer!),
+        unbalancedTime: (data, obj) => data.pushU64(4, obj.unbalancedTime!),
     })
 }
 
@@ -3029,12 +3305,25 @@ export function parseNextHopResBucket(r: Buffer): NextHopResBucket {
     })
 }
 
+/** Decoders of the attributes of a {@link NextHopResBucket} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_NextHopResBucket: structs.LazyFields = {
+    0: ['__pad', data => data],
+    1: ['index', data => structs.getU16(data)],
+    2: ['idleTime', data => structs.getU64(data)],
+    3: ['nexthopId', data => structs.getU32(data)],
+}
+
+/** Like {@link parseNextHopResBucket}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseNextHopResBucketLazy(r: Buffer): NextHopResBucket {
+    return structs.getLazyObject(r, __LAZY_NextHopResBucket)
+}
+
 /** Encodes a {@link NextHopResBucket} object into a stream of attributes */
 export function formatNextHopResBucket(x: NextHopResBucket): StreamData {
     return structs.putObject(x, {
         __pad: (data, obj) => data.push(0, obj.__pad!),
-        index: (data, obj) => data.push(1, structs.putU16(obj.index!)),
-        idleTime: (data, obj) => data.push(2, structs.putU64(obj.idleTime!)),
-        nexthopId: (data, obj) => data.push(3, structs.putU32(obj.nexthopId!)),
+        index: (data, obj) => data.pushU16(1, obj.index!),
+        idleTime: (data, obj) => data.pushU64(2, obj.idleTime!),
+        nexthopId: (data, obj) => data.pushU32(3, obj.nexthopId!),
     })
 }
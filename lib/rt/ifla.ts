@@ -473,62 +473,125 @@ export function parseLinkAttrs(r: Buffer): LinkAttrs {
     })
 }
 
+/** Decoders of the attributes of a {@link LinkAttrs} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_LinkAttrs: structs.LazyFields = {
+    1: ['address', data => data],
+    2: ['broadcast', data => data],
+    3: ['ifname', data => structs.getString(data)],
+    4: ['mtu', data => structs.getU32(data)],
+    5: ['link', data => data],
+    6: ['qdisc', data => structs.getString(data)],
+    7: ['stats', data => parseLinkStats(data)],
+    8: ['cost', data => data],
+    9: ['priority', data => data],
+    10: ['master', data => structs.getU32(data)],
+    11: ['wireless', data => data],
+    12: ['protinfo', data => structs.getMap(data, x => x)],
+    13: ['txqlen', data => structs.getU32(data)],
+    14: ['map', data => data],
+    15: ['weight', data => structs.getU32(data)],
+    16: ['operstate', data => structs.getU8(data)],
+    17: ['linkmode', data => structs.getU8(data)],
+    18: ['linkinfo', data => data],
+    19: ['netNsPid', data => structs.getU32(data)],
+    20: ['ifalias', data => structs.getString(data)],
+    21: ['numVf', data => structs.getU32(data)],
+    22: ['vfinfoList', data => parseVirtualFunctionListLazy(data)],
+    23: ['stats64', data => parseLinkStats64(data)],
+    24: ['vfPorts', data => parsePortListLazy(data)],
+    25: ['portSelf', data => parsePortLazy(data)],
+    26: ['afSpec', data => structs.getMap(data, x => x)],
+    27: ['group', data => structs.getU32(data)],
+    28: ['netNsFd', data => structs.getU32(data)],
+    29: ['extMask', data => data],
+    30: ['promiscuity', data => structs.getU32(data)],
+    31: ['numTxQueues', data => structs.getU32(data)],
+    32: ['numRxQueues', data => structs.getU32(data)],
+    33: ['carrier', data => structs.getU8(data)],
+    34: ['physPortId', data => data],
+    35: ['carrierChanges', data => structs.getU32(data)],
+    36: ['physSwitchId', data => data],
+    37: ['linkNetnsid', data => structs.getS32(data)],
+    38: ['physPortName', data => structs.getString(data)],
+    39: ['protoDown', data => data],
+    40: ['gsoMaxSegs', data => structs.getU32(data)],
+    41: ['gsoMaxSize', data => structs.getU32(data)],
+    42: ['__pad', data => data],
+    43: ['xdp', data => parseXdpLazy(data)],
+    44: ['event', data => data],
+    45: ['newNetnsid', data => data],
+    46: ['targetNetnsid', data => structs.getU32(data)],
+    47: ['carrierUpCount', data => structs.getU32(data)],
+    48: ['carrierDownCount', data => structs.getU32(data)],
+    49: ['newIfindex', data => structs.getU32(data)],
+    50: ['minMtu', data => structs.getU32(data)],
+    51: ['maxMtu', data => structs.getU32(data)],
+    52: ['propList', data => data],
+    53: ['altIfname', data => structs.getString(data)],
+    54: ['permAddress', data => data],
+}
+
+/** Like {@link parseLinkAttrs}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseLinkAttrsLazy(r: Buffer): LinkAttrs {
+    return structs.getLazyObject(r, __LAZY_LinkAttrs)
+}
+
 /** Encodes a {@link LinkAttrs} object into a stream of attributes */
 export function formatLinkAttrs(x: LinkAttrs): StreamData {
     return structs.putObject(x, {
         address: (data, obj) => data.push(1, obj.address!),
         broadcast: (data, obj) => data.push(2, obj.broadcast!),
-        ifname: (data, obj) => data.push(3, structs.putString(obj.ifname!)),
-        mtu: (data, obj) => data.push(4, structs.putU32(obj.mtu!)),
+        ifname: (data, obj) => data.pushString(3, obj.ifname!),
+        mtu: (data, obj) => data.pushU32(4, obj.mtu!),
         link: (data, obj) => data.push(5, obj.link!),
-        qdisc: (data, obj) => data.push(6, structs.putString(obj.qdisc!)),
+        qdisc: (data, obj) => data.pushString(6, obj.qdisc!),
         stats: (data, obj) => data.push(7, formatLinkStats(obj.stats!)),
         cost: (data, obj) => data.push(8, obj.cost!),
         priority: (data, obj) => data.push(9, obj.priority!),
-        master: (data, obj) => data.push(10, structs.putU32(obj.master!)),
+        master: (data, obj) => data.pushU32(10, obj.master!),
         wireless: (data, obj) => data.push(11, obj.wireless!),
         protinfo: (data, obj) => data.push(12, structs.putMap(obj.protinfo!, x => x)),
-        txqlen: (data, obj) => data.push(13, structs.putU32(obj.txqlen!)),
+        txqlen: (data, obj) => data.pushU32(13, obj.txqlen!),
         map: (data, obj) => data.push(14, obj.map!),
-        weight: (data, obj) => data.push(15, structs.putU32(obj.weight!)),
-        operstate: (data, obj) => data.push(16, structs.putU8(obj.operstate!)),
-        linkmode: (data, obj) => data.push(17, structs.putU8(obj.linkmode!)),
+        weight: (data, obj) => data.pushU32(15, obj.weight!),
+        operstate: (data, obj) => data.pushU8(16, obj.operstate!),
+        linkmode: (data, obj) => data.pushU8(17, obj.linkmode!),
         linkinfo: (data, obj) => data.push(18, obj.linkinfo!),
-        netNsPid: (data, obj) => data.push(19, structs.putU32(obj.netNsPid!)),
-        ifalias: (data, obj) => data.push(20, structs.putString(obj.ifalias!)),
-        numVf: (data, obj) => data.push(21, structs.putU32(obj.numVf!)),
+        netNsPid: (data, obj) => data.pushU32(19, obj.netNsPid!),
+        ifalias: (data, obj) => data.pushString(20, obj.ifalias!),
+        numVf: (data, obj) => data.pushU32(21, obj.numVf!),
         vfinfoList: (data, obj) => data.push(22, formatVirtualFunctionList(obj.vfinfoList!)),
         stats64: (data, obj) => data.push(23, formatLinkStats64(obj.stats64!)),
         vfPorts: (data, obj) => data.push(24, formatPortList(obj.vfPorts!)),
         portSelf: (data, obj) => data.push(25, formatPort(obj.portSelf!)),
         afSpec: (data, obj) => data.push(26, structs.putMap(obj.afSpec!, x => x)),
-        group: (data, obj) => data.push(27, structs.putU32(obj.group!)),
-        netNsFd: (data, obj) => data.push(28, structs.putU32(obj.netNsFd!)),
+        group: (data, obj) => data.pushU32(27, obj.group!),
+        netNsFd: (data, obj) => data.pushU32(28, obj.netNsFd!),
         extMask: (data, obj) => data.push(29, obj.extMask!),
-        promiscuity: (data, obj) => data.push(30, structs.putU32(obj.promiscuity!)),
-        numTxQueues: (data, obj) => data.push(31, structs.putU32(obj.numTxQueues!)),
-        numRxQueues: (data, obj) => data.push(32, structs.putU32(obj.numRxQueues!)),
-        carrier: (data, obj) => data.push(33, structs.putU8(obj.carrier!)),
+        promiscuity: (data, obj) => data.pushU32(30, obj.promiscuity!),
+        numTxQueues: (data, obj) => data.pushU32(31, obj.numTxQueues!),
+        numRxQueues: (data, obj) => data.pushU32(32, obj.numRxQueues!),
+        carrier: (data, obj) => data.pushU8(33, obj.carrier!),
         physPortId: (data, obj) => data.push(34, obj.physPortId!),
-        carrierChanges: (data, obj) => data.push(35, structs.putU32(obj.carrierChanges!)),
+        carrierChanges: (data, obj) => data.pushU32(35, obj.carrierChanges!),
         physSwitchId: (data, obj) => data.push(36, obj.physSwitchId!),
-        linkNetnsid: (data, obj) => data.push(37, structs.putS32(obj.linkNetnsid!)),
-        physPortName: (data, obj) => data.push(38, structs.putString(obj.physPortName!)),
+        linkNetnsid: (data, obj) => data.pushS32(37, obj.linkNetnsid!),
+        physPortName: (data, obj) => data.pushString(38, obj.physPortName!),
         protoDown: (data, obj) => data.push(39, obj.protoDown!),
-        gsoMaxSegs: (data, obj) => data.push(40, structs.putU32(obj.gsoMaxSegs!)),
-        gsoMaxSize: (data, obj) => data.push(41, structs.putU32(obj.gsoMaxSize!)),
+        gsoMaxSegs: (data, obj) => data.pushU32(40, obj.gsoMaxSegs!),
+        gsoMaxSize: (data, obj) => data.pushU32(41, obj.gsoMaxSize!),
         __pad: (data, obj) => data.push(42, obj.__pad!),
         xdp: (data, obj) => data.push(43, formatXdp(obj.xdp!)),
         event: (data, obj) => data.push(44, obj.event!),
         newNetnsid: (data, obj) => data.push(45, obj.newNetnsid!),
-        targetNetnsid: (data, obj) => data.push(46, structs.putU32(obj.targetNetnsid!)),
-        carrierUpCount: (data, obj) => data.push(47, structs.putU32(obj.carrierUpCount!)),
-        carrierDownCount: (data, obj) => data.push(48, structs.putU32(obj.carrierDownCount!)),
-        newIfindex: (data, obj) => data.push(49, structs.putU32(obj.newIfindex!)),
-        minMtu: (data, obj) => data.push(50, structs.putU32(obj.minMtu!)),
-        maxMtu: (data, obj) => data.push(51, structs.putU32(obj.maxMtu!)),
+        targetNetnsid: (data, obj) => data.pushU32(46, obj.targetNetnsid!),
+        carrierUpCount: (data, obj) => data.pushU32(47, obj.carrierUpCount!),
+        carrierDownCount: (data, obj) => data.pushU32(48, obj.carrierDownCount!),
+        newIfindex: (data, obj) => data.pushU32(49, obj.newIfindex!),
+        minMtu: (data, obj) => data.pushU32(50, obj.minMtu!),
+        maxMtu: (data, obj) => data.pushU32(51, obj.maxMtu!),
         propList: (data, obj) => data.push(52, obj.propList!),
-        altIfname: (data, obj) => data.push(53, structs.putString(obj.altIfname!)),
+        altIfname: (data, obj) => data.pushString(53, obj.altIfname!),
         permAddress: (data, obj) => data.push(54, obj.permAddress!),
     })
 }
@@ -544,6 +607,16 @@ export function parseLinkProtocolInfoInet(r: Buffer): LinkProtocolInfoInet {
     })
 }
 
+/** Decoders of the attributes of a {@link LinkProtocolInfoInet} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_LinkProtocolInfoInet: structs.LazyFields = {
+    1: ['conf', data => data],
+}
+
+/** Like {@link parseLinkProtocolInfoInet}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseLinkProtocolInfoInetLazy(r: Buffer): LinkProtocolInfoInet {
+    return structs.getLazyObject(r, __LAZY_LinkProtocolInfoInet)
+}
+
 /** Encodes a {@link LinkProtocolInfoInet} object into a stream of attributes */
 export function formatLinkProtocolInfoInet(x: LinkProtocolInfoInet): StreamData {
     return structs.putObject(x, {
@@ -592,17 +665,34 @@ export function parseLinkProtocolInfoInet6(r: Buffer): LinkProtocolInfoInet6 {
     })
 }
 
+/** Decoders of the attributes of a {@link LinkProtocolInfoInet6} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_LinkProtocolInfoInet6: structs.LazyFields = {
+    1: ['flags', data => structs.getU32(data)],
+    2: ['conf', data => data],
+    3: ['stats', data => data],
+    4: ['mcast', data => data],
+    5: ['cacheinfo', data => data],
+    6: ['icmp6stats', data => data],
+    7: ['token', data => data],
+    8: ['addrGenMode', data => structs.getU8(data)],
+}
+
+/** Like {@link parseLinkProtocolInfoInet6}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseLinkProtocolInfoInet6Lazy(r: Buffer): LinkProtocolInfoInet6 {
+    return structs.getLazyObject(r, __LAZY_LinkProtocolInfoInet6)
+}
+
 /** Encodes a {@link LinkProtocolInfoInet6} object into a stream of attributes */
 export function formatLinkProtocolInfoInet6(x: LinkProtocolInfoInet6): StreamData {
     return structs.putObject(x, {
-        flags: (data, obj) => data.push(1, structs.putU32(obj.flags!)),
+        flags: (data, obj) => data.pushU32(1, obj.flags!),
         conf: (data, obj) => data.push(2, obj.conf!),
         stats: (data, obj) => data.push(3, obj.stats!),
         mcast: (data, obj) => data.push(4, obj.mcast!),
         cacheinfo: (data, obj) => data.push(5, obj.cacheinfo!),
         icmp6stats: (data, obj) => data.push(6, obj.icmp6stats!),
         token: (data, obj) => data.push(7, obj.token!),
-        addrGenMode: (data, obj) => data.push(8, structs.putU8(obj.addrGenMode!)),
+        addrGenMode: (data, obj) => data.pushU8(8, obj.addrGenMode!),
     })
 }
 
@@ -763,6 +853,61 @@ export function parseBridge(r: Buffer): Bridge {
     })
 }
 
+/** Decoders of the attributes of a {@link Bridge} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Bridge: structs.LazyFields = {
+    1: ['forwardDelay', data => data],
+    2: ['helloTime', data => data],
+    3: ['maxAge', data => data],
+    4: ['ageingTime', data => data],
+    5: ['stpState', data => data],
+    6: ['priority', data => data],
+    7: ['vlanFiltering', data => data],
+    8: ['vlanProtocol', data => data],
+    9: ['groupFwdMask', data => data],
+    10: ['rootId', data => data],
+    11: ['bridgeId', data => data],
+    12: ['rootPort', data => data],
+    13: ['rootPathCost', data => data],
+    14: ['topologyChange', data => data],
+    15: ['topologyChangeDetected', data => data],
+    16: ['helloTimer', data => data],
+    17: ['tcnTimer', data => data],
+    18: ['topologyChangeTimer', data => data],
+    19: ['gcTimer', data => data],
+    20: ['groupAddr', data => data],
+    21: ['fdbFlush', data => data],
+    22: ['mcastRouter', data => data],
+    23: ['mcastSnooping', data => data],
+    24: ['mcastQueryUseIfaddr', data => data],
+    25: ['mcastQuerier', data => data],
+    26: ['mcastHashElasticity', data => data],
+    27: ['mcastHashMax', data => data],
+    28: ['mcastLastMemberCnt', data => data],
+    29: ['mcastStartupQueryCnt', data => data],
+    30: ['mcastLastMemberIntvl', data => data],
+    31: ['mcastMembershipIntvl', data => data],
+    32: ['mcastQuerierIntvl', data => data],
+    33: ['mcastQueryIntvl', data => data],
+    34: ['mcastQueryResponseIntvl', data => data],
+    35: ['mcastStartupQueryIntvl', data => data],
+    36: ['nfCallIptables', data => data],
+    37: ['nfCallIp6tables', data => data],
+    38: ['nfCallArptables', data => data],
+    39: ['vlanDefaultPvid', data => data],
+    40: ['__pad', data => data],
+    41: ['vlanStatsEnabled', data => data],
+    42: ['mcastStatsEnabled', data => data],
+    43: ['mcastIgmpVersion', data => data],
+    44: ['mcastMldVersion', data => data],
+    45: ['vlanStatsPerPort', data => data],
+    46: ['multiBoolopt', data => data],
+}
+
+/** Like {@link parseBridge}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseBridgeLazy(r: Buffer): Bridge {
+    return structs.getLazyObject(r, __LAZY_Bridge)
+}
+
 /** Encodes a {@link Bridge} object into a stream of attributes */
 export function formatBridge(x: Bridge): StreamData {
     return structs.putObject(x, {
@@ -975,20 +1120,63 @@ export function parseBridgePort(r: Buffer): BridgePort {
     })
 }
 
+/** Decoders of the attributes of a {@link BridgePort} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_BridgePort: structs.LazyFields = {
+    1: ['state', data => structs.getU8(data)],
+    2: ['priority', data => structs.getU16(data)],
+    3: ['cost', data => structs.getU32(data)],
+    4: ['mode', data => structs.getU8(data)],
+    5: ['guard', data => structs.getU8(data)],
+    6: ['protect', data => structs.getU8(data)],
+    7: ['fastLeave', data => structs.getU8(data)],
+    8: ['learning', data => structs.getU8(data)],
+    9: ['unicastFlood', data => structs.getU8(data)],
+    10: ['proxyarp', data => data],
+    11: ['learningSync', data => structs.getU8(data)],
+    12: ['proxyarpWifi', data => data],
+    13: ['rootId', data => data],
+    14: ['bridgeId', data => data],
+    15: ['designatedPort', data => data],
+    16: ['designatedCost', data => data],
+    17: ['id', data => data],
+    18: ['no', data => data],
+    19: ['topologyChangeAck', data => data],
+    20: ['configPending', data => data],
+    21: ['messageAgeTimer', data => data],
+    22: ['forwardDelayTimer', data => data],
+    23: ['holdTimer', data => data],
+    24: ['flush', data => data],
+    25: ['multicastRouter', data => data],
+    26: ['__pad', data => data],
+    27: ['mcastFlood', data => data],
+    28: ['mcastToUcast', data => data],
+    29: ['vlanTunnel', data => data],
+    30: ['bcastFlood', data => data],
+    31: ['groupFwdMask', data => data],
+    32: ['neighSuppress', data => data],
+    33: ['isolated', data => data],
+    34: ['backupPort', data => data],
+}
+
+/** Like {@link parseBridgePort}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseBridgePortLazy(r: Buffer): BridgePort {
+    return structs.getLazyObject(r, __LAZY_BridgePort)
+}
+
 /** Encodes a {@link BridgePort} object into a stream of attributes */
 export function formatBridgePort(x: BridgePort): StreamData {
     return structs.putObject(x, {
-        state: (data, obj) => data.push(1, structs.putU8(obj.state!)),
-        priority: (data, obj) => data.push(2, structs.putU16(obj.priority!)),
-        cost: (data, obj) => data.push(3, structs.putU32(obj.cost!)),
-        mode: (data, obj) => data.push(4, structs.putU8(obj.mode!)),
-        guard: (data, obj) => data.push(5, structs.putU8(obj.guard!)),
-        protect: (data, obj) => data.push(6, structs.putU8(obj.protect!)),
-        fastLeave: (data, obj) => data.push(7, structs.putU8(obj.fastLeave!)),
-        learning: (data, obj) => data.push(8, structs.putU8(obj.learning!)),
-        unicastFlood: (data, obj) => data.push(9, structs.putU8(obj.unicastFlood!)),
+        state: (data, obj) => data.pushU8(1, obj.state!),
+        priority: (data, obj) => data.pushU16(2, obj.priority!),
+        cost: (data, obj) => data.pushU32(3, obj.cost!),
+        mode: (data, obj) => data.pushU8(4, obj.mode!),
+        guard: (data, obj) => data.pushU8(5, obj.guard!),
+        protect: (data, obj) => data.pushU8(6, obj.protect!),
+        fastLeave: (data, obj) => data.pushU8(7, obj.fastLeave!),
+        learning: (data, obj) => data.pushU8(8, obj.learning!),
+        unicastFlood: (data, obj) => data.pushU8(9, obj.unicastFlood!),
         proxyarp: (data, obj) => data.push(10, obj.proxyarp!),
-        learningSync: (data, obj) => data.push(11, structs.putU8(obj.learningSync!)),
+        learningSync: (data, obj) => data.pushU8(11, obj.learningSync!),
         proxyarpWifi: (data, obj) => data.push(12, obj.proxyarpWifi!),
         rootId: (data, obj) => data.push(13, obj.rootId!),
         bridgeId: (data, obj) => data.push(14, obj.bridgeId!),
@@ -1072,13 +1260,27 @@ export function parseInfo(r: Buffer): Info {
     })
 }
 
+/** Decoders of the attributes of a {@link Info} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Info: structs.LazyFields = {
+    1: ['kind', data => structs.getString(data)],
+    2: ['data', data => data],
+    3: ['xstats', data => data],
+    4: ['slaveKind', data => structs.getString(data)],
+    5: ['slaveData', data => data],
+}
+
+/** Like {@link parseInfo}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseInfoLazy(r: Buffer): Info {
+    return structs.getLazyObject(r, __LAZY_Info)
+}
+
 /** Encodes a {@link Info} object into a stream of attributes */
 export function formatInfo(x: Info): StreamData {
     return structs.putObject(x, {
-        kind: (data, obj) => data.push(1, structs.putString(obj.kind!)),
+        kind: (data, obj) => data.pushString(1, obj.kind!),
         data: (data, obj) => data.push(2, obj.data!),
         xstats: (data, obj) => data.push(3, obj.xstats!),
-        slaveKind: (data, obj) => data.push(4, structs.putString(obj.slaveKind!)),
+        slaveKind: (data, obj) => data.pushString(4, obj.slaveKind!),
         slaveData: (data, obj) => data.push(5, obj.slaveData!),
     })
 }
@@ -1107,14 +1309,28 @@ export function parseVlan(r: Buffer): Vlan {
     })
 }
 
+/** Decoders of the attributes of a {@link Vlan} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Vlan: structs.LazyFields = {
+    1: ['id', data => structs.getU16(data)],
+    2: ['flags', data => data],
+    3: ['egressQos', data => data],
+    4: ['ingressQos', data => data],
+    5: ['protocol', data => structs.getU16(data)],
+}
+
+/** Like {@link parseVlan}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseVlanLazy(r: Buffer): Vlan {
+    return structs.getLazyObject(r, __LAZY_Vlan)
+}
+
 /** Encodes a {@link Vlan} object into a stream of attributes */
 export function formatVlan(x: Vlan): StreamData {
     return structs.putObject(x, {
-        id: (data, obj) => data.push(1, structs.putU16(obj.id!)),
+        id: (data, obj) => data.pushU16(1, obj.id!),
         flags: (data, obj) => data.push(2, obj.flags!),
         egressQos: (data, obj) => data.push(3, obj.egressQos!),
         ingressQos: (data, obj) => data.push(4, obj.ingressQos!),
-        protocol: (data, obj) => data.push(5, structs.putU16(obj.protocol!)),
+        protocol: (data, obj) => data.pushU16(5, obj.protocol!),
     })
 }
 
@@ -1154,6 +1370,16 @@ export function parseVlanQos(r: Buffer): VlanQos {
     })
 }
 
+/** Decoders of the attributes of a {@link VlanQos} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_VlanQos: structs.LazyFields = {
+    1: ['mapping', data => data],
+}
+
+/** Like {@link parseVlanQos}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseVlanQosLazy(r: Buffer): VlanQos {
+    return structs.getLazyObject(r, __LAZY_VlanQos)
+}
+
 /** Encodes a {@link VlanQos} object into a stream of attributes */
 export function formatVlanQos(x: VlanQos): StreamData {
     return structs.putObject(x, {
@@ -1213,15 +1439,30 @@ export function parseMacvlan(r: Buffer): Macvlan {
     })
 }
 
+/** Decoders of the attributes of a {@link Macvlan} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Macvlan: structs.LazyFields = {
+    1: ['mode', data => structs.getU32(data)],
+    2: ['flags', data => structs.getU16(data)],
+    3: ['macaddrMode', data => structs.getU32(data)],
+    4: ['macaddr', data => data],
+    5: ['macaddrData', data => data],
+    6: ['macaddrCount', data => structs.getU32(data)],
+}
+
+/** Like {@link parseMacvlan}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseMacvlanLazy(r: Buffer): Macvlan {
+    return structs.getLazyObject(r, __LAZY_Macvlan)
+}
+
 /** Encodes a {@link Macvlan} object into a stream of attributes */
 export function formatMacvlan(x: Macvlan): StreamData {
     return structs.putObject(x, {
-        mode: (data, obj) => data.push(1, structs.putU32(obj.mode!)),
-        flags: (data, obj) => data.push(2, structs.putU16(obj.flags!)),
-        macaddrMode: (data, obj) => data.push(3, structs.putU32(obj.macaddrMode!)),
+        mode: (data, obj) => data.pushU32(1, obj.mode!),
+        flags: (data, obj) => data.pushU16(2, obj.flags!),
+        macaddrMode: (data, obj) => data.pushU32(3, obj.macaddrMode!),
         macaddr: (data, obj) => data.push(4, obj.macaddr!),
         macaddrData: (data, obj) => data.push(5, obj.macaddrData!),
-        macaddrCount: (data, obj) => data.push(6, structs.putU32(obj.macaddrCount!)),
+        macaddrCount: (data, obj) => data.pushU32(6, obj.macaddrCount!),
     })
 }
 
@@ -1289,10 +1530,20 @@ export function parseVrf(r: Buffer): Vrf {
     })
 }
 
+/** Decoders of the attributes of a {@link Vrf} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Vrf: structs.LazyFields = {
+    1: ['table', data => structs.getU32(data)],
+}
+
+/** Like {@link parseVrf}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseVrfLazy(r: Buffer): Vrf {
+    return structs.getLazyObject(r, __LAZY_Vrf)
+}
+
 /** Encodes a {@link Vrf} object into a stream of attributes */
 export function formatVrf(x: Vrf): StreamData {
     return structs.putObject(x, {
-        table: (data, obj) => data.push(1, structs.putU32(obj.table!)),
+        table: (data, obj) => data.pushU32(1, obj.table!),
     })
 }
 
@@ -1307,6 +1558,16 @@ export function parseVrfPort(r: Buffer): VrfPort {
     })
 }
 
+/** Decoders of the attributes of a {@link VrfPort} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_VrfPort: structs.LazyFields = {
+    1: ['table', data => data],
+}
+
+/** Like {@link parseVrfPort}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseVrfPortLazy(r: Buffer): VrfPort {
+    return structs.getLazyObject(r, __LAZY_VrfPort)
+}
+
 /** Encodes a {@link VrfPort} object into a stream of attributes */
 export function formatVrfPort(x: VrfPort): StreamData {
     return structs.putObject(x, {
@@ -1365,22 +1626,45 @@ export function parseMacsec(r: Buffer): Macsec {
     })
 }
 
+/** Decoders of the attributes of a {@link Macsec} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Macsec: structs.LazyFields = {
+    1: ['sci', data => structs.getU64(data)],
+    2: ['port', data => structs.getU16(data)],
+    3: ['icvLen', data => structs.getU8(data)],
+    4: ['cipherSuite', data => structs.getU64(data)],
+    5: ['window', data => structs.getU32(data)],
+    6: ['encodingSa', data => structs.getU8(data)],
+    7: ['encrypt', data => structs.getU8(data)],
+    8: ['protect', data => structs.getU8(data)],
+    9: ['incSci', data => structs.getU8(data)],
+    10: ['es', data => structs.getU8(data)],
+    11: ['scb', data => structs.getU8(data)],
+    12: ['replayProtect', data => structs.getU8(data)],
+    13: ['validation', data => structs.getU8(data)],
+    14: ['__pad', data => data],
+}
+
+/** Like {@link parseMacsec}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseMacsecLazy(r: Buffer): Macsec {
+    return structs.getLazyObject(r, __LAZY_Macsec)
+}
+
 /** Encodes a {@link Macsec} object into a stream of attributes */
 export function formatMacsec(x: Macsec): StreamData {
     return structs.putObject(x, {
-        sci: (data, obj) => data.push(1, structs.putU64(obj.sci!)),
-        port: (data, obj) => data.push(2, structs.putU16(obj.port!)),
-        icvLen: (data, obj) => data.push(3, structs.putU8(obj.icvLen!)),
-        cipherSuite: (data, obj) => data.push(4, structs.putU64(obj.cipherSuite!)),
-        window: (data, obj) => data.push(5, structs.putU32(obj.window!)),
-        encodingSa: (data, obj) => data.push(6, structs.putU8(obj.encodingSa!)),
-        encrypt: (data, obj) => data.push(7, structs.putU8(obj.encrypt!)),
-        protect: (data, obj) => data.push(8, structs.putU8(obj.protect!)),
-        incSci: (data, obj) => data.push(9, structs.putU8(obj.incSci!)),
-        es: (data, obj) => data.push(10, structs.putU8(obj.es!)),
-        scb: (data, obj) => data.push(11, structs.putU8(obj.scb!)),
-        replayProtect: (data, obj) => data.push(12, structs.putU8(obj.replayProtect!)),
-        validation: (data, obj) => data.push(13, structs.putU8(obj.validation!)),
+        sci: (data, obj) => data.pushU64(1, obj.sci!),
+        port: (data, obj) => data.pushU16(2, obj.port!),
+        icvLen: (data, obj) => data.pushU8(3, obj.icvLen!),
+        cipherSuite: (data, obj) => data.pushU64(4, obj.cipherSuite!),
+        window: (data, obj) => data.pushU32(5, obj.window!),
+        encodingSa: (data, obj) => data.pushU8(6, obj.encodingSa!),
+        encrypt: (data, obj) => data.pushU8(7, obj.encrypt!),
+        protect: (data, obj) => data.pushU8(8, obj.protect!),
+        incSci: (data, obj) => data.pushU8(9, obj.incSci!),
+        es: (data, obj) => data.pushU8(10, obj.es!),
+        scb: (data, obj) => data.pushU8(11, obj.scb!),
+        replayProtect: (data, obj) => data.pushU8(12, obj.replayProtect!),
+        validation: (data, obj) => data.pushU8(13, obj.validation!),
         __pad: (data, obj) => data.push(14, obj.__pad!),
     })
 }
@@ -1400,11 +1684,22 @@ export function parseXfrm(r: Buffer): Xfrm {
     })
 }
 
+/** Decoders of the attributes of a {@link Xfrm} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Xfrm: structs.LazyFields = {
+    1: ['link', data => structs.getU32(data)],
+    2: ['ifId', data => structs.getU32(data)],
+}
+
+/** Like {@link parseXfrm}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseXfrmLazy(r: Buffer): Xfrm {
+    return structs.getLazyObject(r, __LAZY_Xfrm)
+}
+
 /** Encodes a {@link Xfrm} object into a stream of attributes */
 export function formatXfrm(x: Xfrm): StreamData {
     return structs.putObject(x, {
-        link: (data, obj) => data.push(1, structs.putU32(obj.link!)),
-        ifId: (data, obj) => data.push(2, structs.putU32(obj.ifId!)),
+        link: (data, obj) => data.pushU32(1, obj.link!),
+        ifId: (data, obj) => data.pushU32(2, obj.ifId!),
     })
 }
 
@@ -1437,10 +1732,21 @@ export function parseIpvlan(r: Buffer): Ipvlan {
     })
 }
 
+/** Decoders of the attributes of a {@link Ipvlan} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Ipvlan: structs.LazyFields = {
+    1: ['mode', data => structs.getU16(data)],
+    2: ['flags', data => data],
+}
+
+/** Like {@link parseIpvlan}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseIpvlanLazy(r: Buffer): Ipvlan {
+    return structs.getLazyObject(r, __LAZY_Ipvlan)
+}
+
 /** Encodes a {@link Ipvlan} object into a stream of attributes */
 export function formatIpvlan(x: Ipvlan): StreamData {
     return structs.putObject(x, {
-        mode: (data, obj) => data.push(1, structs.putU16(obj.mode!)),
+        mode: (data, obj) => data.pushU16(1, obj.mode!),
         flags: (data, obj) => data.push(2, obj.flags!),
     })
 }
@@ -1552,36 +1858,74 @@ export function parseVxlan(r: Buffer): Vxlan {
     })
 }
 
+/** Decoders of the attributes of a {@link Vxlan} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Vxlan: structs.LazyFields = {
+    1: ['id', data => structs.getU32(data)],
+    2: ['group', data => data],
+    3: ['link', data => structs.getU32(data)],
+    4: ['local', data => data],
+    5: ['ttl', data => structs.getU8(data)],
+    6: ['tos', data => structs.getU8(data)],
+    7: ['learning', data => structs.getU8(data)],
+    8: ['ageing', data => structs.getU32(data)],
+    9: ['limit', data => structs.getU32(data)],
+    10: ['portRange', data => data],
+    11: ['proxy', data => structs.getU8(data)],
+    12: ['rsc', data => structs.getU8(data)],
+    13: ['l2miss', data => structs.getU8(data)],
+    14: ['l3miss', data => structs.getU8(data)],
+    15: ['port', data => data],
+    16: ['group6', data => data],
+    17: ['local6', data => data],
+    18: ['udpCsum', data => structs.getU8(data)],
+    19: ['udpZeroCsum6Tx', data => structs.getU8(data)],
+    20: ['udpZeroCsum6Rx', data => structs.getU8(data)],
+    21: ['remcsumTx', data => structs.getU8(data)],
+    22: ['remcsumRx', data => structs.getU8(data)],
+    23: ['gbp', data => structs.getFlag(data)],
+    24: ['remcsumNopartial', data => data],
+    25: ['collectMetadata', data => structs.getU8(data)],
+    26: ['label', data => structs.getU32(data)],
+    27: ['gpe', data => structs.getFlag(data)],
+    28: ['ttlInherit', data => data],
+    29: ['df', data => data],
+}
+
+/** Like {@link parseVxlan}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseVxlanLazy(r: Buffer): Vxlan {
+    return structs.getLazyObject(r, __LAZY_Vxlan)
+}
+
 /** Encodes a {@link Vxlan} object into a stream of attributes */
 export function formatVxlan(x: Vxlan): StreamData {
     return structs.putObject(x, {
-        id: (data, obj) => data.push(1, structs.putU32(obj.id!)),
+        id: (data, obj) => data.pushU32(1, obj.id!),
         group: (data, obj) => data.push(2, obj.group!),
-        link: (data, obj) => data.push(3, structs.putU32(obj.link!)),
+        link: (data, obj) => data.pushU32(3, obj.link!),
         local: (data, obj) => data.push(4, obj.local!),
-        ttl: (data, obj) => data.push(5, structs.putU8(obj.ttl!)),
-        tos: (data, obj) => data.push(6, structs.putU8(obj.tos!)),
-        learning: (data, obj) => data.push(7, structs.putU8(obj.learning!)),
-        ageing: (data, obj) => data.push(8, structs.putU32(obj.ageing!)),
-        limit: (data, obj) => data.push(9, structs.putU32(obj.limit!)),
+        ttl: (data, obj) => data.pushU8(5, obj.ttl!),
+        tos: (data, obj) => data.pushU8(6, obj.tos!),
+        learning: (data, obj) => data.pushU8(7, obj.learning!),
+        ageing: (data, obj) => data.pushU32(8, obj.ageing!),
+        limit: (data, obj) => data.pushU32(9, obj.limit!),
         portRange: (data, obj) => data.push(10, obj.portRange!),
-        proxy: (data, obj) => data.push(11, structs.putU8(obj.proxy!)),
-        rsc: (data, obj) => data.push(12, structs.putU8(obj.rsc!)),
-        l2miss: (data, obj) => data.push(13, structs.putU8(obj.l2miss!)),
-        l3miss: (data, obj) => data.push(14, structs.putU8(obj.l3miss!)),
+        proxy: (data, obj) => data.pushU8(11, obj.proxy!),
+        rsc: (data, obj) => data.pushU8(12, obj.rsc!),
+        l2miss: (data, obj) => data.pushU8(13, obj.l2miss!),
+        l3miss: (data, obj) => data.pushU8(14, obj.l3miss!),
         port: (data, obj) => data.push(15, obj.port!),
         group6: (data, obj) => data.push(16, obj.group6!),
         local6: (data, obj) => data.push(17, obj.local6!),
-        udpCsum: (data, obj) => data.push(18, structs.putU8(obj.udpCsum!)),
-        udpZeroCsum6Tx: (data, obj) => data.push(19, structs.putU8(obj.udpZeroCsum6Tx!)),
-        udpZeroCsum6Rx: (data, obj) => data.push(20, structs.putU8(obj.udpZeroCsum6Rx!)),
-        remcsumTx: (data, obj) => data.push(21, structs.putU8(obj.remcsumTx!)),
-        remcsumRx: (data, obj) => data.push(22, structs.putU8(obj.remcsumRx!)),
-        gbp: (data, obj) => data.push(23, structs.putFlag(obj.gbp!)),
+        udpCsum: (data, obj) => data.pushU8(18, obj.udpCsum!),
+        udpZeroCsum6Tx: (data, obj) => data.pushU8(19, obj.udpZeroCsum6Tx!),
+        udpZeroCsum6Rx: (data, obj) => data.pushU8(20, obj.udpZeroCsum6Rx!),
+        remcsumTx: (data, obj) => data.pushU8(21, obj.remcsumTx!),
+        remcsumRx: (data, obj) => data.pushU8(22, obj.remcsumRx!),
+        gbp: (data, obj) => data.pushFlag(23, obj.gbp!),
         remcsumNopartial: (data, obj) => data.push(24, obj.remcsumNopartial!),
-        collectMetadata: (data, obj) => data.push(25, structs.putU8(obj.collectMetadata!)),
-        label: (data, obj) => data.push(26, structs.putU32(obj.label!)),
-        gpe: (data, obj) => data.push(27, structs.putFlag(obj.gpe!)),
+        collectMetadata: (data, obj) => data.pushU8(25, obj.collectMetadata!),
+        label: (data, obj) => data.pushU32(26, obj.label!),
+        gpe: (data, obj) => data.pushFlag(27, obj.gpe!),
         ttlInherit: (data, obj) => data.push(28, obj.ttlInherit!),
         df: (data, obj) => data.push(29, obj.df!),
     })
@@ -1669,20 +2013,42 @@ export function parseGeneve(r: Buffer): Geneve {
     })
 }
 
+/** Decoders of the attributes of a {@link Geneve} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Geneve: structs.LazyFields = {
+    1: ['id', data => structs.getU32(data)],
+    2: ['remote', data => data],
+    3: ['ttl', data => structs.getU8(data)],
+    4: ['tos', data => structs.getU8(data)],
+    5: ['port', data => data],
+    6: ['collectMetadata', data => data],
+    7: ['remote6', data => data],
+    8: ['udpCsum', data => structs.getU8(data)],
+    9: ['udpZeroCsum6Tx', data => structs.getU8(data)],
+    10: ['udpZeroCsum6Rx', data => structs.getU8(data)],
+    11: ['label', data => structs.getU32(data)],
+    12: ['ttlInherit', data => data],
+    13: ['df', data => data],
+}
+
+/** Like {@link parseGeneve}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseGeneveLazy(r: Buffer): Geneve {
+    return structs.getLazyObject(r, __LAZY_Geneve)
+}
+
 /** Encodes a {@link Geneve} object into a stream of attributes */
 export function formatGeneve(x: Geneve): StreamData {
     return structs.putObject(x, {
-        id: (data, obj) => data.push(1, structs.putU32(obj.id!)),
+        id: (data, obj) => data.pushU32(1, obj.id!),
         remote: (data, obj) => data.push(2, obj.remote!),
-        ttl: (data, obj) => data.push(3, structs.putU8(obj.ttl!)),
-        tos: (data, obj) => data.push(4, structs.putU8(obj.tos!)),
+        ttl: (data, obj) => data.pushU8(3, obj.ttl!),
+        tos: (data, obj) => data.pushU8(4, obj.tos!),
         port: (data, obj) => data.push(5, obj.port!),
         collectMetadata: (data, obj) => data.push(6, obj.collectMetadata!),
         remote6: (data, obj) => data.push(7, obj.remote6!),
-        udpCsum: (data, obj) => data.push(8, structs.putU8(obj.udpCsum!)),
-        udpZeroCsum6Tx: (data, obj) => data.push(9, structs.putU8(obj.udpZeroCsum6Tx!)),
-        udpZeroCsum6Rx: (data, obj) => data.push(10, structs.putU8(obj.udpZeroCsum6Rx!)),
-        label: (data, obj) => data.push(11, structs.putU32(obj.label!)),
+        udpCsum: (data, obj) => data.pushU8(8, obj.udpCsum!),
+        udpZeroCsum6Tx: (data, obj) => data.pushU8(9, obj.udpZeroCsum6Tx!),
+        udpZeroCsum6Rx: (data, obj) => data.pushU8(10, obj.udpZeroCsum6Rx!),
+        label: (data, obj) => data.pushU32(11, obj.label!),
         ttlInherit: (data, obj) => data.push(12, obj.ttlInherit!),
         df: (data, obj) => data.push(13, obj.df!),
     })
@@ -1708,10 +2074,20 @@ export function parsePpp(r: Buffer): Ppp {
     })
 }
 
+/** Decoders of the attributes of a {@link Ppp} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Ppp: structs.LazyFields = {
+    1: ['devFd', data => structs.getS32(data)],
+}
+
+/** Like {@link parsePpp}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parsePppLazy(r: Buffer): Ppp {
+    return structs.getLazyObject(r, __LAZY_Ppp)
+}
+
 /** Encodes a {@link Ppp} object into a stream of attributes */
 export function formatPpp(x: Ppp): StreamData {
     return structs.putObject(x, {
-        devFd: (data, obj) => data.push(1, structs.putS32(obj.devFd!)),
+        devFd: (data, obj) => data.pushS32(1, obj.devFd!),
     })
 }
 
@@ -1742,6 +2118,19 @@ export function parseGtp(r: Buffer): Gtp {
     })
 }
 
+/** Decoders of the attributes of a {@link Gtp} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Gtp: structs.LazyFields = {
+    1: ['fd0', data => data],
+    2: ['fd1', data => data],
+    3: ['pdpHashsize', data => data],
+    4: ['role', data => data],
+}
+
+/** Like {@link parseGtp}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseGtpLazy(r: Buffer): Gtp {
+    return structs.getLazyObject(r, __LAZY_Gtp)
+}
+
 /** Encodes a {@link Gtp} object into a stream of attributes */
 export function formatGtp(x: Gtp): StreamData {
     return structs.putObject(x, {
@@ -1845,6 +2234,43 @@ export function parseBond(r: Buffer): Bond {
     })
 }
 
+/** Decoders of the attributes of a {@link Bond} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Bond: structs.LazyFields = {
+    1: ['mode', data => data],
+    2: ['activeSlave', data => data],
+    3: ['miimon', data => data],
+    4: ['updelay', data => data],
+    5: ['downdelay', data => data],
+    6: ['useCarrier', data => data],
+    7: ['arpInterval', data => data],
+    8: ['arpIpTarget', data => data],
+    9: ['arpValidate', data => data],
+    10: ['arpAllTargets', data => data],
+    11: ['primary', data => data],
+    12: ['primaryReselect', data => data],
+    13: ['failOverMac', data => data],
+    14: ['xmitHashPolicy', data => data],
+    15: ['resendIgmp', data => data],
+    16: ['numPeerNotif', data => data],
+    17: ['allSlavesActive', data => data],
+    18: ['minLinks', data => data],
+    19: ['lpInterval', data => data],
+    20: ['packetsPerSlave', data => data],
+    21: ['adLacpRate', data => data],
+    22: ['adSelect', data => data],
+    23: ['adInfo', data => parseBondAdInfoLazy(data)],
+    24: ['adActorSysPrio', data => data],
+    25: ['adUserPortKey', data => data],
+    26: ['adActorSystem', data => data],
+    27: ['tlbDynamicLb', data => data],
+    28: ['peerNotifDelay', data => data],
+}
+
+/** Like {@link parseBond}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseBondLazy(r: Buffer): Bond {
+    return structs.getLazyObject(r, __LAZY_Bond)
+}
+
 /** Encodes a {@link Bond} object into a stream of attributes */
 export function formatBond(x: Bond): StreamData {
     return structs.putObject(x, {
@@ -1902,6 +2328,20 @@ export function parseBondAdInfo(r: Buffer): BondAdInfo {
     })
 }
 
+/** Decoders of the attributes of a {@link BondAdInfo} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_BondAdInfo: structs.LazyFields = {
+    1: ['aggregator', data => data],
+    2: ['numPorts', data => data],
+    3: ['actorKey', data => data],
+    4: ['partnerKey', data => data],
+    5: ['partnerMac', data => data],
+}
+
+/** Like {@link parseBondAdInfo}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseBondAdInfoLazy(r: Buffer): BondAdInfo {
+    return structs.getLazyObject(r, __LAZY_BondAdInfo)
+}
+
 /** Encodes a {@link BondAdInfo} object into a stream of attributes */
 export function formatBondAdInfo(x: BondAdInfo): StreamData {
     return structs.putObject(x, {
@@ -1945,6 +2385,23 @@ export function parseBondSlave(r: Buffer): BondSlave {
     })
 }
 
+/** Decoders of the attributes of a {@link BondSlave} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_BondSlave: structs.LazyFields = {
+    1: ['state', data => data],
+    2: ['miiStatus', data => data],
+    3: ['linkFailureCount', data => data],
+    4: ['permHwaddr', data => data],
+    5: ['queueId', data => data],
+    6: ['adAggregatorId', data => data],
+    7: ['adActorOperPortState', data => data],
+    8: ['adPartnerOperPortState', data => data],
+}
+
+/** Like {@link parseBondSlave}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseBondSlaveLazy(r: Buffer): BondSlave {
+    return structs.getLazyObject(r, __LAZY_BondSlave)
+}
+
 /** Encodes a {@link BondSlave} object into a stream of attributes */
 export function formatBondSlave(x: BondSlave): StreamData {
     return structs.putObject(x, {
@@ -1970,6 +2427,16 @@ export function parseVirtualFunctionList(r: Buffer): VirtualFunctionList {
     })
 }
 
+/** Decoders of the attributes of a {@link VirtualFunctionList} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_VirtualFunctionList: structs.LazyFields = {
+    1: ['x', data => parseVirtualFunctionLazy(data), true],
+}
+
+/** Like {@link parseVirtualFunctionList}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseVirtualFunctionListLazy(r: Buffer): VirtualFunctionList {
+    return structs.getLazyObject(r, __LAZY_VirtualFunctionList)
+}
+
 /** Encodes a {@link VirtualFunctionList} object into a stream of attributes */
 export function formatVirtualFunctionList(x: VirtualFunctionList): StreamData {
     return structs.putObject(x, {
@@ -2037,6 +2504,28 @@ export function parseVirtualFunction(r: Buffer): VirtualFunction {
     })
 }
 
+/** Decoders of the attributes of a {@link VirtualFunction} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_VirtualFunction: structs.LazyFields = {
+    1: ['mac', data => data],
+    2: ['vlan', data => data],
+    3: ['txRate', data => data],
+    4: ['spoofchk', data => data],
+    5: ['linkState', data => data],
+    6: ['rate', data => data],
+    7: ['rssQueryEn', data => data],
+    8: ['stats', data => parseVirtualFunctionStatsLazy(data)],
+    9: ['trust', data => data],
+    10: ['ibNodeGuid', data => data],
+    11: ['ibPortGuid', data => data],
+    12: ['vlanList', data => data],
+    13: ['broadcast', data => data],
+}
+
+/** Like {@link parseVirtualFunction}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseVirtualFunctionLazy(r: Buffer): VirtualFunction {
+    return structs.getLazyObject(r, __LAZY_VirtualFunction)
+}
+
 /** Encodes a {@link VirtualFunction} object into a stream of attributes */
 export function formatVirtualFunction(x: VirtualFunction): StreamData {
     return structs.putObject(x, {
@@ -2149,6 +2638,16 @@ export function parseVlanList(r: Buffer): VlanList {
     })
 }
 
+/** Decoders of the attributes of a {@link VlanList} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_VlanList: structs.LazyFields = {
+    1: ['x', data => parseVlanLazy(data), true],
+}
+
+/** Like {@link parseVlanList}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseVlanListLazy(r: Buffer): VlanList {
+    return structs.getLazyObject(r, __LAZY_VlanList)
+}
+
 /** Encodes a {@link VlanList} object into a stream of attributes */
 export function formatVlanList(x: VlanList): StreamData {
     return structs.putObject(x, {
@@ -2394,6 +2893,24 @@ export function parseVirtualFunctionStats(r: Buffer): VirtualFunctionStats {
     })
 }
 
+/** Decoders of the attributes of a {@link VirtualFunctionStats} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_VirtualFunctionStats: structs.LazyFields = {
+    0: ['rxPackets', data => data],
+    1: ['txPackets', data => data],
+    2: ['rxBytes', data => data],
+    3: ['txBytes', data => data],
+    4: ['broadcast', data => data],
+    5: ['multicast', data => data],
+    6: ['__pad', data => data],
+    7: ['rxDropped', data => data],
+    8: ['txDropped', data => data],
+}
+
+/** Like {@link parseVirtualFunctionStats}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseVirtualFunctionStatsLazy(r: Buffer): VirtualFunctionStats {
+    return structs.getLazyObject(r, __LAZY_VirtualFunctionStats)
+}
+
 /** Encodes a {@link VirtualFunctionStats} object into a stream of attributes */
 export function formatVirtualFunctionStats(x: VirtualFunctionStats): StreamData {
     return structs.putObject(x, {
@@ -2446,6 +2963,16 @@ export function parsePortList(r: Buffer): PortList {
     })
 }
 
+/** Decoders of the attributes of a {@link PortList} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_PortList: structs.LazyFields = {
+    1: ['x', data => parsePortLazy(data), true],
+}
+
+/** Like {@link parsePortList}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parsePortListLazy(r: Buffer): PortList {
+    return structs.getLazyObject(r, __LAZY_PortList)
+}
+
 /** Encodes a {@link PortList} object into a stream of attributes */
 export function formatPortList(x: PortList): StreamData {
     return structs.putObject(x, {
@@ -2488,6 +3015,22 @@ export function parsePort(r: Buffer): Port {
     })
 }
 
+/** Decoders of the attributes of a {@link Port} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Port: structs.LazyFields = {
+    1: ['vf', data => data],
+    2: ['profile', data => data],
+    3: ['vsiType', data => data],
+    4: ['instanceUuid', data => data],
+    5: ['hostUuid', data => data],
+    6: ['request', data => data],
+    7: ['response', data => data],
+}
+
+/** Like {@link parsePort}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parsePortLazy(r: Buffer): Port {
+    return structs.getLazyObject(r, __LAZY_Port)
+}
+
 /** Encodes a {@link Port} object into a stream of attributes */
 export function formatPort(x: Port): StreamData {
     return structs.putObject(x, {
@@ -2597,6 +3140,18 @@ export function parseIpoib(r: Buffer): Ipoib {
     })
 }
 
+/** Decoders of the attributes of a {@link Ipoib} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Ipoib: structs.LazyFields = {
+    1: ['pkey', data => data],
+    2: ['mode', data => data],
+    3: ['umcast', data => data],
+}
+
+/** Like {@link parseIpoib}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseIpoibLazy(r: Buffer): Ipoib {
+    return structs.getLazyObject(r, __LAZY_Ipoib)
+}
+
 /** Encodes a {@link Ipoib} object into a stream of attributes */
 export function formatIpoib(x: Ipoib): StreamData {
     return structs.putObject(x, {
@@ -2644,6 +3199,21 @@ export function parseHsr(r: Buffer): Hsr {
     })
 }
 
+/** Decoders of the attributes of a {@link Hsr} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Hsr: structs.LazyFields = {
+    1: ['slave1', data => data],
+    2: ['slave2', data => data],
+    3: ['multicastSpec', data => data],
+    4: ['supervisionAddr', data => data],
+    5: ['seqNr', data => data],
+    6: ['version', data => data],
+}
+
+/** Like {@link parseHsr}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseHsrLazy(r: Buffer): Hsr {
+    return structs.getLazyObject(r, __LAZY_Hsr)
+}
+
 /** Encodes a {@link Hsr} object into a stream of attributes */
 export function formatHsr(x: Hsr): StreamData {
     return structs.putObject(x, {
@@ -2717,6 +3287,20 @@ export function parseStats(r: Buffer): Stats {
     })
 }
 
+/** Decoders of the attributes of a {@link Stats} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Stats: structs.LazyFields = {
+    1: ['link64', data => data],
+    2: ['linkXstats', data => parseXstatsLazy(data)],
+    3: ['linkXstatsSlave', data => parseXstatsLazy(data)],
+    4: ['linkOffloadXstats', data => parseOffloadXstatsLazy(data)],
+    5: ['afSpec', data => structs.getMap(data, x => x)],
+}
+
+/** Like {@link parseStats}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseStatsLazy(r: Buffer): Stats {
+    return structs.getLazyObject(r, __LAZY_Stats)
+}
+
 /** Encodes a {@link Stats} object into a stream of attributes */
 export function formatStats(x: Stats): StreamData {
     return structs.putObject(x, {
@@ -2742,6 +3326,17 @@ export function parseXstats(r: Buffer): Xstats {
     })
 }
 
+/** Decoders of the attributes of a {@link Xstats} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Xstats: structs.LazyFields = {
+    1: ['bridge', data => parseBridgeXstatsLazy(data)],
+    2: ['bond', data => data],
+}
+
+/** Like {@link parseXstats}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseXstatsLazy(r: Buffer): Xstats {
+    return structs.getLazyObject(r, __LAZY_Xstats)
+}
+
 /** Encodes a {@link Xstats} object into a stream of attributes */
 export function formatXstats(x: Xstats): StreamData {
     return structs.putObject(x, {
@@ -2763,6 +3358,16 @@ export function parseOffloadXstats(r: Buffer): OffloadXstats {
     })
 }
 
+/** Decoders of the attributes of a {@link OffloadXstats} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_OffloadXstats: structs.LazyFields = {
+    1: ['cpuHit', data => parseLinkStats64(data)],
+}
+
+/** Like {@link parseOffloadXstats}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseOffloadXstatsLazy(r: Buffer): OffloadXstats {
+    return structs.getLazyObject(r, __LAZY_OffloadXstats)
+}
+
 /** Encodes a {@link OffloadXstats} object into a stream of attributes */
 export function formatOffloadXstats(x: OffloadXstats): StreamData {
     return structs.putObject(x, {
@@ -2846,11 +3451,27 @@ export function parseXdp(r: Buffer): Xdp {
     })
 }
 
+/** Decoders of the attributes of a {@link Xdp} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Xdp: structs.LazyFields = {
+    1: ['fd', data => data],
+    2: ['attached', data => structs.getEnum(XdpAttached, structs.getU8(data))],
+    3: ['flags', data => data],
+    4: ['progId', data => data],
+    5: ['drvProgId', data => data],
+    6: ['skbProgId', data => data],
+    7: ['hwProgId', data => data],
+}
+
+/** Like {@link parseXdp}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseXdpLazy(r: Buffer): Xdp {
+    return structs.getLazyObject(r, __LAZY_Xdp)
+}
+
 /** Encodes a {@link Xdp} object into a stream of attributes */
 export function formatXdp(x: Xdp): StreamData {
     return structs.putObject(x, {
         fd: (data, obj) => data.push(1, obj.fd!),
-        attached: (data, obj) => data.push(2, structs.putU8(structs.putEnum(XdpAttached, obj.attached!))),
+        attached: (data, obj) => data.pushU8(2, structs.putEnum(XdpAttached, obj.attached!)),
         flags: (data, obj) => data.push(3, obj.flags!),
         progId: (data, obj) => data.push(4, obj.progId!),
         drvProgId: (data, obj) => data.push(5, obj.drvProgId!),
@@ -2917,6 +3538,24 @@ export function parseTun(r: Buffer): Tun {
     })
 }
 
+/** Decoders of the attributes of a {@link Tun} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Tun: structs.LazyFields = {
+    1: ['owner', data => data],
+    2: ['group', data => data],
+    3: ['type', data => data],
+    4: ['pi', data => data],
+    5: ['vnetHdr', data => data],
+    6: ['persist', data => data],
+    7: ['multiQueue', data => data],
+    8: ['numQueues', data => data],
+    9: ['numDisabledQueues', data => data],
+}
+
+/** Like {@link parseTun}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseTunLazy(r: Buffer): Tun {
+    return structs.getLazyObject(r, __LAZY_Tun)
+}
+
 /** Encodes a {@link Tun} object into a stream of attributes */
 export function formatTun(x: Tun): StreamData {
     return structs.putObject(x, {
@@ -2980,6 +3619,17 @@ export function parseRmnet(r: Buffer): Rmnet {
     })
 }
 
+/** Decoders of the attributes of a {@link Rmnet} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Rmnet: structs.LazyFields = {
+    1: ['muxId', data => data],
+    2: ['flags', data => data],
+}
+
+/** Like {@link parseRmnet}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseRmnetLazy(r: Buffer): Rmnet {
+    return structs.getLazyObject(r, __LAZY_Rmnet)
+}
+
 /** Encodes a {@link Rmnet} object into a stream of attributes */
 export function formatRmnet(x: Rmnet): StreamData {
     return structs.putObject(x, {
@@ -3024,6 +3674,16 @@ export function parseVethInfo(r: Buffer): VethInfo {
     })
 }
 
+/** Decoders of the attributes of a {@link VethInfo} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_VethInfo: structs.LazyFields = {
+    1: ['peer', data => data],
+}
+
+/** Like {@link parseVethInfo}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseVethInfoLazy(r: Buffer): VethInfo {
+    return structs.getLazyObject(r, __LAZY_VethInfo)
+}
+
 /** Encodes a {@link VethInfo} object into a stream of attributes */
 export function formatVethInfo(x: VethInfo): StreamData {
     return structs.putObject(x, {
@@ -3153,11 +3813,24 @@ export function parseBridgeSpec(r: Buffer): BridgeSpec {
     })
 }
 
+/** Decoders of the attributes of a {@link BridgeSpec} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_BridgeSpec: structs.LazyFields = {
+    0: ['flags', data => structs.getU16(data)],
+    1: ['mode', data => structs.getU16(data)],
+    2: ['vlanInfo', data => data],
+    3: ['vlanTunnelInfo', data => data],
+}
+
+/** Like {@link parseBridgeSpec}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseBridgeSpecLazy(r: Buffer): BridgeSpec {
+    return structs.getLazyObject(r, __LAZY_BridgeSpec)
+}
+
 /** Encodes a {@link BridgeSpec} object into a stream of attributes */
 export function formatBridgeSpec(x: BridgeSpec): StreamData {
     return structs.putObject(x, {
-        flags: (data, obj) => data.push(0, structs.putU16(obj.flags!)),
-        mode: (data, obj) => data.push(1, structs.putU16(obj.mode!)),
+        flags: (data, obj) => data.pushU16(0, obj.flags!),
+        mode: (data, obj) => data.pushU16(1, obj.mode!),
         vlanInfo: (data, obj) => data.push(2, obj.vlanInfo!),
         vlanTunnelInfo: (data, obj) => data.push(3, obj.vlanTunnelInfo!),
     })
@@ -3257,6 +3930,18 @@ export function parseBridgeVlanTunnel(r: Buffer): BridgeVlanTunnel {
     })
 }
 
+/** Decoders of the attributes of a {@link BridgeVlanTunnel} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_BridgeVlanTunnel: structs.LazyFields = {
+    1: ['id', data => data],
+    2: ['vid', data => data],
+    3: ['flags', data => data],
+}
+
+/** Like {@link parseBridgeVlanTunnel}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseBridgeVlanTunnelLazy(r: Buffer): BridgeVlanTunnel {
+    return structs.getLazyObject(r, __LAZY_BridgeVlanTunnel)
+}
+
 /** Encodes a {@link BridgeVlanTunnel} object into a stream of attributes */
 export function formatBridgeVlanTunnel(x: BridgeVlanTunnel): StreamData {
     return structs.putObject(x, {
@@ -3397,6 +4082,16 @@ export function parseBridgeVlanDb(r: Buffer): BridgeVlanDb {
     })
 }
 
+/** Decoders of the attributes of a {@link BridgeVlanDb} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_BridgeVlanDb: structs.LazyFields = {
+    1: ['entry', data => parseBridgeVlanDbEntryLazy(data)],
+}
+
+/** Like {@link parseBridgeVlanDb}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseBridgeVlanDbLazy(r: Buffer): BridgeVlanDb {
+    return structs.getLazyObject(r, __LAZY_BridgeVlanDb)
+}
+
 /** Encodes a {@link BridgeVlanDb} object into a stream of attributes */
 export function formatBridgeVlanDb(x: BridgeVlanDb): StreamData {
     return structs.putObject(x, {
@@ -3421,6 +4116,18 @@ export function parseBridgeVlanDbEntry(r: Buffer): BridgeVlanDbEntry {
     })
 }
 
+/** Decoders of the attributes of a {@link BridgeVlanDbEntry} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_BridgeVlanDbEntry: structs.LazyFields = {
+    1: ['info', data => data],
+    2: ['range', data => data],
+    3: ['state', data => data],
+}
+
+/** Like {@link parseBridgeVlanDbEntry}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseBridgeVlanDbEntryLazy(r: Buffer): BridgeVlanDbEntry {
+    return structs.getLazyObject(r, __LAZY_BridgeVlanDbEntry)
+}
+
 /** Encodes a {@link BridgeVlanDbEntry} object into a stream of attributes */
 export function formatBridgeVlanDbEntry(x: BridgeVlanDbEntry): StreamData {
     return structs.putObject(x, {
@@ -3444,6 +4151,17 @@ export function parseMdba(r: Buffer): Mdba {
     })
 }
 
+/** Decoders of the attributes of a {@link Mdba} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Mdba: structs.LazyFields = {
+    1: ['mdb', data => parseMdbaMdbLazy(data)],
+    2: ['router', data => parseMdbaRouterLazy(data)],
+}
+
+/** Like {@link parseMdba}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseMdbaLazy(r: Buffer): Mdba {
+    return structs.getLazyObject(r, __LAZY_Mdba)
+}
+
 /** Encodes a {@link Mdba} object into a stream of attributes */
 export function formatMdba(x: Mdba): StreamData {
     return structs.putObject(x, {
@@ -3463,6 +4181,16 @@ export function parseMdbaMdb(r: Buffer): MdbaMdb {
     })
 }
 
+/** Decoders of the attributes of a {@link MdbaMdb} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_MdbaMdb: structs.LazyFields = {
+    1: ['entry', data => parseMdbaMdbEntryLazy(data)],
+}
+
+/** Like {@link parseMdbaMdb}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseMdbaMdbLazy(r: Buffer): MdbaMdb {
+    return structs.getLazyObject(r, __LAZY_MdbaMdb)
+}
+
 /** Encodes a {@link MdbaMdb} object into a stream of attributes */
 export function formatMdbaMdb(x: MdbaMdb): StreamData {
     return structs.putObject(x, {
@@ -3481,6 +4209,16 @@ export function parseMdbaMdbEntry(r: Buffer): MdbaMdbEntry {
     })
 }
 
+/** Decoders of the attributes of a {@link MdbaMdbEntry} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_MdbaMdbEntry: structs.LazyFields = {
+    1: ['info', data => data],
+}
+
+/** Like {@link parseMdbaMdbEntry}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseMdbaMdbEntryLazy(r: Buffer): MdbaMdbEntry {
+    return structs.getLazyObject(r, __LAZY_MdbaMdbEntry)
+}
+
 /** Encodes a {@link MdbaMdbEntry} object into a stream of attributes */
 export function formatMdbaMdbEntry(x: MdbaMdbEntry): StreamData {
     return structs.putObject(x, {
@@ -3500,6 +4238,16 @@ export function parseMdbaMdbEattr(r: Buffer): MdbaMdbEattr {
     })
 }
 
+/** Decoders of the attributes of a {@link MdbaMdbEattr} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_MdbaMdbEattr: structs.LazyFields = {
+    1: ['timer', data => data],
+}
+
+/** Like {@link parseMdbaMdbEattr}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseMdbaMdbEattrLazy(r: Buffer): MdbaMdbEattr {
+    return structs.getLazyObject(r, __LAZY_MdbaMdbEattr)
+}
+
 /** Encodes a {@link MdbaMdbEattr} object into a stream of attributes */
 export function formatMdbaMdbEattr(x: MdbaMdbEattr): StreamData {
     return structs.putObject(x, {
@@ -3529,6 +4277,16 @@ export function parseMdbaRouter(r: Buffer): MdbaRouter {
     })
 }
 
+/** Decoders of the attributes of a {@link MdbaRouter} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_MdbaRouter: structs.LazyFields = {
+    1: ['port', data => data],
+}
+
+/** Like {@link parseMdbaRouter}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseMdbaRouterLazy(r: Buffer): MdbaRouter {
+    return structs.getLazyObject(r, __LAZY_MdbaRouter)
+}
+
 /** Encodes a {@link MdbaRouter} object into a stream of attributes */
 export function formatMdbaRouter(x: MdbaRouter): StreamData {
     return structs.putObject(x, {
@@ -3551,6 +4309,17 @@ export function parseMdbaRouterPattr(r: Buffer): MdbaRouterPattr {
     })
 }
 
+/** Decoders of the attributes of a {@link MdbaRouterPattr} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_MdbaRouterPattr: structs.LazyFields = {
+    1: ['timer', data => data],
+    2: ['type', data => data],
+}
+
+/** Like {@link parseMdbaRouterPattr}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseMdbaRouterPattrLazy(r: Buffer): MdbaRouterPattr {
+    return structs.getLazyObject(r, __LAZY_MdbaRouterPattr)
+}
+
 /** Encodes a {@link MdbaRouterPattr} object into a stream of attributes */
 export function formatMdbaRouterPattr(x: MdbaRouterPattr): StreamData {
     return structs.putObject(x, {
@@ -3693,6 +4462,16 @@ export function parseMdbaSetEntry(r: Buffer): MdbaSetEntry {
     })
 }
 
+/** Decoders of the attributes of a {@link MdbaSetEntry} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_MdbaSetEntry: structs.LazyFields = {
+    1: ['x', data => parseMdbaSetEntryLazy(data), true],
+}
+
+/** Like {@link parseMdbaSetEntry}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseMdbaSetEntryLazy(r: Buffer): MdbaSetEntry {
+    return structs.getLazyObject(r, __LAZY_MdbaSetEntry)
+}
+
 /** Encodes a {@link MdbaSetEntry} object into a stream of attributes */
 export function formatMdbaSetEntry(x: MdbaSetEntry): StreamData {
     return structs.putObject(x, {
@@ -3721,6 +4500,19 @@ export function parseBridgeXstats(r: Buffer): BridgeXstats {
     })
 }
 
+/** Decoders of the attributes of a {@link BridgeXstats} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_BridgeXstats: structs.LazyFields = {
+    1: ['vlan', data => data],
+    2: ['mcast', data => data],
+    3: ['__pad', data => data],
+    4: ['stp', data => data],
+}
+
+/** Like {@link parseBridgeXstats}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseBridgeXstatsLazy(r: Buffer): BridgeXstats {
+    return structs.getLazyObject(r, __LAZY_BridgeXstats)
+}
+
 /** Encodes a {@link BridgeXstats} object into a stream of attributes */
 export function formatBridgeXstats(x: BridgeXstats): StreamData {
     return structs.putObject(x, {
@@ -3945,23 +4737,52 @@ export function parseIptun(r: Buffer): Iptun {
     })
 }
 
+/** Decoders of the attributes of a {@link Iptun} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Iptun: structs.LazyFields = {
+    1: ['link', data => structs.getU32(data)],
+    2: ['local', data => structs.getU32(data)],
+    3: ['remote', data => structs.getU32(data)],
+    4: ['ttl', data => structs.getU8(data)],
+    5: ['tos', data => structs.getU8(data)],
+    6: ['encapLimit', data => structs.getU8(data)],
+    7: ['flowinfo', data => structs.getU32(data)],
+    8: ['flags', data => data],
+    9: ['proto', data => structs.getU8(data)],
+    10: ['pmtudisc', data => structs.getU8(data)],
+    11: ['_6rdPrefix', data => data],
+    12: ['_6rdRelayPrefix', data => structs.getU32(data)],
+    13: ['_6rdPrefixlen', data => structs.getU16(data)],
+    14: ['_6rdRelayPrefixlen', data => structs.getU16(data)],
+    15: ['encapType', data => data],
+    16: ['encapFlags', data => data],
+    17: ['encapSport', data => data],
+    18: ['encapDport', data => data],
+    19: ['collectMetadata', data => data],
+    20: ['fwmark', data => data],
+}
+
+/** Like {@link parseIptun}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseIptunLazy(r: Buffer): Iptun {
+    return structs.getLazyObject(r, __LAZY_Iptun)
+}
+
 /** Encodes a {@link Iptun} object into a stream of attributes */
 export function formatIptun(x: Iptun): StreamData {
     return structs.putObject(x, {
-        link: (data, obj) => data.push(1, structs.putU32(obj.link!)),
-        local: (data, obj) => data.push(2, structs.putU32(obj.local!)),
-        remote: (data, obj) => data.push(3, structs.putU32(obj.remote!)),
-        ttl: (data, obj) => data.push(4, structs.putU8(obj.ttl!)),
-        tos: (data, obj) => data.push(5, structs.putU8(obj.tos!)),
-        encapLimit: (data, obj) => data.push(6, structs.putU8(obj.encapLimit!)),
-        flowinfo: (data, obj) => data.push(7, structs.putU32(obj.flowinfo!)),
+        link: (data, obj) => data.pushU32(1, obj.link!),
+        local: (data, obj) => data.pushU32(2, obj.local!),
+        remote: (data, obj) => data.pushU32(3, obj.remote!),
+        ttl: (data, obj) => data.pushU8(4, obj.ttl!),
+        tos: (data, obj) => data.pushU8(5, obj.tos!),
+        encapLimit: (data, obj) => data.pushU8(6, obj.encapLimit!),
+        flowinfo: (data, obj) => data.pushU32(7, obj.flowinfo!),
         flags: (data, obj) => data.push(8, obj.flags!),
-        proto: (data, obj) => data.push(9, structs.putU8(obj.proto!)),
-        pmtudisc: (data, obj) => data.push(10, structs.putU8(obj.pmtudisc!)),
+        proto: (data, obj) => data.pushU8(9, obj.proto!),
+        pmtudisc: (data, obj) => data.pushU8(10, obj.pmtudisc!),
         _6rdPrefix: (data, obj) => data.push(11, obj._6rdPrefix!),
-        _6rdRelayPrefix: (data, obj) => data.push(12, structs.putU32(obj._6rdRelayPrefix!)),
-        _6rdPrefixlen: (data, obj) => data.push(13, structs.putU16(obj._6rdPrefixlen!)),
-        _6rdRelayPrefixlen: (data, obj) => data.push(14, structs.putU16(obj._6rdRelayPrefixlen!)),
+        _6rdRelayPrefix: (data, obj) => data.pushU32(12, obj._6rdRelayPrefix!),
+        _6rdPrefixlen: (data, obj) => data.pushU16(13, obj._6rdPrefixlen!),
+        _6rdRelayPrefixlen: (data, obj) => data.pushU16(14, obj._6rdRelayPrefixlen!),
         encapType: (data, obj) => data.push(15, obj.encapType!),
         encapFlags: (data, obj) => data.push(16, obj.encapFlags!),
         encapSport: (data, obj) => data.push(17, obj.encapSport!),
@@ -4163,19 +4984,52 @@ export function parseGre(r: Buffer): Gre {
     })
 }
 
+/** Decoders of the attributes of a {@link Gre} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Gre: structs.LazyFields = {
+    1: ['link', data => structs.getU32(data)],
+    2: ['iflags', data => structs.getU16(data)],
+    3: ['oflags', data => structs.getU16(data)],
+    4: ['ikey', data => structs.getU32(data)],
+    5: ['okey', data => structs.getU32(data)],
+    6: ['local', data => structs.getU32(data)],
+    7: ['remote', data => structs.getU32(data)],
+    8: ['ttl', data => structs.getU8(data)],
+    9: ['tos', data => structs.getU8(data)],
+    10: ['pmtudisc', data => structs.getU8(data)],
+    11: ['encapLimit', data => data],
+    12: ['flowinfo', data => data],
+    13: ['flags', data => data],
+    14: ['encapType', data => data],
+    15: ['encapFlags', data => data],
+    16: ['encapSport', data => data],
+    17: ['encapDport', data => data],
+    18: ['collectMetadata', data => data],
+    19: ['ignoreDf', data => data],
+    20: ['fwmark', data => data],
+    21: ['erspanIndex', data => data],
+    22: ['erspanVer', data => data],
+    23: ['erspanDir', data => data],
+    24: ['erspanHwid', data => data],
+}
+
+/** Like {@link parseGre}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseGreLazy(r: Buffer): Gre {
+    return structs.getLazyObject(r, __LAZY_Gre)
+}
+
 /** Encodes a {@link Gre} object into a stream of attributes */
 export function formatGre(x: Gre): StreamData {
     return structs.putObject(x, {
-        link: (data, obj) => data.push(1, structs.putU32(obj.link!)),
-        iflags: (data, obj) => data.push(2, structs.putU16(obj.iflags!)),
-        oflags: (data, obj) => data.push(3, structs.putU16(obj.oflags!)),
-        ikey: (data, obj) => data.push(4, structs.putU32(obj.ikey!)),
-        okey: (data, obj) => data.push(5, structs.putU32(obj.okey!)),
-        local: (data, obj) => data.push(6, structs.putU32(obj.local!)),
-        remote: (data, obj) => data.push(7, structs.putU32(obj.remote!)),
-        ttl: (data, obj) => data.push(8, structs.putU8(obj.ttl!)),
-        tos: (data, obj) => data.push(9, structs.putU8(obj.tos!)),
-        pmtudisc: (data, obj) => data.push(10, structs.putU8(obj.pmtudisc!)),
+        link: (data, obj) => data.pushU32(1, obj.link!),
+        iflags: (data, obj) => data.pushU16(2, obj.iflags!),
+        oflags: (data, obj) => data.pushU16(3, obj.oflags!),
+        ikey: (data, obj) => data.pushU32(4, obj.ikey!),
+        okey: (data, obj) => data.pushU32(5, obj.okey!),
+        local: (data, obj) => data.pushU32(6, obj.local!),
+        remote: (data, obj) => data.pushU32(7, obj.remote!),
+        ttl: (data, obj) => data.pushU8(8, obj.ttl!),
+        tos: (data, obj) => data.pushU8(9, obj.tos!),
+        pmtudisc: (data, obj) => data.pushU8(10, obj.pmtudisc!),
         encapLimit: (data, obj) => data.push(11, obj.encapLimit!),
         flowinfo: (data, obj) => data.push(12, obj.flowinfo!),
         flags: (data, obj) => data.push(13, obj.flags!),
@@ -4219,14 +5073,29 @@ export function parseVti(r: Buffer): Vti {
     })
 }
 
+/** Decoders of the attributes of a {@link Vti} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Vti: structs.LazyFields = {
+    1: ['link', data => structs.getU32(data)],
+    2: ['ikey', data => structs.getU32(data)],
+    3: ['okey', data => structs.getU32(data)],
+    4: ['local', data => structs.getU32(data)],
+    5: ['remote', data => structs.getU32(data)],
+    6: ['fwmark', data => data],
+}
+
+/** Like {@link parseVti}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseVtiLazy(r: Buffer): Vti {
+    return structs.getLazyObject(r, __LAZY_Vti)
+}
+
 /** Encodes a {@link Vti} object into a stream of attributes */
 export function formatVti(x: Vti): StreamData {
     return structs.putObject(x, {
-        link: (data, obj) => data.push(1, structs.putU32(obj.link!)),
-        ikey: (data, obj) => data.push(2, structs.putU32(obj.ikey!)),
-        okey: (data, obj) => data.push(3, structs.putU32(obj.okey!)),
-        local: (data, obj) => data.push(4, structs.putU32(obj.local!)),
-        remote: (data, obj) => data.push(5, structs.putU32(obj.remote!)),
+        link: (data, obj) => data.pushU32(1, obj.link!),
+        ikey: (data, obj) => data.pushU32(2, obj.ikey!),
+        okey: (data, obj) => data.pushU32(3, obj.okey!),
+        local: (data, obj) => data.pushU32(4, obj.local!),
+        remote: (data, obj) => data.pushU32(5, obj.remote!),
         fwmark: (data, obj) => data.push(6, obj.fwmark!),
     })
 }
@@ -4693,16 +5562,40 @@ export function parseCan(r: Buffer): Can {
     })
 }
 
+/** Decoders of the attributes of a {@link Can} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Can: structs.LazyFields = {
+    1: ['bittiming', data => data],
+    2: ['bittimingConst', data => data],
+    3: ['clock', data => data],
+    4: ['state', data => structs.getU32(data)],
+    5: ['ctrlmode', data => data],
+    6: ['restartMs', data => structs.getU32(data)],
+    7: ['restart', data => structs.getU32(data)],
+    8: ['berrCounter', data => data],
+    9: ['dataBittiming', data => data],
+    10: ['dataBittimingConst', data => data],
+    11: ['termination', data => data],
+    12: ['terminationConst', data => data],
+    13: ['bitrateConst', data => data],
+    14: ['dataBitrateConst', data => data],
+    15: ['bitrateMax', data => data],
+}
+
+/** Like {@link parseCan}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseCanLazy(r: Buffer): Can {
+    return structs.getLazyObject(r, __LAZY_Can)
+}
+
 /** Encodes a {@link Can} object into a stream of attributes */
 export function formatCan(x: Can): StreamData {
     return structs.putObject(x, {
         bittiming: (data, obj) => data.push(1, obj.bittiming!),
         bittimingConst: (data, obj) => data.push(2, obj.bittimingConst!),
         clock: (data, obj) => data.push(3, obj.clock!),
-        state: (data, obj) => data.push(4, structs.putU32(obj.state!)),
+        state: (data, obj) => data.pushU32(4, obj.state!),
         ctrlmode: (data, obj) => data.push(5, obj.ctrlmode!),
-        restartMs: (data, obj) => data.push(6, structs.putU32(obj.restartMs!)),
-        restart: (data, obj) => data.push(7, structs.putU32(obj.restart!)),
+        restartMs: (data, obj) => data.pushU32(6, obj.restartMs!),
+        restart: (data, obj) => data.pushU32(7, obj.restart!),
         berrCounter: (data, obj) => data.push(8, obj.berrCounter!),
         dataBittiming: (data, obj) => data.push(9, obj.dataBittiming!),
         dataBittimingConst: (data, obj) => data.push(10, obj.dataBittimingConst!),
@@ -0,0 +1,137 @@
+/**
+ * Parsing of the most common rtnetlink messages (links, addresses, routes
+ * and neighbors) with the decoders generated into the native binding.
+ *
+ * The native side validates the messages and writes a tape describing
+ * the resulting objects (see `src/decoder.h`), which is replayed here to
+ * build them; creating the objects through N-API would cost more than
+ * parsing in JS. The result is the same as with {@link parseMessage}.
+ * @module
+ */
+
+import { NetlinkMessage, readU64, readS64 } from '../structs'
+import { parseMessage, Message } from './structs'
+
+const binding = require('node-gyp-build')(__dirname + '/../..')
+
+// Tape opcodes (see decoder.h)
+const END = 0
+const NUMBER = 1
+const STRING = 2
+const BYTES = 3
+const TRUE = 4
+const FALSE = 5
+const ENUM = 6
+const BIGINT = 7
+const SBIGINT = 8
+const OBJECT = 9
+const ARRAY = 10
+const MAP = 11
+const UNPARSED = 12
+const REPEATED = 0x100
+
+/** Property names, by key id */
+let keys: string[] | undefined
+let tape = new Float64Array(16384)
+/** Type, offset and length of each message (see decodeRtMessages in binding.cc) */
+let frames = new Uint32Array(768)
+
+// Replay state
+let pos = 0
+let data: Buffer
+
+function readContainer(kind: number): any {
+    const result: any = kind === OBJECT ? {} : kind === ARRAY ? [] : new Map()
+    let unparsed: [number, Buffer][] | undefined
+    let rest: Buffer | undefined
+    while (true) {
+        const op = tape[pos++]
+        if (op === END) break
+        if (op === UNPARSED) {
+            const type = tape[pos++], start = tape[pos++], end = tape[pos++]
+            if (type < 0)
+                rest = data.subarray(start, end)
+            else
+                (unparsed || (unparsed = [])).push([ type, data.subarray(start, end) ])
+            continue
+        }
+        const key = tape[pos++]
+        let value: any
+        switch (op & 0xFF) {
+            case NUMBER: value = tape[pos++]; break
+            case STRING: value = data.toString('utf8', tape[pos], tape[pos + 1]); pos += 2; break
+            case BYTES: value = data.subarray(tape[pos], tape[pos + 1]); pos += 2; break
+            case TRUE: value = true; break
+            case FALSE: value = false; break
+            case ENUM: value = keys![tape[pos++]]; break
+            case BIGINT: value = readU64.call(data, tape[pos++]); break
+            case SBIGINT: value = readS64.call(data, tape[pos++]); break
+            default: value = readContainer(op & 0xFF)
+        }
+        if (kind === ARRAY) {
+            result.push(value)
+        } else if (kind === MAP) {
+            result.set(key, value)
+        } else if (op & REPEATED) {
+            const name = keys![key]
+            result[name] = result[name] || []
+            result[name].push(value)
+        } else {
+            result[keys![key]] = value
+        }
+    }
+    // like in the TS parsers, __unparsed is set last
+    if (unparsed)
+        result.__unparsed = unparsed
+    else if (rest)
+        result.__unparsed = rest
+    return result
+}
+
+/**
+ * Parses rtnetlink messages like {@link parseMessage} does, using the
+ * native decoders for the types that have one.
+ *
+ * @param msg Messages to parse
+ * @returns Parsed messages
+ */
+export function parseMessagesNative(msg: NetlinkMessage[]): Message[] {
+    if (!keys)
+        keys = binding.decoderKeys as string[]
+    if (frames.length < msg.length * 3)
+        frames = new Uint32Array(msg.length * 3)
+    const result: Message[] = new Array(msg.length)
+    // messages are decoded in runs that share a buffer (usually a datagram)
+    for (let start = 0, end = 0; start < msg.length; start = end) {
+        const buffer = msg[start].data.buffer
+        let n = 0
+        for (; end < msg.length && msg[end].data.buffer === buffer; end++) {
+            frames[n++] = msg[end].type
+            frames[n++] = msg[end].data.byteOffset
+            frames[n++] = msg[end].data.length
+        }
+        while (!binding.decodeRtMessages(buffer, frames, end - start, tape))
+            tape = new Float64Array(tape.length * 2)
+        replay(msg, start, end, result)
+    }
+    return result
+}
+
+function replay(msg: NetlinkMessage[], start: number, end: number, result: Message[]) {
+    pos = 0
+    for (let i = start; i < end; i++) {
+        if (tape[pos] === END) {
+            pos++
+            result[i] = parseMessage(msg[i].type, msg[i].data)
+            continue
+        }
+        data = msg[i].data
+        const kind = keys![tape[pos + 1]]
+        pos += 2
+        const header = readContainer(OBJECT)
+        pos += 2
+        const attrs = readContainer(OBJECT)
+        result[i] = { kind, data: header, attrs } as Message
+    }
+    data = undefined as any
+}
@@ -6,12 +6,15 @@
 import { EventEmitter } from 'events'
 
 import { MessageInfo, RawNetlinkSocketOptions } from '../raw'
-import { createNetlink, NetlinkSocket, NetlinkSocketOptions, NetlinkSendOptions, RequestOptions } from '../netlink'
-import { Protocol, FlagsGet } from '../constants'
-import { NetlinkMessage, AttrStream } from '../structs'
+import { createNetlink, NetlinkSocket, NetlinkSocketOptions, NetlinkSendOptions, RequestOptions, DumpOptions } from '../netlink'
+import { Protocol, Flags, FlagsGet, Attributes } from '../constants'
+import { NetlinkMessage, StreamData, putU32 } from '../structs'
 import { parseMessage, Message, MessageType, MulticastGroups } from './structs'
+import { parseMessagesNative } from './native'
 import * as rt from './structs'
 import * as ifla from './ifla'
+import { ColumnarDecoder, ColumnarSnapshot, RouteColumns, LinkColumns, NeighborColumns, AddressColumns,
+    ROUTE_COLUMNS, LINK_COLUMNS, NEIGHBOR_COLUMNS, ADDRESS_COLUMNS, ColumnSpecs, headerMatch, headerField } from './columnar'
 
 /**
  * rtnetlink families. Values up to 127 are reserved for real address
@@ -29,7 +32,37 @@ export const RTNL_FAMILY_MAX = 129
 export const TCM_IFINDEX_MAGIC_BLOCK = 0xFFFFFFFF
 
 
+// Header fields of dump requests that the kernel can't filter by (see headerMatch)
+const RULE_HEADER: ColumnSpecs<{ dstLen: number, srcLen: number, tos: number, action: number, flags: number }> = {
+    dstLen: headerField(1, 1), srcLen: headerField(2, 1), tos: headerField(3, 1), action: headerField(7, 1), flags: headerField(8, 4),
+}
+const NEXTHOP_HEADER: ColumnSpecs<{ scope: number, protocol: number, flags: number }> = {
+    scope: headerField(1, 1), protocol: headerField(2, 1), flags: headerField(4, 4),
+}
+
 export interface RtNetlinkSocketOptions {
+    /**
+     * Enable strict checking of requests (`NETLINK_GET_STRICT_CHK`),
+     * which is needed for the kernel to filter dumps, if supported
+     * (default: true). The kernel then rejects dump requests with
+     * header fields it can't filter by, so the dump methods clear
+     * those and filter by them after receiving the replies.
+     */
+    strictCheck?: boolean
+    /**
+     * Decode attributes of received messages when they're first read,
+     * rather than upfront (default: false). This saves work when only
+     * some attributes are used, but parsing errors are then thrown on
+     * access and the messages keep the received buffer alive. See
+     * {@link getLazyObject} and {@link materialize}.
+     */
+    lazy?: boolean
+    /**
+     * Parse links, addresses, routes and neighbors with the decoders
+     * generated into the native binding (default: false). The result is
+     * the same, see {@link parseMessagesNative}. Ignored if `lazy` is set.
+     */
+    native?: boolean
 }
 
 export interface RtNetlinkSendOptions extends NetlinkSendOptions {
@@ -57,21 +90,31 @@ export class RtNetlinkSocket extends EventEmitter {
     removeListener<E extends keyof EventMap>(event: E, listener: EventMap[E]) { return super.removeListener(event, listener) }
 
     readonly socket: NetlinkSocket
+    readonly lazy: boolean
+    readonly native: boolean
 
     constructor(socket: NetlinkSocket, options?: RtNetlinkSocketOptions) {
         super()
         this.socket = socket
+        this.lazy = !!(options && options.lazy)
+        this.native = !!(options && options.native) && !this.lazy
         this.socket.on('message', this._receive.bind(this))
+        if (!(options && options.strictCheck === false))
+            this.socket.trySetNetlinkOption(Attributes.GET_STRICT_CHK, true)
     }
 
     private _receive(omsg: NetlinkMessage[], rinfo: MessageInfo) {
         try {
-            this.emit('message', omsg.map(x => parseMessage(x.type, x.data)), rinfo)
+            this.emit('message', this._parse(omsg), rinfo)
         } catch (e) {
             this.emit('invalid', e, omsg, rinfo)
         }
     }
 
+    private _parse(msg: NetlinkMessage[]): Message[] {
+        return this.native ? parseMessagesNative(msg) : msg.map(x => parseMessage(x.type, x.data, this.lazy))
+    }
+
     /** re-exposes `socket.addMembership()` with the specific type */
     addMembership(group: MulticastGroups | keyof typeof MulticastGroups) {
         return this.socket.addMembership(typeof group === 'number' ? group : MulticastGroups[group])
@@ -84,7 +127,7 @@ export class RtNetlinkSocket extends EventEmitter {
 
     send(
         type: MessageType,
-        data: Uint8Array | Uint8Array[],
+        data: StreamData,
         options?: RtNetlinkSendOptions & RequestOptions,
         callback?: (error?: Error) => any,
     ) {
@@ -93,17 +136,89 @@ export class RtNetlinkSocket extends EventEmitter {
 
     async request(
         type: MessageType,
-        data: Uint8Array | Uint8Array[],
+        data: StreamData,
         options?: RtNetlinkSendOptions & RequestOptions
     ): Promise<Message[]> {
         const [msg, rinfo] = await this.socket.request(type, data, options)
-        return msg.map(x => parseMessage(x.type, x.data))
+        return this._parse(msg)
+    }
+
+    /**
+     * Sends a dump request, and yields the parsed replies as they
+     * arrive, see {@link NetlinkSocket.dump}.
+     */
+    async *dump(
+        type: MessageType,
+        data: StreamData,
+        options?: RtNetlinkSendOptions & DumpOptions
+    ): AsyncGenerator<Message[], void, undefined> {
+        for await (const [msg, rinfo] of this.socket.dump(type, data, options))
+            yield this._parse(msg)
+    }
+
+    /**
+     * Like {@link dump}, but checks the kind of the replies. If the
+     * kernel didn't filter the dump (the replies lack the
+     * DUMP_FILTERED flag), `match` is used to filter them here instead.
+     * `local` filters by fields the kernel never filters by.
+     */
+    protected async *filteredDump<T extends Message>(
+        type: MessageType,
+        kind: T['kind'],
+        data: StreamData,
+        options: (RtNetlinkSendOptions & DumpOptions) | undefined,
+        match: (x: T) => boolean,
+        local?: (x: T) => boolean,
+    ): AsyncGenerator<T[], void, undefined> {
+        for await (const [omsg, rinfo] of this.socket.dump(type, data, options)) {
+            const filtered = omsg.some(x => x.flags & Flags.DUMP_FILTERED)
+            const result = this._parse(omsg).map(msg => {
+                if (msg.kind !== kind)
+                    throw Error(`Unexpected ${msg.kind} message received`)
+                return msg as T
+            })
+            const matched = filtered ? result : result.filter(match)
+            yield local ? matched.filter(local) : matched
+        }
+    }
+
+    /**
+     * Like {@link filteredDump}, but decodes the replies into columns
+     * instead of parsing them. `match` inspects the loaded message.
+     */
+    protected async columnarDump<C, F extends keyof C>(
+        type: MessageType,
+        replyType: MessageType,
+        decoder: ColumnarDecoder<C, F>,
+        data: StreamData,
+        options: (RtNetlinkSendOptions & DumpOptions) | undefined,
+        match: (x: ColumnarDecoder<C, F>) => boolean,
+        local?: (x: ColumnarDecoder<C, F>) => boolean,
+    ): Promise<ColumnarSnapshot<C, F>> {
+        for await (const [omsg] of this.socket.dump(type, data, options)) {
+            const filtered = omsg.some(x => x.flags & Flags.DUMP_FILTERED)
+            for (const x of omsg) {
+                if (x.type !== replyType)
+                    throw Error(`Unexpected message type ${x.type} received`)
+                decoder.load(x.data)
+                if ((filtered || match(decoder)) && (!local || local(decoder)))
+                    decoder.commit()
+            }
+        }
+        return decoder.finish()
+    }
+
+    /** Collects the results of a dump into an array */
+    protected async collect<T>(dump: AsyncIterable<T[]>): Promise<T[]> {
+        const result: T[] = []
+        for await (const msgs of dump)
+            result.push(...msgs)
+        return result
     }
 
     async newTrafficAction(data: rt.TcAction, attrs?: {}, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.TcActionMessage[]> {
-        const msg = new AttrStream()
-        rt.formatTcActionMessage({ kind: 'tcAction', data }, msg)
-        const omsg = await this.request(MessageType.NEWACTION, msg.bufs, options)
+        const msg: StreamData = out => rt.formatTcActionMessage({ kind: 'tcAction', data }, out)
+        const omsg = await this.request(MessageType.NEWACTION, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'tcAction')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -112,9 +227,8 @@ export class RtNetlinkSocket extends EventEmitter {
     }
 
     async delTrafficAction(data: rt.TcAction, attrs?: {}, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.TcActionMessage[]> {
-        const msg = new AttrStream()
-        rt.formatTcActionMessage({ kind: 'tcAction', data }, msg)
-        const omsg = await this.request(MessageType.DELACTION, msg.bufs, options)
+        const msg: StreamData = out => rt.formatTcActionMessage({ kind: 'tcAction', data }, out)
+        const omsg = await this.request(MessageType.DELACTION, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'tcAction')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -123,9 +237,8 @@ export class RtNetlinkSocket extends EventEmitter {
     }
 
     async getTrafficAction(data: rt.TcAction, attrs?: {}, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.TcActionMessage[]> {
-        const msg = new AttrStream()
-        rt.formatTcActionMessage({ kind: 'tcAction', data }, msg)
-        const omsg = await this.request(MessageType.GETACTION, msg.bufs, options)
+        const msg: StreamData = out => rt.formatTcActionMessage({ kind: 'tcAction', data }, out)
+        const omsg = await this.request(MessageType.GETACTION, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'tcAction')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -139,9 +252,8 @@ export class RtNetlinkSocket extends EventEmitter {
     }
 
     async newAddress(data: rt.Address, attrs?: rt.AddressAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.AddressMessage[]> {
-        const msg = new AttrStream()
-        rt.formatAddressMessage({ kind: 'address', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.NEWADDR, msg.bufs, options)
+        const msg: StreamData = out => rt.formatAddressMessage({ kind: 'address', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.NEWADDR, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'address')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -150,9 +262,8 @@ export class RtNetlinkSocket extends EventEmitter {
     }
 
     async delAddress(data: rt.Address, attrs?: rt.AddressAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.AddressMessage[]> {
-        const msg = new AttrStream()
-        rt.formatAddressMessage({ kind: 'address', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.DELADDR, msg.bufs, options)
+        const msg: StreamData = out => rt.formatAddressMessage({ kind: 'address', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.DELADDR, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'address')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -161,9 +272,8 @@ export class RtNetlinkSocket extends EventEmitter {
     }
 
     async getAddress(data: rt.Address, attrs?: rt.AddressAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.AddressMessage[]> {
-        const msg = new AttrStream()
-        rt.formatAddressMessage({ kind: 'address', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.GETADDR, msg.bufs, options)
+        const msg: StreamData = out => rt.formatAddressMessage({ kind: 'address', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.GETADDR, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'address')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -171,15 +281,42 @@ export class RtNetlinkSocket extends EventEmitter {
         })
     }
 
+    /**
+     * Dumps addresses. The kernel filters them by `family` and
+     * `index` (if strict checking is supported, otherwise they're
+     * filtered after receiving them). Other header fields are
+     * always filtered after receiving them.
+     */
     getAddresses(data?: rt.Address, attrs?: rt.AddressAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.AddressMessage[]> {
-        options = { ...options, flags: Number(options?.flags) | FlagsGet.DUMP }
-        return this.getAddress(data || {}, attrs, options)
+        return this.collect(this.dumpAddresses(data, attrs, options))
+    }
+
+    /** Like {@link getAddresses}, but yields the replies as they arrive (see {@link dump}) */
+    dumpAddresses(data?: rt.Address, attrs?: rt.AddressAttrs, options?: RtNetlinkSendOptions & DumpOptions): AsyncGenerator<rt.AddressMessage[], void, undefined> {
+        data = data || {}
+        const { family, index } = data
+        const msg: StreamData = out => rt.formatAddressMessage({ kind: 'address', data: { family, index }, attrs: attrs || {} }, out)
+        const local = headerMatch(ADDRESS_COLUMNS, rt.formatAddress(data), ['prefixlen', 'flags', 'scope'])
+        return this.filteredDump<rt.AddressMessage>(MessageType.GETADDR, 'address', msg, options, x =>
+            (!family || x.data.family === family) && (!index || x.data.index === index),
+            local && (x => local.header(rt.formatAddress(x.data))))
+    }
+
+    /** Like {@link getAddresses}, but returns the selected fields as columns (see {@link ColumnarSnapshot}) */
+    getAddressesColumnar<F extends keyof AddressColumns>(fields: F[], data?: rt.Address, attrs?: rt.AddressAttrs, options?: RtNetlinkSendOptions & DumpOptions): Promise<ColumnarSnapshot<AddressColumns, F>> {
+        data = data || {}
+        const { family, index } = data
+        const msg: StreamData = out => rt.formatAddressMessage({ kind: 'address', data: { family, index }, attrs: attrs || {} }, out)
+        const local = headerMatch(ADDRESS_COLUMNS, rt.formatAddress(data), ['prefixlen', 'flags', 'scope'])
+        const decoder = new ColumnarDecoder('address', rt.__LENGTH_Address, ADDRESS_COLUMNS, fields)
+        return this.columnarDump(MessageType.GETADDR, MessageType.NEWADDR, decoder, msg, options, x =>
+            (!family || x.value('family') === family) && (!index || x.value('ifindex') === index),
+            local && local.decoder)
     }
 
     async newLink(data: rt.Link, attrs?: ifla.LinkAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.LinkMessage[]> {
-        const msg = new AttrStream()
-        rt.formatLinkMessage({ kind: 'link', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.NEWLINK, msg.bufs, options)
+        const msg: StreamData = out => rt.formatLinkMessage({ kind: 'link', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.NEWLINK, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'link')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -188,9 +325,8 @@ export class RtNetlinkSocket extends EventEmitter {
     }
 
     async delLink(data: rt.Link, attrs?: ifla.LinkAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.LinkMessage[]> {
-        const msg = new AttrStream()
-        rt.formatLinkMessage({ kind: 'link', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.DELLINK, msg.bufs, options)
+        const msg: StreamData = out => rt.formatLinkMessage({ kind: 'link', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.DELLINK, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'link')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -199,9 +335,8 @@ export class RtNetlinkSocket extends EventEmitter {
     }
 
     async getLink(data: rt.Link, attrs?: ifla.LinkAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.LinkMessage[]> {
-        const msg = new AttrStream()
-        rt.formatLinkMessage({ kind: 'link', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.GETLINK, msg.bufs, options)
+        const msg: StreamData = out => rt.formatLinkMessage({ kind: 'link', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.GETLINK, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'link')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -210,9 +345,8 @@ export class RtNetlinkSocket extends EventEmitter {
     }
 
     async setLink(data: rt.Link, attrs?: ifla.LinkAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.LinkMessage[]> {
-        const msg = new AttrStream()
-        rt.formatLinkMessage({ kind: 'link', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.SETLINK, msg.bufs, options)
+        const msg: StreamData = out => rt.formatLinkMessage({ kind: 'link', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.SETLINK, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'link')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -220,15 +354,43 @@ export class RtNetlinkSocket extends EventEmitter {
         })
     }
 
+    /**
+     * Dumps links. The kernel filters them by the `master` attribute
+     * (if strict checking is supported, otherwise they're filtered
+     * after receiving them). `type`, `index` and `flags` are always
+     * filtered after receiving them.
+     */
     getLinks(data?: rt.Link, attrs?: ifla.LinkAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.LinkMessage[]> {
-        options = { ...options, flags: Number(options?.flags) | FlagsGet.DUMP }
-        return this.getLink(data || {}, attrs, options)
+        return this.collect(this.dumpLinks(data, attrs, options))
+    }
+
+    /** Like {@link getLinks}, but yields the replies as they arrive (see {@link dump}) */
+    dumpLinks(data?: rt.Link, attrs?: ifla.LinkAttrs, options?: RtNetlinkSendOptions & DumpOptions): AsyncGenerator<rt.LinkMessage[], void, undefined> {
+        // the kernel rejects link dumps with any other header field set
+        const family = data && data.family
+        const msg: StreamData = out => rt.formatLinkMessage({ kind: 'link', data: { family }, attrs: attrs || {} }, out)
+        const master = attrs && attrs.master
+        const local = headerMatch(LINK_COLUMNS, rt.formatLink(data || {}), ['type', 'ifindex', 'flags'])
+        return this.filteredDump<rt.LinkMessage>(MessageType.GETLINK, 'link', msg, options, x =>
+            !master || x.attrs.master === master,
+            local && (x => local.header(rt.formatLink(x.data))))
+    }
+
+    /** Like {@link getLinks}, but returns the selected fields as columns (see {@link ColumnarSnapshot}) */
+    getLinksColumnar<F extends keyof LinkColumns>(fields: F[], data?: rt.Link, attrs?: ifla.LinkAttrs, options?: RtNetlinkSendOptions & DumpOptions): Promise<ColumnarSnapshot<LinkColumns, F>> {
+        const family = data && data.family
+        const msg: StreamData = out => rt.formatLinkMessage({ kind: 'link', data: { family }, attrs: attrs || {} }, out)
+        const master = attrs && attrs.master
+        const local = headerMatch(LINK_COLUMNS, rt.formatLink(data || {}), ['type', 'ifindex', 'flags'])
+        const decoder = new ColumnarDecoder('link', rt.__LENGTH_Link, LINK_COLUMNS, fields)
+        return this.columnarDump(MessageType.GETLINK, MessageType.NEWLINK, decoder, msg, options, x =>
+            !master || x.value('master') === master,
+            local && local.decoder)
     }
 
     async newNdUserOption(data: rt.NdUserOption, attrs?: rt.NdUserOptionAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.NdUserOptionMessage[]> {
-        const msg = new AttrStream()
-        rt.formatNdUserOptionMessage({ kind: 'ndUserOption', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.NEWNDUSEROPT, msg.bufs, options)
+        const msg: StreamData = out => rt.formatNdUserOptionMessage({ kind: 'ndUserOption', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.NEWNDUSEROPT, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'ndUserOption')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -237,9 +399,8 @@ export class RtNetlinkSocket extends EventEmitter {
     }
 
     async newNeighbor(data: rt.Neighbor, attrs?: rt.NeighborAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.NeighborMessage[]> {
-        const msg = new AttrStream()
-        rt.formatNeighborMessage({ kind: 'neighbor', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.NEWNEIGH, msg.bufs, options)
+        const msg: StreamData = out => rt.formatNeighborMessage({ kind: 'neighbor', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.NEWNEIGH, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'neighbor')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -248,9 +409,8 @@ export class RtNetlinkSocket extends EventEmitter {
     }
 
     async delNeighbor(data: rt.Neighbor, attrs?: rt.NeighborAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.NeighborMessage[]> {
-        const msg = new AttrStream()
-        rt.formatNeighborMessage({ kind: 'neighbor', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.DELNEIGH, msg.bufs, options)
+        const msg: StreamData = out => rt.formatNeighborMessage({ kind: 'neighbor', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.DELNEIGH, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'neighbor')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -259,9 +419,8 @@ export class RtNetlinkSocket extends EventEmitter {
     }
 
     async getNeighbor(data: rt.Neighbor, attrs?: rt.NeighborAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.NeighborMessage[]> {
-        const msg = new AttrStream()
-        rt.formatNeighborMessage({ kind: 'neighbor', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.GETNEIGH, msg.bufs, options)
+        const msg: StreamData = out => rt.formatNeighborMessage({ kind: 'neighbor', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.GETNEIGH, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'neighbor')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -269,15 +428,57 @@ export class RtNetlinkSocket extends EventEmitter {
         })
     }
 
+    /**
+     * Dumps neighbors. The kernel filters them by `family`, `ifindex`
+     * and the `master` attribute (if strict checking is supported,
+     * otherwise they're filtered after receiving them). `state`, `type`
+     * and `flags` (except `proxy`) are always filtered after receiving them.
+     */
     getNeighbors(data?: rt.Neighbor, attrs?: rt.NeighborAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.NeighborMessage[]> {
-        options = { ...options, flags: Number(options?.flags) | FlagsGet.DUMP }
-        return this.getNeighbor(data || {}, attrs, options)
+        return this.collect(this.dumpNeighbors(data, attrs, options))
+    }
+
+    /** Like {@link getNeighbors}, but yields the replies as they arrive (see {@link dump}) */
+    dumpNeighbors(data?: rt.Neighbor, attrs?: rt.NeighborAttrs, options?: RtNetlinkSendOptions & DumpOptions): AsyncGenerator<rt.NeighborMessage[], void, undefined> {
+        const { ifindex, state, type, flags, ...rest } = data || {}
+        // of the flags, the kernel only accepts NTF_PROXY (which selects the proxy table)
+        const { proxy, ...otherFlags } = flags || {}
+        const header: rt.Neighbor = { ...rest, flags: proxy ? { proxy } : undefined }
+        attrs = { ...attrs }
+        // dumps are filtered through the IFINDEX attribute, not the header
+        if (ifindex)
+            attrs.ifindex = putU32(ifindex)
+        const msg: StreamData = out => rt.formatNeighborMessage({ kind: 'neighbor', data: header, attrs }, out)
+        const { family } = header, { master } = attrs
+        const local = headerMatch(NEIGHBOR_COLUMNS, rt.formatNeighbor({ state, type, flags: otherFlags }), ['state', 'type', 'flags'])
+        return this.filteredDump<rt.NeighborMessage>(MessageType.GETNEIGH, 'neighbor', msg, options, x =>
+            (!family || x.data.family === family) && (!ifindex || x.data.ifindex === ifindex) &&
+            (!master || x.attrs.master === master),
+            local && (x => local.header(rt.formatNeighbor(x.data))))
+    }
+
+    /** Like {@link getNeighbors}, but returns the selected fields as columns (see {@link ColumnarSnapshot}) */
+    getNeighborsColumnar<F extends keyof NeighborColumns>(fields: F[], data?: rt.Neighbor, attrs?: rt.NeighborAttrs, options?: RtNetlinkSendOptions & DumpOptions): Promise<ColumnarSnapshot<NeighborColumns, F>> {
+        const { ifindex, state, type, flags, ...rest } = data || {}
+        // of the flags, the kernel only accepts NTF_PROXY (which selects the proxy table)
+        const { proxy, ...otherFlags } = flags || {}
+        const header: rt.Neighbor = { ...rest, flags: proxy ? { proxy } : undefined }
+        attrs = { ...attrs }
+        if (ifindex)
+            attrs.ifindex = putU32(ifindex)
+        const msg: StreamData = out => rt.formatNeighborMessage({ kind: 'neighbor', data: header, attrs: attrs! }, out)
+        const { family } = header, { master } = attrs
+        const local = headerMatch(NEIGHBOR_COLUMNS, rt.formatNeighbor({ state, type, flags: otherFlags }), ['state', 'type', 'flags'])
+        const decoder = new ColumnarDecoder('neighbor', rt.__LENGTH_Neighbor, NEIGHBOR_COLUMNS, fields)
+        return this.columnarDump(MessageType.GETNEIGH, MessageType.NEWNEIGH, decoder, msg, options, x =>
+            (!family || x.value('family') === family) && (!ifindex || x.value('ifindex') === ifindex) &&
+            (!master || x.value('master') === master),
+            local && local.decoder)
     }
 
     async newNeighborTable(data: rt.NeighborTable, attrs?: rt.NeighborTableAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.NeighborTableMessage[]> {
-        const msg = new AttrStream()
-        rt.formatNeighborTableMessage({ kind: 'neighborTable', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.NEWNEIGHTBL, msg.bufs, options)
+        const msg: StreamData = out => rt.formatNeighborTableMessage({ kind: 'neighborTable', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.NEWNEIGHTBL, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'neighborTable')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -286,9 +487,8 @@ export class RtNetlinkSocket extends EventEmitter {
     }
 
     async getNeighborTable(data: rt.NeighborTable, attrs?: rt.NeighborTableAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.NeighborTableMessage[]> {
-        const msg = new AttrStream()
-        rt.formatNeighborTableMessage({ kind: 'neighborTable', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.GETNEIGHTBL, msg.bufs, options)
+        const msg: StreamData = out => rt.formatNeighborTableMessage({ kind: 'neighborTable', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.GETNEIGHTBL, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'neighborTable')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -297,9 +497,8 @@ export class RtNetlinkSocket extends EventEmitter {
     }
 
     async setNeighborTable(data: rt.NeighborTable, attrs?: rt.NeighborTableAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.NeighborTableMessage[]> {
-        const msg = new AttrStream()
-        rt.formatNeighborTableMessage({ kind: 'neighborTable', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.SETNEIGHTBL, msg.bufs, options)
+        const msg: StreamData = out => rt.formatNeighborTableMessage({ kind: 'neighborTable', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.SETNEIGHTBL, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'neighborTable')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -307,15 +506,21 @@ export class RtNetlinkSocket extends EventEmitter {
         })
     }
 
-    getNeighborTables(data?: rt.NeighborTable, attrs?: rt.NeighborTableAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.NeighborTableMessage[]> {
+    /**
+     * Dumps neighbor tables. The kernel filters them by `family`;
+     * the `name` attribute is matched after receiving them.
+     */
+    async getNeighborTables(data?: rt.NeighborTable, attrs?: rt.NeighborTableAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.NeighborTableMessage[]> {
         options = { ...options, flags: Number(options?.flags) | FlagsGet.DUMP }
-        return this.getNeighborTable(data || {}, attrs, options)
+        // the kernel rejects neighbor table dumps with attributes
+        const name = attrs && attrs.name
+        const result = await this.getNeighborTable({ family: data && data.family }, {}, options)
+        return result.filter(x => !name || x.attrs.name === name)
     }
 
     async newPrefix(data: rt.Prefix, attrs?: rt.PrefixAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.PrefixMessage[]> {
-        const msg = new AttrStream()
-        rt.formatPrefixMessage({ kind: 'prefix', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.NEWPREFIX, msg.bufs, options)
+        const msg: StreamData = out => rt.formatPrefixMessage({ kind: 'prefix', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.NEWPREFIX, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'prefix')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -324,9 +529,8 @@ export class RtNetlinkSocket extends EventEmitter {
     }
 
     async newQdisc(data: rt.Tc, attrs?: rt.TcAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.TcMessage[]> {
-        const msg = new AttrStream()
-        rt.formatTcMessage({ kind: 'tc', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.NEWQDISC, msg.bufs, options)
+        const msg: StreamData = out => rt.formatTcMessage({ kind: 'tc', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.NEWQDISC, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'tc')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -335,9 +539,8 @@ export class RtNetlinkSocket extends EventEmitter {
     }
 
     async delQdisc(data: rt.Tc, attrs?: rt.TcAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.TcMessage[]> {
-        const msg = new AttrStream()
-        rt.formatTcMessage({ kind: 'tc', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.DELQDISC, msg.bufs, options)
+        const msg: StreamData = out => rt.formatTcMessage({ kind: 'tc', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.DELQDISC, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'tc')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -346,9 +549,8 @@ export class RtNetlinkSocket extends EventEmitter {
     }
 
     async getQdisc(data: rt.Tc, attrs?: rt.TcAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.TcMessage[]> {
-        const msg = new AttrStream()
-        rt.formatTcMessage({ kind: 'tc', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.GETQDISC, msg.bufs, options)
+        const msg: StreamData = out => rt.formatTcMessage({ kind: 'tc', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.GETQDISC, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'tc')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -362,9 +564,8 @@ export class RtNetlinkSocket extends EventEmitter {
     }
 
     async newRoute(data: rt.Route, attrs?: rt.RouteAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.RouteMessage[]> {
-        const msg = new AttrStream()
-        rt.formatRouteMessage({ kind: 'route', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.NEWROUTE, msg.bufs, options)
+        const msg: StreamData = out => rt.formatRouteMessage({ kind: 'route', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.NEWROUTE, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'route')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -373,9 +574,8 @@ export class RtNetlinkSocket extends EventEmitter {
     }
 
     async delRoute(data: rt.Route, attrs?: rt.RouteAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.RouteMessage[]> {
-        const msg = new AttrStream()
-        rt.formatRouteMessage({ kind: 'route', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.DELROUTE, msg.bufs, options)
+        const msg: StreamData = out => rt.formatRouteMessage({ kind: 'route', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.DELROUTE, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'route')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -384,9 +584,8 @@ export class RtNetlinkSocket extends EventEmitter {
     }
 
     async getRoute(data: rt.Route, attrs?: rt.RouteAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.RouteMessage[]> {
-        const msg = new AttrStream()
-        rt.formatRouteMessage({ kind: 'route', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.GETROUTE, msg.bufs, options)
+        const msg: StreamData = out => rt.formatRouteMessage({ kind: 'route', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.GETROUTE, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'route')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -394,15 +593,64 @@ export class RtNetlinkSocket extends EventEmitter {
         })
     }
 
+    /**
+     * Dumps routes. The kernel filters them by `family`, `table`,
+     * `protocol`, `type` and the `table` and `oif` attributes (if
+     * strict checking is supported, otherwise they're filtered
+     * after receiving them). `dstLen`, `srcLen`, `tos` and `scope`
+     * are always filtered after receiving them.
+     */
     getRoutes(data?: rt.Route, attrs?: rt.RouteAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.RouteMessage[]> {
-        options = { ...options, flags: Number(options?.flags) | FlagsGet.DUMP }
-        return this.getRoute(data || {}, attrs, options)
+        return this.collect(this.dumpRoutes(data, attrs, options))
+    }
+
+    /** Like {@link getRoutes}, but yields the replies as they arrive (see {@link dump}) */
+    dumpRoutes(data?: rt.Route, attrs?: rt.RouteAttrs, options?: RtNetlinkSendOptions & DumpOptions): AsyncGenerator<rt.RouteMessage[], void, undefined> {
+        data = data || {}
+        attrs = attrs || {}
+        // the kernel rejects route dumps with these header fields set
+        const { dstLen, srcLen, tos, scope, ...header } = data
+        const msg: StreamData = out => rt.formatRouteMessage({ kind: 'route', data: header, attrs: attrs! }, out)
+        // compare formatted headers, to deal with enum values
+        const filter = rt.formatRoute(data)
+        const local = headerMatch(ROUTE_COLUMNS, filter, ['dstLen', 'srcLen', 'tos', 'scope'])
+        const table = attrs.table || data.table
+        const oif = attrs.oif
+        return this.filteredDump<rt.RouteMessage>(MessageType.GETROUTE, 'route', msg, options, x => {
+            const header = rt.formatRoute(x.data)
+            return [0, 5, 7].every(i => !filter[i] || filter[i] === header[i]) &&
+                (!table || (x.attrs.table || x.data.table) === table) &&
+                (!oif || x.attrs.oif === oif)
+        }, local && (x => local.header(rt.formatRoute(x.data))))
+    }
+
+    /**
+     * Like {@link getRoutes}, but returns the selected fields as columns
+     * (see {@link ColumnarSnapshot}), decoded straight from the replies.
+     * Use this for large tables, when per-route objects aren't needed.
+     */
+    getRoutesColumnar<F extends keyof RouteColumns>(fields: F[], data?: rt.Route, attrs?: rt.RouteAttrs, options?: RtNetlinkSendOptions & DumpOptions): Promise<ColumnarSnapshot<RouteColumns, F>> {
+        data = data || {}
+        attrs = attrs || {}
+        const { dstLen, srcLen, tos, scope, ...header } = data
+        const msg: StreamData = out => rt.formatRouteMessage({ kind: 'route', data: header, attrs: attrs! }, out)
+        const filter = rt.formatRoute(data)
+        const local = headerMatch(ROUTE_COLUMNS, filter, ['dstLen', 'srcLen', 'tos', 'scope'])
+        const table = attrs.table || data.table
+        const oif = attrs.oif
+        const decoder = new ColumnarDecoder('route', rt.__LENGTH_Route, ROUTE_COLUMNS, fields)
+        return this.columnarDump(MessageType.GETROUTE, MessageType.NEWROUTE, decoder, msg, options, x =>
+            (!filter[0] || filter[0] === x.value('family')) &&
+            (!filter[5] || filter[5] === x.value('protocol')) &&
+            (!filter[7] || filter[7] === x.value('type')) &&
+            (!table || x.value('table') === table) &&
+            (!oif || x.value('oif') === oif),
+            local && local.decoder)
     }
 
     async newRule(data: rt.Rule, attrs?: rt.RuleAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.RuleMessage[]> {
-        const msg = new AttrStream()
-        rt.formatRuleMessage({ kind: 'rule', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.NEWRULE, msg.bufs, options)
+        const msg: StreamData = out => rt.formatRuleMessage({ kind: 'rule', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.NEWRULE, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'rule')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -411,9 +659,8 @@ export class RtNetlinkSocket extends EventEmitter {
     }
 
     async delRule(data: rt.Rule, attrs?: rt.RuleAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.RuleMessage[]> {
-        const msg = new AttrStream()
-        rt.formatRuleMessage({ kind: 'rule', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.DELRULE, msg.bufs, options)
+        const msg: StreamData = out => rt.formatRuleMessage({ kind: 'rule', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.DELRULE, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'rule')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -422,9 +669,8 @@ export class RtNetlinkSocket extends EventEmitter {
     }
 
     async getRule(data: rt.Rule, attrs?: rt.RuleAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.RuleMessage[]> {
-        const msg = new AttrStream()
-        rt.formatRuleMessage({ kind: 'rule', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.GETRULE, msg.bufs, options)
+        const msg: StreamData = out => rt.formatRuleMessage({ kind: 'rule', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.GETRULE, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'rule')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -432,15 +678,25 @@ export class RtNetlinkSocket extends EventEmitter {
         })
     }
 
-    getRules(data?: rt.Rule, attrs?: rt.RuleAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.RuleMessage[]> {
+    /**
+     * Dumps rules. The kernel filters them by `family`; `dstLen`,
+     * `srcLen`, `tos`, `action`, `flags` and the table (header field
+     * or attribute) are matched after receiving them.
+     */
+    async getRules(data?: rt.Rule, attrs?: rt.RuleAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.RuleMessage[]> {
         options = { ...options, flags: Number(options?.flags) | FlagsGet.DUMP }
-        return this.getRule(data || {}, attrs, options)
+        data = data || {}
+        // the kernel rejects rule dumps with anything but the family set
+        const local = headerMatch(RULE_HEADER, rt.formatRule(data), ['dstLen', 'srcLen', 'tos', 'action', 'flags'])
+        const table = (attrs && attrs.table) || data.table
+        const result = await this.getRule({ family: data.family }, {}, options)
+        return result.filter(x => (!local || local.header(rt.formatRule(x.data))) &&
+            (!table || (x.attrs.table || x.data.table) === table))
     }
 
     async newNextHop(data: rt.NextHop, attrs?: rt.NextHopAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.NextHopMessage[]> {
-        const msg = new AttrStream()
-        rt.formatNextHopMessage({ kind: 'nexthop', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.NEWNEXTHOP, msg.bufs, options)
+        const msg: StreamData = out => rt.formatNextHopMessage({ kind: 'nexthop', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.NEWNEXTHOP, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'nexthop')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -449,9 +705,8 @@ export class RtNetlinkSocket extends EventEmitter {
     }
 
     async delNextHop(data: rt.NextHop, attrs?: rt.NextHopAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.NextHopMessage[]> {
-        const msg = new AttrStream()
-        rt.formatNextHopMessage({ kind: 'nexthop', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.DELNEXTHOP, msg.bufs, options)
+        const msg: StreamData = out => rt.formatNextHopMessage({ kind: 'nexthop', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.DELNEXTHOP, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'nexthop')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -460,9 +715,8 @@ export class RtNetlinkSocket extends EventEmitter {
     }
 
     async getNextHop(data: rt.NextHop, attrs?: rt.NextHopAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.NextHopMessage[]> {
-        const msg = new AttrStream()
-        rt.formatNextHopMessage({ kind: 'nexthop', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.GETNEXTHOP, msg.bufs, options)
+        const msg: StreamData = out => rt.formatNextHopMessage({ kind: 'nexthop', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.GETNEXTHOP, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'nexthop')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -470,15 +724,18 @@ export class RtNetlinkSocket extends EventEmitter {
         })
     }
 
-    getNextHops(data?: rt.NextHop, attrs?: rt.NextHopAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.NextHopMessage[]> {
+    async getNextHops(data?: rt.NextHop, attrs?: rt.NextHopAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.NextHopMessage[]> {
         options = { ...options, flags: Number(options?.flags) | FlagsGet.DUMP }
-        return this.getNextHop(data || {}, attrs, options)
+        // the kernel rejects nexthop dumps with these header fields set
+        const { scope, protocol, flags, ...header } = data || {}
+        const local = headerMatch(NEXTHOP_HEADER, rt.formatNextHop({ scope, protocol, flags }), ['scope', 'protocol', 'flags'])
+        const result = await this.getNextHop(header, attrs, options)
+        return local ? result.filter(x => local.header(rt.formatNextHop(x.data))) : result
     }
 
     async newNextHopBucket(data: rt.NextHop, attrs?: rt.NextHopAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.NextHopMessage[]> {
-        const msg = new AttrStream()
-        rt.formatNextHopMessage({ kind: 'nexthop', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.NEWNEXTHOPBUCKET, msg.bufs, options)
+        const msg: StreamData = out => rt.formatNextHopMessage({ kind: 'nexthop', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.NEWNEXTHOPBUCKET, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'nexthop')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -487,9 +744,8 @@ export class RtNetlinkSocket extends EventEmitter {
     }
 
     async delNextHopBucket(data: rt.NextHop, attrs?: rt.NextHopAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.NextHopMessage[]> {
-        const msg = new AttrStream()
-        rt.formatNextHopMessage({ kind: 'nexthop', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.DELNEXTHOPBUCKET, msg.bufs, options)
+        const msg: StreamData = out => rt.formatNextHopMessage({ kind: 'nexthop', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.DELNEXTHOPBUCKET, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'nexthop')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -498,9 +754,8 @@ export class RtNetlinkSocket extends EventEmitter {
     }
 
     async getNextHopBucket(data: rt.NextHop, attrs?: rt.NextHopAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.NextHopMessage[]> {
-        const msg = new AttrStream()
-        rt.formatNextHopMessage({ kind: 'nexthop', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.GETNEXTHOPBUCKET, msg.bufs, options)
+        const msg: StreamData = out => rt.formatNextHopMessage({ kind: 'nexthop', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.GETNEXTHOPBUCKET, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'nexthop')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -508,15 +763,18 @@ export class RtNetlinkSocket extends EventEmitter {
         })
     }
 
-    getNextHopBuckets(data?: rt.NextHop, attrs?: rt.NextHopAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.NextHopMessage[]> {
+    async getNextHopBuckets(data?: rt.NextHop, attrs?: rt.NextHopAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.NextHopMessage[]> {
         options = { ...options, flags: Number(options?.flags) | FlagsGet.DUMP }
-        return this.getNextHopBucket(data || {}, attrs, options)
+        // the kernel rejects nexthop dumps with these header fields set
+        const { scope, protocol, flags, ...header } = data || {}
+        const local = headerMatch(NEXTHOP_HEADER, rt.formatNextHop({ scope, protocol, flags }), ['scope', 'protocol', 'flags'])
+        const result = await this.getNextHopBucket(header, attrs, options)
+        return local ? result.filter(x => local.header(rt.formatNextHop(x.data))) : result
     }
 
     async newTrafficClass(data: rt.Tc, attrs?: rt.TcAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.TcMessage[]> {
-        const msg = new AttrStream()
-        rt.formatTcMessage({ kind: 'tc', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.NEWTCLASS, msg.bufs, options)
+        const msg: StreamData = out => rt.formatTcMessage({ kind: 'tc', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.NEWTCLASS, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'tc')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -525,9 +783,8 @@ export class RtNetlinkSocket extends EventEmitter {
     }
 
     async delTrafficClass(data: rt.Tc, attrs?: rt.TcAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.TcMessage[]> {
-        const msg = new AttrStream()
-        rt.formatTcMessage({ kind: 'tc', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.DELTCLASS, msg.bufs, options)
+        const msg: StreamData = out => rt.formatTcMessage({ kind: 'tc', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.DELTCLASS, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'tc')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -536,9 +793,8 @@ export class RtNetlinkSocket extends EventEmitter {
     }
 
     async getTrafficClass(data: rt.Tc, attrs?: rt.TcAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.TcMessage[]> {
-        const msg = new AttrStream()
-        rt.formatTcMessage({ kind: 'tc', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.GETTCLASS, msg.bufs, options)
+        const msg: StreamData = out => rt.formatTcMessage({ kind: 'tc', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.GETTCLASS, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'tc')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -552,9 +808,8 @@ export class RtNetlinkSocket extends EventEmitter {
     }
 
     async newTrafficFilter(data: rt.Tc, attrs?: rt.TcAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.TcMessage[]> {
-        const msg = new AttrStream()
-        rt.formatTcMessage({ kind: 'tc', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.NEWTFILTER, msg.bufs, options)
+        const msg: StreamData = out => rt.formatTcMessage({ kind: 'tc', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.NEWTFILTER, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'tc')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -563,9 +818,8 @@ export class RtNetlinkSocket extends EventEmitter {
     }
 
     async delTrafficFilter(data: rt.Tc, attrs?: rt.TcAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.TcMessage[]> {
-        const msg = new AttrStream()
-        rt.formatTcMessage({ kind: 'tc', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.DELTFILTER, msg.bufs, options)
+        const msg: StreamData = out => rt.formatTcMessage({ kind: 'tc', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.DELTFILTER, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'tc')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -574,9 +828,8 @@ export class RtNetlinkSocket extends EventEmitter {
     }
 
     async getTrafficFilter(data: rt.Tc, attrs?: rt.TcAttrs, options?: RtNetlinkSendOptions & RequestOptions): Promise<rt.TcMessage[]> {
-        const msg = new AttrStream()
-        rt.formatTcMessage({ kind: 'tc', data, attrs: attrs || {} }, msg)
-        const omsg = await this.request(MessageType.GETTFILTER, msg.bufs, options)
+        const msg: StreamData = out => rt.formatTcMessage({ kind: 'tc', data, attrs: attrs || {} }, out)
+        const omsg = await this.request(MessageType.GETTFILTER, msg, options)
         return omsg.map(x => {
             if (x.kind !== 'tc')
                 throw Error(`Unexpected ${x.kind} message received`)
@@ -1,4 +1,5 @@
 import { AttrStream } from '../structs'
+import { FilterRule } from '../filter'
 import { MessageType } from './gen_structs'
 import * as rt from './gen_structs'
 import * as ifla from './ifla'
@@ -22,11 +23,11 @@ export interface AddressMessage {
     attrs: rt.AddressAttrs
 }
 
-export function parseAddressMessage(r: Buffer): AddressMessage {
+export function parseAddressMessage(r: Buffer, lazy?: boolean): AddressMessage {
     if (r.length < rt.__LENGTH_Address)
         throw Error(`Unexpected Address message length (${r.length})`)
     const data = rt.parseAddress(r.subarray(0, rt.__LENGTH_Address))
-    const attrs = rt.parseAddressAttrs(r.subarray(rt.__LENGTH_Address))
+    const attrs = (lazy ? rt.parseAddressAttrsLazy : rt.parseAddressAttrs)(r.subarray(rt.__LENGTH_Address))
     return { kind: 'address', data, attrs }
 }
 
@@ -41,11 +42,11 @@ export interface LinkMessage {
     attrs: ifla.LinkAttrs
 }
 
-export function parseLinkMessage(r: Buffer): LinkMessage {
+export function parseLinkMessage(r: Buffer, lazy?: boolean): LinkMessage {
     if (r.length < rt.__LENGTH_Link)
         throw Error(`Unexpected Link message length (${r.length})`)
     const data = rt.parseLink(r.subarray(0, rt.__LENGTH_Link))
-    const attrs = ifla.parseLinkAttrs(r.subarray(rt.__LENGTH_Link))
+    const attrs = (lazy ? ifla.parseLinkAttrsLazy : ifla.parseLinkAttrs)(r.subarray(rt.__LENGTH_Link))
     return { kind: 'link', data, attrs }
 }
 
@@ -60,11 +61,11 @@ export interface NdUserOptionMessage {
     attrs: rt.NdUserOptionAttrs
 }
 
-export function parseNdUserOptionMessage(r: Buffer): NdUserOptionMessage {
+export function parseNdUserOptionMessage(r: Buffer, lazy?: boolean): NdUserOptionMessage {
     if (r.length < rt.__LENGTH_NdUserOption)
         throw Error(`Unexpected NdUserOption message length (${r.length})`)
     const data = rt.parseNdUserOption(r.subarray(0, rt.__LENGTH_NdUserOption))
-    const attrs = rt.parseNdUserOptionAttrs(r.subarray(rt.__LENGTH_NdUserOption))
+    const attrs = (lazy ? rt.parseNdUserOptionAttrsLazy : rt.parseNdUserOptionAttrs)(r.subarray(rt.__LENGTH_NdUserOption))
     return { kind: 'ndUserOption', data, attrs }
 }
 
@@ -79,11 +80,11 @@ export interface NeighborMessage {
     attrs: rt.NeighborAttrs
 }
 
-export function parseNeighborMessage(r: Buffer): NeighborMessage {
+export function parseNeighborMessage(r: Buffer, lazy?: boolean): NeighborMessage {
     if (r.length < rt.__LENGTH_Neighbor)
         throw Error(`Unexpected Neighbor message length (${r.length})`)
     const data = rt.parseNeighbor(r.subarray(0, rt.__LENGTH_Neighbor))
-    const attrs = rt.parseNeighborAttrs(r.subarray(rt.__LENGTH_Neighbor))
+    const attrs = (lazy ? rt.parseNeighborAttrsLazy : rt.parseNeighborAttrs)(r.subarray(rt.__LENGTH_Neighbor))
     return { kind: 'neighbor', data, attrs }
 }
 
@@ -98,11 +99,11 @@ export interface NeighborTableMessage {
     attrs: rt.NeighborTableAttrs
 }
 
-export function parseNeighborTableMessage(r: Buffer): NeighborTableMessage {
+export function parseNeighborTableMessage(r: Buffer, lazy?: boolean): NeighborTableMessage {
     if (r.length < rt.__LENGTH_NeighborTable)
         throw Error(`Unexpected NeighborTable message length (${r.length})`)
     const data = rt.parseNeighborTable(r.subarray(0, rt.__LENGTH_NeighborTable))
-    const attrs = rt.parseNeighborTableAttrs(r.subarray(rt.__LENGTH_NeighborTable))
+    const attrs = (lazy ? rt.parseNeighborTableAttrsLazy : rt.parseNeighborTableAttrs)(r.subarray(rt.__LENGTH_NeighborTable))
     return { kind: 'neighborTable', data, attrs }
 }
 
@@ -117,11 +118,11 @@ export interface PrefixMessage {
     attrs: rt.PrefixAttrs
 }
 
-export function parsePrefixMessage(r: Buffer): PrefixMessage {
+export function parsePrefixMessage(r: Buffer, lazy?: boolean): PrefixMessage {
     if (r.length < rt.__LENGTH_Prefix)
         throw Error(`Unexpected Prefix message length (${r.length})`)
     const data = rt.parsePrefix(r.subarray(0, rt.__LENGTH_Prefix))
-    const attrs = rt.parsePrefixAttrs(r.subarray(rt.__LENGTH_Prefix))
+    const attrs = (lazy ? rt.parsePrefixAttrsLazy : rt.parsePrefixAttrs)(r.subarray(rt.__LENGTH_Prefix))
     return { kind: 'prefix', data, attrs }
 }
 
@@ -136,11 +137,11 @@ export interface RouteMessage {
     attrs: rt.RouteAttrs
 }
 
-export function parseRouteMessage(r: Buffer): RouteMessage {
+export function parseRouteMessage(r: Buffer, lazy?: boolean): RouteMessage {
     if (r.length < rt.__LENGTH_Route)
         throw Error(`Unexpected Route message length (${r.length})`)
     const data = rt.parseRoute(r.subarray(0, rt.__LENGTH_Route))
-    const attrs = rt.parseRouteAttrs(r.subarray(rt.__LENGTH_Route))
+    const attrs = (lazy ? rt.parseRouteAttrsLazy : rt.parseRouteAttrs)(r.subarray(rt.__LENGTH_Route))
     return { kind: 'route', data, attrs }
 }
 
@@ -155,11 +156,11 @@ export interface RuleMessage {
     attrs: rt.RuleAttrs
 }
 
-export function parseRuleMessage(r: Buffer): RuleMessage {
+export function parseRuleMessage(r: Buffer, lazy?: boolean): RuleMessage {
     if (r.length < rt.__LENGTH_Rule)
         throw Error(`Unexpected Rule message length (${r.length})`)
     const data = rt.parseRule(r.subarray(0, rt.__LENGTH_Rule))
-    const attrs = rt.parseRuleAttrs(r.subarray(rt.__LENGTH_Rule))
+    const attrs = (lazy ? rt.parseRuleAttrsLazy : rt.parseRuleAttrs)(r.subarray(rt.__LENGTH_Rule))
     return { kind: 'rule', data, attrs }
 }
 
@@ -174,11 +175,11 @@ export interface NextHopMessage {
     attrs: rt.NextHopAttrs
 }
 
-export function parseNextHopMessage(r: Buffer): NextHopMessage {
+export function parseNextHopMessage(r: Buffer, lazy?: boolean): NextHopMessage {
     if (r.length < rt.__LENGTH_NextHop)
         throw Error(`Unexpected NextHop message length (${r.length})`)
     const data = rt.parseNextHop(r.subarray(0, rt.__LENGTH_NextHop))
-    const attrs = rt.parseNextHopAttrs(r.subarray(rt.__LENGTH_NextHop))
+    const attrs = (lazy ? rt.parseNextHopAttrsLazy : rt.parseNextHopAttrs)(r.subarray(rt.__LENGTH_NextHop))
     return { kind: 'nexthop', data, attrs }
 }
 
@@ -193,11 +194,11 @@ export interface TcMessage {
     attrs: rt.TcAttrs
 }
 
-export function parseTcMessage(r: Buffer): TcMessage {
+export function parseTcMessage(r: Buffer, lazy?: boolean): TcMessage {
     if (r.length < rt.__LENGTH_Tc)
         throw Error(`Unexpected Tc message length (${r.length})`)
     const data = rt.parseTc(r.subarray(0, rt.__LENGTH_Tc))
-    const attrs = rt.parseTcAttrs(r.subarray(rt.__LENGTH_Tc))
+    const attrs = (lazy ? rt.parseTcAttrsLazy : rt.parseTcAttrs)(r.subarray(rt.__LENGTH_Tc))
     return { kind: 'tc', data, attrs }
 }
 
@@ -222,7 +223,7 @@ export function formatTcActionMessage(x: TcActionMessage, out: AttrStream) {
     out.emit(rt.formatTcAction(x.data))
 }
 
-const parseFns: { [t in MessageType]?: (r: Buffer) => Message } = {
+const parseFns: { [t in MessageType]?: (r: Buffer, lazy?: boolean) => Message } = {
     [MessageType.NEWLINK]: parseLinkMessage,
     [MessageType.DELLINK]: parseLinkMessage,
     [MessageType.GETLINK]: parseLinkMessage,
@@ -264,10 +265,75 @@ const parseFns: { [t in MessageType]?: (r: Buffer) => Message } = {
     [MessageType.GETNEXTHOPBUCKET]: parseNextHopMessage,
 }
 
-export function parseMessage(t: MessageType, r: Buffer): Message {
+/**
+ * Parses an rtnetlink message of the given type.
+ *
+ * @param lazy Decode attributes when first read (see {@link getLazyObject})
+ */
+export function parseMessage(t: MessageType, r: Buffer, lazy?: boolean): Message {
     if (!{}.hasOwnProperty.call(parseFns, t))
         throw Error(`Unsupported message type ${t}`)
-    return parseFns[t]!(r)
+    return parseFns[t]!(r, lazy)
+}
+
+// Socket filter rules (see compileFilter)
+
+export interface FilterRuleOptions {
+    /** Attribute types that must be present */
+    attributes?: number[]
+}
+
+/**
+ * Rule accepting link notifications (NEWLINK / DELLINK),
+ * optionally only for some interfaces (`ifi_index`)
+ */
+export function linkFilterRule(index?: number | number[], options?: FilterRuleOptions): FilterRule {
+    return {
+        type: [ MessageType.NEWLINK, MessageType.DELLINK ],
+        headerLength: rt.__LENGTH_Link,
+        fields: typeof index !== 'undefined' ? [{ offset: 4, size: 4, equals: index }] : [],
+        ...options,
+    }
+}
+
+/**
+ * Rule accepting address notifications (NEWADDR / DELADDR),
+ * optionally only for some interfaces (`ifa_index`)
+ */
+export function addressFilterRule(index?: number | number[], options?: FilterRuleOptions): FilterRule {
+    return {
+        type: [ MessageType.NEWADDR, MessageType.DELADDR ],
+        headerLength: rt.__LENGTH_Address,
+        fields: typeof index !== 'undefined' ? [{ offset: 4, size: 4, equals: index }] : [],
+        ...options,
+    }
+}
+
+/**
+ * Rule accepting neighbor notifications (NEWNEIGH / DELNEIGH),
+ * optionally only for some interfaces (`ndm_ifindex`)
+ */
+export function neighborFilterRule(ifindex?: number | number[], options?: FilterRuleOptions): FilterRule {
+    return {
+        type: [ MessageType.NEWNEIGH, MessageType.DELNEIGH ],
+        headerLength: rt.__LENGTH_Neighbor,
+        fields: typeof ifindex !== 'undefined' ? [{ offset: 4, size: 4, equals: ifindex }] : [],
+        ...options,
+    }
+}
+
+/**
+ * Rule accepting route notifications (NEWROUTE / DELROUTE),
+ * optionally only for some tables (`rtm_table`). Note that
+ * table IDs above 255 are signalled through the TABLE attribute.
+ */
+export function routeFilterRule(table?: number | number[], options?: FilterRuleOptions): FilterRule {
+    return {
+        type: [ MessageType.NEWROUTE, MessageType.DELROUTE ],
+        headerLength: rt.__LENGTH_Route,
+        fields: typeof table !== 'undefined' ? [{ offset: 4, size: 1, equals: table }] : [],
+        ...options,
+    }
 }
 
 // Export rest of types
@@ -10,6 +10,7 @@
  */
 
 import { endianness } from 'os'
+import { FlagsAck, ExtAckAttributes } from './constants'
 
 // Buffer read functions from host order
 
@@ -164,6 +165,20 @@ export function formatMessage(x: NetlinkMessage_): Uint8Array[] {
     return [header as Uint8Array].concat(data)
 }
 
+/**
+ * Like {@link formatMessage}, but serializes the message into a
+ * single buffer (see {@link serialize}).
+ */
+export function serializeMessage(x: Omit<NetlinkMessage_, 'data'> & { data: StreamData }, target?: Buffer): Buffer {
+    const r = serialize(x.data, target, HEADER_LENGTH)
+    writeU32.call(r, r.length, 0)
+    writeU16.call(r, x.type, 4)
+    writeU16.call(r, x.flags, 6)
+    writeU32.call(r, x.seq, 8)
+    writeU32.call(r, x.port, 12)
+    return r
+}
+
 export function parseMessage(r: Buffer): ParseResult<NetlinkMessage> {
     const { length, type, flags, seq, port } = parseHeader(r).x
     if (length < HEADER_LENGTH || r.length < length)
@@ -193,27 +208,127 @@ export function parseMessages(r: Buffer): NetlinkMessage[] {
 }
 
 
+/** Number of entries per message in a framing index */
+export const INDEX_ENTRY_SIZE = 6
+
+/**
+ * Builds message objects from a framing index, as produced by the
+ * native binding after validating a datagram: an entry of
+ * (offset, length, type, flags, seq, port) per message, with offsets
+ * relative to `r`. The result is the same as calling
+ * {@link parseMessages} on the datagram, without decoding headers.
+ *
+ * @param r Data the index refers to
+ * @param index Framing index
+ * @returns Array of messages
+ */
+export function parseIndexedMessages(r: Buffer, index: Uint32Array): NetlinkMessage[] {
+    const x: NetlinkMessage[] = new Array(index.length / INDEX_ENTRY_SIZE)
+    for (let i = 0, n = 0; i < index.length; i += INDEX_ENTRY_SIZE, n++) {
+        const offset = index[i]
+        x[n] = {
+            type: index[i + 2],
+            flags: index[i + 3],
+            seq: index[i + 4],
+            port: index[i + 5],
+            data: r.subarray(offset + HEADER_LENGTH, offset + index[i + 1]),
+        }
+    }
+    return x
+}
+
+
 // ERROR MESSAGE
 // -------------
 
 export interface NetlinkErrorMessage {
     errno: number
     code?: string
+    /** Header of the original request */
     header: NetlinkHeader
+    /** Payload of the original request (unless the ACK was capped) */
+    payload?: Buffer
+    /** Extended ACK TLVs, if present */
     tlvData?: Buffer
+    /** Extended ACK error message */
+    message?: string
+    /** Offset of the offending attribute, within the original request */
+    offset?: number
+    /** Subsystem specific cookie */
+    cookie?: Buffer
+    /** Policy of the rejected attribute (nested attributes) */
+    policy?: Buffer
+    /** Type of a missing required attribute */
+    missingType?: number
+    /** Offset of the nest where the attribute was missing */
+    missingNest?: number
 }
 
+/**
+ * Parses the payload of an ERROR message (which is an ACK if
+ * `errno` is zero). Depending on the flags, the ERROR message
+ * contains only the header of the original request
+ * ({@link FlagsAck.CAPPED}) and is followed by extended
+ * ACK attributes ({@link FlagsAck.ACK_TLVS}).
+ */
 export function parseError(r: Buffer, flags: number): NetlinkErrorMessage {
     if (r.length < 4 + 16)
         throw Error('Invalid ERROR message length')
+    const header = parseHeader(r.subarray(4)).x
     let x: NetlinkErrorMessage = {
         errno: readS32.call(r, 0),
-        header: parseHeader(r.subarray(4)).x,
+        header,
     }
-    // FIXME: TLV?
+    // kernels before 4.12 only echo the header of successful requests,
+    // without setting CAPPED, so a short echo is taken as capped too
+    const capped = (flags & FlagsAck.CAPPED) || header.length < HEADER_LENGTH || r.length - 4 < header.length
+    const echoed = capped ? HEADER_LENGTH : header.length
+    if (!capped)
+        x.payload = r.subarray(4 + HEADER_LENGTH, 4 + echoed)
+    if (!(flags & FlagsAck.ACK_TLVS))
+        return x
+
+    parseExtAck(x, r.subarray(Math.min(4 + align(echoed), r.length)))
     return x
 }
 
+/**
+ * Parses the payload of a DONE message terminating a dump, which
+ * carries the dump's error code (and extended ACK attributes, if
+ * {@link FlagsAck.ACK_TLVS} is set). Returns undefined if there's
+ * no error.
+ */
+export function parseDoneError(msg: NetlinkMessage): NetlinkErrorMessage | undefined {
+    const r = msg.data
+    if (r.length < 4 || readS32.call(r, 0) >= 0) return
+    const { type, flags, seq, port } = msg
+    const x: NetlinkErrorMessage = {
+        errno: readS32.call(r, 0),
+        header: { length: HEADER_LENGTH + r.length, type, flags, seq, port },
+    }
+    if (flags & FlagsAck.ACK_TLVS)
+        parseExtAck(x, r.subarray(4))
+    return x
+}
+
+function parseExtAck(x: NetlinkErrorMessage, tlvData: Buffer) {
+    x.tlvData = tlvData
+    parseAttributes(tlvData, ({ type, data }) => {
+        if (type === ExtAckAttributes.MSG)
+            x.message = data.toString('utf8').replace(/\0+$/, '')
+        else if (type === ExtAckAttributes.OFFS && data.length === 4)
+            x.offset = readU32.call(data, 0)
+        else if (type === ExtAckAttributes.COOKIE)
+            x.cookie = data
+        else if (type === ExtAckAttributes.POLICY)
+            x.policy = data
+        else if (type === ExtAckAttributes.MISS_TYPE && data.length === 4)
+            x.missingType = readU32.call(data, 0)
+        else if (type === ExtAckAttributes.MISS_NEST && data.length === 4)
+            x.missingNest = readU32.call(data, 0)
+    })
+}
+
 
 // ATTRIBUTE
 // ---------
@@ -237,14 +352,40 @@ export interface NetlinkAttribute extends NetlinkAttribute_ {
 
 /**
  * Object allowing efficient construction of an attribute stream.
+ *
+ * By default, the stream is collected into a list of buffers
+ * (`bufs`). {@link serialize} instead runs the formatting code
+ * twice over a stream: once to measure it, and once to write it
+ * in place into a single buffer. The `push*` methods encode
+ * scalars directly (without allocating in the latter case), and
+ * should be preferred over `push(type, putXXX(value))`.
  */
 export type StreamData = Uint8Array | Uint8Array[] | ((out: AttrStream) => any)
 export class AttrStream {
     readonly bufs: Uint8Array[] = []
     private offset: number = 0
+    /**
+     * If undefined, data is collected into `bufs`. If null, data
+     * is only measured. Otherwise, data is written here.
+     */
+    private readonly target?: Buffer | null
+
+    /** @param target See {@link serialize}, leave unset to collect the data into `bufs` */
+    constructor(target?: Buffer | null) {
+        this.target = target
+    }
+
+    /** Amount of data emitted so far */
+    get length() {
+        return this.offset
+    }
+
     emit(data: StreamData) {
         if (data instanceof Uint8Array) {
-            this.bufs.push(data)
+            if (this.target === undefined)
+                this.bufs.push(data)
+            else if (this.target)
+                this.target.set(data, this.offset)
             this.offset += data.length
         } else if (data instanceof Array) {
             data.forEach(x => this.emit(x))
@@ -252,26 +393,107 @@ export class AttrStream {
             data(this)
         }
     }
-    push(type: number, data: StreamData) {
-        // Emit padding (make sure to start on aligned offset)
+
+    /** Emit padding (make sure to start on aligned offset) */
+    private pad() {
         const p = padding(this.offset)
-        if (p) this.emit(Buffer.alloc(p))
+        if (!p) return
+        if (this.target === undefined)
+            this.bufs.push(Buffer.alloc(p))
+        else if (this.target)
+            this.target.fill(0, this.offset, this.offset + p)
+        this.offset += p
+    }
+
+    push(type: number, data: StreamData) {
+        this.pad()
 
         // Emit header and data
         const start = this.offset
-        const header = Buffer.alloc(4)
-        writeU16.call(header, (type & ((1 << 14) - 1)), 2)
-        this.emit(header)
+        let header: Buffer | undefined
+        if (this.target === undefined) {
+            header = Buffer.alloc(4)
+            writeU16.call(header, (type & ((1 << 14) - 1)), 2)
+            this.emit(header)
+        } else {
+            if (this.target)
+                writeU16.call(this.target, (type & ((1 << 14) - 1)), start + 2)
+            this.offset += 4
+        }
         this.emit(data)
 
         // Patch length in header
         const length = this.offset - start
         if (length >= 0x10000)
             throw Error(`Maximum attribute length exceeded (${length})`)
-        writeU16.call(header, length, 0)
+        if (header)
+            writeU16.call(header, length, 0)
+        else if (this.target)
+            writeU16.call(this.target, length, start)
+    }
+
+    /** Emits an attribute with a fixed-size value, written by `write` */
+    private pushValue<T>(type: number, size: number, write: (this: Buffer, value: T, offset: number) => number, value: T) {
+        this.pad()
+        let r = this.target, offset = this.offset
+        if (r === undefined) {
+            r = Buffer.alloc(4 + size)
+            offset = 0
+            this.bufs.push(r)
+        }
+        if (r) {
+            writeU16.call(r, 4 + size, offset)
+            writeU16.call(r, (type & ((1 << 14) - 1)), offset + 2)
+            write.call(r, value, offset + 4)
+        }
+        this.offset += 4 + size
+    }
+
+    pushU8(type: number, x: number) { this.pushValue(type, 1, writeU8, x) }
+    pushU16(type: number, x: number) { this.pushValue(type, 2, writeU16, x) }
+    pushU32(type: number, x: number) { this.pushValue(type, 4, writeU32, x) }
+    pushU64(type: number, x: bigint) { this.pushValue(type, 8, writeU64, x) }
+    pushS8(type: number, x: number) { this.pushValue(type, 1, writeS8, x) }
+    pushS16(type: number, x: number) { this.pushValue(type, 2, writeS16, x) }
+    pushS32(type: number, x: number) { this.pushValue(type, 4, writeS32, x) }
+    pushS64(type: number, x: bigint) { this.pushValue(type, 8, writeS64, x) }
+    pushU16be(type: number, x: number) { this.pushValue(type, 2, writeU16be, x) }
+    pushU32be(type: number, x: number) { this.pushValue(type, 4, writeU32be, x) }
+    pushBool(type: number, x: boolean) { this.pushValue(type, 1, writeU8, Number(x)) }
+    pushFlag(type: number, x: true) { this.pushValue(type, 0, () => 0, x) }
+
+    /** Like `push(type, putString(x))` */
+    pushString(type: number, x: string) {
+        this.pushValue(type, Buffer.byteLength(x) + 1, function (value, offset) {
+            return this.writeUInt8(0, offset + this.write(value, offset))
+        }, x)
     }
 }
 
+/**
+ * Serializes a stream into a single buffer, in two passes: the
+ * first one computes the length, and the second writes the data
+ * in place.
+ *
+ * @param data Data to serialize
+ * @param target Buffer to write into, if it's big enough (a new
+ * one is allocated otherwise)
+ * @param offset Where to start writing in the result; the bytes
+ * before it are left for the caller to fill (i.e. a header)
+ * @returns Slice of `target` (or the new buffer) holding the data
+ */
+export function serialize(data: StreamData, target?: Buffer, offset: number = 0): Buffer {
+    const sizing = new AttrStream(null)
+    sizing.emit(data)
+    const length = offset + sizing.length
+    const r = (target && target.length >= length) ? target.subarray(0, length) : Buffer.allocUnsafe(length)
+    const stream = new AttrStream(r.subarray(offset))
+    stream.emit(data)
+    if (stream.length !== sizing.length)
+        throw Error('Stream length changed between passes')
+    return r
+}
+
 export function formatAttribute(x: NetlinkAttribute_): Uint8Array[] {
     const data = ensureArray(x.data)
     const header = Buffer.alloc(4)
@@ -455,19 +677,92 @@ export function getObject<T extends BaseObject>(
         if ({}.hasOwnProperty.call(fns, item.type)) {
             fns[item.type](checkNO(item).data, obj)
         } else {
-            obj.__unparsed?.push([ item.type, checkNO(item).data ])
+            unparsed.push([ item.type, checkNO(item).data ])
+        }
+    })
+    if (unparsed.length)
+        obj.__unparsed = unparsed
+    return obj
+}
+
+/**
+ * Lazy decoders for the attributes of an object, by attribute type:
+ * field name, decoder and whether the attribute is repeated.
+ */
+export type LazyFields = { [key: number]: [string, (data: Buffer) => any, boolean?] }
+
+function setField(obj: any, name: string, value: any) {
+    Object.defineProperty(obj, name, { value, writable: true, enumerable: true, configurable: true })
+}
+
+function defineLazyField(obj: any, name: string, decode: () => any) {
+    Object.defineProperty(obj, name, {
+        enumerable: true,
+        configurable: true,
+        get() {
+            const value = decode()
+            setField(obj, name, value)
+            return value
+        },
+        set(value) {
+            setField(obj, name, value)
+        },
+    })
+}
+
+/**
+ * Like {@link getObject}, but only indexes the attributes: the
+ * fields are defined as (enumerable, own) getters that decode the
+ * attribute when first read, and then replace themselves with the
+ * decoded value. Decoding errors are thrown when reading the field
+ * rather than when parsing. The object keeps a reference to `x`.
+ */
+export function getLazyObject<T extends BaseObject>(x: Buffer, fields: LazyFields): T {
+    let obj: T = {} as T
+    let unparsed: BaseObject['__unparsed'] = []
+    let repeated: Map<string, Buffer[]> | undefined
+    parseAttributes(x, item => {
+        if (!{}.hasOwnProperty.call(fields, item.type)) {
+            unparsed.push([ item.type, checkNO(item).data ])
+            return
         }
+        const [ name, decode, isRepeated ] = fields[item.type]
+        const data = checkNO(item).data
+        if (!isRepeated)
+            return defineLazyField(obj, name, () => decode(data))
+        repeated = repeated || new Map()
+        const items = repeated.get(name)
+        if (items)
+            return items.push(data)
+        const newItems = [ data ]
+        repeated.set(name, newItems)
+        defineLazyField(obj, name, () => newItems.map(decode))
     })
     if (unparsed.length)
         obj.__unparsed = unparsed
     return obj
 }
+
+/**
+ * Decodes all pending fields of an object returned by a lazy parser
+ * (see {@link getLazyObject}), recursively, turning it into a plain
+ * object. Plain objects are left untouched.
+ *
+ * @returns The same object
+ */
+export function materialize<T>(x: T): T {
+    if (x instanceof Array || x instanceof Map)
+        (x as any).forEach((v: any) => materialize(v))
+    else if (x && typeof x === 'object' && !ArrayBuffer.isView(x))
+        Object.keys(x).forEach(key => materialize((x as any)[key]))
+    return x
+}
 export function putObject<T extends BaseObject>(
     x: T, fns: { [key: string]: (data: AttrStream, obj: T) => any }
 ): StreamData {
     return out => {
         Object.keys(x).forEach(key => {
-            if (typeof (x as any)[key] === 'undefined') return
+            if (key === '__unparsed' || typeof (x as any)[key] === 'undefined') return
             if ({}.hasOwnProperty.call(fns, key)) {
                 fns[key](out, x)
             } else {
@@ -0,0 +1,381 @@
+/**
+ * Polls the peer counters of a WireGuard device, reporting only
+ * the peers that changed since the previous poll.
+ * @module
+ */
+
+import { EventEmitter } from 'events'
+import { endianness } from 'os'
+import { performance } from 'perf_hooks'
+
+import { DumpOptions } from '../netlink'
+import { Flags } from '../constants'
+import { readU16, readU32, align } from '../structs'
+import { WireGuardSocket, WireGuardSendOptions, WG_KEY_LEN } from './wg'
+
+// Attribute types (see ./structs)
+const WGDEVICE_A_PEERS = 8
+const WGPEER_A_PUBLIC_KEY = 1
+const WGPEER_A_ENDPOINT = 4
+const WGPEER_A_LAST_HANDSHAKE_TIME = 6
+const WGPEER_A_RX_BYTES = 7
+const WGPEER_A_TX_BYTES = 8
+
+const ATTR_TYPE_MASK = (1 << 14) - 1
+/** Size of the largest endpoint (struct sockaddr_in6) */
+const MAX_ENDPOINT = 28
+/** Size of struct __kernel_timespec */
+const TIMESPEC_SIZE = 16
+
+// 64-bit integers are read as two halves, without going through a bigint
+const [ LO, HI ] = endianness() === 'LE' ? [0, 4] : [4, 0]
+const readU64Number = (data: Buffer, offset: number) =>
+    readU32.call(data, offset + LO) + readU32.call(data, offset + HI) * 2 ** 32
+const readS64Number = (data: Buffer, offset: number) =>
+    readU32.call(data, offset + LO) + (readU32.call(data, offset + HI) | 0) * 2 ** 32
+
+export interface PeerStatsPollerOptions {
+    /**
+     * If set, poll every this many milliseconds and emit the
+     * results as `poll` events (default: only poll when asked)
+     */
+    interval?: number
+    /** Options for the dump requests */
+    dumpOptions?: WireGuardSendOptions & DumpOptions
+}
+
+/** Counters of a peer that changed (or appeared) since the previous poll */
+export interface PeerStats {
+    /** Public key, base64 encoded */
+    publicKey: string
+    /** Counters, as numbers (exact up to 2^53) */
+    rxBytes: number
+    txBytes: number
+    /** Bytes received / sent since the previous poll (all of them for new or reset peers) */
+    rxDelta: number
+    txDelta: number
+    /** Time of the last handshake in ms since the epoch, or 0 if there was none */
+    lastHandshake: number
+    /** struct sockaddr_in or struct sockaddr_in6, if known */
+    endpoint?: Buffer
+    /** True if the peer wasn't present in the previous poll */
+    added: boolean
+}
+
+/** Cost of a poll */
+export interface PollReport {
+    /** Total duration in ms, including the wait for the kernel */
+    duration: number
+    /** Time spent decoding and diffing the replies, in ms */
+    decodeTime: number
+    messages: number
+    bytes: number
+    peers: number
+    changed: number
+    removed: number
+    /**
+     * True if the device changed during the dump (`DUMP_INTR`).
+     * Some peers may be missing, so removals aren't reported.
+     */
+    interrupted: boolean
+}
+
+export interface PeerStatsDelta {
+    /** Peers whose counters, handshake or endpoint changed, in dump order */
+    changed: PeerStats[]
+    /** Public keys (base64) of the peers that are gone */
+    removed: string[]
+    report: PollReport
+}
+
+interface EventMap {
+    /** Emitted after each poll started by `interval` */
+    poll(delta: PeerStatsDelta): void
+    /** Emitted when a poll started by `interval` fails */
+    error(err: Error): void
+}
+
+/** State of a poll in progress, committed once the dump completes */
+interface PollContext {
+    /** Slots in dump order */
+    order: number[]
+    changed: PeerStats[]
+    /** Slot of each entry of `changed` */
+    changedSlots: number[]
+    /** Slots allocated during this poll, freed if it fails */
+    added: number[]
+}
+
+/**
+ * Polls the peers of a WireGuard device, and reports the ones whose
+ * counters, last handshake or endpoint changed since the previous
+ * poll, along with the ones that are gone.
+ *
+ * Every poll still dumps the whole device, but only the public key,
+ * endpoint, last handshake and counters of each peer are decoded,
+ * straight from the replies (keys, allowed IPs and the rest are
+ * skipped). The previous values are kept in typed arrays, in a slot
+ * per peer. Since the kernel lists peers in a stable order, peers
+ * are matched to their slot by comparing the key with the one at the
+ * same position in the previous poll, and only looked up by key
+ * when that fails.
+ */
+export class PeerStatsPoller extends EventEmitter {
+    // copy-pasted code for type-safe events
+    emit<E extends keyof EventMap>(event: E, ...args: Parameters<EventMap[E]>) { return super.emit(event, ...args) }
+    on<E extends keyof EventMap>(event: E, listener: EventMap[E]) { return super.on(event, listener) }
+    once<E extends keyof EventMap>(event: E, listener: EventMap[E]) { return super.once(event, listener) }
+    off<E extends keyof EventMap>(event: E, listener: EventMap[E]) { return super.off(event, listener) }
+    addListener<E extends keyof EventMap>(event: E, listener: EventMap[E]) { return super.addListener(event, listener) }
+    removeListener<E extends keyof EventMap>(event: E, listener: EventMap[E]) { return super.removeListener(event, listener) }
+
+    readonly socket: WireGuardSocket
+    readonly iface: number | string
+    private readonly dumpOptions?: WireGuardSendOptions & DumpOptions
+
+    /** Slots by public key (base64) */
+    private slots: Map<string, number> = new Map()
+    private freeSlots: number[] = []
+    private capacity = 0
+    private keys = Buffer.alloc(0)
+    private rx = new Float64Array(0)
+    private tx = new Float64Array(0)
+    private handshake = new Float64Array(0)
+    private endpoints = Buffer.alloc(0)
+    private endpointLengths = new Uint8Array(0)
+    /** Whether each slot holds a peer */
+    private used = new Uint8Array(0)
+    /** Slots in dump order, as of the previous poll */
+    private order: number[] = []
+
+    private polling?: Promise<PeerStatsDelta>
+    private timer?: NodeJS.Timeout
+
+    /**
+     * @param socket WireGuard socket (it isn't closed by {@link stop})
+     * @param iface Device index or name
+     * @param options Options
+     */
+    constructor(socket: WireGuardSocket, iface: number | string, options?: PeerStatsPollerOptions) {
+        super()
+        this.socket = socket
+        this.iface = iface
+        this.dumpOptions = options && options.dumpOptions
+        const interval = options && options.interval
+        if (interval) {
+            this.timer = setInterval(() => {
+                this.poll().then(delta => this.emit('poll', delta), error => this.emit('error', error))
+            }, interval)
+            this.timer.unref()
+        }
+    }
+
+    /** Stops polling periodically */
+    stop() {
+        if (typeof this.timer !== 'undefined')
+            clearInterval(this.timer)
+        this.timer = undefined
+    }
+
+    /** Number of peers seen in the last poll */
+    get size() {
+        return this.slots.size
+    }
+
+    /**
+     * Dumps the device and returns the changes since the previous
+     * poll (in the first poll, every peer is reported as added).
+     * If a poll is already in progress, waits for it instead. If
+     * the poll fails, the state is left as it was.
+     */
+    poll(): Promise<PeerStatsDelta> {
+        if (!this.polling)
+            this.polling = this._poll().finally(() => this.polling = undefined)
+        return this.polling
+    }
+
+    private async _poll(): Promise<PeerStatsDelta> {
+        const start = performance.now()
+        const ctx: PollContext = { order: [], changed: [], changedSlots: [], added: [] }
+        let decodeTime = 0, messages = 0, bytes = 0, interrupted = false
+        try {
+            for await (const [msgs] of this.socket.dumpDevice(this.iface, this.dumpOptions)) {
+                const t = performance.now()
+                for (const msg of msgs) {
+                    messages++
+                    bytes += msg.data.length
+                    if (msg.flags & Flags.DUMP_INTR)
+                        interrupted = true
+                    this.decodeDevice(msg.data, ctx)
+                }
+                decodeTime += performance.now() - t
+            }
+        } catch (e) {
+            ctx.added.forEach(slot => this.release(slot))
+            throw e
+        }
+
+        const t = performance.now()
+        const removed = this.commit(ctx, !interrupted)
+        decodeTime += performance.now() - t
+        return {
+            changed: ctx.changed,
+            removed,
+            report: {
+                duration: performance.now() - start,
+                decodeTime, messages, bytes,
+                peers: ctx.order.length,
+                changed: ctx.changed.length,
+                removed: removed.length,
+                interrupted,
+            },
+        }
+    }
+
+    /** Walks the attributes of a GET_DEVICE reply, decoding its peers */
+    private decodeDevice(data: Buffer, ctx: PollContext) {
+        forEachAttribute(data, 0, data.length, (type, start, end) => {
+            if (type === WGDEVICE_A_PEERS)
+                forEachAttribute(data, start, end, (_, pstart, pend) => this.decodePeer(data, pstart, pend, ctx))
+        })
+    }
+
+    private decodePeer(data: Buffer, start: number, end: number, ctx: PollContext) {
+        let key = -1, endpoint = -1, endpointLength = 0, handshake = -1, rx = -1, tx = -1
+        forEachAttribute(data, start, end, (type, vstart, vend) => {
+            const size = vend - vstart
+            if (type === WGPEER_A_PUBLIC_KEY && size === WG_KEY_LEN)
+                key = vstart
+            else if (type === WGPEER_A_ENDPOINT && size <= MAX_ENDPOINT)
+                (endpoint = vstart, endpointLength = size)
+            else if (type === WGPEER_A_LAST_HANDSHAKE_TIME && size === TIMESPEC_SIZE)
+                handshake = vstart
+            else if (type === WGPEER_A_RX_BYTES && size === 8)
+                rx = vstart
+            else if (type === WGPEER_A_TX_BYTES && size === 8)
+                tx = vstart
+        })
+        // peers with many allowed IPs continue in the next message,
+        // repeating only the public key
+        if (key < 0 || rx < 0 || tx < 0) return
+
+        let added = false
+        let slot: number | undefined = this.order[ctx.order.length]
+        if (!(typeof slot === 'number' && this.used[slot] &&
+                data.compare(this.keys, slot * WG_KEY_LEN, (slot + 1) * WG_KEY_LEN, key, key + WG_KEY_LEN) === 0)) {
+            const name = data.toString('base64', key, key + WG_KEY_LEN)
+            slot = this.slots.get(name)
+            if (typeof slot === 'undefined') {
+                slot = this.allocate(name, data, key)
+                ctx.added.push(slot)
+                added = true
+            }
+        }
+        ctx.order.push(slot)
+
+        const rxBytes = readU64Number(data, rx)
+        const txBytes = readU64Number(data, tx)
+        const lastHandshake = handshake < 0 ? 0 :
+            readS64Number(data, handshake) * 1000 + readS64Number(data, handshake + 8) / 1e6
+        const endpointChanged = endpointLength !== this.endpointLengths[slot] || (endpointLength > 0 &&
+            data.compare(this.endpoints, slot * MAX_ENDPOINT, slot * MAX_ENDPOINT + endpointLength, endpoint, endpoint + endpointLength) !== 0)
+        if (!(added || endpointChanged || rxBytes !== this.rx[slot] ||
+                txBytes !== this.tx[slot] || lastHandshake !== this.handshake[slot]))
+            return
+
+        // counters going backwards means the peer was recreated
+        const rxPrev = added ? 0 : this.rx[slot], txPrev = added ? 0 : this.tx[slot]
+        ctx.changed.push({
+            publicKey: this.keys.toString('base64', slot * WG_KEY_LEN, (slot + 1) * WG_KEY_LEN),
+            rxBytes, txBytes,
+            rxDelta: rxBytes >= rxPrev ? rxBytes - rxPrev : rxBytes,
+            txDelta: txBytes >= txPrev ? txBytes - txPrev : txBytes,
+            lastHandshake,
+            endpoint: endpointLength ? Buffer.from(data.subarray(endpoint, endpoint + endpointLength)) : undefined,
+            added,
+        })
+        ctx.changedSlots.push(slot)
+    }
+
+    /**
+     * Stores the values of a completed poll and, if `prune` is set,
+     * frees the slots of peers that are gone and returns their keys
+     */
+    private commit(ctx: PollContext, prune: boolean): string[] {
+        this.order = ctx.order
+        ctx.changed.forEach((x, i) => {
+            const slot = ctx.changedSlots[i]
+            this.rx[slot] = x.rxBytes
+            this.tx[slot] = x.txBytes
+            this.handshake[slot] = x.lastHandshake
+            this.endpointLengths[slot] = x.endpoint ? x.endpoint.length : 0
+            if (x.endpoint)
+                x.endpoint.copy(this.endpoints, slot * MAX_ENDPOINT)
+        })
+
+        if (!prune) return []
+        const seen = new Uint8Array(this.capacity)
+        ctx.order.forEach(slot => seen[slot] = 1)
+        const removed: string[] = []
+        for (let slot = 0; slot < this.capacity; slot++) {
+            if (this.used[slot] && !seen[slot]) {
+                removed.push(this.keys.toString('base64', slot * WG_KEY_LEN, (slot + 1) * WG_KEY_LEN))
+                this.release(slot)
+            }
+        }
+        return removed
+    }
+
+    private allocate(name: string, data: Buffer, key: number): number {
+        if (!this.freeSlots.length)
+            this.grow(Math.max(this.capacity * 2, 64))
+        const slot = this.freeSlots.pop()!
+        data.copy(this.keys, slot * WG_KEY_LEN, key, key + WG_KEY_LEN)
+        this.rx[slot] = this.tx[slot] = this.handshake[slot] = 0
+        this.endpointLengths[slot] = 0
+        this.used[slot] = 1
+        this.slots.set(name, slot)
+        return slot
+    }
+
+    private release(slot: number) {
+        this.slots.delete(this.keys.toString('base64', slot * WG_KEY_LEN, (slot + 1) * WG_KEY_LEN))
+        this.used[slot] = 0
+        this.freeSlots.push(slot)
+    }
+
+    private grow(capacity: number) {
+        const resize = <T extends Uint8Array | Float64Array>(old: T, create: (n: number) => T, size: number = 1) => {
+            const x = create(capacity * size)
+            x.set(old)
+            return x
+        }
+        this.keys = resize(this.keys, n => Buffer.alloc(n), WG_KEY_LEN)
+        this.endpoints = resize(this.endpoints, n => Buffer.alloc(n), MAX_ENDPOINT)
+        this.rx = resize(this.rx, n => new Float64Array(n))
+        this.tx = resize(this.tx, n => new Float64Array(n))
+        this.handshake = resize(this.handshake, n => new Float64Array(n))
+        this.endpointLengths = resize(this.endpointLengths, n => new Uint8Array(n))
+        this.used = resize(this.used, n => new Uint8Array(n))
+        // hand out lower slots first
+        for (let slot = capacity - 1; slot >= this.capacity; slot--)
+            this.freeSlots.push(slot)
+        this.capacity = capacity
+    }
+}
+
+/**
+ * Calls `fn` with the type (without flags) and value bounds of each
+ * attribute in `data[start, end)`, without slicing it
+ */
+function forEachAttribute(data: Buffer, start: number, end: number, fn: (type: number, start: number, end: number) => void) {
+    for (let offset = start; offset < end; ) {
+        if (end - offset < 4)
+            throw Error('Not enough data')
+        const length = readU16.call(data, offset)
+        if (length < 4 || offset + length > end)
+            throw Error(`Invalid attribute length (${length})`)
+        fn(readU16.call(data, offset + 2) & ATTR_TYPE_MASK, offset + 4, offset + length)
+        offset += align(length)
+    }
+}
@@ -70,16 +70,33 @@ export function parseDevice(r: Buffer): Device {
     })
 }
 
+/** Decoders of the attributes of a {@link Device} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Device: structs.LazyFields = {
+    1: ['ifindex', data => structs.getU32(data)],
+    2: ['ifname', data => structs.getString(data)],
+    3: ['privateKey', data => data],
+    4: ['publicKey', data => data],
+    5: ['flags', data => parseDeviceFlags(structs.getU32(data))],
+    6: ['listenPort', data => structs.getU16(data)],
+    7: ['fwmark', data => structs.getU32(data)],
+    8: ['peers', data => structs.getArray(data, x => parsePeerLazy(x))],
+}
+
+/** Like {@link parseDevice}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseDeviceLazy(r: Buffer): Device {
+    return structs.getLazyObject(r, __LAZY_Device)
+}
+
 /** Encodes a {@link Device} object into a stream of attributes */
 export function formatDevice(x: Device): StreamData {
     return structs.putObject(x, {
-        ifindex: (data, obj) => data.push(1, structs.putU32(obj.ifindex!)),
-        ifname: (data, obj) => data.push(2, structs.putString(obj.ifname!)),
+        ifindex: (data, obj) => data.pushU32(1, obj.ifindex!),
+        ifname: (data, obj) => data.pushString(2, obj.ifname!),
         privateKey: (data, obj) => data.push(3, obj.privateKey!),
         publicKey: (data, obj) => data.push(4, obj.publicKey!),
-        flags: (data, obj) => data.push(5, structs.putU32(formatDeviceFlags(obj.flags!))),
-        listenPort: (data, obj) => data.push(6, structs.putU16(obj.listenPort!)),
-        fwmark: (data, obj) => data.push(7, structs.putU32(obj.fwmark!)),
+        flags: (data, obj) => data.pushU32(5, formatDeviceFlags(obj.flags!)),
+        listenPort: (data, obj) => data.pushU16(6, obj.listenPort!),
+        fwmark: (data, obj) => data.pushU32(7, obj.fwmark!),
         peers: (data, obj) => data.push(8, structs.putArray(obj.peers!, x => formatPeer(x))),
     })
 }
@@ -170,19 +187,38 @@ export function parsePeer(r: Buffer): Peer {
     })
 }
 
+/** Decoders of the attributes of a {@link Peer} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_Peer: structs.LazyFields = {
+    1: ['publicKey', data => data],
+    2: ['presharedKey', data => data],
+    3: ['flags', data => parsePeerFlags(structs.getU32(data))],
+    4: ['endpoint', data => data],
+    5: ['persistentKeepaliveInterval', data => structs.getU16(data)],
+    6: ['lastHandshakeTime', data => data],
+    7: ['rxBytes', data => structs.getU64(data)],
+    8: ['txBytes', data => structs.getU64(data)],
+    9: ['allowedIps', data => structs.getArray(data, x => parseAllowedIpLazy(x))],
+    10: ['protocolVersion', data => structs.getU32(data)],
+}
+
+/** Like {@link parsePeer}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parsePeerLazy(r: Buffer): Peer {
+    return structs.getLazyObject(r, __LAZY_Peer)
+}
+
 /** Encodes a {@link Peer} object into a stream of attributes */
 export function formatPeer(x: Peer): StreamData {
     return structs.putObject(x, {
         publicKey: (data, obj) => data.push(1, obj.publicKey!),
         presharedKey: (data, obj) => data.push(2, obj.presharedKey!),
-        flags: (data, obj) => data.push(3, structs.putU32(formatPeerFlags(obj.flags!))),
+        flags: (data, obj) => data.pushU32(3, formatPeerFlags(obj.flags!)),
         endpoint: (data, obj) => data.push(4, obj.endpoint!),
-        persistentKeepaliveInterval: (data, obj) => data.push(5, structs.putU16(obj.persistentKeepaliveInterval!)),
+        persistentKeepaliveInterval: (data, obj) => data.pushU16(5, obj.persistentKeepaliveInterval!),
         lastHandshakeTime: (data, obj) => data.push(6, obj.lastHandshakeTime!),
-        rxBytes: (data, obj) => data.push(7, structs.putU64(obj.rxBytes!)),
-        txBytes: (data, obj) => data.push(8, structs.putU64(obj.txBytes!)),
+        rxBytes: (data, obj) => data.pushU64(7, obj.rxBytes!),
+        txBytes: (data, obj) => data.pushU64(8, obj.txBytes!),
         allowedIps: (data, obj) => data.push(9, structs.putArray(obj.allowedIps!, x => formatAllowedIp(x))),
-        protocolVersion: (data, obj) => data.push(10, structs.putU32(obj.protocolVersion!)),
+        protocolVersion: (data, obj) => data.pushU32(10, obj.protocolVersion!),
     })
 }
 
@@ -204,11 +240,23 @@ export function parseAllowedIp(r: Buffer): AllowedIp {
     })
 }
 
+/** Decoders of the attributes of a {@link AllowedIp} object, by type (see {@link structs.LazyFields}) */
+export const __LAZY_AllowedIp: structs.LazyFields = {
+    1: ['family', data => structs.getU16(data)],
+    2: ['ipaddr', data => data],
+    3: ['cidrMask', data => structs.getU8(data)],
+}
+
+/** Like {@link parseAllowedIp}, but attributes are decoded when first read (see {@link structs.getLazyObject}) */
+export function parseAllowedIpLazy(r: Buffer): AllowedIp {
+    return structs.getLazyObject(r, __LAZY_AllowedIp)
+}
+
 /** Encodes a {@link AllowedIp} object into a stream of attributes */
 export function formatAllowedIp(x: AllowedIp): StreamData {
     return structs.putObject(x, {
-        family: (data, obj) => data.push(1, structs.putU16(obj.family!)),
+        family: (data, obj) => data.pushU16(1, obj.family!),
         ipaddr: (data, obj) => data.push(2, obj.ipaddr!),
-        cidrMask: (data, obj) => data.push(3, structs.putU8(obj.cidrMask!)),
+        cidrMask: (data, obj) => data.pushU8(3, obj.cidrMask!),
     })
 }
@@ -6,11 +6,10 @@
 import { EventEmitter } from 'events'
 
 import { MessageInfo, RawNetlinkSocketOptions } from '../raw'
-import { NetlinkSocket, NetlinkSocketOptions, NetlinkSendOptions, RequestOptions } from '../netlink'
+import { NetlinkSocket, NetlinkSocketOptions, NetlinkSendOptions, RequestOptions, DumpOptions } from '../netlink'
 import { Flags, FlagsGet } from '../constants'
-import { NetlinkMessage, AttrStream } from '../structs'
 import { Commands, Device, formatDevice, parseDevice } from './structs'
-import { GenericNetlinkSocketOptions, GenericNetlinkSocket, GenericNetlinkSendOptions, createGenericNetlink } from '../genl/genl'
+import { GenericNetlinkSocketOptions, GenericNetlinkSocket, GenericNetlinkSendOptions, GenericNetlinkMessage, createGenericNetlink, getSharedGenericNetlink } from '../genl/genl'
 import { genl } from '..'
 
 // Based on <linux/wireguard.h> at a2ec8b5
@@ -22,6 +21,13 @@ export const WG_KEY_LEN = 32
 
 
 export interface WireGuardSocketOptions {
+    /**
+     * Generic netlink socket to use, possibly shared with other
+     * clients (default: a new socket is created, unless `shared` is set)
+     */
+    socket?: GenericNetlinkSocket
+    /** Use the process-wide socket (see {@link getSharedGenericNetlink}) */
+    shared?: boolean
 }
 
 export interface WireGuardSendOptions extends GenericNetlinkSendOptions {
@@ -50,11 +56,20 @@ export class WireGuardSocket extends EventEmitter {
             throw Error('Invalid family data')
         this.familyId = familyData.familyId
         this.socket = socket
-        this.socket.on('message', this._receive.bind(this))
+        this._receive = this._receive.bind(this)
+        this.socket.subscribe(this.familyId, this._receive)
     }
 
-    private _receive(omsg: NetlinkMessage[], rinfo: MessageInfo) {
-        // TODO
+    private _receive(msgs: GenericNetlinkMessage[], rinfo: MessageInfo) {
+        this.emit('message', msgs, rinfo)
+    }
+
+    /**
+     * Stops receiving messages from the socket. The socket itself is
+     * left open, since it may be shared with other clients.
+     */
+    detach() {
+        this.socket.unsubscribe(this.familyId, this._receive)
     }
 
     send(
@@ -62,9 +77,7 @@ export class WireGuardSocket extends EventEmitter {
         msg: Device,
         options?: WireGuardSendOptions
     ) {
-        const attrs = new AttrStream()
-        attrs.emit(formatDevice(msg))
-        return this.socket.send(this.familyId, cmd, WG_GENL_VERSION, attrs.bufs, options)
+        return this.socket.send(this.familyId, cmd, WG_GENL_VERSION, formatDevice(msg), options)
     }
 
     async request(
@@ -72,14 +85,36 @@ export class WireGuardSocket extends EventEmitter {
         msg?: Device,
         options?: WireGuardSendOptions & RequestOptions
     ): Promise<Device[]> {
-        const attrs = new AttrStream()
-        attrs.emit(formatDevice(msg || {}))
         // rinfo isn't very useful here; this is a kernel interface
         const [omsg, _] = await this.socket.request(
-            this.familyId, cmd, WG_GENL_VERSION, attrs.bufs, options)
+            this.familyId, cmd, WG_GENL_VERSION, formatDevice(msg || {}), options)
         return omsg.map(x => parseDevice(x.data))
     }
 
+    /**
+     * Sends a dump request, and yields the parsed replies as they
+     * arrive, see {@link NetlinkSocket.dump}.
+     */
+    async *dump(
+        cmd: Commands,
+        msg?: Device,
+        options?: WireGuardSendOptions & DumpOptions
+    ): AsyncGenerator<Device[], void, undefined> {
+        for await (const [omsg, _] of this.socket.dump(this.familyId, cmd, WG_GENL_VERSION, formatDevice(msg || {}), options))
+            yield omsg.map(x => parseDevice(x.data))
+    }
+
+    /**
+     * Dumps a device like {@link getDevice}, but yields the replies
+     * unparsed as they arrive (see {@link PeerStatsPoller}).
+     */
+    dumpDevice(
+        iface: number | string,
+        options?: WireGuardSendOptions & DumpOptions
+    ): AsyncGenerator<[GenericNetlinkMessage[], MessageInfo], void, undefined> {
+        return this.socket.dump(this.familyId, Commands.GET_DEVICE, WG_GENL_VERSION, formatDevice(setIface({}, iface)), options)
+    }
+
     /** gets a wireguard interface */
     getDevice(
         iface: number | string,
@@ -102,10 +137,9 @@ export class WireGuardSocket extends EventEmitter {
 export async function createWireGuard(
     options?: WireGuardSocketOptions & GenericNetlinkSocketOptions & NetlinkSocketOptions & RawNetlinkSocketOptions
 ): Promise<WireGuardSocket> {
-    const socket = createGenericNetlink(options)
-    // FIXME: do this correctly, check version, etc.
-    const families = await socket.ctrlRequest(genl.Commands.GET_FAMILY, {}, { flags: FlagsGet.DUMP })
-    const family = families.filter(x => x.familyName === WG_GENL_NAME)[0]
+    const socket = (options && options.socket) ||
+        ((options && options.shared) ? getSharedGenericNetlink() : createGenericNetlink(options))
+    const family = await socket.families.resolve(WG_GENL_NAME)
     if (typeof family === 'undefined')
         throw Error('wireguard genl family not available')
     return new WireGuardSocket(socket, family, options)
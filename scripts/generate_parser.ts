@@ -3,8 +3,8 @@
  * from a definitions file.
  */
 
-import { TypeStore, TypeDef, TypeExpr, AttributeOptions } from '../types/_base'
-import { dirname } from 'path'
+import { TypeStore, TypeDef, TypeExpr, AttributeDef, AttributeOptions } from '../types/_base'
+import { basename, dirname } from 'path'
 import { runInNewContext } from 'vm'
 import * as ts from "typescript"
 import { readFileSync, writeFileSync } from 'fs'
@@ -74,16 +74,20 @@ const genField = (x: TSField) => withDocstring(x.docs, `${x.name}${x.required ?
 const genInterface = (name: string, fields: TSField[], docs?: string, extend?: string) =>
     withDocstring(docs, `export interface ${name}${extend ? ` extends ${extend}` : ''} {\n${indent(fields.map(genField).join('\n\n'))}\n}`)
 
+/** Scalar types with a push method in AttrStream */
+const pushTypes = new Set(['U8', 'U16', 'U32', 'U64', 'S8', 'S16', 'S32', 'S64', 'U16be', 'U32be', 'String', 'Flag', 'Bool'])
+
 
 // Main code
 
 const args = process.argv.slice(2)
-if (args.length !== 2) {
-    console.error(`Usage: ${process.argv[1]} <types.ts> <output.ts>`)
+if (args.length !== 2 && args.length !== 3) {
+    console.error(`Usage: ${process.argv[1]} <types.ts> <output.ts> [<native.h>]`)
     process.exit(1)
 }
 const filename = args[0]
 const outFilename = args[1]
+const nativeFilename = args[2] as string | undefined
 const types = loadTypesFile(filename)
 initialValidation(types)
 const blocks: { [key:string]: string } = {}
@@ -110,6 +114,8 @@ const pre = [
 ].join('\n') + '\n\n'
 const output = pre + Object.keys(types).map(k => blocks[k]).join('\n\n') + '\n'
 writeFileSync(outFilename, output)
+if (nativeFilename)
+    writeFileSync(nativeFilename, generateNative(nativeFilename))
 
 // FIXME: warn if 64-bit on flags (enum should be safe)
 // FIXME: remember to set bigint on 64-bit
@@ -130,7 +136,9 @@ function isStructExpandable(x: TypeDef) {
     return x.attrs!.some(attr => attr[2]?.abi)
 }
 
-type TypeResult = { type: null | string, parse: (x: string) => string, format: (x: string) => string }
+type TypeResult = { type: null | string, parse: (x: string) => string, format: (x: string) => string,
+    /** If present, code that pushes the value as an attribute of that type directly (see AttrStream.pushU32) */
+    push?: (t: string, x: string) => string }
 
 function processLower(lower?: AttributeOptions['type']): TypeResult {
     if (!lower) return { type: null, parse: x => x, format: x => x }
@@ -153,7 +161,7 @@ function processLower(lower?: AttributeOptions['type']): TypeResult {
     throw Error(`Unknown lower type: ${lower}`)
 }
 
-function processType(t: TypeExpr, lower?: AttributeOptions['type']): TypeResult {
+function processType(t: TypeExpr, lower?: AttributeOptions['type'], lazy: boolean = false): TypeResult {
     if (typeof t === 'string') {
         if (/^[su](8|16|32|64)([bl]e)?$/.test(t)) {
             if (/64/.test(t) && lower)
@@ -162,7 +170,8 @@ function processType(t: TypeExpr, lower?: AttributeOptions['type']): TypeResult
             const tname = t[0].toUpperCase() + t.substring(1)
             return { type: type || (/64/.test(t) ? 'bigint' : 'number'),
                 parse: x => parse(`structs.get${tname}(${x})`),
-                format: x => `structs.put${tname}(${format(x)})` }
+                format: x => `structs.put${tname}(${format(x)})`,
+                push: pushTypes.has(tname) ? (n, x) => `data.push${tname}(${n}, ${format(x)})` : undefined }
         } else if (t === 'data') {
             if (lower) console.warn(`Warning: Ignoring ${lower} since it's over data`)
             return { type: 'Buffer', parse: x => x, format: x => x }
@@ -171,13 +180,15 @@ function processType(t: TypeExpr, lower?: AttributeOptions['type']): TypeResult
             if (lower) throw Error(`Lower type ${lower} specified over ${t}`)
             return { type: { string: 'string', flag: 'true', bool: 'boolean' }[t],
                 parse: x => `structs.get${tname}(${x})`,
-                format: x => `structs.put${tname}(${x})` }
+                format: x => `structs.put${tname}(${x})`,
+                push: (n, x) => `data.push${tname}(${n}, ${x})` }
         } else if ({}.hasOwnProperty.call(types, t)) {
             const type = types[t]
             if (lower) throw Error(`Lower type ${lower} specified over attr type`)
             if (type.kind && type.kind !== 'attrs' && type.kind !== 'struct')
                 throw Error(`Invalid type ${t} specified as attr type`)
-            return { type: t, parse: x => `parse${t}(${x})`, format: x => `format${t}(${x})` }
+            const suffix = lazy && type.kind !== 'struct' ? 'Lazy' : ''
+            return { type: t, parse: x => `parse${t}${suffix}(${x})`, format: x => `format${t}(${x})` }
         }
     } else {
         if (t.kind === 'flags') {
@@ -191,13 +202,13 @@ function processType(t: TypeExpr, lower?: AttributeOptions['type']): TypeResult
             const name = getFlagName(t.type)
             return { type: name, parse: x => `parse${name}Attr(${x})`, format: x => `format${name}Attr(${x})` }
         } else if (t.kind === 'array') {
-            const { type, parse, format } = processType(t.type, lower)
+            const { type, parse, format } = processType(t.type, lower, lazy)
             const opts = t.zero ? `, { zero: true }` : ''
             return { type: `${type}[]`,
                 parse: x => `structs.getArray(${x}, x => ${parse('x')}${opts})`,
                 format: x => `structs.putArray(${x}, x => ${format('x')}${opts})` }
         } else if (t.kind === 'map') {
-            const { type, parse, format } = processType(t.type, lower)
+            const { type, parse, format } = processType(t.type, lower, lazy)
             return { type: `Map<number, ${type}>`,
                 parse: x => `structs.getMap(${x}, x => ${parse('x')})`,
                 format: x => `structs.putMap(${x}, x => ${format('x')})` }
@@ -250,7 +261,7 @@ function processEnum(name: string, type: TypeDef, emitFlags: boolean, emitAttrFl
         parseCode.push(`if (r & (1 << ${name}.${ename})) x.${fname} = true`)
         formatCode.push(`if (x.${fname}) r |= 1 << ${name}.${ename}`)
         parseAttrCode.push(`[${name}.${ename}]: (data, obj) => obj.${fname} = structs.getFlag(data),`)
-        formatAttrCode.push(`${fname}: (data, obj) => data.push(${name}.${ename}, structs.putFlag(obj.${fname}!)),`)
+        formatAttrCode.push(`${fname}: (data, obj) => data.pushFlag(${name}.${ename}, obj.${fname}!),`)
     }
     parseCode.push('return x')
     formatCode.push('return r')
@@ -274,29 +285,42 @@ function processEnum(name: string, type: TypeDef, emitFlags: boolean, emitAttrFl
 }
 
 function processAttr(name: string, type: TypeDef) {
-    const fields: TSField[] = [], parseCode: string[] = [], formatCode: string[] = []
+    const fields: TSField[] = [], parseCode: string[] = [], formatCode: string[] = [], lazyCode: string[] = []
     let index = type.zero ? 0 : 1
     for (const [ name, ftype, opts ] of type.attrs!) {
         const built = processType(ftype, opts && opts.type)
+        const lazy = processType(ftype, opts && opts.type, true)
+        lazyCode.push(`${index}: ['${name}', data => ${lazy.parse('data')}${opts && opts.repeated ? ', true' : ''}],`)
         if (opts && opts.repeated) {
             fields.push({ name, type: built.type! + '[]', docs: opts &&  opts.docs && opts.docs.join('\n') })
             parseCode.push(`${index}: (data, obj) => (obj.${name} = obj.${name} || []).push(${built.parse('data')}),`)
-            formatCode.push(`${name}: (data, obj) => obj.${name}!.forEach(x => data.push(${index}, ${built.format('x')})),`)
+            const push = built.push ? built.push(`${index}`, 'x') : `data.push(${index}, ${built.format('x')})`
+            formatCode.push(`${name}: (data, obj) => obj.${name}!.forEach(x => ${push}),`)
         } else {
             fields.push({ name, type: built.type!, docs: opts &&  opts.docs && opts.docs.join('\n') })
             parseCode.push(`${index}: (data, obj) => obj.${name} = ${built.parse('data')},`)
-            formatCode.push(`${name}: (data, obj) => data.push(${index}, ${built.format(`obj.${name}!`)}),`)
+            const push = built.push ? built.push(`${index}`, `obj.${name}!`) : `data.push(${index}, ${built.format(`obj.${name}!`)})`
+            formatCode.push(`${name}: (data, obj) => ${push},`)
         }
         index++
     }
     const fullParseCode = `return structs.getObject(r, {\n${indent(parseCode.join('\n'))}\n})`
     const fullFormatCode = `return structs.putObject(x, {\n${indent(formatCode.join('\n'))}\n})`
+    const lazyName = getLazyName(name)
     const iface = genInterface(name + ' extends BaseObject', fields, type.docs && type.docs.join('\n'))
     const parse = genFunction(`parse${name}`, `r: Buffer`, name, fullParseCode,
         `Parses the attributes of a {@link ${name}} object`)
+    const lazyTable = `/** Decoders of the attributes of a {@link ${name}} object, by type (see {@link structs.LazyFields}) */\n` +
+        `export const ${lazyName}: structs.LazyFields = {\n${indent(lazyCode.join('\n'))}\n}`
+    const parseLazy = genFunction(`parse${name}Lazy`, `r: Buffer`, name, `return structs.getLazyObject(r, ${lazyName})`,
+        `Like {@link parse${name}}, but attributes are decoded when first read (see {@link structs.getLazyObject})`)
     const format = genFunction(`format${name}`, `x: ${name}`, 'StreamData', fullFormatCode,
         `Encodes a {@link ${name}} object into a stream of attributes`)
-    return iface + '\n\n' + parse + '\n\n' + format
+    return iface + '\n\n' + parse + '\n\n' + lazyTable + '\n\n' + parseLazy + '\n\n' + format
+}
+
+function getLazyName(t: string) {
+    return `__LAZY_${t}`
 }
 
 type StructTypeResult = { type: null | string, length: number | string, parse: (o: string) => string, format: (x: string, o: string) => string }
@@ -429,3 +453,180 @@ function processStruct(name: string, type: TypeDef) {
         `Encodes a {@link ${name}} object into a stream of attributes`)
     return iface + '\n\n' + parse + '\n\n' + format + '\n\n' + `export const ${lengthName} = ${length}`
 }
+
+
+// Native decoder tables (see src/decoder.h)
+
+/** Values of an enum as the TS enum assigns them (implicit values follow the previous one) */
+function getEnumValues(type: TypeDef): { name: string, value: number }[] {
+    let next = 0
+    return type.values!.map(({ name, value }) => {
+        value = value ? value : next
+        next = value + 1
+        return { name, value }
+    })
+}
+
+function generateNative(outName: string) {
+    const namespace = basename(outName).replace(/\.h$/, '').replace(/\W/g, '_')
+    const guard = `NETLINK_${namespace.toUpperCase()}_H`
+    const keys: Map<string, number> = new Map()
+    const key = (x: string) => (keys.has(x) || keys.set(x, keys.size), keys.get(x)!)
+    const decls: string[] = [], defs: string[] = []
+    let itemCount = 0
+
+    const scalarKinds: { [t: string]: [string, number] } = {
+        u8: ['U8', 1], u16: ['U16', 2], u32: ['U32', 4], u64: ['U64', 8],
+        s8: ['S8', 1], s16: ['S16', 2], s32: ['S32', 4], s64: ['S64', 8],
+        u16be: ['U16be', 2], u32be: ['U32be', 4], bool: ['U8', 1],
+    }
+    const nativeLower = (lower?: AttributeOptions['type']) => {
+        if (!lower) return 'Lower::None, nullptr, nullptr'
+        if (typeof lower === 'string')
+            return types[lower].kind === 'flags' ? `Lower::Flags, nullptr, &${lower}` : `Lower::Enum, &${lower}, nullptr`
+        return `Lower::EnumBits, &${lower.type}, nullptr`
+    }
+    const genType = (kind: string, lower: string, attrs = 'nullptr', structure = 'nullptr', item = 'nullptr', zero = false) =>
+        `{ Kind::${kind}, ${lower}, ${attrs}, ${structure}, ${item}, ${zero} }`
+
+    function nativeType(t: TypeExpr, lower?: AttributeOptions['type']): string {
+        if (typeof t === 'string') {
+            if ({}.hasOwnProperty.call(scalarKinds, t) && t !== 'bool') {
+                if (lower && /64/.test(t))
+                    throw Error(`Lower type over 64-bit ${t} not supported in native decoders`)
+                return genType(scalarKinds[t][0], nativeLower(lower))
+            }
+            const simple: { [t: string]: string } = { data: 'Data', string: 'String', flag: 'Flag', bool: 'Bool' }
+            if ({}.hasOwnProperty.call(simple, t))
+                return genType(simple[t], nativeLower())
+            if ({}.hasOwnProperty.call(types, t))
+                return types[t].kind === 'struct' ?
+                    genType('Struct', nativeLower(), 'nullptr', `&${t}`) :
+                    genType('Attrs', nativeLower(), `&${t}`)
+        } else if (t.kind === 'flags') {
+            return genType('Attrs', nativeLower(), `&${t.type}SetAttr`)
+        } else {
+            const item = `item${itemCount++}`
+            defs.push(`const Type ${item} = ${nativeType(t.type, lower)};`)
+            return genType(t.kind === 'array' ? 'Array' : 'Map', nativeLower(), 'nullptr', 'nullptr', `&${item}`, !!t.zero)
+        }
+        throw Error(`Unknown type: ${t}`)
+    }
+
+    function structLength(name: string, attrs: AttributeDef[]): number {
+        return attrs.reduce((length, [ , ftype, opts ]) => length + memberSize(ftype, opts) * (opts && opts.count || 1), 0)
+    }
+    function memberSize(t: TypeExpr, opts?: AttributeOptions) {
+        if (t === 'data' || t === 'string') return 1
+        if (typeof t === 'string' && {}.hasOwnProperty.call(scalarKinds, t)) return scalarKinds[t][1]
+        if (typeof t === 'string' && types[t] && types[t].kind === 'struct') return structLength(t, types[t].attrs!)
+        throw Error(`Unsupported struct member type: ${t}`)
+    }
+
+    function emitEnum(name: string, type: TypeDef) {
+        const values = getEnumValues(type)
+        // the TS reverse mapping keeps the last name for each value
+        const reverse: Map<number, string> = new Map()
+        values.forEach(({ name, value }) => reverse.set(value, name))
+        const sorted = [...reverse].sort((a, b) => a[0] - b[0])
+        decls.push(`extern const Enum ${name};`)
+        defs.push(`const EnumValue ${name}_values[] = {\n` +
+            indent(sorted.map(([ value, ename ]) => `{ ${value}, ${key(ename)} },`).join('\n')) + '\n};')
+        let bits = 'nullptr, 0'
+        if (enumFlagsNeeded.has(name)) {
+            defs.push(`const EnumValue ${name}_bits[] = {\n` +
+                indent(values.map(({ name, value }) => `{ ${value}, ${key(toCamelCase(name))} },`).join('\n')) + '\n};')
+            bits = `${name}_bits, ${values.length}`
+        }
+        defs.push(`const Enum ${name} = { ${name}_values, ${sorted.length}, ${bits}, &kKeyTable };`)
+        if (enumAttrFlagsNeeded.has(name)) {
+            // like the object literal in parse*SetAttr, later names override earlier ones
+            const fields: Map<number, string> = new Map()
+            values.forEach(({ name, value }) => fields.set(value, toCamelCase(name)))
+            emitAttrs(`${name}SetAttr`, [...fields].map(([ value, fname ]) => [ value, fname, genType('Flag', nativeLower()), false ]))
+        }
+    }
+
+    function emitFlags(name: string, type: TypeDef) {
+        decls.push(`extern const Flags ${name};`)
+        defs.push(`const FlagValue ${name}_values[] = {\n` +
+            indent(type.values!.map(({ name, value }) => `{ ${value | 0}, ${key(name)} },`).join('\n')) + '\n};')
+        defs.push(`const Flags ${name} = { ${name}_values, ${type.values!.length}, &kKeyTable };`)
+    }
+
+    function emitAttrs(name: string, fields: [number, string, string, boolean][]) {
+        decls.push(`extern const Attrs ${name};`)
+        const first = Math.min(...fields.map(x => x[0]))
+        const last = Math.max(...fields.map(x => x[0]))
+        const table: string[] = []
+        for (let i = first; i <= last; i++) {
+            const field = fields.find(x => x[0] === i)
+            table.push(field ?
+                `{ ${key(field[1])}, ${field[2]}, ${field[3]} },` :
+                `{ -1, ${genType('Data', nativeLower())}, false },`)
+        }
+        defs.push(`const Field ${name}_fields[] = {\n${indent(table.join('\n'))}\n};`)
+        defs.push(`const Attrs ${name} = { ${name}_fields, ${table.length}, ${first}, &kKeyTable };`)
+    }
+
+    function emitStruct(name: string, type: TypeDef) {
+        const expandable = isStructExpandable(type)
+        let attrs = type.attrs!
+        if (expandable)
+            attrs = attrs.slice(0, attrs.findIndex(attr => attr[2]?.abi) + 1)
+        decls.push(`extern const Struct ${name};`)
+        let offset = 0
+        const members = attrs.map(([ fname, ftype, opts ]) => {
+            const count = opts && opts.count || 0
+            const size = memberSize(ftype, opts)
+            const t = (ftype === 'data' || ftype === 'string') ? genType('Data', nativeLower()) : nativeType(ftype, opts && opts.type)
+            const isData = ftype === 'data' || ftype === 'string'
+            const member = `{ ${key(fname)}, ${t}, ${offset}, ${isData ? count : size}, ${isData ? 0 : count} },`
+            offset += size * (count || 1)
+            return member
+        })
+        defs.push(`const Member ${name}_members[] = {\n${indent(members.join('\n'))}\n};`)
+        defs.push(`const Struct ${name} = { "${name}", ${name}_members, ${members.length}, ${offset}, ${expandable}, &kKeyTable };`)
+    }
+
+    for (const name of Object.keys(types)) {
+        const type = types[name]
+        if (type.kind === 'enum') emitEnum(name, type)
+        if (type.kind === 'flags') emitFlags(name, type)
+    }
+    for (const name of Object.keys(types)) {
+        const type = types[name]
+        if (type.kind === 'struct')
+            emitStruct(name, type)
+        if (!type.kind || type.kind === 'attrs') {
+            let index = type.zero ? 0 : 1
+            emitAttrs(name, type.attrs!.map(([ fname, ftype, opts ]) =>
+                [ index++, fname, nativeType(ftype, opts && opts.type), !!(opts && opts.repeated) ]))
+        }
+    }
+
+    const keyTable = `const char* const kKeys[] = {\n${indent([...keys.keys()].map(x => JSON.stringify(x) + ',').join('\n'))}\n};\n\n` +
+        `/** Key ids are assigned when registering the tables (see DecoderKeys in binding.cc) */\nKeyTable kKeyTable = { kKeys, ${keys.size}, 0 };`
+    return [
+        `// Generated by scripts/generate_parser.ts from ${filename}, do not edit`,
+        `#ifndef ${guard}`,
+        `#define ${guard}`,
+        '',
+        '#include "decoder.h"',
+        '',
+        `namespace ${namespace} {`,
+        '',
+        'using namespace decoder;',
+        '',
+        keyTable,
+        '',
+        decls.join('\n'),
+        '',
+        defs.join('\n\n'),
+        '',
+        `} // namespace ${namespace}`,
+        '',
+        `#endif // ${guard}`,
+        '',
+    ].join('\n')
+}
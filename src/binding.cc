@@ -1,19 +1,58 @@
 #include <sys/socket.h>
+#include <sys/eventfd.h>
+#include <sys/epoll.h>
+#include <sys/mman.h>
+#include <fcntl.h>
 #include <linux/netlink.h>
+#include <linux/filter.h>
+#include <linux/sock_diag.h>
+#include <linux/rtnetlink.h>
+#include <poll.h>
 #include <unistd.h>
 #include <errno.h>
 #include <queue>
+#include <deque>
+#include <unordered_map>
+#include <vector>
 #include <memory>
+#include <cstring>
 #include <sstream>
+#include <thread>
+#include <atomic>
+#include <mutex>
 #include <assert.h>
 
 #include <napi.h>
 #include <uv.h>
 
+#include "ring.h"
+#include "stats.h"
+#include "capture.h"
+#include "requests.h"
+#include "netns.h"
+#include "decoder.h"
+#include "gen_rt.h"
+#include "gen_ifla.h"
+
 #ifndef SOL_NETLINK
 #define SOL_NETLINK	270
 #endif
 
+// Maximum amount of datagrams read per poll event (prevents loop starvation)
+static const int kReadLimit = 32;
+// Max. number of queued requests sent in a single sendmmsg() call
+static const int kWriteLimit = 32;
+// Initial slot size for batched reads when message peeking is enabled
+// (the kernel caps dump skbs at 32kb, except for very large single messages)
+static const size_t kBatchSlotSize = 32768;
+// Number of uint32 entries per datagram in the batch table (see RecvBatch)
+static const size_t kBatchEntrySize = 9;
+// Number of uint32 entries per message in a framing index (see IndexMessages)
+static const size_t kIndexEntrySize = 6;
+// Initial receive buffer size in adaptive mode (matches the kernel's
+// maximum size for dump skbs, which depends on our read size)
+static const size_t kAdaptiveSlabSize = 32768;
+
 using Napi::CallbackInfo;
 
 Napi::Error ErrnoException(Napi::Env env, int errnum, const char* syscall, std::string message) {
@@ -94,6 +133,9 @@ class UvTimer : public UvHandle<UvTimer, uv_timer_t> {
         if (auto err = uv_timer_start(&handle, cb, timeout, repeat))
             throw ErrnoException(env, -err, "uv_timer_start");
     }
+    void stop() {
+        uv_timer_stop(&handle);
+    }
 };
 
 class UvPoll : public UvHandle<UvPoll, uv_poll_t> {
@@ -110,6 +152,25 @@ class UvPoll : public UvHandle<UvPoll, uv_poll_t> {
         if (auto err = uv_poll_start(&handle, events, cb))
             throw ErrnoException(env, -err, "uv_poll_start");
     }
+    void stop() {
+        uv_poll_stop(&handle);
+    }
+};
+
+class UvAsync : public UvHandle<UvAsync, uv_async_t> {
+  protected:
+    friend class UvHandle<UvAsync, uv_async_t>;
+    UvAsync() = default;
+    ~UvAsync() = default;
+  public:
+    static auto New(Napi::Env env, uv_loop_t* loop, uv_async_cb cb) { return New_([&](UvAsync& self) {
+        if (auto err = uv_async_init(loop, &self.handle, cb))
+            throw ErrnoException(env, -err, "uv_async_init");
+    }); }
+    /** Can be called from any thread */
+    void send() {
+        uv_async_send(&handle);
+    }
 };
 
 class FileDescriptor {
@@ -140,18 +201,275 @@ class FileDescriptor {
 };
 
 
-Napi::Object nlsockaddrToObject(Napi::Env env, const struct sockaddr_nl& addr, size_t len) {
-    assert(addr.nl_family == AF_NETLINK && len == sizeof(addr));
+// Senders that aren't netlink sockets (i.e. the peer of an injected
+// socketpair) are reported as the kernel (port 0, no groups)
+Napi::Object nlsockaddrToObject(Napi::Env env, const struct sockaddr_nl& addr, size_t len, int32_t nsid = kNoNsid) {
+    bool netlink = addr.nl_family == AF_NETLINK && len == sizeof(addr);
     auto res = Napi::Object::New(env);
-    res["port"] = Napi::Number::New(env, addr.nl_pid);
-    res["groups"] = Napi::Number::New(env, addr.nl_groups);
+    res["port"] = Napi::Number::New(env, netlink ? addr.nl_pid : 0);
+    res["groups"] = Napi::Number::New(env, netlink ? addr.nl_groups : 0);
+    if (nsid != kNoNsid)
+        res["nsid"] = Napi::Number::New(env, nsid);
     return res;
 }
 
+/**
+ * Validates the nlmsghdr framing of a datagram, appending an entry of
+ * (offset, length, type, flags, seq, port) to `index` for each message
+ * (offsets are relative to `base`). Padding between messages is skipped,
+ * like `parseMessages` does. Returns false if the framing is invalid,
+ * in which case `index` is left untouched.
+ */
+bool IndexMessages(const char* data, size_t length, uint32_t base, std::vector<uint32_t>& index) {
+    size_t start = index.size();
+    size_t offset = 0;
+    while (offset < length) {
+        struct nlmsghdr hdr;
+        if (length - offset < sizeof(hdr)) break;
+        memcpy(&hdr, data + offset, sizeof(hdr));
+        if (hdr.nlmsg_len < sizeof(hdr) || hdr.nlmsg_len > length - offset) break;
+        index.insert(index.end(), {
+            (uint32_t)(base + offset), hdr.nlmsg_len, hdr.nlmsg_type,
+            hdr.nlmsg_flags, hdr.nlmsg_seq, hdr.nlmsg_pid });
+        offset += std::min((size_t)NLMSG_ALIGN(hdr.nlmsg_len), length - offset);
+    }
+    if (offset < length) {
+        index.resize(start);
+        return false;
+    }
+    return true;
+}
+
+Napi::Uint32Array IndexToArray(Napi::Env env, const std::vector<uint32_t>& index) {
+    auto array = Napi::Uint32Array::New(env, index.size());
+    if (!index.empty())
+        memcpy(array.Data(), index.data(), index.size() * sizeof(uint32_t));
+    return array;
+}
+
+
 void deleteFinalizer(Napi::Env env, char* obj) {
     delete[] obj;
 }
 
+void deleteVectorFinalizer(Napi::Env env, char* data, std::vector<char>* obj) {
+    delete obj;
+}
+
+/**
+ * Creates a netlink socket, inside a network namespace if `netns` is
+ * given as an fd or a path (see SocketInNetns). Throws on failure.
+ */
+int CreateNetlinkSocket(Napi::Env env, int protocol, Napi::Value netns, int flags = 0) {
+    flags |= SOCK_RAW;
+#ifdef SOCK_CLOEXEC
+    flags |= SOCK_CLOEXEC;
+#endif
+    if (netns.IsUndefined() || netns.IsNull()) {
+        int fd = socket(AF_NETLINK, flags, protocol);
+        if (fd == -1)
+            throw ErrnoException(env, errno, "socket", "Couldn't create netlink socket");
+        return fd;
+    }
+
+    FileDescriptor opened;
+    int nsfd;
+    if (netns.IsString()) {
+        opened = OpenNetns(netns.As<Napi::String>().Utf8Value().c_str());
+        if (opened == -1)
+            throw ErrnoException(env, errno, "open", "Couldn't open network namespace");
+        nsfd = opened;
+    } else if (netns.IsNumber()) {
+        nsfd = netns.As<Napi::Number>().Int32Value();
+    } else {
+        throw Napi::TypeError::New(env, "Invalid netns -- must be a file descriptor or path");
+    }
+    int err;
+    const char* syscall = nullptr;
+    int fd = SocketInNetns(nsfd, flags, protocol, err, syscall);
+    if (fd == -1)
+        throw ErrnoException(env, err, syscall, "Couldn't create netlink socket in network namespace");
+    return fd;
+}
+
+/** Datagram (or receive error) passed from the receive thread to the JS thread */
+struct RecvItem {
+    std::unique_ptr<char[]> data;
+    size_t length = 0;
+    /** Original size (bigger than length if truncated) */
+    size_t size = 0;
+    bool truncated = false;
+    struct sockaddr_nl addr {};
+    socklen_t namelen = 0;
+    /** If nonzero, this item reports a receive error */
+    int error = 0;
+    int32_t nsid = kNoNsid;
+};
+
+/** Received datagram, as passed to DeliverBatch */
+struct Datagram {
+    const char* data;
+    size_t length;
+    size_t size;
+    bool truncated;
+    struct sockaddr_nl addr;
+    int32_t nsid;
+    /** Fleet member it was received from (see Fleet), otherwise 0 */
+    uint32_t member;
+};
+
+/**
+ * Fills the batch table entry (see Socket::RecvBatch) of a datagram
+ * placed at `offset` of `data`, indexing it if `index_messages`.
+ */
+void FillBatchEntry(uint32_t* entry, const char* data, uint32_t offset, const Datagram& item,
+                    bool index_messages, std::vector<uint32_t>& index) {
+    entry[0] = offset;
+    entry[1] = item.length;
+    entry[2] = item.addr.nl_pid;
+    entry[3] = item.addr.nl_groups;
+    entry[4] = item.truncated ? item.size : 0;
+    entry[5] = index.size() / kIndexEntrySize;
+    entry[6] = 0xFFFFFFFF;
+    if (!item.truncated && index_messages && IndexMessages(data + offset, item.length, offset, index))
+        entry[6] = index.size() / kIndexEntrySize - entry[5];
+    entry[7] = (uint32_t) item.nsid;
+    entry[8] = item.member;
+}
+
+class RecvPool;
+
+/** Receive buffer, owned by a RecvPool or by the JS Buffer wrapping it */
+struct Slab {
+    std::weak_ptr<RecvPool> pool;
+    size_t capacity;
+    std::unique_ptr<char[]> data;
+};
+
+/**
+ * Pool of receive buffers. Slabs are lent to JS as the backing memory of
+ * the received Buffers, and return to the pool when they're collected.
+ * The slab size grows to fit the largest datagram seen.
+ */
+class RecvPool : public std::enable_shared_from_this<RecvPool> {
+  public:
+    // Maximum amount of idle slabs to keep around
+    static const size_t kMaxFree = 16;
+
+    RecvPool(size_t slab_size): slab_size(slab_size) {}
+
+    std::unique_ptr<Slab> Acquire() {
+        while (!free_slabs.empty()) {
+            auto slab = std::move(free_slabs.back());
+            free_slabs.pop_back();
+            if (slab->capacity >= slab_size)
+                return slab;
+        }
+        auto slab = std::make_unique<Slab>();
+        slab->pool = shared_from_this();
+        slab->capacity = slab_size;
+        slab->data = std::make_unique<char[]>(slab_size);
+        return slab;
+    }
+
+    void Release(std::unique_ptr<Slab> slab) {
+        if (slab->capacity >= slab_size && free_slabs.size() < kMaxFree)
+            free_slabs.push_back(std::move(slab));
+    }
+
+    /** Make future slabs big enough to hold a datagram of this size */
+    void Learn(size_t size) {
+        // round up to a multiple of 4kb
+        size = (size + 4095) & ~(size_t)4095;
+        if (size > slab_size) slab_size = size;
+    }
+
+    /**
+     * Wrap the first `length` bytes of a slab into a Buffer. Small datagrams
+     * are copied out so that the slab can be immediately reused, instead of
+     * having JS hold on to mostly unused memory.
+     */
+    Napi::Buffer<char> Wrap(Napi::Env env, std::unique_ptr<Slab> slab, size_t length) {
+        if (length * 4 < slab->capacity) {
+            auto buf = Napi::Buffer<char>::Copy(env, slab->data.get(), length);
+            Release(std::move(slab));
+            return buf;
+        }
+        char* data = slab->data.get();
+        return Napi::Buffer<char>::New(env, data, length, Finalizer, slab.release());
+    }
+
+  private:
+    static void Finalizer(Napi::Env env, char* data, Slab* slab) {
+        std::unique_ptr<Slab> owned (slab);
+        if (auto pool = owned->pool.lock())
+            pool->Release(std::move(owned));
+    }
+
+    size_t slab_size;
+    std::vector<std::unique_ptr<Slab>> free_slabs;
+};
+
+/**
+ * kReadLimit slots for recvmmsg(), `stride` bytes apart in a lazily
+ * committed mapping: only the pages datagrams are written to get backed
+ * by memory, so slots can be as large as the socket's receive buffer
+ * (bigger datagrams are only queued if the queue is almost empty). Pages
+ * past the first kBatchSlotSize bytes of a slot are released after use.
+ */
+class RecvSlots {
+  public:
+    RecvSlots() {}
+    ~RecvSlots() { Unmap(); }
+    RecvSlots(const RecvSlots&) = delete;
+    RecvSlots& operator=(const RecvSlots&) = delete;
+
+    /** Make slots at least `size` bytes. Returns false if mapping failed */
+    bool Reserve(size_t size) {
+        size_t page = sysconf(_SC_PAGESIZE);
+        size = (size + page - 1) & ~(page - 1);
+        if (base && stride >= size) return true;
+        Unmap();
+        void* addr = mmap(NULL, size * kReadLimit, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (addr == MAP_FAILED) return false;
+        base = (char*) addr;
+        stride = size;
+        return true;
+    }
+
+    char* Slot(int i) { return base + i * stride; }
+    size_t Size() { return stride; }
+
+    /** Give back the memory of a slot beyond kBatchSlotSize, once `used` bytes were read */
+    void Release(int i, size_t used) {
+        if (used <= kBatchSlotSize || stride <= kBatchSlotSize) return;
+        size_t page = sysconf(_SC_PAGESIZE);
+        size_t start = (kBatchSlotSize + page - 1) & ~(page - 1);
+        size_t end = std::min(used, stride);
+        if (end > start)
+            madvise(Slot(i) + start, end - start, MADV_DONTNEED);
+    }
+
+  private:
+    void Unmap() {
+        if (base) munmap(base, stride * kReadLimit);
+        base = nullptr;
+        stride = 0;
+    }
+    char* base = nullptr;
+    size_t stride = 0;
+};
+
+/** Size of the socket's receive buffer, or 0 if unknown */
+static size_t RecvBufferSize(int fd) {
+    int value = 0;
+    socklen_t len = sizeof(value);
+    if (getsockopt(fd, SOL_SOCKET, SO_RCVBUF, &value, &len) || value < 0)
+        return 0;
+    return value;
+}
+
 class SendRequest : public Napi::AsyncContext {
   public:
     SendRequest(Napi::Env env, Napi::Object& res, int port, int groups, Napi::Value& data, Napi::Function& callback,
@@ -173,8 +491,14 @@ class SendRequest : public Napi::AsyncContext {
     struct msghdr msg {};
     struct sockaddr_nl addr {};
     int status;
+    /** If nonzero, this sends a native request (see Socket::Request) */
+    uint32_t request_seq = 0;
+    /** Rewritten header of a native request (sent as the first iovec) */
+    struct nlmsghdr header {};
 };
 
+typedef RequestTable<Napi::FunctionReference> NativeRequests;
+
 // FIXME: do we need to try/catch when calling callbacks?
 
 class Socket : public Napi::ObjectWrap<Socket> {
@@ -183,6 +507,11 @@ class Socket : public Napi::ObjectWrap<Socket> {
         Napi::Function func = DefineClass(env, "NativeNetlink", {
             InstanceMethod<&Socket::Bind>("bind"),
             InstanceMethod<&Socket::Send>("send"),
+            InstanceMethod<&Socket::Request>("request"),
+            InstanceMethod<&Socket::Cork>("cork"),
+            InstanceMethod<&Socket::Uncork>("uncork"),
+            InstanceMethod<&Socket::Pause>("pause"),
+            InstanceMethod<&Socket::Resume>("resume"),
             InstanceMethod<&Socket::Close>("close"),
             InstanceMethod<&Socket::Ref_>("ref"),
             InstanceMethod<&Socket::Unref_>("unref"),
@@ -193,6 +522,14 @@ class Socket : public Napi::ObjectWrap<Socket> {
             InstanceMethod<&Socket::SetRecvBufferSize>("setRecvBufferSize"),
             InstanceMethod<&Socket::GetSendBufferSize>("getSendBufferSize"),
             InstanceMethod<&Socket::SetSendBufferSize>("setSendBufferSize"),
+            InstanceMethod<&Socket::Stats>("stats"),
+            InstanceMethod<&Socket::AttachFilter>("attachFilter"),
+            InstanceMethod<&Socket::GetNetlinkOption>("getNetlinkOption"),
+            InstanceMethod<&Socket::SetNetlinkOption>("setNetlinkOption"),
+            InstanceMethod<&Socket::DetachFilter>("detachFilter"),
+            InstanceMethod<&Socket::LockFilter>("lockFilter"),
+            InstanceMethod<&Socket::StartCapture>("startCapture"),
+            InstanceMethod<&Socket::StopCapture>("stopCapture"),
         });
 
         Napi::FunctionReference* constructor = new Napi::FunctionReference();
@@ -209,7 +546,7 @@ class Socket : public Napi::ObjectWrap<Socket> {
         uv_loop_t* loop = nullptr;
         NAPI_THROW_IF_FAILED_VOID(env, napi_get_uv_event_loop(env, &loop));
 
-        int protocol = Napi::Number(env, info[0]);
+        protocol = Napi::Number(env, info[0]);
         msg_buffer = (unsigned int) Napi::Number(env, info[1]);
 
         // do not save strong references to functions, instead save them into
@@ -223,14 +560,57 @@ class Socket : public Napi::ObjectWrap<Socket> {
         Value().DefineProperty(Napi::PropertyDescriptor::Value("readCallback", read_callback.Value(), napi_default));
         Value().DefineProperty(Napi::PropertyDescriptor::Value("errorCallback", error_callback.Value(), napi_default));
 
-        // Create the socket
-        int flags = 0;
-#ifdef SOCK_CLOEXEC
-	    flags |= SOCK_CLOEXEC;
-#endif
-        fd = socket(AF_NETLINK, SOCK_RAW | flags, protocol);
-        if (fd == -1)
-            throw ErrnoException(env, errno, "socket", "Couldn't create netlink socket");
+        int injected_fd = -1;
+        Napi::Value netns = env.Undefined();
+        if (info[4].IsObject()) {
+            auto options = info[4].As<Napi::Object>();
+            batch = options.Get("batch").ToBoolean();
+            adaptive = options.Get("adaptive").ToBoolean();
+            index_messages = options.Get("index").ToBoolean();
+            if (options.Get("fd").IsNumber())
+                injected_fd = options.Get("fd").As<Napi::Number>().Int32Value();
+            netns = options.Get("netns");
+            if (injected_fd >= 0 && !(netns.IsUndefined() || netns.IsNull()))
+                throw Napi::TypeError::New(env, "The fd and netns options can't be combined");
+            threaded = options.Get("thread").ToBoolean();
+            if (threaded) {
+                size_t ring_size = 1024;
+                if (options.Get("ringSize").IsNumber())
+                    ring_size = (unsigned int) options.Get("ringSize").As<Napi::Number>();
+                if (ring_size == 0)
+                    throw Napi::RangeError::New(env, "Invalid ring size");
+                ring = std::make_unique<Ring<RecvItem>>(ring_size);
+                std::string overflow = "flag";
+                if (options.Get("overflow").IsString())
+                    overflow = options.Get("overflow").As<Napi::String>().Utf8Value();
+                if (overflow == "drop-oldest")
+                    overflow_policy = OverflowPolicy::DropOldest;
+                else if (overflow == "block")
+                    overflow_policy = OverflowPolicy::Block;
+                else if (overflow == "flag")
+                    overflow_policy = OverflowPolicy::Flag;
+                else
+                    throw Napi::TypeError::New(env, "Invalid overflow policy");
+            }
+        }
+        // if msg_buffer == 0, peek to size every datagram, unless adaptive mode
+        // was requested: then read into buffers of a learned size, which grows
+        // if a datagram doesn't fit
+        adaptive = (msg_buffer == 0 && adaptive);
+        peek = (msg_buffer == 0 && !adaptive);
+        recv_pool = std::make_shared<RecvPool>(msg_buffer ? msg_buffer : kAdaptiveSlabSize);
+
+        // Create the socket (or adopt the passed one)
+        if (injected_fd >= 0) {
+            int domain = 0;
+            socklen_t len = sizeof(domain);
+            if (getsockopt(injected_fd, SOL_SOCKET, SO_DOMAIN, &domain, &len))
+                throw ErrnoException(env, errno, "getsockopt", "Invalid socket passed");
+            fd = injected_fd;
+            netlink = (domain == AF_NETLINK);
+        } else {
+            fd = CreateNetlinkSocket(env, protocol, netns);
+        }
 
         watcher = UvPoll::New(env, loop, fd);
         watcher->setData(this);
@@ -238,6 +618,14 @@ class Socket : public Napi::ObjectWrap<Socket> {
         timer = UvTimer::New(env, loop);
         timer->setData(this);
 
+        if (threaded) {
+            wake_fd = eventfd(0, EFD_CLOEXEC);
+            if (wake_fd == -1)
+                throw ErrnoException(env, errno, "eventfd", "Couldn't create eventfd");
+            async = UvAsync::New(env, loop, AsyncHandler);
+            async->setData(this);
+        }
+
         async_res = std::make_unique<Napi::AsyncContext>(env, "netlink:NativeNetlink", Value());
 
         Ref(); // don't garbage collect us while the socket is active
@@ -251,23 +639,61 @@ class Socket : public Napi::ObjectWrap<Socket> {
         open = false;
         Unref(); // we can now be garbage collected
 
+        // receive thread has to be stopped before anything it uses is closed
+        if (recv_thread.joinable()) {
+            closing = true;
+            uint64_t one = 1;
+            if (write(wake_fd, &one, sizeof(one)) == -1) {} // can only fail if counter overflows
+            ring->Wake();
+            recv_thread.join();
+        }
+        async.reset();
+        wake_fd.reset();
+        // flush whatever was captured
+        std::atomic_store(&capture, std::shared_ptr<Capture>());
+
         timer.reset();
         // watcher has to be closed before its fd
         // closing should stop & unref it
         watcher.reset();
         fd.reset();
         async_res.reset();
+        recv_pool.reset();
 
-        std::queue<std::unique_ptr<SendRequest>>().swap(write_queue);
+        std::deque<std::unique_ptr<SendRequest>>().swap(write_queue);
         std::queue<std::unique_ptr<SendRequest>>().swap(completed_queue);
+        requests.TakeAll(NativeRequests::kCancelled, finished_requests);
+        finished_requests.clear();
     }
     inline void CheckOpen(Napi::Env env) {
         if (!open)
             throw Napi::Error::New(env, "Netlink socket is closed");
     }
+    // Poll for reads (unless paused, or the receive thread does them) and, if requested, writes
+    void StartWatcher(Napi::Env env, bool writing) {
+        int events = (threaded || paused ? 0 : UV_READABLE) | (writing ? UV_WRITABLE : 0);
+        if (events)
+            watcher->start(env, events, PollHandler);
+        else
+            watcher->stop();
+    }
+    // The timer runs send completions (with zero delay) and request
+    // timeouts; completions take precedence, the timeouts are rearmed after them
     inline void Feed() {
-        if (!timer->isActive())
-            timer->start(Env(), TimerHandler, 0, 0);
+        if (fed) return;
+        fed = true;
+        timer_deadline = 0;
+        timer->start(Env(), TimerHandler, 0, 0);
+    }
+    void ArmTimer() {
+        if (fed) return;
+        uint64_t deadline = requests.NextDeadline();
+        if (deadline == timer_deadline) return;
+        timer_deadline = deadline;
+        if (!deadline) return timer->stop();
+        uint64_t now = uv_hrtime();
+        uint64_t delay = (deadline > now) ? (deadline - now + 999999) / 1000000 : 0;
+        timer->start(Env(), TimerHandler, delay, 0);
     }
 
     void Bind(const CallbackInfo& info) {
@@ -280,9 +706,15 @@ class Socket : public Napi::ObjectWrap<Socket> {
         addr.nl_family = AF_NETLINK;
         addr.nl_pid = port;
         addr.nl_groups = groups;
-        if (bind(fd, (sockaddr*) &addr, sizeof(addr)))
+        // injected non-netlink sockets are already connected
+        if (netlink && bind(fd, (sockaddr*) &addr, sizeof(addr)))
             throw ErrnoException(env, errno, "bind", "Couldn't bind netlink socket");
-        watcher->start(Env(), UV_READABLE, PollHandler);
+        socklen_t len = sizeof(addr);
+        if (netlink && getsockname(fd, (sockaddr*) &addr, &len) == 0)
+            local_port = addr.nl_pid;
+        StartWatcher(env, !write_queue.empty() && !corked);
+        if (threaded && !recv_thread.joinable())
+            recv_thread = std::thread(&Socket::ReceiveLoop, this);
     }
 
     void Send(const CallbackInfo& info) {
@@ -294,6 +726,59 @@ class Socket : public Napi::ObjectWrap<Socket> {
         CheckOpen(env);
 
         size_t nbufs;
+        auto buffers = DataToIovecs(env, data, nbufs);
+        Napi::Object res = Value();
+        Enqueue(env, std::make_unique<SendRequest>(
+            env, res, port, groups, data, callback, std::move(buffers), nbufs));
+    }
+
+    // Native request path: sends a message (filling in its sequence number,
+    // port and the REQUEST and ACK flags) and collects the replies for it
+    // until DONE or ERROR arrives. The callback is then called once, with
+    // (error, replies, rinfo). Only replies from the kernel are matched.
+    // Returns the assigned sequence number.
+    Napi::Value Request(const CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        unsigned int port = Napi::Number(env, info[0]);
+        unsigned int groups = Napi::Number(env, info[1]);
+        auto data = info[2];
+        double timeout = Napi::Number(env, info[3]);
+        auto callback = Napi::Function(env, info[4]);
+        CheckOpen(env);
+
+        size_t nbufs;
+        auto data_buffers = DataToIovecs(env, data, nbufs);
+        if (!nbufs || data_buffers[0].iov_len < sizeof(struct nlmsghdr))
+            throw Napi::TypeError::New(env, "Invalid data -- must start with a message header");
+
+        // the rewritten header is sent from a copy (the caller's buffer is
+        // left untouched), followed by the rest of the data
+        auto buffers = std::make_unique<struct iovec[]>(nbufs + 1);
+        buffers[1].iov_base = (char*) data_buffers[0].iov_base + sizeof(struct nlmsghdr);
+        buffers[1].iov_len = data_buffers[0].iov_len - sizeof(struct nlmsghdr);
+        for (size_t i = 1; i < nbufs; i++)
+            buffers[i + 1] = data_buffers[i];
+
+        uint64_t deadline = (timeout > 0) ? uv_hrtime() + (uint64_t)(timeout * 1e6) : 0;
+        uint32_t seq = requests.Add(Napi::Persistent(callback), deadline);
+        Inc(stats.requests);
+
+        Napi::Object res = Value();
+        auto req = std::make_unique<SendRequest>(env, res, port, groups, data, callback, std::move(buffers), nbufs + 1);
+        struct nlmsghdr& hdr = req->header;
+        memcpy(&hdr, data_buffers[0].iov_base, sizeof(hdr));
+        hdr.nlmsg_flags |= NLM_F_REQUEST | NLM_F_ACK;
+        hdr.nlmsg_seq = seq;
+        hdr.nlmsg_pid = local_port;
+        req->buffers[0].iov_base = &hdr;
+        req->buffers[0].iov_len = sizeof(hdr);
+        req->request_seq = seq;
+        Enqueue(env, std::move(req));
+        ArmTimer();
+        return Napi::Number::New(env, seq);
+    }
+
+    std::unique_ptr<struct iovec[]> DataToIovecs(Napi::Env env, Napi::Value data, size_t& nbufs) {
         std::unique_ptr<struct iovec[]> buffers;
         if (data.IsBuffer()) {
             auto item = Napi::Buffer<char>(env, data);
@@ -312,11 +797,19 @@ class Socket : public Napi::ObjectWrap<Socket> {
         } else {
             throw Napi::TypeError::New(env, "Invalid data -- must be Buffer or Array of Buffers");
         }
+        return buffers;
+    }
 
+    void Enqueue(Napi::Env env, std::unique_ptr<SendRequest> req) {
         bool empty_queue = write_queue.empty() && completed_queue.empty();
-        Napi::Object res = Value();
-        write_queue.push(std::make_unique<SendRequest>(
-            env, res, port, groups, data, callback, std::move(buffers), nbufs));
+        write_queue.push_back(std::move(req));
+        if (!netlink) {
+            write_queue.back()->msg.msg_name = nullptr;
+            write_queue.back()->msg.msg_namelen = 0;
+        }
+        Max(stats.write_queue_max, write_queue.size());
+        if (corked)
+            return;
 
         if (empty_queue && !processing) {
             Sendmsg();
@@ -324,16 +817,66 @@ class Socket : public Napi::ObjectWrap<Socket> {
                 return;
         }
 
-        watcher->start(env, UV_READABLE | UV_WRITABLE, PollHandler);
+        StartWatcher(env, true);
+    }
+
+    // While corked, requests are only queued; uncorking sends them
+    // all (in as few sendmmsg() calls as possible)
+    void Cork(const CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        CheckOpen(env);
+        corked = true;
+    }
+
+    void Uncork(const CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        CheckOpen(env);
+        if (!corked) return;
+        corked = false;
+        if (write_queue.empty())
+            return;
+
+        if (!processing) {
+            Sendmsg();
+            if (write_queue.empty())
+                return;
+        }
+
+        StartWatcher(env, true);
+    }
+
+    // While paused, no datagrams are delivered (they queue up in the
+    // socket, or the ring if the receive thread is used)
+    void Pause(const CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        CheckOpen(env);
+        if (paused) return;
+        paused = true;
+        StartWatcher(env, !write_queue.empty() && !corked);
+    }
+
+    void Resume(const CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        CheckOpen(env);
+        if (!paused) return;
+        paused = false;
+        StartWatcher(env, !write_queue.empty() && !corked);
+        if (threaded) async->send();
     }
 
     static void TimerHandler(uv_timer_t* handle) {
         Socket* obj = static_cast<Socket*>(handle->data);
         Napi::HandleScope scope (obj->Env());
         assert(obj->async_res);
+        obj->fed = false;
+        obj->timer_deadline = 0;
         obj->Sendmsg();
         obj->RunCompleted();
         // FIXME: is this correct?
+        if (!obj->open) return;
+        obj->requests.Expire(uv_hrtime(), obj->finished_requests);
+        obj->RunRequests();
+        if (obj->open) obj->ArmTimer();
     }
 
     static void PollHandler(uv_poll_t* handle, int status, int events) {
@@ -349,7 +892,7 @@ class Socket : public Napi::ObjectWrap<Socket> {
         }
 
         if (events & UV_READABLE)
-            obj->Recvmsg();
+            obj->batch ? obj->RecvBatch() : obj->Recvmsg();
 
         if (events & UV_WRITABLE) {
             obj->Sendmsg();
@@ -360,13 +903,13 @@ class Socket : public Napi::ObjectWrap<Socket> {
     void Recvmsg() {
         // Prevent loop starvation when the data comes in as fast as (or faster than)
         // we can read it.
-        int count = 32;
+        int count = kReadLimit;
 
         while (count-- > 0) {
-            std::unique_ptr<char[]> data;
             struct sockaddr_nl addr {};
             struct iovec iov {};
             struct msghdr hdr {};
+            char control [kRecvControlSize];
             hdr.msg_name = &addr;
             hdr.msg_namelen = sizeof(addr);
             hdr.msg_iov = &iov;
@@ -374,33 +917,42 @@ class Socket : public Napi::ObjectWrap<Socket> {
             int flags = 0;
             int size = 0;
 
-            // if msg_buffer == 0, then peek first to determine buffer size
-            iov.iov_len = msg_buffer;
-            if (msg_buffer == 0) {
-                char tmpBuf [1];
-                iov.iov_base = tmpBuf;
-                iov.iov_len = sizeof(tmpBuf);
+            // in peeking mode, peek first to determine buffer size (MSG_TRUNC
+            // returns the real size, so only the header needs to be copied)
+            auto slab = recv_pool->Acquire();
+            if (peek) {
+                struct nlmsghdr peek_buf;
+                iov.iov_base = &peek_buf;
+                iov.iov_len = sizeof(peek_buf);
 
                 do {
                     size = recvmsg(fd, &hdr, flags | MSG_PEEK | MSG_TRUNC);
+                    Inc(stats.recv_calls);
                 } while (size == -1 && errno == EINTR);
-                iov.iov_base = NULL;
-                iov.iov_len = size;
+                if (size > 0 && (size_t)size > slab->capacity) {
+                    recv_pool->Learn(size);
+                    recv_pool->Release(std::move(slab));
+                    slab = recv_pool->Acquire();
+                }
             }
 
-            // allocate buffer, perform actual read
+            // perform actual read
             if (size >= 0) {
-                data = std::make_unique<char[]>(iov.iov_len);
-                iov.iov_base = data.get();
-                if (iov.iov_len > 0 && iov.iov_base == NULL) break;
+                iov.iov_base = slab->data.get();
+                iov.iov_len = slab->capacity;
+                hdr.msg_control = control;
+                hdr.msg_controllen = sizeof(control);
 
                 do {
                     size = recvmsg(fd, &hdr, flags | MSG_TRUNC);
+                    Inc(stats.recv_calls);
                 } while (size == -1 && errno == EINTR);
             }
 
             // break on error (calling error_callback if needed)
             if (size == -1) {
+                CountRecvError(errno);
+                recv_pool->Release(std::move(slab));
                 if (!(errno == EAGAIN || errno == EWOULDBLOCK)) {
                     Napi::Env env = Env();
                     Napi::HandleScope scope (env);
@@ -410,44 +962,453 @@ class Socket : public Napi::ObjectWrap<Socket> {
                 break;
             }
 
+            CountRecv(size, hdr.msg_flags & MSG_TRUNC);
+            if (capture)
+                capture->Record(false, addr.nl_pid, addr.nl_groups, &iov, 1, size);
+
+            // in adaptive mode, a truncated read means the slab was too small;
+            // the datagram is lost (reported as truncated), later reads use the
+            // learned size
+            if ((hdr.msg_flags & MSG_TRUNC) && adaptive)
+                recv_pool->Learn(size);
+
             Napi::Env env = Env();
             Napi::HandleScope scope (env);
 
-            // wrap result into Buffer (transferring ownership), call read_callback
-            auto buf = Napi::Buffer<char>::New(env, data.release(), std::min((size_t)size, iov.iov_len), deleteFinalizer);
+            // wrap result into Buffer, call read_callback
+            auto buf = recv_pool->Wrap(env, std::move(slab), std::min((size_t)size, iov.iov_len));
+            DeliverDatagram(env, buf, addr, hdr.msg_namelen, size, hdr.msg_flags & MSG_TRUNC, GetNsid(&hdr));
 
-            auto rinfo = nlsockaddrToObject(env, addr, hdr.msg_namelen);
-            if (hdr.msg_flags & MSG_TRUNC)
-                rinfo["truncated"] = Napi::Number::New(env, size);
+            // callback may decide to close or pause the socket
+            if (fd == -1 || paused) break;
+        }
+        if (count < 0)
+            Inc(stats.read_limit_hits);
+    }
+
+    void CountRecv(size_t size, bool truncated) {
+        Inc(stats.recv_datagrams);
+        Inc(stats.recv_bytes, size);
+        if (truncated)
+            Inc(stats.truncated);
+    }
 
-            read_callback.MakeCallback(Value(), { buf, rinfo }, *async_res);
+    void CountRecvError(int err) {
+        if (err == EAGAIN || err == EWOULDBLOCK)
+            Inc(stats.recv_eagain);
+        else if (err == ENOBUFS)
+            Inc(stats.recv_enobufs);
+        else
+            Inc(stats.recv_errors);
+    }
+
+    // Batch mode: drain up to kReadLimit datagrams with a single recvmmsg()
+    // into reusable slots, then pass them to JS in one call as a Buffer with
+    // all the datagrams concatenated, and a Uint32Array with an entry of
+    // (offset, length, port, groups, truncated, first message, message count,
+    // nsid, fleet member) for each of them. Messages are described in a third
+    // array, the framing index (see IndexMessages); message count is
+    // 0xFFFFFFFF if not indexed.
+    void RecvBatch() {
+        // unless msg_buffer was given, make slots as big as the receive buffer
+        // so that datagrams aren't truncated (see RecvSlots)
+        if (!msg_buffer && !batch_slot_size)
+            batch_slot_size = std::max(kBatchSlotSize, RecvBufferSize(fd));
+        size_t slot_size = msg_buffer ? msg_buffer : batch_slot_size;
+        if (!batch_slots.Reserve(slot_size)) {
+            Napi::Env env = Env();
+            Napi::HandleScope scope (env);
+            auto error = ErrnoException(env, errno, "mmap", "Couldn't allocate receive slots");
+            error_callback.MakeCallback(Value(), { error.Value() }, *async_res);
+            return;
+        }
 
-            // callback may decide to close the socket
-            if (fd == -1) break;
+        struct mmsghdr msgs [kReadLimit] {};
+        struct iovec iovs [kReadLimit];
+        struct sockaddr_nl addrs [kReadLimit] {};
+        char controls [kReadLimit][kRecvControlSize];
+        for (int i = 0; i < kReadLimit; i++) {
+            iovs[i].iov_base = batch_slots.Slot(i);
+            iovs[i].iov_len = slot_size;
+            msgs[i].msg_hdr.msg_name = &addrs[i];
+            msgs[i].msg_hdr.msg_namelen = sizeof(addrs[i]);
+            msgs[i].msg_hdr.msg_iov = &iovs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+            msgs[i].msg_hdr.msg_control = controls[i];
+            msgs[i].msg_hdr.msg_controllen = sizeof(controls[i]);
+        }
+
+        int count;
+        do {
+            count = recvmmsg(fd, msgs, kReadLimit, MSG_TRUNC | MSG_DONTWAIT, NULL);
+            Inc(stats.recv_calls);
+        } while (count == -1 && errno == EINTR);
+
+        Napi::Env env = Env();
+        Napi::HandleScope scope (env);
+
+        if (count == -1) {
+            CountRecvError(errno);
+            if (!(errno == EAGAIN || errno == EWOULDBLOCK)) {
+                auto error = ErrnoException(env, errno, "recvmmsg", "Error when receiving Netlink messages");
+                error_callback.MakeCallback(Value(), { error.Value() }, *async_res);
+            }
+            return;
+        }
+
+        if (count == kReadLimit)
+            Inc(stats.read_limit_hits);
+        batch_scratch.clear();
+        for (int i = 0; i < count; i++) {
+            size_t size = msgs[i].msg_len;
+            bool truncated = msgs[i].msg_hdr.msg_flags & MSG_TRUNC;
+            CountRecv(size, truncated);
+            if (msgs[i].msg_hdr.msg_namelen != sizeof(addrs[i]) || addrs[i].nl_family != AF_NETLINK)
+                addrs[i] = {}; // not a netlink peer, see nlsockaddrToObject
+            if (capture)
+                capture->Record(false, addrs[i].nl_pid, addrs[i].nl_groups, &iovs[i], 1, size);
+            batch_scratch.push_back({ (const char*) iovs[i].iov_base, std::min(size, slot_size), size, truncated, addrs[i],
+                GetNsid(&msgs[i].msg_hdr), 0 });
+
+            // if peeking was requested, grow slots so this doesn't happen again
+            if (truncated && !msg_buffer)
+                while (batch_slot_size < size) batch_slot_size *= 2;
+        }
+        DeliverBatch(env, batch_scratch);
+        for (int i = 0; i < count; i++)
+            batch_slots.Release(i, msgs[i].msg_len);
+    }
+
+    // Claim replies to native requests (only from the kernel, and if the
+    // datagram is complete). Returns false if nothing was claimed, otherwise
+    // claim_scratch holds the rest of the datagram.
+    bool ClaimReplies(const char* data, size_t length, uint32_t sender, bool truncated) {
+        if (requests.empty() || truncated || sender != 0) return false;
+        claim_scratch.clear();
+        return requests.Claim(data, length, local_port, claim_scratch, finished_requests);
+    }
+
+    // Call the callbacks of finished native requests
+    void RunRequests() {
+        Napi::Env env = Env();
+        while (open && !finished_requests.empty()) {
+            Napi::HandleScope scope (env);
+            auto req = std::move(finished_requests.front());
+            finished_requests.pop_front();
+            Napi::Value error = env.Undefined(), replies = env.Undefined(), rinfo = env.Undefined();
+            if (req.reason == NativeRequests::kReplied) {
+                auto data = new std::vector<char>(std::move(req.data));
+                replies = Napi::Buffer<char>::New(env, data->data(), data->size(), deleteVectorFinalizer, data);
+                struct sockaddr_nl kernel {};
+                rinfo = nlsockaddrToObject(env, kernel, 0);
+            } else if (req.reason == NativeRequests::kTimedOut) {
+                Inc(stats.request_timeouts);
+                error = Napi::Error::New(env, "Timeout has been reached").Value();
+            } else if (req.reason == NativeRequests::kCancelled) {
+                error = Napi::Error::New(env, "Socket has been closed").Value();
+            } else {
+                error = ErrnoException(env, req.reason, "sendmsg", "Error when sending Netlink message").Value();
+            }
+            req.payload.MakeCallback(Value(), { error, replies, rinfo }, *async_res);
+        }
+    }
+
+    // Validate framing of a datagram, call read_callback with it
+    void DeliverDatagram(Napi::Env env, Napi::Buffer<char> buf, const struct sockaddr_nl& addr,
+                         socklen_t namelen, size_t size, bool truncated, int32_t nsid) {
+        bool from_netlink = addr.nl_family == AF_NETLINK && namelen == sizeof(addr);
+        if (ClaimReplies(buf.Data(), buf.Length(), from_netlink ? addr.nl_pid : 0, truncated)) {
+            bool rest = !claim_scratch.empty();
+            if (rest)
+                buf = Napi::Buffer<char>::Copy(env, claim_scratch.data(), claim_scratch.size());
+            RunRequests();
+            if (!open) return;
+            ArmTimer();
+            if (!rest) return;
+        }
+
+        Napi::Value index = env.Undefined();
+        if (!truncated && index_messages) {
+            index_scratch.clear();
+            if (IndexMessages(buf.Data(), buf.Length(), 0, index_scratch))
+                index = IndexToArray(env, index_scratch);
+        }
+
+        auto rinfo = nlsockaddrToObject(env, addr, namelen, nsid);
+        if (truncated)
+            rinfo["truncated"] = Napi::Number::New(env, size);
+
+        uint64_t start = uv_hrtime();
+        read_callback.MakeCallback(Value(), { buf, rinfo, index }, *async_res);
+        stats.read_callback.Record(uv_hrtime() - start);
+    }
+
+    // Claim replies to native requests, then pass the rest to EmitBatch
+    void DeliverBatch(Napi::Env env, const std::vector<Datagram>& items) {
+        if (requests.empty())
+            return EmitBatch(env, items);
+
+        std::vector<Datagram> rest;
+        std::vector<std::vector<char>> rest_data;
+        bool claimed = false;
+        for (auto& item : items) {
+            if (!ClaimReplies(item.data, item.length, item.addr.nl_pid, item.truncated)) {
+                rest.push_back(item);
+                continue;
+            }
+            claimed = true;
+            if (claim_scratch.empty()) continue;
+            // moving the vector keeps its data in place
+            rest_data.push_back(std::move(claim_scratch));
+            claim_scratch = std::vector<char>();
+            auto& data = rest_data.back();
+            rest.push_back({ data.data(), data.size(), data.size(), false, item.addr, item.nsid, item.member });
+        }
+        if (claimed) {
+            RunRequests();
+            if (!open) return;
+            ArmTimer();
+        }
+        if (!rest.empty())
+            EmitBatch(env, rest);
+    }
+
+    // Concatenate datagrams into a single Buffer, build table and framing
+    // index, call read_callback with them (see RecvBatch)
+    void EmitBatch(Napi::Env env, const std::vector<Datagram>& items) {
+        size_t total = 0;
+        for (auto& item : items)
+            total += item.length;
+
+        auto buf = Napi::Buffer<char>::New(env, total);
+        auto table = Napi::Uint32Array::New(env, items.size() * kBatchEntrySize);
+        index_scratch.clear();
+        size_t offset = 0;
+        for (size_t i = 0; i < items.size(); i++) {
+            auto& item = items[i];
+            memcpy(buf.Data() + offset, item.data, item.length);
+            FillBatchEntry(&table[i * kBatchEntrySize], buf.Data(), offset, item, index_messages, index_scratch);
+            offset += item.length;
+        }
+
+        auto index = IndexToArray(env, index_scratch);
+        uint64_t start = uv_hrtime();
+        read_callback.MakeCallback(Value(), { buf, table, index }, *async_res);
+        stats.read_callback.Record(uv_hrtime() - start);
+    }
+
+    // Receive thread (if the `thread` option is set): waits for datagrams
+    // and queues them into the ring, for AsyncHandler to deliver them.
+    // It must not touch any JS state.
+    void ReceiveLoop() {
+        std::vector<char> scratch (msg_buffer ? msg_buffer : kAdaptiveSlabSize);
+        struct pollfd fds [2] {};
+        fds[0].fd = fd;
+        fds[0].events = POLLIN;
+        fds[1].fd = wake_fd;
+        fds[1].events = POLLIN;
+
+        while (!closing) {
+            if (poll(fds, 2, -1) == -1) {
+                if (errno == EINTR) continue;
+                PushRecvError(errno);
+                return;
+            }
+            if (fds[1].revents) return;
+            auto capture = std::atomic_load(&this->capture);
+
+            int count = 0;
+            for (; count < kReadLimit && !closing; count++) {
+                auto item = std::make_unique<RecvItem>();
+                struct iovec iov {};
+                struct msghdr hdr {};
+                char control [kRecvControlSize];
+                hdr.msg_name = &item->addr;
+                hdr.msg_namelen = sizeof(item->addr);
+                hdr.msg_iov = &iov;
+                hdr.msg_iovlen = 1;
+                iov.iov_base = scratch.data();
+                iov.iov_len = scratch.size();
+                int size = 0;
+
+                // unless msg_buffer was given, peek first so we never truncate
+                if (!msg_buffer) {
+                    struct nlmsghdr peek_buf;
+                    iov.iov_base = &peek_buf;
+                    iov.iov_len = sizeof(peek_buf);
+                    do {
+                        size = recvmsg(fd, &hdr, MSG_PEEK | MSG_TRUNC);
+                        Inc(stats.recv_calls);
+                    } while (size == -1 && errno == EINTR);
+                    if (size > 0 && (size_t)size > scratch.size())
+                        scratch.resize(size);
+                    iov.iov_base = scratch.data();
+                    iov.iov_len = scratch.size();
+                }
+                if (size >= 0) {
+                    hdr.msg_control = control;
+                    hdr.msg_controllen = sizeof(control);
+                    do {
+                        size = recvmsg(fd, &hdr, MSG_TRUNC);
+                        Inc(stats.recv_calls);
+                    } while (size == -1 && errno == EINTR);
+                }
+
+                if (size == -1) {
+                    CountRecvError(errno);
+                    if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+                    // keep going after ENOBUFS, it only reports the kernel dropped something
+                    int err = errno;
+                    PushRecvError(err);
+                    if (err == ENOBUFS) continue;
+                    return;
+                }
+
+                item->size = size;
+                item->length = std::min((size_t)size, iov.iov_len);
+                item->truncated = hdr.msg_flags & MSG_TRUNC;
+                CountRecv(size, item->truncated);
+                item->namelen = hdr.msg_namelen;
+                item->nsid = GetNsid(&hdr);
+                if (capture)
+                    capture->Record(false, item->addr.nl_pid, item->addr.nl_groups, &iov, 1, size);
+                item->data = std::make_unique<char[]>(item->length);
+                memcpy(item->data.get(), scratch.data(), item->length);
+                if (!ring->Push(std::move(item), overflow_policy, closing) && !closing) {
+                    Inc(stats.ring_overflows);
+                    ring_overflow = true;
+                }
+            }
+            if (count == kReadLimit)
+                Inc(stats.read_limit_hits);
+            async->send();
+        }
+    }
+
+    void PushRecvError(int err) {
+        auto item = std::make_unique<RecvItem>();
+        item->error = err;
+        if (!ring->Push(std::move(item), overflow_policy, closing) && !closing) {
+            Inc(stats.ring_overflows);
+            ring_overflow = true;
+        }
+        async->send();
+    }
+
+    static void AsyncHandler(uv_async_t* handle) {
+        Socket* obj = static_cast<Socket*>(handle->data);
+        Napi::HandleScope scope (obj->Env());
+        assert(obj->async_res);
+        obj->DrainRing();
+    }
+
+    // Deliver datagrams queued by the receive thread (at most the ring
+    // size per call, to prevent loop starvation)
+    void DrainRing() {
+        Napi::Env env = Env();
+        if (paused) return;
+
+        // report datagrams discarded because the ring was full, like the kernel does
+        uint64_t dropped = ring->dropped.exchange(0);
+        Inc(stats.ring_overflows, dropped);
+        if (ring_overflow.exchange(false) || dropped) {
+            auto error = ErrnoException(env, ENOBUFS, "recvmsg", "Receive ring overflowed, datagrams were lost");
+            error_callback.MakeCallback(Value(), { error.Value() }, *async_res);
+            if (fd == -1) return;
+        }
+
+        std::vector<std::unique_ptr<RecvItem>> items;
+        for (size_t budget = ring->Capacity(); budget > 0; budget--) {
+            auto item = ring->Pop();
+            if (item && !item->error) {
+                items.push_back(std::move(item));
+                if (!batch || items.size() >= (size_t)kReadLimit) FlushItems(env, items);
+            } else {
+                FlushItems(env, items);
+                if (!item) return;
+                auto error = ErrnoException(env, item->error, "recvmsg", "Error when receiving Netlink message");
+                error_callback.MakeCallback(Value(), { error.Value() }, *async_res);
+            }
+            // callback may decide to close or pause the socket
+            if (fd == -1 || paused) return;
+        }
+        FlushItems(env, items);
+        // budget exhausted, yield to the loop and continue later
+        if (fd != -1 && !paused) async->send();
+    }
+
+    void FlushItems(Napi::Env env, std::vector<std::unique_ptr<RecvItem>>& items) {
+        if (items.empty()) return;
+        if (batch) {
+            batch_scratch.clear();
+            for (auto& item : items)
+                batch_scratch.push_back({ item->data.get(), item->length, item->size, item->truncated, item->addr, item->nsid, 0 });
+            DeliverBatch(env, batch_scratch);
+        } else {
+            for (auto& item : items) {
+                Napi::HandleScope scope (env);
+                size_t length = item->length;
+                auto buf = Napi::Buffer<char>::New(env, item->data.release(), length, deleteFinalizer);
+                DeliverDatagram(env, buf, item->addr, item->namelen, item->size, item->truncated, item->nsid);
+                if (fd == -1) break;
+            }
         }
+        items.clear();
     }
 
     void Sendmsg() {
+        if (corked) return;
         while (!write_queue.empty()) {
-            SendRequest* req = write_queue.front().get();
+            // send as many queued requests as we can in a single call
+            struct mmsghdr msgs [kWriteLimit] {};
+            size_t count = std::min(write_queue.size(), (size_t) kWriteLimit);
+            for (size_t i = 0; i < count; i++)
+                msgs[i].msg_hdr = write_queue[i]->msg;
 
-            int size;
+            int sent;
             do {
-                size = sendmsg(fd, &req->msg, 0);
-            } while (size == -1 && errno == EINTR);
-
-            if (size == -1) {
-                if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS)
+                sent = sendmmsg(fd, msgs, count, 0);
+                Inc(stats.send_calls);
+            } while (sent == -1 && errno == EINTR);
+
+            // sendmmsg() only fails if the first request fails; the
+            // error for a later one will be reported on the next call
+            if (sent == -1) {
+                if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                    Inc(stats.send_eagain);
+                    break;
+                }
+                if (errno == ENOBUFS) {
+                    Inc(stats.send_enobufs);
                     break;
+                }
+                Inc(stats.send_errors);
+                write_queue.front()->status = -errno;
+                Complete();
+                continue;
             }
 
-            req->status = (size == -1 ? -errno : size);
-            completed_queue.push(std::move(write_queue.front()));
-            write_queue.pop();
-            Feed();
+            for (int i = 0; i < sent; i++) {
+                Inc(stats.send_datagrams);
+                Inc(stats.send_bytes, msgs[i].msg_len);
+                if (capture) {
+                    auto& req = *write_queue.front();
+                    capture->Record(true, req.addr.nl_pid, req.addr.nl_groups, req.msg.msg_iov, req.msg.msg_iovlen, msgs[i].msg_len);
+                }
+                write_queue.front()->status = msgs[i].msg_len;
+                Complete();
+            }
         }
     }
 
+    // Move the first request of write_queue to completed_queue
+    void Complete() {
+        completed_queue.push(std::move(write_queue.front()));
+        write_queue.pop_front();
+        Max(stats.completed_queue_max, completed_queue.size());
+        Feed();
+    }
+
     void RunCompleted() {
         Napi::HandleScope scope (Env());
         assert(!processing);
@@ -456,21 +1417,35 @@ class Socket : public Napi::ObjectWrap<Socket> {
         while (!completed_queue.empty()) {
             std::unique_ptr<SendRequest> req = std::move(completed_queue.front());
             completed_queue.pop();
+            if (req->request_seq) {
+                // native requests are finished by their replies, unless sending failed
+                if (req->status < 0)
+                    requests.Take(req->request_seq, -req->status, finished_requests);
+                continue;
+            }
             Napi::Value error = (req->status >= 0) ? Env().Undefined() :
                 ErrnoException(Env(), -req->status, "sendmsg", "Error when sending Netlink message").Value();
+            uint64_t start = uv_hrtime();
             req->callback.MakeCallback(Value(), { error }, *req);
+            stats.send_callback.Record(uv_hrtime() - start);
             if (fd == -1) return; // callback may decide to close the socket
         }
 
-        if (write_queue.empty())
-            // Pending queue and completion queue empty, stop watching for write
-            watcher->start(Env(), UV_READABLE, PollHandler);
+        if (write_queue.empty() || corked)
+            // Pending queue empty (or on hold) and completion queue empty, stop watching for write
+            StartWatcher(Env(), false);
             // XXX: catch exceptions in PollHandler / TimerHandler, call error
 
         processing = false;
+        RunRequests();
     }
 
     void Close(const CallbackInfo& info) {
+        // fail pending native requests, rather than dropping them silently
+        if (open) {
+            requests.TakeAll(NativeRequests::kCancelled, finished_requests);
+            RunRequests();
+        }
         DoClose();
     }
 
@@ -478,12 +1453,14 @@ class Socket : public Napi::ObjectWrap<Socket> {
         Napi::Env env = info.Env();
         CheckOpen(env);
         watcher->ref();
+        if (async) async->ref();
     }
 
     void Unref_(const CallbackInfo& info) {
         Napi::Env env = info.Env();
         CheckOpen(env);
         watcher->unref();
+        if (async) async->unref();
     }
 
     Napi::Value Address(const CallbackInfo& info) {
@@ -500,6 +1477,8 @@ class Socket : public Napi::ObjectWrap<Socket> {
         Napi::Env env = info.Env();
         unsigned int group = Napi::Number(env, info[0]);
         CheckOpen(env);
+        // the peer of an injected socket decides what it sends
+        if (!netlink) return;
         if (setsockopt(fd, SOL_NETLINK, NETLINK_ADD_MEMBERSHIP, &group, sizeof(group)))
             throw ErrnoException(env, errno, "setsockopt", "Couldn't add membership");
     }
@@ -508,6 +1487,7 @@ class Socket : public Napi::ObjectWrap<Socket> {
         Napi::Env env = info.Env();
         unsigned int group = Napi::Number(env, info[0]);
         CheckOpen(env);
+        if (!netlink) return;
         if (setsockopt(fd, SOL_NETLINK, NETLINK_DROP_MEMBERSHIP, &group, sizeof(group)))
             throw ErrnoException(env, errno, "setsockopt", "Couldn't drop membership");
     }
@@ -519,6 +1499,8 @@ class Socket : public Napi::ObjectWrap<Socket> {
         if (size <= 0) size = 32768;
         if (setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size)))
             throw ErrnoException(env, errno, "setsockopt", "Couldn't set receive buffer size");
+        if (batch_slot_size)
+            batch_slot_size = std::max(batch_slot_size, RecvBufferSize(fd));
     }
 
     Napi::Value GetRecvBufferSize(const CallbackInfo& info) {
@@ -552,21 +1534,659 @@ class Socket : public Napi::ObjectWrap<Socket> {
         return Napi::Number::New(env, size);
     }
 
+    void SetNetlinkOption(const CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        int option = Napi::Number(env, info[0]);
+        int value = Napi::Number(env, info[1]);
+        CheckOpen(env);
+        if (!netlink)
+            throw ErrnoException(env, ENOPROTOOPT, "setsockopt", "Couldn't set netlink option");
+        if (setsockopt(fd, SOL_NETLINK, option, &value, sizeof(value)))
+            throw ErrnoException(env, errno, "setsockopt", "Couldn't set netlink option");
+    }
+
+    Napi::Value GetNetlinkOption(const CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        int option = Napi::Number(env, info[0]);
+        CheckOpen(env);
+        int value = 0;
+        socklen_t len = sizeof(value);
+        if (!netlink)
+            throw ErrnoException(env, ENOPROTOOPT, "getsockopt", "Couldn't get netlink option");
+        if (getsockopt(fd, SOL_NETLINK, option, &value, &len))
+            throw ErrnoException(env, errno, "getsockopt", "Couldn't get netlink option");
+        return Napi::Number::New(env, value);
+    }
+
+    void AttachFilter(const CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        auto program = Napi::Buffer<char>(env, info[0]);
+        CheckOpen(env);
+        if (program.Length() % sizeof(struct sock_filter) || !program.Length() ||
+                program.Length() / sizeof(struct sock_filter) > BPF_MAXINSNS)
+            throw Napi::RangeError::New(env, "Invalid filter program length");
+        // copy the program to ensure alignment
+        std::vector<struct sock_filter> filter (program.Length() / sizeof(struct sock_filter));
+        memcpy(filter.data(), program.Data(), program.Length());
+        struct sock_fprog fprog {};
+        fprog.len = filter.size();
+        fprog.filter = filter.data();
+        if (setsockopt(fd, SOL_SOCKET, SO_ATTACH_FILTER, &fprog, sizeof(fprog)))
+            throw ErrnoException(env, errno, "setsockopt", "Couldn't attach filter");
+    }
+
+    void DetachFilter(const CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        CheckOpen(env);
+        int dummy = 0;
+        if (setsockopt(fd, SOL_SOCKET, SO_DETACH_FILTER, &dummy, sizeof(dummy)))
+            throw ErrnoException(env, errno, "setsockopt", "Couldn't detach filter");
+    }
+
+    void LockFilter(const CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        CheckOpen(env);
+        int value = 1;
+        if (setsockopt(fd, SOL_SOCKET, SO_LOCK_FILTER, &value, sizeof(value)))
+            throw ErrnoException(env, errno, "setsockopt", "Couldn't lock filter");
+    }
+
+    // Start teeing datagrams into a pcap file (see capture.h)
+    void StartCapture(const CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        std::string path = Napi::String(env, info[0]).Utf8Value();
+        size_t max_buffered = (unsigned int) Napi::Number(env, info[1]);
+        uint32_t snaplen = Napi::Number(env, info[2]).Uint32Value();
+        CheckOpen(env);
+        if (capture)
+            throw Napi::Error::New(env, "Capture already running");
+
+        int file = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (file == -1)
+            throw ErrnoException(env, errno, "open", "Couldn't open capture file");
+        auto instance = std::make_shared<Capture>(file, protocol, max_buffered, snaplen);
+        if (int err = instance->Start())
+            throw ErrnoException(env, err, "write", "Couldn't write capture file");
+        // the receive thread picks it up on its next wakeup
+        std::atomic_store(&capture, instance);
+    }
+
+    // Stop capturing, flush the file and return the capture counters
+    Napi::Value StopCapture(const CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        CheckOpen(env);
+        auto instance = std::atomic_exchange(&capture, std::shared_ptr<Capture>());
+        if (!instance)
+            return env.Undefined();
+        instance->Stop();
+        if (int err = instance->error.load())
+            throw ErrnoException(env, err, "write", "Couldn't write capture file");
+        return CaptureToObject(env, *instance);
+    }
+
+    static Napi::Object CaptureToObject(Napi::Env env, const Capture& capture) {
+        auto result = Napi::Object::New(env);
+        result["packets"] = Napi::Number::New(env, capture.packets.load());
+        result["bytes"] = Napi::Number::New(env, capture.bytes.load());
+        result["dropped"] = Napi::Number::New(env, capture.dropped.load());
+        return result;
+    }
+
+    static Napi::Object HistogramToObject(Napi::Env env, const LatencyHistogram& histogram) {
+        auto result = Napi::Object::New(env);
+        auto buckets = Napi::Array::New(env, LatencyHistogram::kBuckets);
+        for (int i = 0; i < LatencyHistogram::kBuckets; i++)
+            buckets[i] = Napi::Number::New(env, histogram.buckets[i].load());
+        result["count"] = Napi::Number::New(env, histogram.count.load());
+        result["totalNs"] = Napi::Number::New(env, histogram.total_ns.load());
+        result["maxNs"] = Napi::Number::New(env, histogram.max_ns.load());
+        result["buckets"] = buckets;
+        return result;
+    }
+
+    Napi::Value Stats(const CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        CheckOpen(env);
+        auto num = [&](const Counter& counter) { return Napi::Number::New(env, counter.load()); };
+
+        auto recv = Napi::Object::New(env);
+        recv["calls"] = num(stats.recv_calls);
+        recv["datagrams"] = num(stats.recv_datagrams);
+        recv["bytes"] = num(stats.recv_bytes);
+        recv["eagain"] = num(stats.recv_eagain);
+        recv["enobufs"] = num(stats.recv_enobufs);
+        recv["errors"] = num(stats.recv_errors);
+        recv["truncated"] = num(stats.truncated);
+        recv["readLimitHits"] = num(stats.read_limit_hits);
+        recv["ringOverflows"] = Napi::Number::New(env, stats.ring_overflows.load() + (ring ? ring->dropped.load() : 0));
+
+        auto send = Napi::Object::New(env);
+        send["calls"] = num(stats.send_calls);
+        send["datagrams"] = num(stats.send_datagrams);
+        send["bytes"] = num(stats.send_bytes);
+        send["eagain"] = num(stats.send_eagain);
+        send["enobufs"] = num(stats.send_enobufs);
+        send["errors"] = num(stats.send_errors);
+        send["writeQueue"] = Napi::Number::New(env, write_queue.size());
+        send["writeQueueMax"] = num(stats.write_queue_max);
+        send["completedQueue"] = Napi::Number::New(env, completed_queue.size());
+        send["completedQueueMax"] = num(stats.completed_queue_max);
+
+        auto native_requests = Napi::Object::New(env);
+        native_requests["sent"] = num(stats.requests);
+        native_requests["pending"] = Napi::Number::New(env, requests.size());
+        native_requests["timeouts"] = num(stats.request_timeouts);
+
+        auto result = Napi::Object::New(env);
+        result["recv"] = recv;
+        result["send"] = send;
+        result["requests"] = native_requests;
+        result["readCallback"] = HistogramToObject(env, stats.read_callback);
+        result["sendCallback"] = HistogramToObject(env, stats.send_callback);
+        if (capture)
+            result["capture"] = CaptureToObject(env, *capture);
+
+        // kernel side counters (netlink doesn't implement SO_RXQ_OVFL, but
+        // SO_MEMINFO includes the socket's drop count); omitted if unsupported
+#ifdef SO_MEMINFO
+        uint32_t meminfo [SK_MEMINFO_VARS] {};
+        socklen_t len = sizeof(meminfo);
+        if (getsockopt(fd, SOL_SOCKET, SO_MEMINFO, meminfo, &len) == 0) {
+            auto kernel = Napi::Object::New(env);
+            kernel["rmemAlloc"] = Napi::Number::New(env, meminfo[SK_MEMINFO_RMEM_ALLOC]);
+            kernel["rcvbuf"] = Napi::Number::New(env, meminfo[SK_MEMINFO_RCVBUF]);
+            kernel["wmemAlloc"] = Napi::Number::New(env, meminfo[SK_MEMINFO_WMEM_ALLOC]);
+            kernel["sndbuf"] = Napi::Number::New(env, meminfo[SK_MEMINFO_SNDBUF]);
+            kernel["backlog"] = Napi::Number::New(env, meminfo[SK_MEMINFO_BACKLOG]);
+            kernel["drops"] = Napi::Number::New(env, meminfo[SK_MEMINFO_DROPS]);
+            result["kernel"] = kernel;
+        }
+#endif
+
+        return result;
+    }
+
     bool open;
+    int protocol;
+    /** False if an injected socket of another family (i.e. AF_UNIX) is used */
+    bool netlink = true;
     size_t msg_buffer;
+    bool batch = false;
+    bool peek = false;
+    bool adaptive = false;
+    std::shared_ptr<RecvPool> recv_pool;
+    bool index_messages = false;
+    std::vector<uint32_t> index_scratch;
+    SocketStats stats;
+    std::vector<Datagram> batch_scratch;
+    bool threaded = false;
+    std::unique_ptr<Ring<RecvItem>> ring;
+    OverflowPolicy overflow_policy = OverflowPolicy::Flag;
+    std::atomic<bool> ring_overflow {false};
+    std::atomic<bool> closing {false};
+    FileDescriptor wake_fd;
+    std::unique_ptr<UvAsync, UvAsync::Deleter> async;
+    std::thread recv_thread;
+    /**
+     * Active capture, if any. The JS thread is the only writer, so it
+     * reads it directly; the receive thread must use std::atomic_load.
+     */
+    std::shared_ptr<Capture> capture;
+    /** Slot size for batched reads if msg_buffer == 0 (0 until the first read) */
+    size_t batch_slot_size = 0;
+    RecvSlots batch_slots;
     Napi::FunctionReference read_callback;
     Napi::FunctionReference error_callback;
     FileDescriptor fd;
     std::unique_ptr<UvTimer, UvTimer::Deleter> timer;
     std::unique_ptr<UvPoll, UvPoll::Deleter> watcher;
     std::unique_ptr<Napi::AsyncContext> async_res;
-    std::queue<std::unique_ptr<SendRequest>> write_queue;
+    std::deque<std::unique_ptr<SendRequest>> write_queue;
     std::queue<std::unique_ptr<SendRequest>> completed_queue;
     bool processing = false;
+    NativeRequests requests;
+    std::deque<NativeRequests::Finished> finished_requests;
+    std::vector<char> claim_scratch;
+    uint32_t local_port = 0;
+    // whether the timer is armed for send completions (see Feed),
+    // otherwise the request deadline it's armed for (0 if none)
+    bool fed = false;
+    uint64_t timer_deadline = 0;
+    bool corked = false;
+    bool paused = false;
 };
 
+/**
+ * Set of netlink sockets (typically one per network namespace) driven
+ * from a single epoll set, so that the whole fleet costs one poll handle
+ * and one callback per wakeup. The callback gets the datagrams of every
+ * member that was ready, in the batch format (see Socket::RecvBatch) with
+ * the member column set. Members are plain sockets: they have no send
+ * queue or request tracking, sends are done synchronously.
+ */
+class Fleet : public Napi::ObjectWrap<Fleet> {
+  public:
+    // Maximum amount of ready members handled per poll event
+    static const int kMaxEvents = 64;
+
+    static Napi::Object Init(Napi::Env env, Napi::Object exports) {
+        Napi::Function func = DefineClass(env, "NativeNetlinkFleet", {
+            InstanceMethod<&Fleet::Add>("add"),
+            InstanceMethod<&Fleet::Remove>("remove"),
+            InstanceMethod<&Fleet::Send>("send"),
+            InstanceMethod<&Fleet::Address>("address"),
+            InstanceMethod<&Fleet::AddMembership>("addMembership"),
+            InstanceMethod<&Fleet::DropMembership>("dropMembership"),
+            InstanceMethod<&Fleet::SetNetlinkOption>("setNetlinkOption"),
+            InstanceMethod<&Fleet::SetRecvBufferSize>("setRecvBufferSize"),
+            InstanceMethod<&Fleet::Close>("close"),
+            InstanceMethod<&Fleet::Ref_>("ref"),
+            InstanceMethod<&Fleet::Unref_>("unref"),
+        });
+        exports.Set("NativeNetlinkFleet", func);
+        return exports;
+    }
+
+    Fleet(const CallbackInfo& info): Napi::ObjectWrap<Fleet>(info) {
+        Napi::Env env = info.Env();
+        uv_loop_t* loop = nullptr;
+        NAPI_THROW_IF_FAILED_VOID(env, napi_get_uv_event_loop(env, &loop));
+
+        protocol = Napi::Number(env, info[0]);
+        // weak references, see Socket
+        read_callback = Napi::Weak(Napi::Function(env, info[1]));
+        error_callback = Napi::Weak(Napi::Function(env, info[2]));
+        Value().DefineProperty(Napi::PropertyDescriptor::Value("readCallback", read_callback.Value(), napi_default));
+        Value().DefineProperty(Napi::PropertyDescriptor::Value("errorCallback", error_callback.Value(), napi_default));
+        if (info[3].IsObject())
+            index_messages = info[3].As<Napi::Object>().Get("index").ToBoolean();
+
+        epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+        if (epoll_fd == -1)
+            throw ErrnoException(env, errno, "epoll_create1", "Couldn't create epoll set");
+        watcher = UvPoll::New(env, loop, epoll_fd);
+        watcher->setData(this);
+        watcher->start(env, UV_READABLE, PollHandler);
+        async_res = std::make_unique<Napi::AsyncContext>(env, "netlink:NativeNetlinkFleet", Value());
+
+        Ref(); // don't garbage collect us until closed
+        open = true;
+    }
+
+  private:
+    struct Member {
+        FileDescriptor fd;
+        uint32_t port = 0;
+    };
+
+    void DoClose() {
+        if (!open) return;
+        open = false;
+        Unref();
+        // watcher has to be closed before its fd
+        watcher.reset();
+        members.clear();
+        epoll_fd.reset();
+        async_res.reset();
+    }
+    inline void CheckOpen(Napi::Env env) {
+        if (!open)
+            throw Napi::Error::New(env, "Netlink fleet is closed");
+    }
+    Member& GetMember(Napi::Env env, Napi::Value id) {
+        CheckOpen(env);
+        auto it = members.find(Napi::Number(env, id).Uint32Value());
+        if (it == members.end())
+            throw Napi::RangeError::New(env, "Unknown fleet member");
+        return *it->second;
+    }
+
+    // Creates a member socket (in the namespace given by netns, if any)
+    // bound to a port chosen by the kernel, and returns its id
+    Napi::Value Add(const CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        CheckOpen(env);
+        auto member = std::make_unique<Member>();
+        member->fd = CreateNetlinkSocket(env, protocol, info[0], SOCK_NONBLOCK);
+
+        struct sockaddr_nl addr {};
+        addr.nl_family = AF_NETLINK;
+        socklen_t len = sizeof(addr);
+        if (bind(member->fd, (sockaddr*) &addr, sizeof(addr)))
+            throw ErrnoException(env, errno, "bind", "Couldn't bind netlink socket");
+        if (getsockname(member->fd, (sockaddr*) &addr, &len))
+            throw ErrnoException(env, errno, "getsockname", "Couldn't get socket address");
+        member->port = addr.nl_pid;
+
+        uint32_t id;
+        do {
+            id = ++last_id;
+        } while (id == 0 || members.count(id));
+        struct epoll_event event {};
+        event.events = EPOLLIN;
+        event.data.u32 = id;
+        if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, member->fd, &event))
+            throw ErrnoException(env, errno, "epoll_ctl", "Couldn't add socket to epoll set");
+        // slots are as big as the biggest receive buffer (see RecvSlots)
+        slot_size = std::max(slot_size, RecvBufferSize(member->fd));
+        members.emplace(id, std::move(member));
+        return Napi::Number::New(env, id);
+    }
+
+    void Remove(const CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        Member& member = GetMember(env, info[0]);
+        epoll_ctl(epoll_fd, EPOLL_CTL_DEL, member.fd, nullptr);
+        members.erase(Napi::Number(env, info[0]).Uint32Value());
+    }
+
+    // Sends a datagram from a member, right away (port, groups, data)
+    void Send(const CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        Member& member = GetMember(env, info[0]);
+        struct sockaddr_nl addr {};
+        addr.nl_family = AF_NETLINK;
+        addr.nl_pid = Napi::Number(env, info[1]).Uint32Value();
+        addr.nl_groups = Napi::Number(env, info[2]).Uint32Value();
+        if (!info[3].IsBuffer())
+            throw Napi::TypeError::New(env, "Invalid data -- must be a Buffer");
+        auto data = info[3].As<Napi::Buffer<char>>();
+        ssize_t sent;
+        do {
+            sent = sendto(member.fd, data.Data(), data.Length(), 0, (sockaddr*) &addr, sizeof(addr));
+        } while (sent == -1 && errno == EINTR);
+        if (sent == -1)
+            throw ErrnoException(env, errno, "sendmsg", "Error when sending Netlink message");
+    }
+
+    Napi::Value Address(const CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        Member& member = GetMember(env, info[0]);
+        sockaddr_nl addr;
+        socklen_t len = sizeof(addr);
+        if (getsockname(member.fd, (sockaddr*) &addr, &len))
+            throw ErrnoException(env, errno, "getsockname", "Couldn't get socket address");
+        return nlsockaddrToObject(env, addr, len);
+    }
+
+    void AddMembership(const CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        Member& member = GetMember(env, info[0]);
+        unsigned int group = Napi::Number(env, info[1]);
+        if (setsockopt(member.fd, SOL_NETLINK, NETLINK_ADD_MEMBERSHIP, &group, sizeof(group)))
+            throw ErrnoException(env, errno, "setsockopt", "Couldn't add membership");
+    }
+
+    void DropMembership(const CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        Member& member = GetMember(env, info[0]);
+        unsigned int group = Napi::Number(env, info[1]);
+        if (setsockopt(member.fd, SOL_NETLINK, NETLINK_DROP_MEMBERSHIP, &group, sizeof(group)))
+            throw ErrnoException(env, errno, "setsockopt", "Couldn't drop membership");
+    }
+
+    void SetNetlinkOption(const CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        Member& member = GetMember(env, info[0]);
+        int option = Napi::Number(env, info[1]);
+        int value = Napi::Number(env, info[2]);
+        if (setsockopt(member.fd, SOL_NETLINK, option, &value, sizeof(value)))
+            throw ErrnoException(env, errno, "setsockopt", "Couldn't set netlink option");
+    }
+
+    void SetRecvBufferSize(const CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        Member& member = GetMember(env, info[0]);
+        int size = Napi::Number(env, info[1]);
+        if (size <= 0) size = 32768;
+        if (setsockopt(member.fd, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size)))
+            throw ErrnoException(env, errno, "setsockopt", "Couldn't set receive buffer size");
+        slot_size = std::max(slot_size, RecvBufferSize(member.fd));
+    }
+
+    void Close(const CallbackInfo& info) {
+        DoClose();
+    }
+
+    void Ref_(const CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        CheckOpen(env);
+        watcher->ref();
+    }
+
+    void Unref_(const CallbackInfo& info) {
+        Napi::Env env = info.Env();
+        CheckOpen(env);
+        watcher->unref();
+    }
+
+    static void PollHandler(uv_poll_t* handle, int status, int events) {
+        Fleet* obj = static_cast<Fleet*>(handle->data);
+        Napi::HandleScope scope (obj->Env());
+        assert(obj->async_res);
+
+        if (status != 0) {
+            auto error = ErrnoException(obj->Env(), -status, NULL, "error when polling epoll set");
+            obj->error_callback.MakeCallback(obj->Value(), { error.Value() }, *obj->async_res);
+            obj->DoClose();
+            return;
+        }
+        obj->Receive();
+    }
+
+    // Read the members that are ready (up to kReadLimit datagrams each,
+    // so that a busy one doesn't starve the rest; epoll is level-triggered
+    // so we'll be called again) and deliver everything in one callback,
+    // followed by the receive errors
+    void Receive() {
+        Napi::Env env = Env();
+        struct epoll_event events [kMaxEvents];
+        int count;
+        do {
+            count = epoll_wait(epoll_fd, events, kMaxEvents, 0);
+        } while (count == -1 && errno == EINTR);
+        if (count == -1) {
+            auto error = ErrnoException(env, errno, "epoll_wait", "Error when polling epoll set");
+            error_callback.MakeCallback(Value(), { error.Value() }, *async_res);
+            return;
+        }
+
+        arena.clear();
+        items.clear();
+        offsets.clear();
+        errors.clear();
+        for (int i = 0; i < count; i++) {
+            auto it = members.find(events[i].data.u32);
+            if (it != members.end())
+                ReadMember(it->first, *it->second);
+        }
+
+        if (!items.empty()) {
+            auto buf = Napi::Buffer<char>::Copy(env, arena.data(), arena.size());
+            auto table = Napi::Uint32Array::New(env, items.size() * kBatchEntrySize);
+            index_scratch.clear();
+            for (size_t i = 0; i < items.size(); i++)
+                FillBatchEntry(&table[i * kBatchEntrySize], buf.Data(), offsets[i], items[i], index_messages, index_scratch);
+            auto index = IndexToArray(env, index_scratch);
+            read_callback.MakeCallback(Value(), { buf, table, index }, *async_res);
+        }
+        for (auto& error : errors) {
+            if (!open) return;
+            auto e = ErrnoException(env, error.second, "recvmmsg", "Error when receiving Netlink messages");
+            error_callback.MakeCallback(Value(), { e.Value(), Napi::Number::New(env, error.first) }, *async_res);
+        }
+    }
+
+    // Receive datagrams of a member with recvmmsg() into the slots, and
+    // append them to the arena
+    void ReadMember(uint32_t id, Member& member) {
+        if (!slots.Reserve(slot_size)) {
+            errors.push_back({ id, errno });
+            return;
+        }
+        size_t slots_size = slots.Size();
+        struct mmsghdr msgs [kReadLimit] {};
+        struct iovec iovs [kReadLimit];
+        struct sockaddr_nl addrs [kReadLimit] {};
+        char controls [kReadLimit][kRecvControlSize];
+        for (int i = 0; i < kReadLimit; i++) {
+            iovs[i].iov_base = slots.Slot(i);
+            iovs[i].iov_len = slots_size;
+            msgs[i].msg_hdr.msg_name = &addrs[i];
+            msgs[i].msg_hdr.msg_namelen = sizeof(addrs[i]);
+            msgs[i].msg_hdr.msg_iov = &iovs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+            msgs[i].msg_hdr.msg_control = controls[i];
+            msgs[i].msg_hdr.msg_controllen = sizeof(controls[i]);
+        }
+
+        int count;
+        do {
+            count = recvmmsg(member.fd, msgs, kReadLimit, MSG_TRUNC | MSG_DONTWAIT, NULL);
+        } while (count == -1 && errno == EINTR);
+        if (count == -1) {
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+                errors.push_back({ id, errno });
+            return;
+        }
+
+        for (int i = 0; i < count; i++) {
+            size_t size = msgs[i].msg_len;
+            size_t length = std::min(size, slots_size);
+            bool truncated = msgs[i].msg_hdr.msg_flags & MSG_TRUNC;
+            // datagrams are lost if truncated, grow slots so this doesn't happen again
+            if (truncated)
+                while (slot_size < size) slot_size *= 2;
+            offsets.push_back(arena.size());
+            arena.insert(arena.end(), (const char*) iovs[i].iov_base, (const char*) iovs[i].iov_base + length);
+            slots.Release(i, size);
+            items.push_back({ nullptr, length, size, truncated, addrs[i], GetNsid(&msgs[i].msg_hdr), id });
+        }
+    }
+
+    Napi::FunctionReference read_callback;
+    Napi::FunctionReference error_callback;
+    std::unique_ptr<Napi::AsyncContext> async_res;
+    std::unique_ptr<UvPoll, UvPoll::Deleter> watcher;
+    FileDescriptor epoll_fd;
+    std::unordered_map<uint32_t, std::unique_ptr<Member>> members;
+    uint32_t last_id = 0;
+    int protocol = 0;
+    bool index_messages = false;
+    bool open = false;
+
+    // receive state (see Receive)
+    size_t slot_size = kBatchSlotSize;
+    RecvSlots slots;
+    std::vector<char> arena;
+    std::vector<Datagram> items;
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> index_scratch;
+    std::vector<std::pair<uint32_t, int>> errors;
+};
+
+/**
+ * Creates a pair of connected AF_UNIX SOCK_SEQPACKET sockets, returning
+ * their fds. Either can be passed to the `fd` option of NativeNetlink,
+ * so that the other end stands in for the kernel.
+ */
+Napi::Value SocketPair(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    int fds [2];
+    if (socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, fds))
+        throw ErrnoException(env, errno, "socketpair", "Couldn't create socket pair");
+    auto result = Napi::Array::New(env, 2);
+    result[(uint32_t) 0] = Napi::Number::New(env, fds[0]);
+    result[(uint32_t) 1] = Napi::Number::New(env, fds[1]);
+    return result;
+}
+
+// Key ids of the decoder tapes: __unknown, the message kinds, then the tables
+static const char* const kReservedKeys[] = { "__unknown", "link", "address", "route", "neighbor" };
+enum { kLinkKind = 1, kAddressKind, kRouteKind, kNeighborKind };
+static decoder::KeyTable* const kKeyTables[] = { &gen_rt::kKeyTable, &gen_ifla::kKeyTable };
+
+static std::once_flag key_ids_assigned;
+
+/** Assigns the key ids of the generated tables (once per process) */
+static void AssignKeyIds() {
+    uint32_t id = sizeof(kReservedKeys) / sizeof(kReservedKeys[0]);
+    for (decoder::KeyTable* table : kKeyTables) {
+        table->base = id;
+        id += table->count;
+    }
+}
+
+/** Returns all keys by id (Init runs once per env, i.e. per worker) */
+Napi::Array DecoderKeys(Napi::Env env) {
+    std::call_once(key_ids_assigned, AssignKeyIds);
+    auto keys = Napi::Array::New(env);
+    uint32_t id = 0;
+    for (const char* key : kReservedKeys)
+        keys[id++] = Napi::String::New(env, key);
+    for (const decoder::KeyTable* table : kKeyTables) {
+        for (uint32_t i = 0; i < table->count; i++)
+            keys[table->base + i] = Napi::String::New(env, table->keys[i]);
+    }
+    return keys;
+}
+
+/**
+ * Decodes rtnetlink messages into a tape (see decoder.h). Takes an
+ * ArrayBuffer holding the messages, a Uint32Array with the type, offset
+ * and length of each, the message count, and the tape (a Float64Array).
+ * Messages without a native decoder are written as a lone END. Returns
+ * false if the tape was too small (the caller retries with a bigger one).
+ */
+Napi::Value DecodeRtMessages(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    auto buffer = info[0].As<Napi::ArrayBuffer>();
+    auto frames = info[1].As<Napi::Uint32Array>();
+    uint32_t count = info[2].As<Napi::Number>().Uint32Value();
+    auto tape = info[3].As<Napi::Float64Array>();
+    const uint8_t* base = (const uint8_t*) buffer.Data();
+    size_t size = buffer.ByteLength();
+    if ((size_t) count * 3 > frames.ElementLength())
+        throw Napi::RangeError::New(env, "Message count exceeds frames");
+
+    decoder::Decoder d (tape.Data(), tape.ElementLength());
+    try {
+        for (uint32_t i = 0; i < count; i++) {
+            uint32_t type = frames[i * 3], offset = frames[i * 3 + 1], length = frames[i * 3 + 2];
+            if (offset > size || length > size - offset)
+                throw Napi::RangeError::New(env, "Message out of bounds");
+            const uint8_t* data = base + offset;
+            switch (type) {
+                case RTM_NEWLINK: case RTM_DELLINK: case RTM_GETLINK: case RTM_SETLINK:
+                    d.Message(kLinkKind, gen_rt::Link, gen_ifla::LinkAttrs, data, length);
+                    break;
+                case RTM_NEWADDR: case RTM_DELADDR: case RTM_GETADDR:
+                    d.Message(kAddressKind, gen_rt::Address, gen_rt::AddressAttrs, data, length);
+                    break;
+                case RTM_NEWROUTE: case RTM_DELROUTE: case RTM_GETROUTE:
+                    d.Message(kRouteKind, gen_rt::Route, gen_rt::RouteAttrs, data, length);
+                    break;
+                case RTM_NEWNEIGH: case RTM_DELNEIGH: case RTM_GETNEIGH:
+                    d.Message(kNeighborKind, gen_rt::Neighbor, gen_rt::NeighborAttrs, data, length);
+                    break;
+                default:
+                    d.Skip();
+            }
+        }
+    } catch (const decoder::DecodeError& e) {
+        throw Napi::Error::New(env, e.what());
+    } catch (const decoder::TapeFull&) {
+        return Napi::Boolean::New(env, false);
+    }
+    return Napi::Boolean::New(env, true);
+}
+
 Napi::Object Init(Napi::Env env, Napi::Object exports) {
     Socket::Init(env, exports);
+    Fleet::Init(env, exports);
+    exports.Set("socketpair", Napi::Function::New(env, SocketPair));
+    exports.Set("decoderKeys", DecoderKeys(env));
+    exports.Set("decodeRtMessages", Napi::Function::New(env, DecodeRtMessages));
     return exports;
 }
 
@@ -0,0 +1,176 @@
+#ifndef NETLINK_CAPTURE_H
+#define NETLINK_CAPTURE_H
+
+#include <sys/uio.h>
+#include <arpa/inet.h>
+#include <time.h>
+#include <unistd.h>
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "stats.h"
+
+/**
+ * Tees sent and received datagrams into a pcap file, in the format
+ * of nlmon captures (LINKTYPE_NETLINK) so that Wireshark dissects them.
+ * Packets are appended to an in-memory buffer of bounded size, which a
+ * writer thread flushes to the file; if it's full, packets are dropped
+ * (and counted) instead of blocking the caller.
+ *
+ * Record() is thread safe, since both the JS thread and the receive
+ * thread call it.
+ */
+class Capture {
+  public:
+    /** pcap link type of nlmon devices */
+    static const uint32_t kLinkType = 253;
+    /** Magic of pcap files with nanosecond timestamps */
+    static const uint32_t kMagic = 0xA1B23C4D;
+    static const uint16_t kArphrdNetlink = 824;
+    static const uint16_t kPacketHost = 0;
+    static const uint16_t kPacketOutgoing = 4;
+    /** Size of the per-packet pcap header */
+    static const size_t kRecordHeaderSize = 16;
+    /** Size of the cooked header (like SLL) preceding each datagram */
+    static const size_t kCookedHeaderSize = 16;
+
+    /** Takes ownership of `fd` */
+    Capture(int fd, uint16_t protocol, size_t max_buffered, uint32_t snaplen):
+        fd(fd), protocol(protocol), max_buffered(max_buffered), snaplen(snaplen) {}
+    ~Capture() {
+        Stop();
+        close(fd);
+    }
+    Capture(const Capture&) = delete;
+    Capture& operator=(const Capture&) = delete;
+
+    /** Writes the file header and starts the writer thread. Returns an errno on failure. */
+    int Start() {
+        struct {
+            uint32_t magic;
+            uint16_t version_major, version_minor;
+            int32_t thiszone;
+            uint32_t sigfigs, snaplen, network;
+        } header = { kMagic, 2, 4, 0, 0, snaplen, kLinkType };
+        if (int err = WriteAll((const char*) &header, sizeof(header)))
+            return err;
+        writer = std::thread(&Capture::WriteLoop, this);
+        return 0;
+    }
+
+    /**
+     * Appends a datagram. `port` and `groups` are the peer's address,
+     * `size` is the datagram's original size (the data may be truncated).
+     */
+    void Record(bool outgoing, uint32_t port, uint32_t groups, const struct iovec* iov, size_t iovcnt, size_t size) {
+        size_t captured = 0;
+        for (size_t i = 0; i < iovcnt; i++)
+            captured += iov[i].iov_len;
+        captured = std::min(std::min(captured, size), (size_t) snaplen);
+        size_t length = kRecordHeaderSize + kCookedHeaderSize + captured;
+        struct timespec ts;
+        clock_gettime(CLOCK_REALTIME, &ts);
+
+        std::lock_guard<std::mutex> lock (mutex);
+        if (stopping || error.load(std::memory_order_relaxed) || pending.size() + length > max_buffered) {
+            Inc(dropped);
+            return;
+        }
+        size_t offset = pending.size();
+        pending.resize(offset + length);
+        char* p = pending.data() + offset;
+
+        // pcap record header, in host order
+        uint32_t record [4] = { (uint32_t) ts.tv_sec, (uint32_t) ts.tv_nsec,
+            (uint32_t) (kCookedHeaderSize + captured), (uint32_t) (kCookedHeaderSize + size) };
+        memcpy(p, record, sizeof(record));
+        p += sizeof(record);
+
+        // cooked header, in network order; the link-layer address holds port and groups
+        uint16_t cooked [3] = { htons(outgoing ? kPacketOutgoing : kPacketHost), htons(kArphrdNetlink), htons(8) };
+        uint32_t address [2] = { htonl(port), htonl(groups) };
+        uint16_t proto = htons(protocol);
+        memcpy(p, cooked, sizeof(cooked));
+        memcpy(p + 6, address, sizeof(address));
+        memcpy(p + 14, &proto, sizeof(proto));
+        p += kCookedHeaderSize;
+
+        // datagram, in host order like nlmon
+        for (size_t i = 0; i < iovcnt && captured; i++) {
+            size_t n = std::min(captured, iov[i].iov_len);
+            memcpy(p, iov[i].iov_base, n);
+            p += n;
+            captured -= n;
+        }
+        Inc(packets);
+        Inc(bytes, size);
+        // the writer only waits when the buffer is empty
+        if (offset == 0) cv.notify_one();
+    }
+
+    /** Flushes buffered packets and stops the writer thread */
+    void Stop() {
+        {
+            std::lock_guard<std::mutex> lock (mutex);
+            stopping = true;
+        }
+        cv.notify_one();
+        if (writer.joinable()) writer.join();
+    }
+
+    Counter packets {0};
+    Counter bytes {0};
+    /** Packets discarded because the buffer was full (or writing failed) */
+    Counter dropped {0};
+    /** If nonzero, writing failed with this errno and capture stopped */
+    std::atomic<int> error {0};
+
+  private:
+    int WriteAll(const char* data, size_t length) {
+        while (length) {
+            ssize_t n = write(fd, data, length);
+            if (n == -1) {
+                if (errno == EINTR) continue;
+                return errno;
+            }
+            data += n;
+            length -= n;
+        }
+        return 0;
+    }
+
+    // Swap the buffer out and write it, until stopped and drained
+    void WriteLoop() {
+        std::vector<char> buffer;
+        std::unique_lock<std::mutex> lock (mutex);
+        while (true) {
+            cv.wait(lock, [&] { return stopping || !pending.empty(); });
+            if (pending.empty()) return;
+            buffer.swap(pending);
+            lock.unlock();
+            if (int err = WriteAll(buffer.data(), buffer.size()))
+                error = err;
+            buffer.clear();
+            lock.lock();
+        }
+    }
+
+    const int fd;
+    const uint16_t protocol;
+    const size_t max_buffered;
+    const uint32_t snaplen;
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<char> pending;
+    bool stopping = false;
+    std::thread writer;
+};
+
+#endif // NETLINK_CAPTURE_H
@@ -0,0 +1,422 @@
+#ifndef NETLINK_DECODER_H
+#define NETLINK_DECODER_H
+
+#include <linux/netlink.h>
+#include <arpa/inet.h>
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+/**
+ * Table-driven decoder for the types defined under types/. The tables
+ * (src/gen_*.h) are emitted by scripts/generate_parser.ts from the same
+ * definitions as the TS parse* functions, indexed by attribute type so
+ * that dispatch is a bounds check and a lookup.
+ *
+ * Setting properties through N-API costs more than the whole TS decoding,
+ * so instead of creating objects the decoder validates and walks the data
+ * writing a tape, which JS replays to build the same objects parse* would
+ * (see lib/rt/native.ts). Errors are thrown as DecodeError, with the same
+ * messages as in TS.
+ *
+ * The tape is made of doubles. Each value is an opcode, a key and its
+ * operands; in objects the key is a key id, in maps it's the map key, and
+ * in arrays it's ignored. Offsets are relative to the message, and 64-bit
+ * integers are left for JS to read (at offset `at`).
+ *
+ *     NUMBER key x     STRING key start end    BYTES key start end
+ *     TRUE key         FALSE key               ENUM key name
+ *     BIGINT key at    SBIGINT key at          OBJECT/ARRAY/MAP key ... END
+ *
+ * Objects may also contain `UNPARSED type start end` entries, and values
+ * in objects may have the REPEATED bit (pushed into an array at key).
+ */
+namespace decoder {
+
+enum Op {
+    END = 0, NUMBER, STRING, BYTES, TRUE, FALSE, ENUM, BIGINT, SBIGINT,
+    OBJECT, ARRAY, MAP, UNPARSED,
+    REPEATED = 0x100,
+};
+
+/** Key id of `__unknown` (ids of generated tables start after it) */
+const uint32_t kUnknownKey = 0;
+
+enum class Kind : uint8_t {
+    U8, U16, U32, U64, S8, S16, S32, S64, U16be, U32be,
+    String, Flag, Bool, Data,
+    Attrs, Struct, Array, Map,
+};
+
+/** Transformation applied to integers (see processLower in the generator) */
+enum class Lower : uint8_t { None, Enum, Flags, EnumBits };
+
+/** Property names used by a set of tables, referenced by index */
+struct KeyTable {
+    const char* const* keys;
+    uint32_t count;
+    /** Id of the first key (assigned when the tables are registered) */
+    uint32_t base;
+};
+
+struct Attrs;
+struct Struct;
+
+struct EnumValue {
+    int64_t value;
+    uint16_t name;
+};
+
+struct Enum {
+    /** Sorted by value; for repeated values, the name the TS enum maps back to */
+    const EnumValue* values;
+    uint32_t count;
+    /** In declaration order, with field names (if used as bits, else null) */
+    const EnumValue* bits;
+    uint32_t bit_count;
+    const KeyTable* keys;
+};
+
+struct FlagValue {
+    int32_t mask;
+    uint16_t name;
+};
+
+struct Flags {
+    const FlagValue* values;
+    uint32_t count;
+    const KeyTable* keys;
+};
+
+struct Type {
+    Kind kind;
+    Lower lower;
+    const Enum* enumeration;
+    const Flags* flags;
+    const Attrs* attrs;
+    const Struct* structure;
+    /** Item type of arrays and maps */
+    const Type* item;
+    /** Arrays only: whether item types start at 0 */
+    bool zero;
+};
+
+/** Attribute of an attribute set; `name` is -1 for unused types */
+struct Field {
+    int32_t name;
+    Type type;
+    bool repeated;
+};
+
+/** Attribute set, with a field for each type starting at `first` */
+struct Attrs {
+    const Field* fields;
+    uint32_t count;
+    uint32_t first;
+    const KeyTable* keys;
+};
+
+/**
+ * Struct member. Data members are `size` bytes long; others are `count`
+ * items of `size` bytes (or a single one, if `count` is 0).
+ */
+struct Member {
+    uint16_t name;
+    Type type;
+    uint32_t offset;
+    uint32_t size;
+    uint32_t count;
+};
+
+struct Struct {
+    const char* name;
+    const Member* members;
+    uint32_t count;
+    /** Exact length, or minimum length if expandable */
+    uint32_t length;
+    bool expandable;
+    const KeyTable* keys;
+};
+
+class DecodeError : public std::runtime_error {
+  public:
+    explicit DecodeError(const std::string& message): std::runtime_error(message) {}
+};
+
+/** Thrown when the tape is full (the caller retries with a bigger one) */
+struct TapeFull {};
+
+/** Writes the tape of decoded messages into a caller-provided buffer */
+class Decoder {
+  public:
+    Decoder(double* tape, size_t capacity): tape(tape), capacity(capacity) {}
+
+    /** Tape entries written so far */
+    size_t size() const { return length; }
+
+    /**
+     * Decodes a message (a header followed by attributes) like the
+     * parse*Message functions, writing the header as an OBJECT with
+     * `kind` as key, followed by the attributes as another OBJECT.
+     */
+    void Message(double kind, const Struct& header, const Attrs& attrs, const uint8_t* data, size_t size) {
+        if (size < header.length)
+            throw DecodeError(std::string("Unexpected ") + header.name + " message length (" + std::to_string(size) + ")");
+        base = data;
+        Emit(OBJECT, kind);
+        DecodeStruct(header, data, header.length);
+        Emit(OBJECT, 0);
+        DecodeAttrs(attrs, data + header.length, size - header.length);
+    }
+
+    /** Writes a lone END in place of a message that isn't decoded */
+    void Skip() {
+        Emit(END);
+    }
+
+  private:
+    void DecodeStruct(const Struct& def, const uint8_t* data, size_t size) {
+        if (def.expandable ? size < def.length : size != def.length)
+            throw DecodeError(std::string("Unexpected length for ") + def.name);
+        for (uint32_t i = 0; i < def.count; i++) {
+            const Member& m = def.members[i];
+            const uint8_t* p = data + m.offset;
+            double key = Key(def.keys, m.name);
+            if (m.type.kind == Kind::Data) {
+                Emit(BYTES, key, Offset(p), Offset(p + m.size));
+            } else if (m.count) {
+                Emit(ARRAY, key);
+                for (uint32_t j = 0; j < m.count; j++)
+                    DecodeMember(m, 0, p + j * m.size);
+                Emit(END);
+            } else {
+                DecodeMember(m, key, p);
+            }
+        }
+        if (def.expandable && size > def.length)
+            Emit(UNPARSED, -1, Offset(data + def.length), Offset(data + size));
+        Emit(END);
+    }
+
+    // Struct members are read without checks (the struct's length was checked)
+    void DecodeMember(const Member& m, double key, const uint8_t* p) {
+        switch (m.type.kind) {
+            case Kind::U8: return Integer(m.type, key, Read<uint8_t>(p));
+            case Kind::U16: return Integer(m.type, key, Read<uint16_t>(p));
+            case Kind::U32: return Integer(m.type, key, Read<uint32_t>(p));
+            case Kind::S8: return Integer(m.type, key, Read<int8_t>(p));
+            case Kind::S16: return Integer(m.type, key, Read<int16_t>(p));
+            case Kind::S32: return Integer(m.type, key, Read<int32_t>(p));
+            case Kind::U16be: return Integer(m.type, key, ntohs(Read<uint16_t>(p)));
+            case Kind::U32be: return Integer(m.type, key, ntohl(Read<uint32_t>(p)));
+            case Kind::U64: return Emit(BIGINT, key, Offset(p));
+            case Kind::S64: return Emit(SBIGINT, key, Offset(p));
+            case Kind::Struct:
+                Emit(OBJECT, key);
+                return DecodeStruct(*m.type.structure, p, m.size);
+            default:
+                throw DecodeError("Unsupported struct member");
+        }
+    }
+
+    void DecodeAttrs(const Attrs& def, const uint8_t* data, size_t size) {
+        ForEachAttribute(data, size, [&](uint16_t type, const uint8_t* p, size_t n) {
+            uint32_t index = type - def.first;
+            if (type < def.first || index >= def.count || def.fields[index].name < 0)
+                return Emit(UNPARSED, type, Offset(p), Offset(p + n));
+            const Field& field = def.fields[index];
+            Value(field.type, Key(def.keys, field.name), p, n, field.repeated ? REPEATED : 0);
+        });
+        Emit(END);
+    }
+
+    void DecodeArray(const Type& type, const uint8_t* data, size_t size) {
+        uint32_t next = type.zero ? 0 : 1;
+        ForEachAttribute(data, size, [&](uint16_t t, const uint8_t* p, size_t n) {
+            if (t != next)
+                throw DecodeError("Non-sequential array types (expected " + std::to_string(next) +
+                    ", got " + std::to_string(t) + ")");
+            next++;
+            Value(*type.item, 0, p, n);
+        });
+        Emit(END);
+    }
+
+    void DecodeMap(const Type& type, const uint8_t* data, size_t size) {
+        ForEachAttribute(data, size, [&](uint16_t t, const uint8_t* p, size_t n) {
+            Value(*type.item, t, p, n);
+        });
+        Emit(END);
+    }
+
+    /** Decodes an attribute's payload */
+    void Value(const Type& type, double key, const uint8_t* data, size_t size, int flags = 0) {
+        switch (type.kind) {
+            case Kind::U8: return Integer(type, key, ReadExact<uint8_t>(data, size), flags);
+            case Kind::U16: return Integer(type, key, ReadExact<uint16_t>(data, size), flags);
+            case Kind::U32: return Integer(type, key, ReadExact<uint32_t>(data, size), flags);
+            case Kind::S8: return Integer(type, key, ReadExact<int8_t>(data, size), flags);
+            case Kind::S16: return Integer(type, key, ReadExact<int16_t>(data, size), flags);
+            case Kind::S32: return Integer(type, key, ReadExact<int32_t>(data, size), flags);
+            case Kind::U16be: return Integer(type, key, ntohs(ReadExact<uint16_t>(data, size)), flags);
+            case Kind::U32be: return Integer(type, key, ntohl(ReadExact<uint32_t>(data, size)), flags);
+            case Kind::U64:
+                CheckLength(size, 8);
+                return Emit(BIGINT | flags, key, Offset(data));
+            case Kind::S64:
+                CheckLength(size, 8);
+                return Emit(SBIGINT | flags, key, Offset(data));
+            case Kind::Flag:
+                CheckLength(size, 0);
+                return Emit(TRUE | flags, key);
+            case Kind::Bool: {
+                uint8_t b = ReadExact<uint8_t>(data, size);
+                if (b > 1)
+                    throw DecodeError("Expected 0 or 1, got " + std::to_string(b));
+                return Emit((b ? TRUE : FALSE) | flags, key);
+            }
+            case Kind::String:
+                if (!size || data[size - 1])
+                    throw DecodeError("Not null terminated");
+                return Emit(STRING | flags, key, Offset(data), Offset(data + size - 1));
+            case Kind::Data:
+                return Emit(BYTES | flags, key, Offset(data), Offset(data + size));
+            case Kind::Attrs:
+                Emit(OBJECT | flags, key);
+                return DecodeAttrs(*type.attrs, data, size);
+            case Kind::Struct:
+                Emit(OBJECT | flags, key);
+                return DecodeStruct(*type.structure, data, size);
+            case Kind::Array:
+                Emit(ARRAY | flags, key);
+                return DecodeArray(type, data, size);
+            case Kind::Map:
+                Emit(MAP | flags, key);
+                return DecodeMap(type, data, size);
+        }
+        throw DecodeError("Unknown type");
+    }
+
+    /** Applies the lower transformation (if any) to an integer */
+    void Integer(const Type& type, double key, double x, int flags = 0) {
+        switch (type.lower) {
+            case Lower::None:
+                return Emit(NUMBER | flags, key, x);
+            case Lower::Enum: {
+                const Enum& e = *type.enumeration;
+                const EnumValue* end = e.values + e.count;
+                const EnumValue* it = std::lower_bound(e.values, end, x,
+                    [](const EnumValue& v, double x) { return v.value < x; });
+                if (it != end && it->value == x)
+                    return Emit(ENUM | flags, key, Key(e.keys, it->name));
+                return Emit(NUMBER | flags, key, x);
+            }
+            case Lower::Flags: {
+                // like the JS bitwise ops, which turn the remaining value into an int32
+                const Flags& f = *type.flags;
+                Emit(OBJECT | flags, key);
+                for (uint32_t i = 0; i < f.count; i++) {
+                    int32_t r = ToInt32(x);
+                    if (r & f.values[i].mask) {
+                        Emit(TRUE, Key(f.keys, f.values[i].name));
+                        x = r & ~f.values[i].mask;
+                    }
+                }
+                if (x) Emit(NUMBER, kUnknownKey, x);
+                return Emit(END);
+            }
+            case Lower::EnumBits: {
+                const Enum& e = *type.enumeration;
+                int32_t r = ToInt32(x);
+                Emit(OBJECT | flags, key);
+                for (uint32_t i = 0; i < e.bit_count; i++)
+                    if (r & (1u << (e.bits[i].value & 31)))
+                        Emit(TRUE, Key(e.keys, e.bits[i].name));
+                return Emit(END);
+            }
+        }
+    }
+
+    template <class F> static void ForEachAttribute(const uint8_t* data, size_t size, F fn) {
+        while (size) {
+            if (size < 4)
+                throw DecodeError("Not enough data");
+            uint16_t length = Read<uint16_t>(data), type = Read<uint16_t>(data + 2);
+            if (length < 4 || size < length)
+                throw DecodeError("Invalid attribute length (" + std::to_string(length) + ")");
+            if (type & NLA_F_NET_BYTEORDER)
+                throw DecodeError("Unexpected attribute with NO set");
+            fn(type & NLA_TYPE_MASK, data + 4, length - 4);
+            size_t consumed = std::min((size_t) NLA_ALIGN(length), size);
+            data += consumed;
+            size -= consumed;
+        }
+    }
+
+    static void CheckLength(size_t size, size_t expected) {
+        if (size != expected)
+            throw DecodeError("Unexpected length (got " + std::to_string(size) +
+                ", expected " + std::to_string(expected) + ")");
+    }
+
+    template <class T> static T ReadExact(const uint8_t* data, size_t size) {
+        CheckLength(size, sizeof(T));
+        return Read<T>(data);
+    }
+
+    template <class T> static T Read(const uint8_t* data) {
+        T x;
+        memcpy(&x, data, sizeof(T));
+        return x;
+    }
+
+    static int32_t ToInt32(double x) {
+        return (int32_t) (uint32_t) (int64_t) x;
+    }
+
+    static double Key(const KeyTable* keys, uint16_t index) {
+        return keys->base + index;
+    }
+
+    double Offset(const uint8_t* p) const {
+        return p - base;
+    }
+
+    void Emit(int op) {
+        Reserve(1);
+        tape[length++] = op;
+    }
+    void Emit(int op, double key) {
+        Reserve(2);
+        tape[length++] = op;
+        tape[length++] = key;
+    }
+    void Emit(int op, double key, double a) {
+        Reserve(3);
+        tape[length++] = op;
+        tape[length++] = key;
+        tape[length++] = a;
+    }
+    void Emit(int op, double key, double a, double b) {
+        Reserve(4);
+        tape[length++] = op;
+        tape[length++] = key;
+        tape[length++] = a;
+        tape[length++] = b;
+    }
+    void Reserve(size_t n) {
+        if (capacity - length < n) throw TapeFull();
+    }
+
+    double* tape;
+    size_t capacity;
+    size_t length = 0;
+    /** Start of the message being decoded */
+    const uint8_t* base = nullptr;
+};
+
+} // namespace decoder
+
+#endif // NETLINK_DECODER_H
@@ -0,0 +1,2100 @@
+// Generated by scripts/generate_parser.ts from types/ifla.ts, do not edit
+#ifndef NETLINK_GEN_IFLA_H
+#define NETLINK_GEN_IFLA_H
+
+#include "decoder.h"
+
+namespace gen_ifla {
+
+using namespace decoder;
+
+const char* const kKeys[] = {
+    "EUI64",
+    "NONE",
+    "STABLE_PRIVACY",
+    "RANDOM",
+    "UNSPEC",
+    "HAIRPIN",
+    "private",
+    "vepa",
+    "bridge",
+    "passthru",
+    "source",
+    "ADD",
+    "DEL",
+    "FLUSH",
+    "SET",
+    "DISABLED",
+    "CHECK",
+    "STRICT",
+    "OFF",
+    "PHY",
+    "L2",
+    "L3",
+    "L3S",
+    "UNSET",
+    "INHERIT",
+    "GGSN",
+    "SGSN",
+    "AUTO",
+    "ENABLE",
+    "DISABLE",
+    "PREASSOCIATE",
+    "PREASSOCIATE_RR",
+    "ASSOCIATE",
+    "DISASSOCIATE",
+    "SUCCESS",
+    "INVALID_FORMAT",
+    "INSUFFICIENT_RESOURCES",
+    "UNUSED_VTID",
+    "VTID_VIOLATION",
+    "VTID_VERSION_VIOALTION",
+    "OUT_OF_SYNC",
+    "INPROGRESS",
+    "INVALID",
+    "BADSTATE",
+    "ERROR",
+    "DATAGRAM",
+    "CONNECTED",
+    "updateIfNoexist",
+    "skbMode",
+    "drvMode",
+    "hwMode",
+    "DRV",
+    "SKB",
+    "HW",
+    "MULTI",
+    "REBOOT",
+    "FEATURES",
+    "BONDING_FAILOVER",
+    "NOTIFY_PEERS",
+    "IGMP_RESEND",
+    "BONDING_OPTIONS",
+    "ingressDeaggregation",
+    "ingressMapCommands",
+    "ingressMapCksumv4",
+    "egressMapCksumv4",
+    "reorderHdr",
+    "gvrp",
+    "looseBinding",
+    "mvrp",
+    "bridgeBinding",
+    "PLUS_VID",
+    "RAW_PLUS_VID",
+    "PLUS_VID_NO_PAD",
+    "RAW_PLUS_VID_NO_PAD",
+    "LISTENING",
+    "LEARNING",
+    "FORWARDING",
+    "BLOCKING",
+    "master",
+    "self",
+    "VEB",
+    "VEPA",
+    "UNDEF",
+    "pvid",
+    "untagged",
+    "rangeBegin",
+    "rangeEnd",
+    "brentry",
+    "onlyOpts",
+    "TEMP_QUERY",
+    "PERM",
+    "TEMP",
+    "TEMPORARY",
+    "PERMANENT",
+    "offload",
+    "fastLeave",
+    "RX",
+    "TX",
+    "NO_LL_LEARN",
+    "FOU",
+    "GUE",
+    "MPLS",
+    "csum",
+    "csum6",
+    "remcsum",
+    "routing",
+    "key",
+    "seq",
+    "strict",
+    "rec",
+    "version",
+    "noKey",
+    "dontFragment",
+    "oam",
+    "critOpt",
+    "geneveOpt",
+    "vxlanOpt",
+    "nocache",
+    "erspanOpt",
+    "ERROR_ACTIVE",
+    "ERROR_WARNING",
+    "ERROR_PASSIVE",
+    "BUS_OFF",
+    "STOPPED",
+    "SLEEPING",
+    "loopback",
+    "listenonly",
+    "_3Samples",
+    "oneShot",
+    "berrReporting",
+    "fd",
+    "presumeAck",
+    "fdNonIso",
+    "rxPackets",
+    "txPackets",
+    "rxBytes",
+    "txBytes",
+    "rxErrors",
+    "txErrors",
+    "rxDropped",
+    "txDropped",
+    "multicast",
+    "collisions",
+    "rxLengthErrors",
+    "rxOverErrors",
+    "rxCrcErrors",
+    "rxFrameErrors",
+    "rxFifoErrors",
+    "rxMissedErrors",
+    "txAbortedErrors",
+    "txCarrierErrors",
+    "txFifoErrors",
+    "txHeartbeatErrors",
+    "txWindowErrors",
+    "rxCompressed",
+    "txCompressed",
+    "memStart",
+    "memEnd",
+    "baseAddr",
+    "irq",
+    "dma",
+    "port",
+    "address",
+    "broadcast",
+    "ifname",
+    "mtu",
+    "link",
+    "qdisc",
+    "stats",
+    "cost",
+    "priority",
+    "wireless",
+    "protinfo",
+    "txqlen",
+    "map",
+    "weight",
+    "operstate",
+    "linkmode",
+    "linkinfo",
+    "netNsPid",
+    "ifalias",
+    "numVf",
+    "vfinfoList",
+    "stats64",
+    "vfPorts",
+    "portSelf",
+    "afSpec",
+    "group",
+    "netNsFd",
+    "extMask",
+    "promiscuity",
+    "numTxQueues",
+    "numRxQueues",
+    "carrier",
+    "physPortId",
+    "carrierChanges",
+    "physSwitchId",
+    "linkNetnsid",
+    "physPortName",
+    "protoDown",
+    "gsoMaxSegs",
+    "gsoMaxSize",
+    "__pad",
+    "xdp",
+    "event",
+    "newNetnsid",
+    "targetNetnsid",
+    "carrierUpCount",
+    "carrierDownCount",
+    "newIfindex",
+    "minMtu",
+    "maxMtu",
+    "propList",
+    "altIfname",
+    "permAddress",
+    "conf",
+    "flags",
+    "mcast",
+    "cacheinfo",
+    "icmp6stats",
+    "token",
+    "addrGenMode",
+    "forwardDelay",
+    "helloTime",
+    "maxAge",
+    "ageingTime",
+    "stpState",
+    "vlanFiltering",
+    "vlanProtocol",
+    "groupFwdMask",
+    "rootId",
+    "bridgeId",
+    "rootPort",
+    "rootPathCost",
+    "topologyChange",
+    "topologyChangeDetected",
+    "helloTimer",
+    "tcnTimer",
+    "topologyChangeTimer",
+    "gcTimer",
+    "groupAddr",
+    "fdbFlush",
+    "mcastRouter",
+    "mcastSnooping",
+    "mcastQueryUseIfaddr",
+    "mcastQuerier",
+    "mcastHashElasticity",
+    "mcastHashMax",
+    "mcastLastMemberCnt",
+    "mcastStartupQueryCnt",
+    "mcastLastMemberIntvl",
+    "mcastMembershipIntvl",
+    "mcastQuerierIntvl",
+    "mcastQueryIntvl",
+    "mcastQueryResponseIntvl",
+    "mcastStartupQueryIntvl",
+    "nfCallIptables",
+    "nfCallIp6tables",
+    "nfCallArptables",
+    "vlanDefaultPvid",
+    "vlanStatsEnabled",
+    "mcastStatsEnabled",
+    "mcastIgmpVersion",
+    "mcastMldVersion",
+    "vlanStatsPerPort",
+    "multiBoolopt",
+    "prio",
+    "addr",
+    "state",
+    "mode",
+    "guard",
+    "protect",
+    "learning",
+    "unicastFlood",
+    "proxyarp",
+    "learningSync",
+    "proxyarpWifi",
+    "designatedPort",
+    "designatedCost",
+    "id",
+    "no",
+    "topologyChangeAck",
+    "configPending",
+    "messageAgeTimer",
+    "forwardDelayTimer",
+    "holdTimer",
+    "flush",
+    "multicastRouter",
+    "mcastFlood",
+    "mcastToUcast",
+    "vlanTunnel",
+    "bcastFlood",
+    "neighSuppress",
+    "isolated",
+    "backupPort",
+    "maxReasmLen",
+    "tstamp",
+    "reachableTime",
+    "retransTime",
+    "kind",
+    "data",
+    "xstats",
+    "slaveKind",
+    "slaveData",
+    "egressQos",
+    "ingressQos",
+    "protocol",
+    "mask",
+    "mapping",
+    "from",
+    "to",
+    "macaddrMode",
+    "macaddr",
+    "macaddrData",
+    "macaddrCount",
+    "table",
+    "sci",
+    "icvLen",
+    "cipherSuite",
+    "window",
+    "encodingSa",
+    "encrypt",
+    "incSci",
+    "es",
+    "scb",
+    "replayProtect",
+    "validation",
+    "ifId",
+    "local",
+    "ttl",
+    "tos",
+    "ageing",
+    "limit",
+    "portRange",
+    "proxy",
+    "rsc",
+    "l2miss",
+    "l3miss",
+    "group6",
+    "local6",
+    "udpCsum",
+    "udpZeroCsum6Tx",
+    "udpZeroCsum6Rx",
+    "remcsumTx",
+    "remcsumRx",
+    "gbp",
+    "remcsumNopartial",
+    "collectMetadata",
+    "label",
+    "gpe",
+    "ttlInherit",
+    "df",
+    "low",
+    "high",
+    "remote",
+    "remote6",
+    "devFd",
+    "fd0",
+    "fd1",
+    "pdpHashsize",
+    "role",
+    "activeSlave",
+    "miimon",
+    "updelay",
+    "downdelay",
+    "useCarrier",
+    "arpInterval",
+    "arpIpTarget",
+    "arpValidate",
+    "arpAllTargets",
+    "primary",
+    "primaryReselect",
+    "failOverMac",
+    "xmitHashPolicy",
+    "resendIgmp",
+    "numPeerNotif",
+    "allSlavesActive",
+    "minLinks",
+    "lpInterval",
+    "packetsPerSlave",
+    "adLacpRate",
+    "adSelect",
+    "adInfo",
+    "adActorSysPrio",
+    "adUserPortKey",
+    "adActorSystem",
+    "tlbDynamicLb",
+    "peerNotifDelay",
+    "aggregator",
+    "numPorts",
+    "actorKey",
+    "partnerKey",
+    "partnerMac",
+    "miiStatus",
+    "linkFailureCount",
+    "permHwaddr",
+    "queueId",
+    "adAggregatorId",
+    "adActorOperPortState",
+    "adPartnerOperPortState",
+    "x",
+    "mac",
+    "vlan",
+    "txRate",
+    "spoofchk",
+    "linkState",
+    "rate",
+    "rssQueryEn",
+    "trust",
+    "ibNodeGuid",
+    "ibPortGuid",
+    "vlanList",
+    "vf",
+    "qos",
+    "vlanProto",
+    "minTxRate",
+    "maxTxRate",
+    "setting",
+    "guid",
+    "profile",
+    "vsiType",
+    "instanceUuid",
+    "hostUuid",
+    "request",
+    "response",
+    "vsiMgrId",
+    "vsiTypeId",
+    "vsiTypeVersion",
+    "pkey",
+    "umcast",
+    "slave1",
+    "slave2",
+    "multicastSpec",
+    "supervisionAddr",
+    "seqNr",
+    "family",
+    "__pad1",
+    "__pad2",
+    "ifindex",
+    "filterMask",
+    "link64",
+    "linkXstats",
+    "linkXstatsSlave",
+    "linkOffloadXstats",
+    "bond",
+    "cpuHit",
+    "attached",
+    "progId",
+    "drvProgId",
+    "skbProgId",
+    "hwProgId",
+    "owner",
+    "type",
+    "pi",
+    "vnetHdr",
+    "persist",
+    "multiQueue",
+    "numQueues",
+    "numDisabledQueues",
+    "muxId",
+    "peer",
+    "vlanInfo",
+    "vlanTunnelInfo",
+    "vid",
+    "transitionBlk",
+    "transitionFwd",
+    "rxBpdu",
+    "txBpdu",
+    "rxTcn",
+    "txTcn",
+    "__reserved1",
+    "__reserved2",
+    "entry",
+    "info",
+    "range",
+    "mdb",
+    "router",
+    "timer",
+    "ip",
+    "proto",
+    "stp",
+    "igmpV1queries",
+    "igmpV2queries",
+    "igmpV3queries",
+    "igmpLeaves",
+    "igmpV1reports",
+    "igmpV2reports",
+    "igmpV3reports",
+    "igmpParseErrors",
+    "mldV1queries",
+    "mldV2queries",
+    "mldLeaves",
+    "mldV1reports",
+    "mldV2reports",
+    "mldParseErrors",
+    "mcastBytes",
+    "mcastPackets",
+    "encapLimit",
+    "flowinfo",
+    "pmtudisc",
+    "_6rdPrefix",
+    "_6rdRelayPrefix",
+    "_6rdPrefixlen",
+    "_6rdRelayPrefixlen",
+    "encapType",
+    "encapFlags",
+    "encapSport",
+    "encapDport",
+    "fwmark",
+    "__reserved",
+    "datalen",
+    "prefix",
+    "relayPrefix",
+    "prefixlen",
+    "relayPrefixlen",
+    "iflags",
+    "oflags",
+    "ikey",
+    "okey",
+    "ignoreDf",
+    "erspanIndex",
+    "erspanVer",
+    "erspanDir",
+    "erspanHwid",
+    "bitrate",
+    "samplePoint",
+    "tq",
+    "propSeg",
+    "phaseSeg1",
+    "phaseSeg2",
+    "sjw",
+    "brp",
+    "name",
+    "tseg1Min",
+    "tseg1Max",
+    "tseg2Min",
+    "tseg2Max",
+    "sjwMax",
+    "brpMin",
+    "brpMax",
+    "brpInc",
+    "freq",
+    "txerr",
+    "rxerr",
+    "busError",
+    "errorWarning",
+    "errorPassive",
+    "busOff",
+    "arbitrationLost",
+    "restarts",
+    "bittiming",
+    "bittimingConst",
+    "clock",
+    "ctrlmode",
+    "restartMs",
+    "restart",
+    "berrCounter",
+    "dataBittiming",
+    "dataBittimingConst",
+    "termination",
+    "terminationConst",
+    "bitrateConst",
+    "dataBitrateConst",
+    "bitrateMax",
+};
+
+/** Key ids are assigned when registering the tables (see DecoderKeys in binding.cc) */
+KeyTable kKeyTable = { kKeys, 564, 0 };
+
+extern const Enum In6AddrGenMode;
+extern const Enum BridgePortMode;
+extern const Flags MacvlanMode;
+extern const Enum MacvlanMacaddrMode;
+extern const Enum MacsecValidationType;
+extern const Enum MacsecOffload;
+extern const Enum IpvlanMode;
+extern const Enum VxlanDf;
+extern const Enum GeneveDf;
+extern const Enum GtpRole;
+extern const Enum VirtualFunctionLinkStateId;
+extern const Enum PortRequest;
+extern const Enum PortVdpResponse;
+extern const Enum PortProfileResponse;
+extern const Enum IpoibMode;
+extern const Flags XdpFlags;
+extern const Enum XdpAttached;
+extern const Enum Event;
+extern const Flags RmnetFlags;
+extern const Flags VlanFlags;
+extern const Enum VlanNameType;
+extern const Enum BridgeState;
+extern const Flags BridgeFlags;
+extern const Enum BridgeMode;
+extern const Flags BridgeVlanFlags;
+extern const Enum MdbRtrType;
+extern const Enum BridgeMdbState;
+extern const Flags MdbFlags;
+extern const Enum BridgeMcastDir;
+extern const Enum BridgeBooloptId;
+extern const Enum TunnelEncapTypes;
+extern const Flags TunnelEncapFlag;
+extern const Flags Tunnel;
+extern const Enum CanState;
+extern const Flags CanCtrlMode;
+extern const Struct LinkStats;
+extern const Struct LinkStats64;
+extern const Struct LinkInterfaceMap;
+extern const Attrs LinkAttrs;
+extern const Attrs LinkProtocolInfoInet;
+extern const Attrs LinkProtocolInfoInet6;
+extern const Attrs Bridge;
+extern const Struct BridgeId;
+extern const Attrs BridgePort;
+extern const Struct CacheInfo;
+extern const Attrs Info;
+extern const Attrs Vlan;
+extern const Struct VlanFlagsMask;
+extern const Attrs VlanQos;
+extern const Struct VlanQosMapping;
+extern const Attrs Macvlan;
+extern const Attrs Vrf;
+extern const Attrs VrfPort;
+extern const Attrs Macsec;
+extern const Attrs Xfrm;
+extern const Attrs Ipvlan;
+extern const Attrs Vxlan;
+extern const Struct VxlanPortRange;
+extern const Attrs Geneve;
+extern const Attrs Ppp;
+extern const Attrs Gtp;
+extern const Attrs Bond;
+extern const Attrs BondAdInfo;
+extern const Attrs BondSlave;
+extern const Attrs VirtualFunctionList;
+extern const Attrs VirtualFunction;
+extern const Struct VirtualFunctionMac;
+extern const Struct VirtualFunctionBroadcast;
+extern const Struct VirtualFunctionVlan;
+extern const Attrs VlanList;
+extern const Struct VirtualFunctionVlanInfo;
+extern const Struct VirtualFunctionTxRate;
+extern const Struct VirtualFunctionRate;
+extern const Struct VirtualFunctionSpoofchk;
+extern const Struct VirtualFunctionGuid;
+extern const Struct VirtualFunctionLinkState;
+extern const Struct VirtualFunctionRssQueryEn;
+extern const Attrs VirtualFunctionStats;
+extern const Struct VirtualFunctionTrust;
+extern const Attrs PortList;
+extern const Attrs Port;
+extern const Struct PortVsi;
+extern const Attrs Ipoib;
+extern const Attrs Hsr;
+extern const Struct IfStatsMsg;
+extern const Attrs Stats;
+extern const Attrs Xstats;
+extern const Attrs OffloadXstats;
+extern const Attrs Xdp;
+extern const Attrs Tun;
+extern const Attrs Rmnet;
+extern const Struct RmnetFlagsMask;
+extern const Attrs VethInfo;
+extern const Attrs BridgeSpec;
+extern const Struct BridgeVlanInfo;
+extern const Attrs BridgeVlanTunnel;
+extern const Struct BridgeVlanXstats;
+extern const Struct BridgeStpXstats;
+extern const Struct BridgeVlanMsg;
+extern const Attrs BridgeVlanDb;
+extern const Attrs BridgeVlanDbEntry;
+extern const Attrs Mdba;
+extern const Attrs MdbaMdb;
+extern const Attrs MdbaMdbEntry;
+extern const Attrs MdbaMdbEattr;
+extern const Attrs MdbaRouter;
+extern const Attrs MdbaRouterPattr;
+extern const Struct BridgePortMsg;
+extern const Struct _IpWithProto;
+extern const Struct BridgeMdbEntry;
+extern const Attrs MdbaSetEntry;
+extern const Attrs BridgeXstats;
+extern const Struct BridgeMcastStats;
+extern const Struct BridgeBooloptMask;
+extern const Attrs Iptun;
+extern const Struct IpTunnelPrl;
+extern const Struct IpTunnel6rd;
+extern const Attrs Gre;
+extern const Attrs Vti;
+extern const Struct CanBittiming;
+extern const Struct CanBittimingConst;
+extern const Struct CanClock;
+extern const Struct CanBerrCounter;
+extern const Struct CanCtrlModeMask;
+extern const Struct CanDeviceStats;
+extern const Attrs Can;
+
+const EnumValue In6AddrGenMode_values[] = {
+    { 0, 0 },
+    { 1, 1 },
+    { 2, 2 },
+    { 3, 3 },
+};
+
+const Enum In6AddrGenMode = { In6AddrGenMode_values, 4, nullptr, 0, &kKeyTable };
+
+const EnumValue BridgePortMode_values[] = {
+    { 0, 4 },
+    { 1, 5 },
+};
+
+const Enum BridgePortMode = { BridgePortMode_values, 2, nullptr, 0, &kKeyTable };
+
+const FlagValue MacvlanMode_values[] = {
+    { 1, 6 },
+    { 2, 7 },
+    { 4, 8 },
+    { 8, 9 },
+    { 16, 10 },
+};
+
+const Flags MacvlanMode = { MacvlanMode_values, 5, &kKeyTable };
+
+const EnumValue MacvlanMacaddrMode_values[] = {
+    { 0, 11 },
+    { 1, 12 },
+    { 2, 13 },
+    { 3, 14 },
+};
+
+const Enum MacvlanMacaddrMode = { MacvlanMacaddrMode_values, 4, nullptr, 0, &kKeyTable };
+
+const EnumValue MacsecValidationType_values[] = {
+    { 0, 15 },
+    { 1, 16 },
+    { 2, 17 },
+};
+
+const Enum MacsecValidationType = { MacsecValidationType_values, 3, nullptr, 0, &kKeyTable };
+
+const EnumValue MacsecOffload_values[] = {
+    { 0, 18 },
+    { 1, 19 },
+};
+
+const Enum MacsecOffload = { MacsecOffload_values, 2, nullptr, 0, &kKeyTable };
+
+const EnumValue IpvlanMode_values[] = {
+    { 0, 20 },
+    { 1, 21 },
+    { 2, 22 },
+};
+
+const Enum IpvlanMode = { IpvlanMode_values, 3, nullptr, 0, &kKeyTable };
+
+const EnumValue VxlanDf_values[] = {
+    { 0, 23 },
+    { 1, 14 },
+    { 2, 24 },
+};
+
+const Enum VxlanDf = { VxlanDf_values, 3, nullptr, 0, &kKeyTable };
+
+const EnumValue GeneveDf_values[] = {
+    { 0, 23 },
+    { 1, 14 },
+    { 2, 24 },
+};
+
+const Enum GeneveDf = { GeneveDf_values, 3, nullptr, 0, &kKeyTable };
+
+const EnumValue GtpRole_values[] = {
+    { 0, 25 },
+    { 1, 26 },
+};
+
+const Enum GtpRole = { GtpRole_values, 2, nullptr, 0, &kKeyTable };
+
+const EnumValue VirtualFunctionLinkStateId_values[] = {
+    { 0, 27 },
+    { 1, 28 },
+    { 2, 29 },
+};
+
+const Enum VirtualFunctionLinkStateId = { VirtualFunctionLinkStateId_values, 3, nullptr, 0, &kKeyTable };
+
+const EnumValue PortRequest_values[] = {
+    { 0, 30 },
+    { 1, 31 },
+    { 2, 32 },
+    { 3, 33 },
+};
+
+const Enum PortRequest = { PortRequest_values, 4, nullptr, 0, &kKeyTable };
+
+const EnumValue PortVdpResponse_values[] = {
+    { 0, 34 },
+    { 1, 35 },
+    { 2, 36 },
+    { 3, 37 },
+    { 4, 38 },
+    { 5, 39 },
+    { 6, 40 },
+};
+
+const Enum PortVdpResponse = { PortVdpResponse_values, 7, nullptr, 0, &kKeyTable };
+
+const EnumValue PortProfileResponse_values[] = {
+    { 256, 34 },
+    { 257, 41 },
+    { 258, 42 },
+    { 259, 43 },
+    { 260, 36 },
+    { 261, 44 },
+};
+
+const Enum PortProfileResponse = { PortProfileResponse_values, 6, nullptr, 0, &kKeyTable };
+
+const EnumValue IpoibMode_values[] = {
+    { 0, 45 },
+    { 1, 46 },
+};
+
+const Enum IpoibMode = { IpoibMode_values, 2, nullptr, 0, &kKeyTable };
+
+const FlagValue XdpFlags_values[] = {
+    { 1, 47 },
+    { 2, 48 },
+    { 4, 49 },
+    { 8, 50 },
+};
+
+const Flags XdpFlags = { XdpFlags_values, 4, &kKeyTable };
+
+const EnumValue XdpAttached_values[] = {
+    { 0, 1 },
+    { 1, 51 },
+    { 2, 52 },
+    { 3, 53 },
+    { 4, 54 },
+};
+
+const Enum XdpAttached = { XdpAttached_values, 5, nullptr, 0, &kKeyTable };
+
+const EnumValue Event_values[] = {
+    { 0, 1 },
+    { 1, 55 },
+    { 2, 56 },
+    { 3, 57 },
+    { 4, 58 },
+    { 5, 59 },
+    { 6, 60 },
+};
+
+const Enum Event = { Event_values, 7, nullptr, 0, &kKeyTable };
+
+const FlagValue RmnetFlags_values[] = {
+    { 1, 61 },
+    { 2, 62 },
+    { 4, 63 },
+    { 8, 64 },
+};
+
+const Flags RmnetFlags = { RmnetFlags_values, 4, &kKeyTable };
+
+const FlagValue VlanFlags_values[] = {
+    { 1, 65 },
+    { 2, 66 },
+    { 4, 67 },
+    { 8, 68 },
+    { 16, 69 },
+};
+
+const Flags VlanFlags = { VlanFlags_values, 5, &kKeyTable };
+
+const EnumValue VlanNameType_values[] = {
+    { 0, 70 },
+    { 1, 71 },
+    { 2, 72 },
+    { 3, 73 },
+};
+
+const Enum VlanNameType = { VlanNameType_values, 4, nullptr, 0, &kKeyTable };
+
+const EnumValue BridgeState_values[] = {
+    { 0, 15 },
+    { 1, 74 },
+    { 2, 75 },
+    { 3, 76 },
+    { 4, 77 },
+};
+
+const Enum BridgeState = { BridgeState_values, 5, nullptr, 0, &kKeyTable };
+
+const FlagValue BridgeFlags_values[] = {
+    { 1, 78 },
+    { 2, 79 },
+};
+
+const Flags BridgeFlags = { BridgeFlags_values, 2, &kKeyTable };
+
+const EnumValue BridgeMode_values[] = {
+    { 0, 80 },
+    { 1, 81 },
+    { 65535, 82 },
+};
+
+const Enum BridgeMode = { BridgeMode_values, 3, nullptr, 0, &kKeyTable };
+
+const FlagValue BridgeVlanFlags_values[] = {
+    { 1, 78 },
+    { 2, 83 },
+    { 4, 84 },
+    { 8, 85 },
+    { 16, 86 },
+    { 32, 87 },
+    { 64, 88 },
+};
+
+const Flags BridgeVlanFlags = { BridgeVlanFlags_values, 7, &kKeyTable };
+
+const EnumValue MdbRtrType_values[] = {
+    { 0, 15 },
+    { 1, 89 },
+    { 2, 90 },
+    { 3, 91 },
+};
+
+const Enum MdbRtrType = { MdbRtrType_values, 4, nullptr, 0, &kKeyTable };
+
+const EnumValue BridgeMdbState_values[] = {
+    { 0, 92 },
+    { 1, 93 },
+};
+
+const Enum BridgeMdbState = { BridgeMdbState_values, 2, nullptr, 0, &kKeyTable };
+
+const FlagValue MdbFlags_values[] = {
+    { 1, 94 },
+    { 2, 95 },
+};
+
+const Flags MdbFlags = { MdbFlags_values, 2, &kKeyTable };
+
+const EnumValue BridgeMcastDir_values[] = {
+    { 0, 96 },
+    { 1, 97 },
+};
+
+const Enum BridgeMcastDir = { BridgeMcastDir_values, 2, nullptr, 0, &kKeyTable };
+
+const EnumValue BridgeBooloptId_values[] = {
+    { 0, 98 },
+};
+
+const Enum BridgeBooloptId = { BridgeBooloptId_values, 1, nullptr, 0, &kKeyTable };
+
+const EnumValue TunnelEncapTypes_values[] = {
+    { 0, 1 },
+    { 1, 99 },
+    { 2, 100 },
+    { 3, 101 },
+};
+
+const Enum TunnelEncapTypes = { TunnelEncapTypes_values, 4, nullptr, 0, &kKeyTable };
+
+const FlagValue TunnelEncapFlag_values[] = {
+    { 1, 102 },
+    { 2, 103 },
+    { 4, 104 },
+};
+
+const Flags TunnelEncapFlag = { TunnelEncapFlag_values, 3, &kKeyTable };
+
+const FlagValue Tunnel_values[] = {
+    { 1, 102 },
+    { 2, 105 },
+    { 4, 106 },
+    { 8, 107 },
+    { 16, 108 },
+    { 32, 109 },
+    { 64, 110 },
+    { 128, 111 },
+    { 256, 112 },
+    { 512, 113 },
+    { 1024, 114 },
+    { 2048, 115 },
+    { 4096, 116 },
+    { 8192, 117 },
+    { 16384, 118 },
+};
+
+const Flags Tunnel = { Tunnel_values, 15, &kKeyTable };
+
+const EnumValue CanState_values[] = {
+    { 0, 119 },
+    { 1, 120 },
+    { 2, 121 },
+    { 3, 122 },
+    { 4, 123 },
+    { 5, 124 },
+};
+
+const Enum CanState = { CanState_values, 6, nullptr, 0, &kKeyTable };
+
+const FlagValue CanCtrlMode_values[] = {
+    { 1, 125 },
+    { 2, 126 },
+    { 4, 127 },
+    { 8, 128 },
+    { 16, 129 },
+    { 32, 130 },
+    { 64, 131 },
+    { 128, 132 },
+};
+
+const Flags CanCtrlMode = { CanCtrlMode_values, 8, &kKeyTable };
+
+const Member LinkStats_members[] = {
+    { 133, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 4, 0 },
+    { 134, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+    { 135, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 8, 4, 0 },
+    { 136, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 12, 4, 0 },
+    { 137, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 16, 4, 0 },
+    { 138, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 20, 4, 0 },
+    { 139, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 24, 4, 0 },
+    { 140, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 28, 4, 0 },
+    { 141, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 32, 4, 0 },
+    { 142, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 36, 4, 0 },
+    { 143, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 40, 4, 0 },
+    { 144, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 44, 4, 0 },
+    { 145, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 48, 4, 0 },
+    { 146, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 52, 4, 0 },
+    { 147, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 56, 4, 0 },
+    { 148, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 60, 4, 0 },
+    { 149, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 64, 4, 0 },
+    { 150, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 68, 4, 0 },
+    { 151, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 72, 4, 0 },
+    { 152, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 76, 4, 0 },
+    { 153, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 80, 4, 0 },
+    { 154, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 84, 4, 0 },
+    { 155, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 88, 4, 0 },
+};
+
+const Struct LinkStats = { "LinkStats", LinkStats_members, 23, 92, true, &kKeyTable };
+
+const Member LinkStats64_members[] = {
+    { 133, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 8, 0 },
+    { 134, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 8, 8, 0 },
+    { 135, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 16, 8, 0 },
+    { 136, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 24, 8, 0 },
+    { 137, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 32, 8, 0 },
+    { 138, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 40, 8, 0 },
+    { 139, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 48, 8, 0 },
+    { 140, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 56, 8, 0 },
+    { 141, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 64, 8, 0 },
+    { 142, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 72, 8, 0 },
+    { 143, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 80, 8, 0 },
+    { 144, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 88, 8, 0 },
+    { 145, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 96, 8, 0 },
+    { 146, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 104, 8, 0 },
+    { 147, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 112, 8, 0 },
+    { 148, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 120, 8, 0 },
+    { 149, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 128, 8, 0 },
+    { 150, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 136, 8, 0 },
+    { 151, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 144, 8, 0 },
+    { 152, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 152, 8, 0 },
+    { 153, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 160, 8, 0 },
+    { 154, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 168, 8, 0 },
+    { 155, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 176, 8, 0 },
+};
+
+const Struct LinkStats64 = { "LinkStats64", LinkStats64_members, 23, 184, true, &kKeyTable };
+
+const Member LinkInterfaceMap_members[] = {
+    { 156, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 8, 0 },
+    { 157, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 8, 8, 0 },
+    { 158, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 16, 8, 0 },
+    { 159, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 24, 2, 0 },
+    { 160, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 26, 1, 0 },
+    { 161, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 27, 1, 0 },
+};
+
+const Struct LinkInterfaceMap = { "LinkInterfaceMap", LinkInterfaceMap_members, 6, 28, false, &kKeyTable };
+
+const Type item0 = { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false };
+
+const Type item1 = { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false };
+
+const Field LinkAttrs_fields[] = {
+    { 162, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 163, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 164, { Kind::String, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 165, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 166, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 167, { Kind::String, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 168, { Kind::Struct, Lower::None, nullptr, nullptr, nullptr, &LinkStats, nullptr, false }, false },
+    { 169, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 170, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 78, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 171, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 172, { Kind::Map, Lower::None, nullptr, nullptr, nullptr, nullptr, &item0, false }, false },
+    { 173, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 174, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 175, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 176, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 177, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 178, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 179, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 180, { Kind::String, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 181, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 182, { Kind::Attrs, Lower::None, nullptr, nullptr, &VirtualFunctionList, nullptr, nullptr, false }, false },
+    { 183, { Kind::Struct, Lower::None, nullptr, nullptr, nullptr, &LinkStats64, nullptr, false }, false },
+    { 184, { Kind::Attrs, Lower::None, nullptr, nullptr, &PortList, nullptr, nullptr, false }, false },
+    { 185, { Kind::Attrs, Lower::None, nullptr, nullptr, &Port, nullptr, nullptr, false }, false },
+    { 186, { Kind::Map, Lower::None, nullptr, nullptr, nullptr, nullptr, &item1, false }, false },
+    { 187, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 188, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 189, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 190, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 191, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 192, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 193, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 194, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 195, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 196, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 197, { Kind::S32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 198, { Kind::String, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 199, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 200, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 201, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 202, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 203, { Kind::Attrs, Lower::None, nullptr, nullptr, &Xdp, nullptr, nullptr, false }, false },
+    { 204, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 205, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 206, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 207, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 208, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 209, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 210, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 211, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 212, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 213, { Kind::String, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 214, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs LinkAttrs = { LinkAttrs_fields, 54, 1, &kKeyTable };
+
+const Field LinkProtocolInfoInet_fields[] = {
+    { 215, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs LinkProtocolInfoInet = { LinkProtocolInfoInet_fields, 1, 1, &kKeyTable };
+
+const Field LinkProtocolInfoInet6_fields[] = {
+    { 216, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 215, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 168, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 217, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 218, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 219, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 220, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 221, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs LinkProtocolInfoInet6 = { LinkProtocolInfoInet6_fields, 8, 1, &kKeyTable };
+
+const Field Bridge_fields[] = {
+    { 222, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 223, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 224, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 225, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 226, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 170, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 227, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 228, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 229, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 230, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 231, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 232, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 233, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 234, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 235, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 236, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 237, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 238, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 239, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 240, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 241, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 242, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 243, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 244, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 245, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 246, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 247, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 248, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 249, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 250, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 251, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 252, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 253, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 254, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 255, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 256, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 257, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 258, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 259, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 202, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 260, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 261, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 262, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 263, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 264, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 265, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs Bridge = { Bridge_fields, 46, 1, &kKeyTable };
+
+const Member BridgeId_members[] = {
+    { 266, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 1, 2 },
+    { 267, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 2, 1, 6 },
+};
+
+const Struct BridgeId = { "BridgeId", BridgeId_members, 2, 8, false, &kKeyTable };
+
+const Field BridgePort_fields[] = {
+    { 268, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 170, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 169, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 269, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 270, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 271, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 95, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 272, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 273, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 274, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 275, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 276, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 230, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 231, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 277, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 278, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 279, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 280, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 281, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 282, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 283, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 284, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 285, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 286, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 287, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 202, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 288, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 289, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 290, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 291, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 229, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 292, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 293, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 294, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs BridgePort = { BridgePort_fields, 34, 1, &kKeyTable };
+
+const Member CacheInfo_members[] = {
+    { 295, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 4, 0 },
+    { 296, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+    { 297, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 8, 4, 0 },
+    { 298, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 12, 4, 0 },
+};
+
+const Struct CacheInfo = { "CacheInfo", CacheInfo_members, 4, 16, false, &kKeyTable };
+
+const Field Info_fields[] = {
+    { 299, { Kind::String, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 300, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 301, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 302, { Kind::String, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 303, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs Info = { Info_fields, 5, 1, &kKeyTable };
+
+const Field Vlan_fields[] = {
+    { 279, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 216, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 304, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 305, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 306, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs Vlan = { Vlan_fields, 5, 1, &kKeyTable };
+
+const Member VlanFlagsMask_members[] = {
+    { 216, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 4, 0 },
+    { 307, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+};
+
+const Struct VlanFlagsMask = { "VlanFlagsMask", VlanFlagsMask_members, 2, 8, false, &kKeyTable };
+
+const Field VlanQos_fields[] = {
+    { 308, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs VlanQos = { VlanQos_fields, 1, 1, &kKeyTable };
+
+const Member VlanQosMapping_members[] = {
+    { 309, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 4, 0 },
+    { 310, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+};
+
+const Struct VlanQosMapping = { "VlanQosMapping", VlanQosMapping_members, 2, 8, false, &kKeyTable };
+
+const Field Macvlan_fields[] = {
+    { 269, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 216, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 311, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 312, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 313, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 314, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs Macvlan = { Macvlan_fields, 6, 1, &kKeyTable };
+
+const Field Vrf_fields[] = {
+    { 315, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs Vrf = { Vrf_fields, 1, 1, &kKeyTable };
+
+const Field VrfPort_fields[] = {
+    { 315, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs VrfPort = { VrfPort_fields, 1, 1, &kKeyTable };
+
+const Field Macsec_fields[] = {
+    { 316, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 161, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 317, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 318, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 319, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 320, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 321, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 271, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 322, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 323, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 324, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 325, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 326, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 202, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs Macsec = { Macsec_fields, 14, 1, &kKeyTable };
+
+const Field Xfrm_fields[] = {
+    { 166, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 327, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs Xfrm = { Xfrm_fields, 2, 1, &kKeyTable };
+
+const Field Ipvlan_fields[] = {
+    { 269, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 216, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs Ipvlan = { Ipvlan_fields, 2, 1, &kKeyTable };
+
+const Field Vxlan_fields[] = {
+    { 279, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 187, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 166, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 328, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 329, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 330, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 272, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 331, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 332, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 333, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 334, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 335, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 336, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 337, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 161, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 338, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 339, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 340, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 341, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 342, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 343, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 344, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 345, { Kind::Flag, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 346, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 347, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 348, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 349, { Kind::Flag, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 350, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 351, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs Vxlan = { Vxlan_fields, 29, 1, &kKeyTable };
+
+const Member VxlanPortRange_members[] = {
+    { 352, { Kind::U16be, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 2, 0 },
+    { 353, { Kind::U16be, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 2, 2, 0 },
+};
+
+const Struct VxlanPortRange = { "VxlanPortRange", VxlanPortRange_members, 2, 4, false, &kKeyTable };
+
+const Field Geneve_fields[] = {
+    { 279, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 354, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 329, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 330, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 161, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 347, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 355, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 340, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 341, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 342, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 348, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 350, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 351, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs Geneve = { Geneve_fields, 13, 1, &kKeyTable };
+
+const Field Ppp_fields[] = {
+    { 356, { Kind::S32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs Ppp = { Ppp_fields, 1, 1, &kKeyTable };
+
+const Field Gtp_fields[] = {
+    { 357, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 358, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 359, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 360, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs Gtp = { Gtp_fields, 4, 1, &kKeyTable };
+
+const Field Bond_fields[] = {
+    { 269, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 361, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 362, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 363, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 364, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 365, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 366, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 367, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 368, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 369, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 370, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 371, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 372, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 373, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 374, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 375, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 376, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 377, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 378, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 379, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 380, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 381, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 382, { Kind::Attrs, Lower::None, nullptr, nullptr, &BondAdInfo, nullptr, nullptr, false }, false },
+    { 383, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 384, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 385, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 386, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 387, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs Bond = { Bond_fields, 28, 1, &kKeyTable };
+
+const Field BondAdInfo_fields[] = {
+    { 388, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 389, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 390, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 391, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 392, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs BondAdInfo = { BondAdInfo_fields, 5, 1, &kKeyTable };
+
+const Field BondSlave_fields[] = {
+    { 268, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 393, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 394, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 395, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 396, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 397, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 398, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 399, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs BondSlave = { BondSlave_fields, 8, 1, &kKeyTable };
+
+const Field VirtualFunctionList_fields[] = {
+    { 400, { Kind::Attrs, Lower::None, nullptr, nullptr, &VirtualFunction, nullptr, nullptr, false }, true },
+};
+
+const Attrs VirtualFunctionList = { VirtualFunctionList_fields, 1, 1, &kKeyTable };
+
+const Field VirtualFunction_fields[] = {
+    { 401, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 402, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 403, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 404, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 405, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 406, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 407, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 168, { Kind::Attrs, Lower::None, nullptr, nullptr, &VirtualFunctionStats, nullptr, nullptr, false }, false },
+    { 408, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 409, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 410, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 411, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 163, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs VirtualFunction = { VirtualFunction_fields, 13, 1, &kKeyTable };
+
+const Member VirtualFunctionMac_members[] = {
+    { 412, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 4, 0 },
+    { 401, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 1, 32 },
+};
+
+const Struct VirtualFunctionMac = { "VirtualFunctionMac", VirtualFunctionMac_members, 2, 36, false, &kKeyTable };
+
+const Member VirtualFunctionBroadcast_members[] = {
+    { 163, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 1, 32 },
+};
+
+const Struct VirtualFunctionBroadcast = { "VirtualFunctionBroadcast", VirtualFunctionBroadcast_members, 1, 32, false, &kKeyTable };
+
+const Member VirtualFunctionVlan_members[] = {
+    { 412, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 4, 0 },
+    { 402, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+    { 413, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 8, 4, 0 },
+};
+
+const Struct VirtualFunctionVlan = { "VirtualFunctionVlan", VirtualFunctionVlan_members, 3, 12, false, &kKeyTable };
+
+const Field VlanList_fields[] = {
+    { 400, { Kind::Attrs, Lower::None, nullptr, nullptr, &Vlan, nullptr, nullptr, false }, true },
+};
+
+const Attrs VlanList = { VlanList_fields, 1, 1, &kKeyTable };
+
+const Member VirtualFunctionVlanInfo_members[] = {
+    { 412, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 4, 0 },
+    { 402, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+    { 413, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 8, 4, 0 },
+    { 414, { Kind::U16be, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 12, 2, 0 },
+};
+
+const Struct VirtualFunctionVlanInfo = { "VirtualFunctionVlanInfo", VirtualFunctionVlanInfo_members, 4, 14, false, &kKeyTable };
+
+const Member VirtualFunctionTxRate_members[] = {
+    { 412, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 4, 0 },
+    { 406, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+};
+
+const Struct VirtualFunctionTxRate = { "VirtualFunctionTxRate", VirtualFunctionTxRate_members, 2, 8, false, &kKeyTable };
+
+const Member VirtualFunctionRate_members[] = {
+    { 412, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 4, 0 },
+    { 415, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+    { 416, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 8, 4, 0 },
+};
+
+const Struct VirtualFunctionRate = { "VirtualFunctionRate", VirtualFunctionRate_members, 3, 12, false, &kKeyTable };
+
+const Member VirtualFunctionSpoofchk_members[] = {
+    { 412, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 4, 0 },
+    { 417, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+};
+
+const Struct VirtualFunctionSpoofchk = { "VirtualFunctionSpoofchk", VirtualFunctionSpoofchk_members, 2, 8, false, &kKeyTable };
+
+const Member VirtualFunctionGuid_members[] = {
+    { 412, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 4, 0 },
+    { 418, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 8, 0 },
+};
+
+const Struct VirtualFunctionGuid = { "VirtualFunctionGuid", VirtualFunctionGuid_members, 2, 12, false, &kKeyTable };
+
+const Member VirtualFunctionLinkState_members[] = {
+    { 412, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 4, 0 },
+    { 405, { Kind::U32, Lower::Enum, &VirtualFunctionLinkStateId, nullptr, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+};
+
+const Struct VirtualFunctionLinkState = { "VirtualFunctionLinkState", VirtualFunctionLinkState_members, 2, 8, false, &kKeyTable };
+
+const Member VirtualFunctionRssQueryEn_members[] = {
+    { 412, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 4, 0 },
+    { 417, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+};
+
+const Struct VirtualFunctionRssQueryEn = { "VirtualFunctionRssQueryEn", VirtualFunctionRssQueryEn_members, 2, 8, false, &kKeyTable };
+
+const Field VirtualFunctionStats_fields[] = {
+    { 133, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 134, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 135, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 136, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 163, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 141, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 202, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 139, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 140, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs VirtualFunctionStats = { VirtualFunctionStats_fields, 9, 0, &kKeyTable };
+
+const Member VirtualFunctionTrust_members[] = {
+    { 412, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 4, 0 },
+    { 417, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+};
+
+const Struct VirtualFunctionTrust = { "VirtualFunctionTrust", VirtualFunctionTrust_members, 2, 8, false, &kKeyTable };
+
+const Field PortList_fields[] = {
+    { 400, { Kind::Attrs, Lower::None, nullptr, nullptr, &Port, nullptr, nullptr, false }, true },
+};
+
+const Attrs PortList = { PortList_fields, 1, 1, &kKeyTable };
+
+const Field Port_fields[] = {
+    { 412, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 419, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 420, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 421, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 422, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 423, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 424, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs Port = { Port_fields, 7, 1, &kKeyTable };
+
+const Member PortVsi_members[] = {
+    { 425, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 1, 0 },
+    { 426, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 1, 1, 3 },
+    { 427, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 1, 0 },
+    { 202, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 5, 1, 3 },
+};
+
+const Struct PortVsi = { "PortVsi", PortVsi_members, 4, 8, false, &kKeyTable };
+
+const Field Ipoib_fields[] = {
+    { 428, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 269, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 429, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs Ipoib = { Ipoib_fields, 3, 1, &kKeyTable };
+
+const Field Hsr_fields[] = {
+    { 430, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 431, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 432, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 433, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 434, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 110, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs Hsr = { Hsr_fields, 6, 1, &kKeyTable };
+
+const Member IfStatsMsg_members[] = {
+    { 435, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 1, 0 },
+    { 436, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 1, 1, 0 },
+    { 437, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 2, 2, 0 },
+    { 438, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+    { 439, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 8, 4, 0 },
+};
+
+const Struct IfStatsMsg = { "IfStatsMsg", IfStatsMsg_members, 5, 12, false, &kKeyTable };
+
+const Type item2 = { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false };
+
+const Field Stats_fields[] = {
+    { 440, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 441, { Kind::Attrs, Lower::None, nullptr, nullptr, &Xstats, nullptr, nullptr, false }, false },
+    { 442, { Kind::Attrs, Lower::None, nullptr, nullptr, &Xstats, nullptr, nullptr, false }, false },
+    { 443, { Kind::Attrs, Lower::None, nullptr, nullptr, &OffloadXstats, nullptr, nullptr, false }, false },
+    { 186, { Kind::Map, Lower::None, nullptr, nullptr, nullptr, nullptr, &item2, false }, false },
+};
+
+const Attrs Stats = { Stats_fields, 5, 1, &kKeyTable };
+
+const Field Xstats_fields[] = {
+    { 8, { Kind::Attrs, Lower::None, nullptr, nullptr, &BridgeXstats, nullptr, nullptr, false }, false },
+    { 444, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs Xstats = { Xstats_fields, 2, 1, &kKeyTable };
+
+const Field OffloadXstats_fields[] = {
+    { 445, { Kind::Struct, Lower::None, nullptr, nullptr, nullptr, &LinkStats64, nullptr, false }, false },
+};
+
+const Attrs OffloadXstats = { OffloadXstats_fields, 1, 1, &kKeyTable };
+
+const Field Xdp_fields[] = {
+    { 130, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 446, { Kind::U8, Lower::Enum, &XdpAttached, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 216, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 447, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 448, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 449, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 450, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs Xdp = { Xdp_fields, 7, 1, &kKeyTable };
+
+const Field Tun_fields[] = {
+    { 451, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 187, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 452, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 453, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 454, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 455, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 456, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 457, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 458, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs Tun = { Tun_fields, 9, 1, &kKeyTable };
+
+const Field Rmnet_fields[] = {
+    { 459, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 216, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs Rmnet = { Rmnet_fields, 2, 1, &kKeyTable };
+
+const Member RmnetFlagsMask_members[] = {
+    { 216, { Kind::U32, Lower::Flags, nullptr, &RmnetFlags, nullptr, nullptr, nullptr, false }, 0, 4, 0 },
+    { 307, { Kind::U32, Lower::Flags, nullptr, &RmnetFlags, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+};
+
+const Struct RmnetFlagsMask = { "RmnetFlagsMask", RmnetFlagsMask_members, 2, 8, false, &kKeyTable };
+
+const Field VethInfo_fields[] = {
+    { 460, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs VethInfo = { VethInfo_fields, 1, 1, &kKeyTable };
+
+const Field BridgeSpec_fields[] = {
+    { 216, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 269, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 461, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 462, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs BridgeSpec = { BridgeSpec_fields, 4, 0, &kKeyTable };
+
+const Member BridgeVlanInfo_members[] = {
+    { 216, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 2, 0 },
+    { 463, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 2, 2, 0 },
+};
+
+const Struct BridgeVlanInfo = { "BridgeVlanInfo", BridgeVlanInfo_members, 2, 4, false, &kKeyTable };
+
+const Field BridgeVlanTunnel_fields[] = {
+    { 279, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 463, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 216, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs BridgeVlanTunnel = { BridgeVlanTunnel_fields, 3, 1, &kKeyTable };
+
+const Member BridgeVlanXstats_members[] = {
+    { 135, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 8, 0 },
+    { 133, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 8, 8, 0 },
+    { 136, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 16, 8, 0 },
+    { 134, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 24, 8, 0 },
+    { 463, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 32, 2, 0 },
+    { 216, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 34, 2, 0 },
+    { 437, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 36, 4, 0 },
+};
+
+const Struct BridgeVlanXstats = { "BridgeVlanXstats", BridgeVlanXstats_members, 7, 40, false, &kKeyTable };
+
+const Member BridgeStpXstats_members[] = {
+    { 464, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 8, 0 },
+    { 465, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 8, 8, 0 },
+    { 466, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 16, 8, 0 },
+    { 467, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 24, 8, 0 },
+    { 468, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 32, 8, 0 },
+    { 469, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 40, 8, 0 },
+};
+
+const Struct BridgeStpXstats = { "BridgeStpXstats", BridgeStpXstats_members, 6, 48, false, &kKeyTable };
+
+const Member BridgeVlanMsg_members[] = {
+    { 435, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 1, 0 },
+    { 470, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 1, 1, 0 },
+    { 471, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 2, 2, 0 },
+    { 438, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+};
+
+const Struct BridgeVlanMsg = { "BridgeVlanMsg", BridgeVlanMsg_members, 4, 8, false, &kKeyTable };
+
+const Field BridgeVlanDb_fields[] = {
+    { 472, { Kind::Attrs, Lower::None, nullptr, nullptr, &BridgeVlanDbEntry, nullptr, nullptr, false }, false },
+};
+
+const Attrs BridgeVlanDb = { BridgeVlanDb_fields, 1, 1, &kKeyTable };
+
+const Field BridgeVlanDbEntry_fields[] = {
+    { 473, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 474, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 268, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs BridgeVlanDbEntry = { BridgeVlanDbEntry_fields, 3, 1, &kKeyTable };
+
+const Field Mdba_fields[] = {
+    { 475, { Kind::Attrs, Lower::None, nullptr, nullptr, &MdbaMdb, nullptr, nullptr, false }, false },
+    { 476, { Kind::Attrs, Lower::None, nullptr, nullptr, &MdbaRouter, nullptr, nullptr, false }, false },
+};
+
+const Attrs Mdba = { Mdba_fields, 2, 1, &kKeyTable };
+
+const Field MdbaMdb_fields[] = {
+    { 472, { Kind::Attrs, Lower::None, nullptr, nullptr, &MdbaMdbEntry, nullptr, nullptr, false }, false },
+};
+
+const Attrs MdbaMdb = { MdbaMdb_fields, 1, 1, &kKeyTable };
+
+const Field MdbaMdbEntry_fields[] = {
+    { 473, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs MdbaMdbEntry = { MdbaMdbEntry_fields, 1, 1, &kKeyTable };
+
+const Field MdbaMdbEattr_fields[] = {
+    { 477, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs MdbaMdbEattr = { MdbaMdbEattr_fields, 1, 1, &kKeyTable };
+
+const Field MdbaRouter_fields[] = {
+    { 161, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs MdbaRouter = { MdbaRouter_fields, 1, 1, &kKeyTable };
+
+const Field MdbaRouterPattr_fields[] = {
+    { 477, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 452, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs MdbaRouterPattr = { MdbaRouterPattr_fields, 2, 1, &kKeyTable };
+
+const Member BridgePortMsg_members[] = {
+    { 435, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 1, 0 },
+    { 438, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 1, 4, 0 },
+};
+
+const Struct BridgePortMsg = { "BridgePortMsg", BridgePortMsg_members, 2, 5, false, &kKeyTable };
+
+const Member _IpWithProto_members[] = {
+    { 478, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 16, 0 },
+    { 479, { Kind::U16be, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 16, 2, 0 },
+};
+
+const Struct _IpWithProto = { "_IpWithProto", _IpWithProto_members, 2, 18, false, &kKeyTable };
+
+const Member BridgeMdbEntry_members[] = {
+    { 438, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 4, 0 },
+    { 268, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 1, 0 },
+    { 216, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 5, 1, 0 },
+    { 463, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 6, 2, 0 },
+    { 267, { Kind::Struct, Lower::None, nullptr, nullptr, nullptr, &_IpWithProto, nullptr, false }, 8, 18, 0 },
+};
+
+const Struct BridgeMdbEntry = { "BridgeMdbEntry", BridgeMdbEntry_members, 5, 26, false, &kKeyTable };
+
+const Field MdbaSetEntry_fields[] = {
+    { 400, { Kind::Attrs, Lower::None, nullptr, nullptr, &MdbaSetEntry, nullptr, nullptr, false }, true },
+};
+
+const Attrs MdbaSetEntry = { MdbaSetEntry_fields, 1, 1, &kKeyTable };
+
+const Field BridgeXstats_fields[] = {
+    { 402, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 217, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 202, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 480, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs BridgeXstats = { BridgeXstats_fields, 4, 1, &kKeyTable };
+
+const Member BridgeMcastStats_members[] = {
+    { 481, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 8, 2 },
+    { 482, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 16, 8, 2 },
+    { 483, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 32, 8, 2 },
+    { 484, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 48, 8, 2 },
+    { 485, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 64, 8, 2 },
+    { 486, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 80, 8, 2 },
+    { 487, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 96, 8, 2 },
+    { 488, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 112, 8, 0 },
+    { 489, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 120, 8, 2 },
+    { 490, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 136, 8, 2 },
+    { 491, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 152, 8, 2 },
+    { 492, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 168, 8, 2 },
+    { 493, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 184, 8, 2 },
+    { 494, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 200, 8, 0 },
+    { 495, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 208, 8, 2 },
+    { 496, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 224, 8, 2 },
+};
+
+const Struct BridgeMcastStats = { "BridgeMcastStats", BridgeMcastStats_members, 16, 240, false, &kKeyTable };
+
+const Member BridgeBooloptMask_members[] = {
+    { 216, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 4, 0 },
+    { 307, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+};
+
+const Struct BridgeBooloptMask = { "BridgeBooloptMask", BridgeBooloptMask_members, 2, 8, false, &kKeyTable };
+
+const Field Iptun_fields[] = {
+    { 166, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 328, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 354, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 329, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 330, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 497, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 498, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 216, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 479, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 499, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 500, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 501, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 502, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 503, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 504, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 505, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 506, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 507, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 347, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 508, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs Iptun = { Iptun_fields, 20, 1, &kKeyTable };
+
+const Member IpTunnelPrl_members[] = {
+    { 267, { Kind::U32be, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 4, 0 },
+    { 216, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 2, 0 },
+    { 509, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 6, 2, 0 },
+    { 510, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 8, 4, 0 },
+    { 471, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 12, 4, 0 },
+};
+
+const Struct IpTunnelPrl = { "IpTunnelPrl", IpTunnelPrl_members, 5, 16, false, &kKeyTable };
+
+const Member IpTunnel6rd_members[] = {
+    { 511, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 16, 0 },
+    { 512, { Kind::U32be, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 16, 4, 0 },
+    { 513, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 20, 2, 0 },
+    { 514, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 22, 2, 0 },
+};
+
+const Struct IpTunnel6rd = { "IpTunnel6rd", IpTunnel6rd_members, 4, 24, false, &kKeyTable };
+
+const Field Gre_fields[] = {
+    { 166, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 515, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 516, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 517, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 518, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 328, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 354, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 329, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 330, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 499, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 497, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 498, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 216, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 504, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 505, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 506, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 507, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 347, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 519, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 508, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 520, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 521, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 522, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 523, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs Gre = { Gre_fields, 24, 1, &kKeyTable };
+
+const Field Vti_fields[] = {
+    { 166, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 517, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 518, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 328, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 354, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 508, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs Vti = { Vti_fields, 6, 1, &kKeyTable };
+
+const Member CanBittiming_members[] = {
+    { 524, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 4, 0 },
+    { 525, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+    { 526, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 8, 4, 0 },
+    { 527, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 12, 4, 0 },
+    { 528, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 16, 4, 0 },
+    { 529, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 20, 4, 0 },
+    { 530, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 24, 4, 0 },
+    { 531, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 28, 4, 0 },
+};
+
+const Struct CanBittiming = { "CanBittiming", CanBittiming_members, 8, 32, false, &kKeyTable };
+
+const Member CanBittimingConst_members[] = {
+    { 532, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 1, 16 },
+    { 533, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 16, 4, 0 },
+    { 534, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 20, 4, 0 },
+    { 535, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 24, 4, 0 },
+    { 536, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 28, 4, 0 },
+    { 537, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 32, 4, 0 },
+    { 538, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 36, 4, 0 },
+    { 539, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 40, 4, 0 },
+    { 540, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 44, 4, 0 },
+};
+
+const Struct CanBittimingConst = { "CanBittimingConst", CanBittimingConst_members, 9, 48, false, &kKeyTable };
+
+const Member CanClock_members[] = {
+    { 541, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 4, 0 },
+};
+
+const Struct CanClock = { "CanClock", CanClock_members, 1, 4, false, &kKeyTable };
+
+const Member CanBerrCounter_members[] = {
+    { 542, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 2, 0 },
+    { 543, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 2, 2, 0 },
+};
+
+const Struct CanBerrCounter = { "CanBerrCounter", CanBerrCounter_members, 2, 4, false, &kKeyTable };
+
+const Member CanCtrlModeMask_members[] = {
+    { 307, { Kind::U32, Lower::Flags, nullptr, &CanCtrlMode, nullptr, nullptr, nullptr, false }, 0, 4, 0 },
+    { 216, { Kind::U32, Lower::Flags, nullptr, &CanCtrlMode, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+};
+
+const Struct CanCtrlModeMask = { "CanCtrlModeMask", CanCtrlModeMask_members, 2, 8, false, &kKeyTable };
+
+const Member CanDeviceStats_members[] = {
+    { 544, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 4, 0 },
+    { 545, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+    { 546, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 8, 4, 0 },
+    { 547, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 12, 4, 0 },
+    { 548, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 16, 4, 0 },
+    { 549, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 20, 4, 0 },
+};
+
+const Struct CanDeviceStats = { "CanDeviceStats", CanDeviceStats_members, 6, 24, false, &kKeyTable };
+
+const Field Can_fields[] = {
+    { 550, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 551, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 552, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 268, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 553, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 554, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 555, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 556, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 557, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 558, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 559, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 560, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 561, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 562, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 563, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs Can = { Can_fields, 15, 1, &kKeyTable };
+
+} // namespace gen_ifla
+
+#endif // NETLINK_GEN_IFLA_H
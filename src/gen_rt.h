@@ -0,0 +1,1432 @@
+// Generated by scripts/generate_parser.ts from types/rt.ts, do not edit
+#ifndef NETLINK_GEN_RT_H
+#define NETLINK_GEN_RT_H
+
+#include "decoder.h"
+
+namespace gen_rt {
+
+using namespace decoder;
+
+const char* const kKeys[] = {
+    "NEWLINK",
+    "DELLINK",
+    "GETLINK",
+    "SETLINK",
+    "NEWADDR",
+    "DELADDR",
+    "GETADDR",
+    "NEWROUTE",
+    "DELROUTE",
+    "GETROUTE",
+    "NEWNEIGH",
+    "DELNEIGH",
+    "GETNEIGH",
+    "NEWRULE",
+    "DELRULE",
+    "GETRULE",
+    "NEWQDISC",
+    "DELQDISC",
+    "GETQDISC",
+    "NEWTCLASS",
+    "DELTCLASS",
+    "GETTCLASS",
+    "NEWTFILTER",
+    "DELTFILTER",
+    "GETTFILTER",
+    "NEWACTION",
+    "DELACTION",
+    "GETACTION",
+    "NEWPREFIX",
+    "GETMULTICAST",
+    "GETANYCAST",
+    "NEWNEIGHTBL",
+    "GETNEIGHTBL",
+    "SETNEIGHTBL",
+    "NEWNDUSEROPT",
+    "NEWADDRLABEL",
+    "DELADDRLABEL",
+    "GETADDRLABEL",
+    "GETDCB",
+    "SETDCB",
+    "NEWNETCONF",
+    "DELNETCONF",
+    "GETNETCONF",
+    "NEWMDB",
+    "DELMDB",
+    "GETMDB",
+    "NEWNSID",
+    "DELNSID",
+    "GETNSID",
+    "NEWSTATS",
+    "GETSTATS",
+    "NEWCACHEREPORT",
+    "NEWCHAIN",
+    "DELCHAIN",
+    "GETCHAIN",
+    "NEWNEXTHOP",
+    "DELNEXTHOP",
+    "GETNEXTHOP",
+    "NEWLINKPROP",
+    "DELLINKPROP",
+    "GETLINKPROP",
+    "NEWVLAN",
+    "DELVLAN",
+    "GETVLAN",
+    "NEWNEXTHOPBUCKET",
+    "DELNEXTHOPBUCKET",
+    "GETNEXTHOPBUCKET",
+    "NONE",
+    "LINK",
+    "NOTIFY",
+    "NEIGH",
+    "TC",
+    "IPV4_IFADDR",
+    "IPV4_MROUTE",
+    "IPV4_ROUTE",
+    "IPV4_RULE",
+    "IPV6_IFADDR",
+    "IPV6_MROUTE",
+    "IPV6_ROUTE",
+    "IPV6_IFINFO",
+    "DECnet_IFADDR",
+    "NOP2",
+    "DECnet_ROUTE",
+    "DECnet_RULE",
+    "NOP4",
+    "IPV6_PREFIX",
+    "IPV6_RULE",
+    "ND_USEROPT",
+    "PHONET_IFADDR",
+    "PHONET_ROUTE",
+    "DCB",
+    "IPV4_NETCONF",
+    "IPV6_NETCONF",
+    "MDB",
+    "MPLS_ROUTE",
+    "NSID",
+    "MPLS_NETCONF",
+    "IPV4_MROUTE_R",
+    "IPV6_MROUTE_R",
+    "NEXTHOP",
+    "BRVLAN",
+    "UNSPEC",
+    "UNICAST",
+    "LOCAL",
+    "BROADCAST",
+    "ANYCAST",
+    "MULTICAST",
+    "BLACKHOLE",
+    "UNREACHABLE",
+    "PROHIBIT",
+    "THROW",
+    "NAT",
+    "XRESOLVE",
+    "REDIRECT",
+    "KERNEL",
+    "BOOT",
+    "STATIC",
+    "GATED",
+    "RA",
+    "MRT",
+    "ZEBRA",
+    "BIRD",
+    "DNROUTED",
+    "XORP",
+    "NTK",
+    "DHCP",
+    "MROUTED",
+    "BABEL",
+    "BGP",
+    "ISIS",
+    "OSPF",
+    "RIP",
+    "EIGRP",
+    "UNIVERSE",
+    "SITE",
+    "HOST",
+    "NOWHERE",
+    "notify",
+    "cloned",
+    "equalize",
+    "prefix",
+    "lookupTable",
+    "fibMatch",
+    "offload",
+    "trap",
+    "COMPAT",
+    "DEFAULT",
+    "MAIN",
+    "dead",
+    "pervasive",
+    "onlink",
+    "linkdown",
+    "unresolved",
+    "ecn",
+    "sack",
+    "timestamp",
+    "allfrag",
+    "secondary",
+    "nodad",
+    "optimistic",
+    "dadfailed",
+    "homeaddress",
+    "deprecated",
+    "tentative",
+    "permanent",
+    "managetempaddr",
+    "noprefixroute",
+    "mcautojoin",
+    "stablePrivacy",
+    "vf",
+    "brvlan",
+    "brvlanCompressed",
+    "skipStats",
+    "up",
+    "broadcast",
+    "debug",
+    "loopback",
+    "pointopoint",
+    "notrailers",
+    "running",
+    "noarp",
+    "promisc",
+    "allmulti",
+    "master",
+    "slave",
+    "multicast",
+    "portsel",
+    "automedia",
+    "dynamic",
+    "lowerUp",
+    "dormant",
+    "echo",
+    "NETROM",
+    "ETHER",
+    "EETHER",
+    "AX25",
+    "PRONET",
+    "CHAOS",
+    "IEEE802",
+    "ARCNET",
+    "APPLETLK",
+    "DLCI",
+    "ATM",
+    "METRICOM",
+    "IEEE1394",
+    "EUI64",
+    "INFINIBAND",
+    "SLIP",
+    "CSLIP",
+    "SLIP6",
+    "CSLIP6",
+    "RSRVD",
+    "ADAPT",
+    "ROSE",
+    "X25",
+    "HWX25",
+    "CAN",
+    "PPP",
+    "CISCO",
+    "LAPB",
+    "DDCMP",
+    "RAWHDLC",
+    "RAWIP",
+    "TUNNEL",
+    "TUNNEL6",
+    "FRAD",
+    "SKIP",
+    "LOOPBACK",
+    "LOCALTLK",
+    "FDDI",
+    "BIF",
+    "SIT",
+    "IPDDP",
+    "IPGRE",
+    "PIMREG",
+    "HIPPI",
+    "ASH",
+    "ECONET",
+    "IRDA",
+    "FCPP",
+    "FCAL",
+    "FCPL",
+    "FCFABRIC",
+    "IEEE802_TR",
+    "IEEE80211",
+    "IEEE80211_PRISM",
+    "IEEE80211_RADIOTAP",
+    "IEEE802154",
+    "IEEE802154_MONITOR",
+    "PHONET",
+    "PHONET_PIPE",
+    "CAIF",
+    "IP6GRE",
+    "NETLINK",
+    "_6LOWPAN",
+    "VSOCKMON",
+    "VOID",
+    "largeDumpOn",
+    "use",
+    "self",
+    "proxy",
+    "extLearned",
+    "offloaded",
+    "sticky",
+    "router",
+    "incomplete",
+    "reachable",
+    "stale",
+    "delay",
+    "probe",
+    "failed",
+    "invert",
+    "iifDetached",
+    "oifDetached",
+    "findSaddr",
+    "unspec",
+    "toTbl",
+    "goto",
+    "nop",
+    "res3",
+    "res4",
+    "blackhole",
+    "unreachable",
+    "prohibit",
+    "multipath",
+    "resilient",
+    "family",
+    "dstLen",
+    "srcLen",
+    "tos",
+    "table",
+    "protocol",
+    "scope",
+    "type",
+    "flags",
+    "dst",
+    "src",
+    "iif",
+    "oif",
+    "gateway",
+    "priority",
+    "prefsrc",
+    "metrics",
+    "protoinfo",
+    "flow",
+    "cacheInfo",
+    "session",
+    "mpAlgo",
+    "mark",
+    "mfcStats",
+    "via",
+    "newdst",
+    "pref",
+    "encapType",
+    "encap",
+    "expires",
+    "__pad",
+    "uid",
+    "ttlPropagate",
+    "ipProto",
+    "sport",
+    "dport",
+    "nhId",
+    "len",
+    "hops",
+    "ifindex",
+    "addr",
+    "clntref",
+    "lastuse",
+    "error",
+    "used",
+    "id",
+    "ts",
+    "tsage",
+    "lock",
+    "mtu",
+    "window",
+    "rtt",
+    "rttvar",
+    "ssthresh",
+    "cwnd",
+    "advmss",
+    "reordering",
+    "hoplimit",
+    "initcwnd",
+    "features",
+    "rtoMin",
+    "initrwnd",
+    "quickack",
+    "ccAlgo",
+    "fastopenNoCookie",
+    "proto",
+    "__pad1",
+    "__pad2",
+    "u",
+    "packets",
+    "bytes",
+    "wrongIf",
+    "prefixlen",
+    "index",
+    "address",
+    "local",
+    "label",
+    "anycast",
+    "rtPriority",
+    "targetNetnsid",
+    "ifaPrefered",
+    "ifaValid",
+    "cstamp",
+    "tstamp",
+    "change",
+    "__pad3",
+    "preferredTime",
+    "validTime",
+    "handle",
+    "parent",
+    "info",
+    "kind",
+    "options",
+    "stats",
+    "xstats",
+    "rate",
+    "fcnt",
+    "stats2",
+    "stab",
+    "dumpInvisible",
+    "chain",
+    "hwOffload",
+    "ingressBlock",
+    "egressBlock",
+    "tab",
+    "count",
+    "timeDelta",
+    "optsLen",
+    "icmpType",
+    "icmpCode",
+    "srcaddr",
+    "state",
+    "lladdr",
+    "probes",
+    "vlan",
+    "port",
+    "vni",
+    "linkNetnsid",
+    "srcVni",
+    "confirmed",
+    "updated",
+    "refcnt",
+    "name",
+    "thresh1",
+    "thresh2",
+    "thresh3",
+    "config",
+    "parms",
+    "gcInterval",
+    "keyLen",
+    "entrySize",
+    "entries",
+    "lastFlush",
+    "lastRand",
+    "hashRnd",
+    "hashMask",
+    "hashChainGc",
+    "proxyQlen",
+    "allocs",
+    "destroys",
+    "hashGrows",
+    "resFailed",
+    "lookups",
+    "hits",
+    "rcvProbesMcast",
+    "rcvProbesUcast",
+    "periodicGcRuns",
+    "forcedGcRuns",
+    "tableFulls",
+    "reachableTime",
+    "baseReachableTime",
+    "retransTime",
+    "gcStaletime",
+    "delayProbeTime",
+    "queueLen",
+    "appProbes",
+    "ucastProbes",
+    "mcastProbes",
+    "anycastDelay",
+    "proxyDelay",
+    "locktime",
+    "queueLenbytes",
+    "mcastReprobes",
+    "__reserved1",
+    "__reserved2",
+    "action",
+    "iifname",
+    "unused2",
+    "unused3",
+    "unused4",
+    "unused5",
+    "fwmark",
+    "tunId",
+    "suppressIfgroup",
+    "suppressPrefixlen",
+    "fwmask",
+    "oifname",
+    "l3Mdev",
+    "uidRange",
+    "sportRange",
+    "dportRange",
+    "start",
+    "end",
+    "__reserved",
+    "group",
+    "groupType",
+    "groups",
+    "fdb",
+    "resGroup",
+    "resBucket",
+    "weight",
+    "buckets",
+    "idleTimer",
+    "unbalancedTimer",
+    "unbalancedTime",
+    "idleTime",
+    "nexthopId",
+};
+
+/** Key ids are assigned when registering the tables (see DecoderKeys in binding.cc) */
+KeyTable kKeyTable = { kKeys, 483, 0 };
+
+extern const Enum MessageType;
+extern const Enum MulticastGroups;
+extern const Enum RouteType;
+extern const Enum RouteProtocol;
+extern const Enum RouteScope;
+extern const Flags RouteFlags;
+extern const Enum RoutingTableClass;
+extern const Flags RouteNextHopFlags;
+extern const Flags RouteMetricsFeatures;
+extern const Flags AddressFlags;
+extern const Flags RtExtFilter;
+extern const Flags DeviceFlags;
+extern const Enum LinkType;
+extern const Flags TcActionFlags;
+extern const Flags NeighborFlags;
+extern const Flags NeighborState;
+extern const Flags RuleFlags;
+extern const Enum RuleAction;
+extern const Enum NextHopGroupType;
+extern const Struct Route;
+extern const Attrs RouteAttrs;
+extern const Struct RouteNextHop;
+extern const Struct RouteVia;
+extern const Struct RouteCacheInfo;
+extern const Attrs RouteMetrics;
+extern const Struct RouteSession;
+extern const Struct RouteMfcStats;
+extern const Struct Address;
+extern const Attrs AddressAttrs;
+extern const Struct AddressCacheInfo;
+extern const Struct Link;
+extern const Struct Prefix;
+extern const Attrs PrefixAttrs;
+extern const Struct PrefixCacheInfo;
+extern const Struct Tc;
+extern const Attrs TcAttrs;
+extern const Struct TcAction;
+extern const Attrs TcActionRoot;
+extern const Struct NdUserOption;
+extern const Attrs NdUserOptionAttrs;
+extern const Struct Neighbor;
+extern const Attrs NeighborAttrs;
+extern const Struct NeighborCacheInfo;
+extern const Struct NeighborTable;
+extern const Attrs NeighborTableAttrs;
+extern const Struct NeighborTableConfig;
+extern const Struct NeighborTableStats;
+extern const Attrs NeighborTableParams;
+extern const Struct Rule;
+extern const Attrs RuleAttrs;
+extern const Struct RuleUidRange;
+extern const Struct RulePortRange;
+extern const Struct NextHop;
+extern const Attrs NextHopAttrs;
+extern const Struct NextHopGroup;
+extern const Attrs NextHopResGroup;
+extern const Attrs NextHopResBucket;
+
+const EnumValue MessageType_values[] = {
+    { 16, 0 },
+    { 17, 1 },
+    { 18, 2 },
+    { 19, 3 },
+    { 20, 4 },
+    { 21, 5 },
+    { 22, 6 },
+    { 24, 7 },
+    { 25, 8 },
+    { 26, 9 },
+    { 28, 10 },
+    { 29, 11 },
+    { 30, 12 },
+    { 32, 13 },
+    { 33, 14 },
+    { 34, 15 },
+    { 36, 16 },
+    { 37, 17 },
+    { 38, 18 },
+    { 40, 19 },
+    { 41, 20 },
+    { 42, 21 },
+    { 44, 22 },
+    { 45, 23 },
+    { 46, 24 },
+    { 48, 25 },
+    { 49, 26 },
+    { 50, 27 },
+    { 52, 28 },
+    { 58, 29 },
+    { 62, 30 },
+    { 64, 31 },
+    { 66, 32 },
+    { 67, 33 },
+    { 68, 34 },
+    { 72, 35 },
+    { 73, 36 },
+    { 74, 37 },
+    { 78, 38 },
+    { 79, 39 },
+    { 80, 40 },
+    { 81, 41 },
+    { 82, 42 },
+    { 84, 43 },
+    { 85, 44 },
+    { 86, 45 },
+    { 88, 46 },
+    { 89, 47 },
+    { 90, 48 },
+    { 92, 49 },
+    { 94, 50 },
+    { 96, 51 },
+    { 100, 52 },
+    { 101, 53 },
+    { 102, 54 },
+    { 104, 55 },
+    { 105, 56 },
+    { 106, 57 },
+    { 108, 58 },
+    { 109, 59 },
+    { 110, 60 },
+    { 112, 61 },
+    { 113, 62 },
+    { 114, 63 },
+    { 116, 64 },
+    { 117, 65 },
+    { 118, 66 },
+};
+
+const Enum MessageType = { MessageType_values, 67, nullptr, 0, &kKeyTable };
+
+const EnumValue MulticastGroups_values[] = {
+    { 0, 67 },
+    { 1, 68 },
+    { 2, 69 },
+    { 3, 70 },
+    { 4, 71 },
+    { 5, 72 },
+    { 6, 73 },
+    { 7, 74 },
+    { 8, 75 },
+    { 9, 76 },
+    { 10, 77 },
+    { 11, 78 },
+    { 12, 79 },
+    { 13, 80 },
+    { 14, 81 },
+    { 15, 82 },
+    { 16, 83 },
+    { 17, 84 },
+    { 18, 85 },
+    { 19, 86 },
+    { 20, 87 },
+    { 21, 88 },
+    { 22, 89 },
+    { 23, 90 },
+    { 24, 91 },
+    { 25, 92 },
+    { 26, 93 },
+    { 27, 94 },
+    { 28, 95 },
+    { 29, 96 },
+    { 30, 97 },
+    { 31, 98 },
+    { 32, 99 },
+    { 33, 100 },
+};
+
+const Enum MulticastGroups = { MulticastGroups_values, 34, nullptr, 0, &kKeyTable };
+
+const EnumValue RouteType_values[] = {
+    { 0, 101 },
+    { 1, 102 },
+    { 2, 103 },
+    { 3, 104 },
+    { 4, 105 },
+    { 5, 106 },
+    { 6, 107 },
+    { 7, 108 },
+    { 8, 109 },
+    { 9, 110 },
+    { 10, 111 },
+    { 11, 112 },
+};
+
+const Enum RouteType = { RouteType_values, 12, nullptr, 0, &kKeyTable };
+
+const EnumValue RouteProtocol_values[] = {
+    { 1, 113 },
+    { 2, 114 },
+    { 3, 115 },
+    { 4, 116 },
+    { 8, 117 },
+    { 9, 118 },
+    { 10, 119 },
+    { 11, 120 },
+    { 12, 121 },
+    { 13, 122 },
+    { 14, 123 },
+    { 15, 124 },
+    { 16, 125 },
+    { 17, 126 },
+    { 42, 127 },
+    { 186, 128 },
+    { 187, 129 },
+    { 188, 130 },
+    { 189, 131 },
+    { 192, 132 },
+};
+
+const Enum RouteProtocol = { RouteProtocol_values, 20, nullptr, 0, &kKeyTable };
+
+const EnumValue RouteScope_values[] = {
+    { 0, 133 },
+    { 200, 134 },
+    { 253, 68 },
+    { 254, 135 },
+    { 255, 136 },
+};
+
+const Enum RouteScope = { RouteScope_values, 5, nullptr, 0, &kKeyTable };
+
+const FlagValue RouteFlags_values[] = {
+    { 256, 137 },
+    { 512, 138 },
+    { 1024, 139 },
+    { 2048, 140 },
+    { 4096, 141 },
+    { 8192, 142 },
+    { 16384, 143 },
+    { 32768, 144 },
+};
+
+const Flags RouteFlags = { RouteFlags_values, 8, &kKeyTable };
+
+const EnumValue RoutingTableClass_values[] = {
+    { 252, 145 },
+    { 253, 146 },
+    { 254, 147 },
+    { 255, 103 },
+};
+
+const Enum RoutingTableClass = { RoutingTableClass_values, 4, nullptr, 0, &kKeyTable };
+
+const FlagValue RouteNextHopFlags_values[] = {
+    { 1, 148 },
+    { 2, 149 },
+    { 4, 150 },
+    { 8, 143 },
+    { 16, 151 },
+    { 32, 152 },
+};
+
+const Flags RouteNextHopFlags = { RouteNextHopFlags_values, 6, &kKeyTable };
+
+const FlagValue RouteMetricsFeatures_values[] = {
+    { 1, 153 },
+    { 2, 154 },
+    { 4, 155 },
+    { 8, 156 },
+};
+
+const Flags RouteMetricsFeatures = { RouteMetricsFeatures_values, 4, &kKeyTable };
+
+const FlagValue AddressFlags_values[] = {
+    { 1, 157 },
+    { 2, 158 },
+    { 4, 159 },
+    { 8, 160 },
+    { 16, 161 },
+    { 32, 162 },
+    { 64, 163 },
+    { 128, 164 },
+    { 256, 165 },
+    { 512, 166 },
+    { 1024, 167 },
+    { 2048, 168 },
+};
+
+const Flags AddressFlags = { AddressFlags_values, 12, &kKeyTable };
+
+const FlagValue RtExtFilter_values[] = {
+    { 1, 169 },
+    { 2, 170 },
+    { 4, 171 },
+    { 8, 172 },
+};
+
+const Flags RtExtFilter = { RtExtFilter_values, 4, &kKeyTable };
+
+const FlagValue DeviceFlags_values[] = {
+    { 1, 173 },
+    { 2, 174 },
+    { 4, 175 },
+    { 8, 176 },
+    { 16, 177 },
+    { 32, 178 },
+    { 64, 179 },
+    { 128, 180 },
+    { 256, 181 },
+    { 512, 182 },
+    { 1024, 183 },
+    { 2048, 184 },
+    { 4096, 185 },
+    { 8192, 186 },
+    { 16384, 187 },
+    { 32768, 188 },
+    { 65536, 189 },
+    { 131072, 190 },
+    { 262144, 191 },
+};
+
+const Flags DeviceFlags = { DeviceFlags_values, 19, &kKeyTable };
+
+const EnumValue LinkType_values[] = {
+    { 0, 192 },
+    { 1, 193 },
+    { 2, 194 },
+    { 3, 195 },
+    { 4, 196 },
+    { 5, 197 },
+    { 6, 198 },
+    { 7, 199 },
+    { 8, 200 },
+    { 15, 201 },
+    { 19, 202 },
+    { 23, 203 },
+    { 24, 204 },
+    { 27, 205 },
+    { 32, 206 },
+    { 256, 207 },
+    { 257, 208 },
+    { 258, 209 },
+    { 259, 210 },
+    { 260, 211 },
+    { 264, 212 },
+    { 270, 213 },
+    { 271, 214 },
+    { 272, 215 },
+    { 280, 216 },
+    { 512, 217 },
+    { 513, 218 },
+    { 516, 219 },
+    { 517, 220 },
+    { 518, 221 },
+    { 519, 222 },
+    { 768, 223 },
+    { 769, 224 },
+    { 770, 225 },
+    { 771, 226 },
+    { 772, 227 },
+    { 773, 228 },
+    { 774, 229 },
+    { 775, 230 },
+    { 776, 231 },
+    { 777, 232 },
+    { 778, 233 },
+    { 779, 234 },
+    { 780, 235 },
+    { 781, 236 },
+    { 782, 237 },
+    { 783, 238 },
+    { 784, 239 },
+    { 785, 240 },
+    { 786, 241 },
+    { 787, 242 },
+    { 800, 243 },
+    { 801, 244 },
+    { 802, 245 },
+    { 803, 246 },
+    { 804, 247 },
+    { 805, 248 },
+    { 820, 249 },
+    { 821, 250 },
+    { 822, 251 },
+    { 823, 252 },
+    { 824, 253 },
+    { 825, 254 },
+    { 826, 255 },
+    { 65534, 67 },
+    { 65535, 256 },
+};
+
+const Enum LinkType = { LinkType_values, 66, nullptr, 0, &kKeyTable };
+
+const FlagValue TcActionFlags_values[] = {
+    { 1, 257 },
+};
+
+const Flags TcActionFlags = { TcActionFlags_values, 1, &kKeyTable };
+
+const FlagValue NeighborFlags_values[] = {
+    { 1, 258 },
+    { 2, 259 },
+    { 4, 183 },
+    { 8, 260 },
+    { 16, 261 },
+    { 32, 262 },
+    { 64, 263 },
+    { 128, 264 },
+};
+
+const Flags NeighborFlags = { NeighborFlags_values, 8, &kKeyTable };
+
+const FlagValue NeighborState_values[] = {
+    { 1, 265 },
+    { 2, 266 },
+    { 4, 267 },
+    { 8, 268 },
+    { 16, 269 },
+    { 32, 270 },
+    { 64, 180 },
+    { 128, 164 },
+};
+
+const Flags NeighborState = { NeighborState_values, 8, &kKeyTable };
+
+const FlagValue RuleFlags_values[] = {
+    { 1, 164 },
+    { 2, 271 },
+    { 4, 152 },
+    { 8, 272 },
+    { 16, 273 },
+    { 65536, 274 },
+};
+
+const Flags RuleFlags = { RuleFlags_values, 6, &kKeyTable };
+
+const EnumValue RuleAction_values[] = {
+    { 0, 275 },
+    { 1, 276 },
+    { 2, 277 },
+    { 3, 278 },
+    { 4, 279 },
+    { 5, 280 },
+    { 6, 281 },
+    { 7, 282 },
+    { 8, 283 },
+};
+
+const Enum RuleAction = { RuleAction_values, 9, nullptr, 0, &kKeyTable };
+
+const EnumValue NextHopGroupType_values[] = {
+    { 0, 284 },
+    { 1, 285 },
+};
+
+const Enum NextHopGroupType = { NextHopGroupType_values, 2, nullptr, 0, &kKeyTable };
+
+const Member Route_members[] = {
+    { 286, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 1, 0 },
+    { 287, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 1, 1, 0 },
+    { 288, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 2, 1, 0 },
+    { 289, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 3, 1, 0 },
+    { 290, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 1, 0 },
+    { 291, { Kind::U8, Lower::Enum, &RouteProtocol, nullptr, nullptr, nullptr, nullptr, false }, 5, 1, 0 },
+    { 292, { Kind::U8, Lower::Enum, &RouteScope, nullptr, nullptr, nullptr, nullptr, false }, 6, 1, 0 },
+    { 293, { Kind::U8, Lower::Enum, &RouteType, nullptr, nullptr, nullptr, nullptr, false }, 7, 1, 0 },
+    { 294, { Kind::U32, Lower::Flags, nullptr, &RouteFlags, nullptr, nullptr, nullptr, false }, 8, 4, 0 },
+};
+
+const Struct Route = { "Route", Route_members, 9, 12, false, &kKeyTable };
+
+const Field RouteAttrs_fields[] = {
+    { 295, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 296, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 297, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 298, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 299, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 300, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 301, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 302, { Kind::Attrs, Lower::None, nullptr, nullptr, &RouteMetrics, nullptr, nullptr, false }, false },
+    { 284, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 303, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 304, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 305, { Kind::Struct, Lower::None, nullptr, nullptr, nullptr, &RouteCacheInfo, nullptr, false }, false },
+    { 306, { Kind::Struct, Lower::None, nullptr, nullptr, nullptr, &RouteSession, nullptr, false }, false },
+    { 307, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 290, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 308, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 309, { Kind::Struct, Lower::None, nullptr, nullptr, nullptr, &RouteMfcStats, nullptr, false }, false },
+    { 310, { Kind::Struct, Lower::None, nullptr, nullptr, nullptr, &RouteVia, nullptr, false }, false },
+    { 311, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 312, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 313, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 314, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 315, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 316, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 317, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 318, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 319, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 320, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 321, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 322, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs RouteAttrs = { RouteAttrs_fields, 30, 1, &kKeyTable };
+
+const Member RouteNextHop_members[] = {
+    { 323, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 2, 0 },
+    { 294, { Kind::U8, Lower::Flags, nullptr, &RouteNextHopFlags, nullptr, nullptr, nullptr, false }, 2, 1, 0 },
+    { 324, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 3, 1, 0 },
+    { 325, { Kind::S32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+};
+
+const Struct RouteNextHop = { "RouteNextHop", RouteNextHop_members, 4, 8, false, &kKeyTable };
+
+const Member RouteVia_members[] = {
+    { 286, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 2, 0 },
+    { 326, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 2, 1, 0 },
+};
+
+const Struct RouteVia = { "RouteVia", RouteVia_members, 2, 3, false, &kKeyTable };
+
+const Member RouteCacheInfo_members[] = {
+    { 327, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 4, 0 },
+    { 328, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+    { 315, { Kind::S32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 8, 4, 0 },
+    { 329, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 12, 4, 0 },
+    { 330, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 16, 4, 0 },
+    { 331, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 20, 4, 0 },
+    { 332, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 24, 4, 0 },
+    { 333, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 28, 4, 0 },
+};
+
+const Struct RouteCacheInfo = { "RouteCacheInfo", RouteCacheInfo_members, 8, 32, false, &kKeyTable };
+
+const Field RouteMetrics_fields[] = {
+    { 334, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 335, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 336, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 337, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 338, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 339, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 340, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 341, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 342, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 343, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 344, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 345, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 346, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 347, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 348, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 349, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 350, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs RouteMetrics = { RouteMetrics_fields, 17, 1, &kKeyTable };
+
+const Member RouteSession_members[] = {
+    { 351, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 1, 0 },
+    { 352, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 1, 1, 0 },
+    { 353, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 2, 2, 0 },
+    { 354, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 1, 4 },
+};
+
+const Struct RouteSession = { "RouteSession", RouteSession_members, 4, 8, false, &kKeyTable };
+
+const Member RouteMfcStats_members[] = {
+    { 355, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 8, 0 },
+    { 356, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 8, 8, 0 },
+    { 357, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 16, 8, 0 },
+};
+
+const Struct RouteMfcStats = { "RouteMfcStats", RouteMfcStats_members, 3, 24, false, &kKeyTable };
+
+const Member Address_members[] = {
+    { 286, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 1, 0 },
+    { 358, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 1, 1, 0 },
+    { 294, { Kind::U8, Lower::Flags, nullptr, &AddressFlags, nullptr, nullptr, nullptr, false }, 2, 1, 0 },
+    { 292, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 3, 1, 0 },
+    { 359, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+};
+
+const Struct Address = { "Address", Address_members, 5, 8, false, &kKeyTable };
+
+const Field AddressAttrs_fields[] = {
+    { 360, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 361, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 362, { Kind::String, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 174, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 363, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 305, { Kind::Struct, Lower::None, nullptr, nullptr, nullptr, &AddressCacheInfo, nullptr, false }, false },
+    { 185, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 294, { Kind::U32, Lower::Flags, nullptr, &AddressFlags, nullptr, nullptr, nullptr, false }, false },
+    { 364, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 365, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs AddressAttrs = { AddressAttrs_fields, 10, 1, &kKeyTable };
+
+const Member AddressCacheInfo_members[] = {
+    { 366, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 4, 0 },
+    { 367, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+    { 368, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 8, 4, 0 },
+    { 369, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 12, 4, 0 },
+};
+
+const Struct AddressCacheInfo = { "AddressCacheInfo", AddressCacheInfo_members, 4, 16, false, &kKeyTable };
+
+const Member Link_members[] = {
+    { 286, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 1, 0 },
+    { 316, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 1, 1, 0 },
+    { 293, { Kind::U16, Lower::Enum, &LinkType, nullptr, nullptr, nullptr, nullptr, false }, 2, 2, 0 },
+    { 359, { Kind::S32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+    { 294, { Kind::U32, Lower::Flags, nullptr, &DeviceFlags, nullptr, nullptr, nullptr, false }, 8, 4, 0 },
+    { 370, { Kind::U32, Lower::Flags, nullptr, &DeviceFlags, nullptr, nullptr, nullptr, false }, 12, 4, 0 },
+};
+
+const Struct Link = { "Link", Link_members, 6, 16, false, &kKeyTable };
+
+const Member Prefix_members[] = {
+    { 286, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 1, 0 },
+    { 352, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 1, 1, 0 },
+    { 353, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 2, 2, 0 },
+    { 325, { Kind::S32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+    { 293, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 8, 1, 0 },
+    { 323, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 9, 1, 0 },
+    { 294, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 10, 1, 0 },
+    { 371, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 11, 1, 0 },
+};
+
+const Struct Prefix = { "Prefix", Prefix_members, 8, 12, false, &kKeyTable };
+
+const Field PrefixAttrs_fields[] = {
+    { 360, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 305, { Kind::Struct, Lower::None, nullptr, nullptr, nullptr, &PrefixCacheInfo, nullptr, false }, false },
+};
+
+const Attrs PrefixAttrs = { PrefixAttrs_fields, 2, 1, &kKeyTable };
+
+const Member PrefixCacheInfo_members[] = {
+    { 372, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 4, 0 },
+    { 373, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+};
+
+const Struct PrefixCacheInfo = { "PrefixCacheInfo", PrefixCacheInfo_members, 2, 8, false, &kKeyTable };
+
+const Member Tc_members[] = {
+    { 286, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 1, 0 },
+    { 352, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 1, 1, 0 },
+    { 353, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 2, 2, 0 },
+    { 325, { Kind::S32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+    { 374, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 8, 4, 0 },
+    { 375, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 12, 4, 0 },
+    { 376, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 16, 4, 0 },
+};
+
+const Struct Tc = { "Tc", Tc_members, 7, 20, false, &kKeyTable };
+
+const Field TcAttrs_fields[] = {
+    { 377, { Kind::String, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 378, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 379, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 380, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 381, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 382, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 383, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 384, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 316, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 385, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 386, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 387, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 388, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 389, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs TcAttrs = { TcAttrs_fields, 14, 1, &kKeyTable };
+
+const Member TcAction_members[] = {
+    { 286, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 1, 0 },
+    { 352, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 1, 1, 0 },
+    { 353, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 2, 2, 0 },
+};
+
+const Struct TcAction = { "TcAction", TcAction_members, 3, 4, false, &kKeyTable };
+
+const Field TcActionRoot_fields[] = {
+    { 390, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 294, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 391, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 392, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs TcActionRoot = { TcActionRoot_fields, 4, 1, &kKeyTable };
+
+const Member NdUserOption_members[] = {
+    { 286, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 1, 0 },
+    { 352, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 1, 1, 0 },
+    { 393, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 2, 2, 0 },
+    { 325, { Kind::S32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+    { 394, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 8, 1, 0 },
+    { 395, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 9, 1, 0 },
+    { 353, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 10, 2, 0 },
+    { 371, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 12, 4, 0 },
+};
+
+const Struct NdUserOption = { "NdUserOption", NdUserOption_members, 8, 16, false, &kKeyTable };
+
+const Field NdUserOptionAttrs_fields[] = {
+    { 396, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs NdUserOptionAttrs = { NdUserOptionAttrs_fields, 1, 1, &kKeyTable };
+
+const Member Neighbor_members[] = {
+    { 286, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 1, 0 },
+    { 352, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 1, 1, 0 },
+    { 353, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 2, 2, 0 },
+    { 325, { Kind::S32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+    { 397, { Kind::U16, Lower::Flags, nullptr, &NeighborState, nullptr, nullptr, nullptr, false }, 8, 2, 0 },
+    { 294, { Kind::U8, Lower::Flags, nullptr, &NeighborFlags, nullptr, nullptr, nullptr, false }, 10, 1, 0 },
+    { 293, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 11, 1, 0 },
+};
+
+const Struct Neighbor = { "Neighbor", Neighbor_members, 7, 12, false, &kKeyTable };
+
+const Field NeighborAttrs_fields[] = {
+    { 295, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 398, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 305, { Kind::Struct, Lower::None, nullptr, nullptr, nullptr, &NeighborCacheInfo, nullptr, false }, false },
+    { 399, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 400, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 401, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 402, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 325, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 183, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 403, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 404, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 291, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs NeighborAttrs = { NeighborAttrs_fields, 12, 1, &kKeyTable };
+
+const Member NeighborCacheInfo_members[] = {
+    { 405, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 4, 0 },
+    { 330, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+    { 406, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 8, 4, 0 },
+    { 407, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 12, 4, 0 },
+};
+
+const Struct NeighborCacheInfo = { "NeighborCacheInfo", NeighborCacheInfo_members, 4, 16, false, &kKeyTable };
+
+const Member NeighborTable_members[] = {
+    { 286, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 1, 0 },
+    { 352, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 1, 1, 0 },
+    { 353, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 2, 2, 0 },
+};
+
+const Struct NeighborTable = { "NeighborTable", NeighborTable_members, 3, 4, false, &kKeyTable };
+
+const Field NeighborTableAttrs_fields[] = {
+    { 408, { Kind::String, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 409, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 410, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 411, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 412, { Kind::Struct, Lower::None, nullptr, nullptr, nullptr, &NeighborTableConfig, nullptr, false }, false },
+    { 413, { Kind::Attrs, Lower::None, nullptr, nullptr, &NeighborTableParams, nullptr, nullptr, false }, false },
+    { 379, { Kind::Struct, Lower::None, nullptr, nullptr, nullptr, &NeighborTableStats, nullptr, false }, false },
+    { 414, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 316, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs NeighborTableAttrs = { NeighborTableAttrs_fields, 9, 1, &kKeyTable };
+
+const Member NeighborTableConfig_members[] = {
+    { 415, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 2, 0 },
+    { 416, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 2, 2, 0 },
+    { 417, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+    { 418, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 8, 4, 0 },
+    { 419, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 12, 4, 0 },
+    { 420, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 16, 4, 0 },
+    { 421, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 20, 4, 0 },
+    { 422, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 24, 4, 0 },
+    { 423, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 28, 4, 0 },
+};
+
+const Struct NeighborTableConfig = { "NeighborTableConfig", NeighborTableConfig_members, 9, 32, false, &kKeyTable };
+
+const Member NeighborTableStats_members[] = {
+    { 424, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 8, 0 },
+    { 425, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 8, 8, 0 },
+    { 426, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 16, 8, 0 },
+    { 427, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 24, 8, 0 },
+    { 428, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 32, 8, 0 },
+    { 429, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 40, 8, 0 },
+    { 430, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 48, 8, 0 },
+    { 431, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 56, 8, 0 },
+    { 432, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 64, 8, 0 },
+    { 433, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 72, 8, 0 },
+    { 434, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 80, 8, 0 },
+};
+
+const Struct NeighborTableStats = { "NeighborTableStats", NeighborTableStats_members, 11, 88, false, &kKeyTable };
+
+const Field NeighborTableParams_fields[] = {
+    { 325, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 407, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 435, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 436, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 437, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 438, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 439, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 440, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 441, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 442, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 443, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 444, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 445, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 423, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 446, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 447, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 448, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 316, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs NeighborTableParams = { NeighborTableParams_fields, 18, 1, &kKeyTable };
+
+const Member Rule_members[] = {
+    { 286, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 1, 0 },
+    { 287, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 1, 1, 0 },
+    { 288, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 2, 1, 0 },
+    { 289, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 3, 1, 0 },
+    { 290, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 1, 0 },
+    { 449, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 5, 1, 0 },
+    { 450, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 6, 1, 0 },
+    { 451, { Kind::U8, Lower::Enum, &RuleAction, nullptr, nullptr, nullptr, nullptr, false }, 7, 1, 0 },
+    { 294, { Kind::U32, Lower::Flags, nullptr, &RuleFlags, nullptr, nullptr, nullptr, false }, 8, 4, 0 },
+};
+
+const Struct Rule = { "Rule", Rule_members, 9, 12, false, &kKeyTable };
+
+const Field RuleAttrs_fields[] = {
+    { 295, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 296, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 452, { Kind::String, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 277, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 453, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 300, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 454, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 455, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 456, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 457, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 304, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 458, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 459, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 460, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 290, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 461, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 462, { Kind::String, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 316, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 463, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 464, { Kind::Struct, Lower::None, nullptr, nullptr, nullptr, &RuleUidRange, nullptr, false }, false },
+    { 291, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 319, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 465, { Kind::Struct, Lower::None, nullptr, nullptr, nullptr, &RulePortRange, nullptr, false }, false },
+    { 466, { Kind::Struct, Lower::None, nullptr, nullptr, nullptr, &RulePortRange, nullptr, false }, false },
+};
+
+const Attrs RuleAttrs = { RuleAttrs_fields, 24, 1, &kKeyTable };
+
+const Member RuleUidRange_members[] = {
+    { 467, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 4, 0 },
+    { 468, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+};
+
+const Struct RuleUidRange = { "RuleUidRange", RuleUidRange_members, 2, 8, false, &kKeyTable };
+
+const Member RulePortRange_members[] = {
+    { 467, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 2, 0 },
+    { 468, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 2, 2, 0 },
+};
+
+const Struct RulePortRange = { "RulePortRange", RulePortRange_members, 2, 4, false, &kKeyTable };
+
+const Member NextHop_members[] = {
+    { 286, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 1, 0 },
+    { 292, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 1, 1, 0 },
+    { 291, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 2, 1, 0 },
+    { 469, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 3, 1, 0 },
+    { 294, { Kind::U32, Lower::Flags, nullptr, &RouteNextHopFlags, nullptr, nullptr, nullptr, false }, 4, 4, 0 },
+};
+
+const Struct NextHop = { "NextHop", NextHop_members, 5, 8, false, &kKeyTable };
+
+const Field NextHopAttrs_fields[] = {
+    { 331, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 470, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 471, { Kind::U16, Lower::Enum, &NextHopGroupType, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 281, { Kind::Flag, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 298, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 299, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 313, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 314, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 472, { Kind::Flag, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 183, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 473, { Kind::Flag, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 474, { Kind::Attrs, Lower::None, nullptr, nullptr, &NextHopResGroup, nullptr, nullptr, false }, false },
+    { 475, { Kind::Attrs, Lower::None, nullptr, nullptr, &NextHopResBucket, nullptr, nullptr, false }, false },
+};
+
+const Attrs NextHopAttrs = { NextHopAttrs_fields, 13, 1, &kKeyTable };
+
+const Member NextHopGroup_members[] = {
+    { 331, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 0, 4, 0 },
+    { 476, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 4, 1, 0 },
+    { 449, { Kind::U8, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 5, 1, 0 },
+    { 450, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, 6, 2, 0 },
+};
+
+const Struct NextHopGroup = { "NextHopGroup", NextHopGroup_members, 4, 8, false, &kKeyTable };
+
+const Field NextHopResGroup_fields[] = {
+    { 316, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 477, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 478, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 479, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 480, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs NextHopResGroup = { NextHopResGroup_fields, 5, 0, &kKeyTable };
+
+const Field NextHopResBucket_fields[] = {
+    { 316, { Kind::Data, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 359, { Kind::U16, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 481, { Kind::U64, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+    { 482, { Kind::U32, Lower::None, nullptr, nullptr, nullptr, nullptr, nullptr, false }, false },
+};
+
+const Attrs NextHopResBucket = { NextHopResBucket_fields, 4, 0, &kKeyTable };
+
+} // namespace gen_rt
+
+#endif // NETLINK_GEN_RT_H
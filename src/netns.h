@@ -0,0 +1,78 @@
+#ifndef NETLINK_NETNS_H
+#define NETLINK_NETNS_H
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <linux/netlink.h>
+#include <sched.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+#include <thread>
+
+#ifndef SOL_NETLINK
+#define SOL_NETLINK 270
+#endif
+#ifndef NETLINK_LISTEN_ALL_NSID
+#define NETLINK_LISTEN_ALL_NSID 8
+#endif
+
+/** Peer namespace id when the datagram didn't carry one (NETNSA_NSID_NOT_ASSIGNED) */
+static const int32_t kNoNsid = -1;
+
+/** Space for the control messages of a received datagram (i.e. its nsid) */
+static const size_t kRecvControlSize = CMSG_SPACE(sizeof(int32_t));
+
+/**
+ * Creates a socket inside the network namespace referred to by `nsfd`
+ * (an fd of /proc/<pid>/ns/net, /run/netns/<name>, etc.). setns() only
+ * affects the calling thread, so the socket is created from a short-lived
+ * helper thread that enters the namespace; the socket then stays bound to
+ * it. Needs CAP_SYS_ADMIN. Returns -1 on failure, with `err` set, and
+ * `syscall` pointing to the name of the failed call.
+ */
+inline int SocketInNetns(int nsfd, int type, int protocol, int& err, const char*& syscall) {
+    int fd = -1;
+    err = 0;
+    std::thread helper ([&] {
+        if (setns(nsfd, CLONE_NEWNET)) {
+            err = errno;
+            syscall = "setns";
+            return;
+        }
+        fd = socket(AF_NETLINK, type, protocol);
+        if (fd == -1) {
+            err = errno;
+            syscall = "socket";
+        }
+    });
+    helper.join();
+    return fd;
+}
+
+/** Opens a network namespace by path. Returns -1 on failure, with errno set. */
+inline int OpenNetns(const char* path) {
+    return open(path, O_RDONLY | O_CLOEXEC);
+}
+
+/**
+ * Returns the peer namespace id carried by a received datagram (present
+ * if NETLINK_LISTEN_ALL_NSID is enabled, and the peer's namespace has an
+ * id assigned in ours), or kNoNsid.
+ */
+inline int32_t GetNsid(struct msghdr* hdr) {
+    if (!hdr->msg_control) return kNoNsid;
+    for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(hdr); cmsg; cmsg = CMSG_NXTHDR(hdr, cmsg)) {
+        if (cmsg->cmsg_level == SOL_NETLINK && cmsg->cmsg_type == NETLINK_LISTEN_ALL_NSID &&
+                cmsg->cmsg_len >= CMSG_LEN(sizeof(int32_t))) {
+            int32_t nsid;
+            memcpy(&nsid, CMSG_DATA(cmsg), sizeof(nsid));
+            return nsid;
+        }
+    }
+    return kNoNsid;
+}
+
+#endif // NETLINK_NETNS_H
@@ -0,0 +1,165 @@
+#ifndef NETLINK_REQUESTS_H
+#define NETLINK_REQUESTS_H
+
+#include <linux/netlink.h>
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Requests waiting for replies, matched by sequence number. Sequence
+ * numbers are assigned from the upper half of the space, so they never
+ * collide with the ones generated in JS. Replies are accumulated until
+ * the final DONE or ERROR (i.e. the ACK) arrives.
+ *
+ * Timeouts are kept in a min-heap. When a request finishes early its
+ * entry is left in the heap, and skipped once it reaches the top.
+ *
+ * `T` is whatever the caller needs to complete a request (its callback).
+ */
+template <class T> class RequestTable {
+  public:
+    static const uint32_t kSeqBase = 0x80000000;
+    /** Finish reasons other than replies (positive values are send errors) */
+    static const int kReplied = 0;
+    static const int kTimedOut = -1;
+    static const int kCancelled = -2;
+
+    struct Finished {
+        uint32_t seq;
+        T payload;
+        /** Replies (if kReplied), including the final DONE or ERROR message */
+        std::vector<char> data;
+        int reason;
+    };
+
+    bool empty() const { return pending.empty(); }
+    size_t size() const { return pending.size(); }
+
+    /** Registers a request and returns its sequence number. `deadline` is in ns (0 = none) */
+    uint32_t Add(T payload, uint64_t deadline) {
+        uint32_t seq;
+        do {
+            seq = next_seq;
+            next_seq = (next_seq == UINT32_MAX) ? kSeqBase : next_seq + 1;
+        } while (pending.count(seq));
+        uint64_t id = ++last_id;
+        pending.emplace(seq, Pending { id, std::move(payload), {} });
+        if (deadline)
+            timeouts.push({ deadline, id, seq });
+        return seq;
+    }
+
+    /**
+     * Claims the messages of a datagram that reply to a pending request
+     * (i.e. addressed to `port`, with a pending sequence number), moving
+     * finished requests into `finished`. Returns false if nothing was
+     * claimed; otherwise `rest` is set to the other messages (which may be
+     * none). Anything after a framing error is left in `rest` as is.
+     */
+    bool Claim(const char* data, size_t length, uint32_t port, std::vector<char>& rest, std::deque<Finished>& finished) {
+        if (pending.empty()) return false;
+        bool claimed = false;
+        size_t offset = 0;
+        while (offset < length) {
+            struct nlmsghdr hdr;
+            if (length - offset < sizeof(hdr)) break;
+            memcpy(&hdr, data + offset, sizeof(hdr));
+            if (hdr.nlmsg_len < sizeof(hdr) || hdr.nlmsg_len > length - offset) break;
+            size_t size = std::min((size_t)NLMSG_ALIGN(hdr.nlmsg_len), length - offset);
+
+            auto it = (hdr.nlmsg_pid == port && !(hdr.nlmsg_flags & NLM_F_REQUEST)) ?
+                pending.find(hdr.nlmsg_seq) : pending.end();
+            if (it != pending.end()) {
+                if (!claimed)
+                    rest.assign(data, data + offset);
+                claimed = true;
+                Append(it->second.data, data + offset, size);
+                if (hdr.nlmsg_type == NLMSG_DONE || hdr.nlmsg_type == NLMSG_ERROR)
+                    Finish(it, kReplied, finished);
+            } else if (claimed) {
+                Append(rest, data + offset, size);
+            }
+            offset += size;
+        }
+        if (claimed && offset < length)
+            rest.insert(rest.end(), data + offset, data + length);
+        return claimed;
+    }
+
+    /** Moves requests whose deadline is not after `now` (in ns) into `finished` */
+    void Expire(uint64_t now, std::deque<Finished>& finished) {
+        while (!timeouts.empty() && timeouts.top().deadline <= now) {
+            auto entry = timeouts.top();
+            timeouts.pop();
+            auto it = pending.find(entry.seq);
+            if (it != pending.end() && it->second.id == entry.id)
+                Finish(it, kTimedOut, finished);
+        }
+    }
+
+    /** Earliest deadline of a pending request, or 0 if none */
+    uint64_t NextDeadline() {
+        while (!timeouts.empty()) {
+            auto it = pending.find(timeouts.top().seq);
+            if (it != pending.end() && it->second.id == timeouts.top().id)
+                return timeouts.top().deadline;
+            timeouts.pop();
+        }
+        return 0;
+    }
+
+    /** Finishes a request with `reason`; returns false if it isn't pending */
+    bool Take(uint32_t seq, int reason, std::deque<Finished>& finished) {
+        auto it = pending.find(seq);
+        if (it == pending.end()) return false;
+        Finish(it, reason, finished);
+        return true;
+    }
+
+    /** Finishes all requests with `reason` */
+    void TakeAll(int reason, std::deque<Finished>& finished) {
+        while (!pending.empty())
+            Finish(pending.begin(), reason, finished);
+        Heap().swap(timeouts);
+    }
+
+  private:
+    struct Pending {
+        uint64_t id;
+        T payload;
+        std::vector<char> data;
+    };
+    struct Timeout {
+        uint64_t deadline;
+        uint64_t id;
+        uint32_t seq;
+        bool operator>(const Timeout& other) const { return deadline > other.deadline; }
+    };
+    typedef std::priority_queue<Timeout, std::vector<Timeout>, std::greater<Timeout>> Heap;
+
+    // Messages are kept aligned, like in a datagram (the last message
+    // of a datagram may lack its padding)
+    static void Append(std::vector<char>& out, const char* data, size_t size) {
+        out.resize(NLMSG_ALIGN(out.size()));
+        out.insert(out.end(), data, data + size);
+    }
+
+    void Finish(typename std::unordered_map<uint32_t, Pending>::iterator it, int reason, std::deque<Finished>& finished) {
+        finished.push_back({ it->first, std::move(it->second.payload),
+            reason == kReplied ? std::move(it->second.data) : std::vector<char>(), reason });
+        pending.erase(it);
+    }
+
+    std::unordered_map<uint32_t, Pending> pending;
+    Heap timeouts;
+    uint32_t next_seq = kSeqBase;
+    uint64_t last_id = 0;
+};
+
+#endif // NETLINK_REQUESTS_H
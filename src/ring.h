@@ -0,0 +1,118 @@
+#ifndef NETLINK_RING_H
+#define NETLINK_RING_H
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <assert.h>
+
+/** What to do when a datagram arrives and the ring is full */
+enum class OverflowPolicy {
+    /** Discard the oldest queued datagram to make room */
+    DropOldest,
+    /** Stop reading from the socket until there's room (the kernel will drop instead) */
+    Block,
+    /** Discard the new datagram and report an overflow to the consumer */
+    Flag,
+};
+
+/**
+ * Bounded ring of owned items, with a single producer (the receive thread)
+ * and a single consumer (the JS thread). Both sides claim the tail with a
+ * CAS, so that the producer can discard the oldest item when full; items
+ * are only dereferenced by whoever wins the claim.
+ */
+template <class T> class Ring {
+  public:
+    Ring(size_t capacity): mask(RoundUp(capacity) - 1), slots(mask + 1) {
+        for (auto& slot : slots) slot.store(nullptr, std::memory_order_relaxed);
+    }
+    ~Ring() {
+        while (auto item = Pop()) {}
+    }
+    Ring(const Ring&) = delete;
+    Ring& operator=(const Ring&) = delete;
+
+    /**
+     * Producer only. Returns false if the item couldn't be queued (only
+     * possible with the Flag policy, or with Block if `closing` is set
+     * while waiting).
+     */
+    bool Push(std::unique_ptr<T> item, OverflowPolicy policy, const std::atomic<bool>& closing) {
+        size_t h = head.load(std::memory_order_relaxed);
+        while (h - tail.load(std::memory_order_acquire) > mask) {
+            if (policy == OverflowPolicy::Flag) {
+                return false;
+            } else if (policy == OverflowPolicy::DropOldest) {
+                size_t t = tail.load(std::memory_order_acquire);
+                T* old = slots[t & mask].load(std::memory_order_acquire);
+                if (h - t > mask && tail.compare_exchange_strong(t, t + 1, std::memory_order_acq_rel)) {
+                    delete old;
+                    dropped.fetch_add(1, std::memory_order_relaxed);
+                }
+            } else {
+                // announce ourselves before checking tail (both seq_cst), so
+                // that either we see the consumer's pop or it sees us waiting
+                std::unique_lock<std::mutex> lock (space_mutex);
+                waiting.store(true);
+                space_cv.wait(lock, [&] {
+                    return closing.load() || h - tail.load() <= mask;
+                });
+                waiting.store(false, std::memory_order_relaxed);
+                if (closing.load()) return false;
+            }
+        }
+        slots[h & mask].store(item.release(), std::memory_order_release);
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** Consumer only. Returns null if the ring is empty. */
+    std::unique_ptr<T> Pop() {
+        size_t t = tail.load(std::memory_order_acquire);
+        while (t != head.load(std::memory_order_acquire)) {
+            T* item = slots[t & mask].load(std::memory_order_acquire);
+            if (tail.compare_exchange_weak(t, t + 1, std::memory_order_seq_cst, std::memory_order_acquire)) {
+                // only take the lock if the producer is blocked (Block policy)
+                if (waiting.load()) {
+                    std::lock_guard<std::mutex> lock (space_mutex);
+                    space_cv.notify_one();
+                }
+                return std::unique_ptr<T>(item);
+            }
+            // lost against the producer dropping the oldest item, retry with new tail
+        }
+        return nullptr;
+    }
+
+    /** Wake up a producer blocked in Push() (call after setting `closing`) */
+    void Wake() {
+        std::lock_guard<std::mutex> lock (space_mutex);
+        space_cv.notify_all();
+    }
+
+    /** Number of items the ring can hold */
+    size_t Capacity() const { return mask + 1; }
+
+    /** Number of items discarded by the DropOldest policy */
+    std::atomic<uint64_t> dropped {0};
+
+  private:
+    static size_t RoundUp(size_t x) {
+        size_t r = 1;
+        while (r < x) r <<= 1;
+        return r;
+    }
+    const size_t mask;
+    std::vector<std::atomic<T*>> slots;
+    std::atomic<size_t> head {0};
+    std::atomic<size_t> tail {0};
+    /** Set while the producer waits for space in Push() */
+    std::atomic<bool> waiting {false};
+    std::mutex space_mutex;
+    std::condition_variable space_cv;
+};
+
+#endif // NETLINK_RING_H
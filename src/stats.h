@@ -0,0 +1,86 @@
+#ifndef NETLINK_STATS_H
+#define NETLINK_STATS_H
+
+#include <atomic>
+#include <stdint.h>
+
+typedef std::atomic<uint64_t> Counter;
+
+inline void Inc(Counter& counter, uint64_t n = 1) {
+    counter.fetch_add(n, std::memory_order_relaxed);
+}
+
+inline void Max(Counter& counter, uint64_t value) {
+    uint64_t current = counter.load(std::memory_order_relaxed);
+    while (current < value && !counter.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+}
+
+/**
+ * Histogram of durations with power-of-two buckets: bucket 0 counts
+ * durations below 1µs, bucket N counts durations in [2^(N-1), 2^N) µs,
+ * and the last bucket also counts anything longer.
+ */
+class LatencyHistogram {
+  public:
+    static const int kBuckets = 24;
+
+    void Record(uint64_t ns) {
+        uint64_t us = ns / 1000;
+        int bucket = 0;
+        while (us && bucket < kBuckets - 1) {
+            us >>= 1;
+            bucket++;
+        }
+        Inc(buckets[bucket]);
+        Inc(count);
+        Inc(total_ns, ns);
+        Max(max_ns, ns);
+    }
+
+    Counter buckets [kBuckets] {};
+    Counter count {0};
+    Counter total_ns {0};
+    Counter max_ns {0};
+};
+
+/**
+ * Per-socket counters. These are updated with relaxed atomics, since
+ * receive counters may be updated by the receive thread.
+ */
+struct SocketStats {
+    /** recvmsg() / recvmmsg() calls, including failed ones */
+    Counter recv_calls {0};
+    Counter recv_datagrams {0};
+    Counter recv_bytes {0};
+    Counter recv_eagain {0};
+    Counter recv_enobufs {0};
+    /** Other receive errors */
+    Counter recv_errors {0};
+    Counter truncated {0};
+    /** Times a read handler stopped because of kReadLimit, with data possibly left */
+    Counter read_limit_hits {0};
+    /** Datagrams discarded because the receive ring was full */
+    Counter ring_overflows {0};
+
+    /** sendmsg() calls, including failed ones */
+    Counter send_calls {0};
+    Counter send_datagrams {0};
+    Counter send_bytes {0};
+    Counter send_eagain {0};
+    Counter send_enobufs {0};
+    /** Other send errors */
+    Counter send_errors {0};
+    Counter write_queue_max {0};
+    Counter completed_queue_max {0};
+
+    /** Native requests sent (see Socket::Request), and those that timed out */
+    Counter requests {0};
+    Counter request_timeouts {0};
+
+    /** Duration of read_callback calls */
+    LatencyHistogram read_callback;
+    /** Duration of send completion callbacks */
+    LatencyHistogram send_callback;
+};
+
+#endif // NETLINK_STATS_H